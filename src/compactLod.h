@@ -0,0 +1,28 @@
+#ifndef COMPACT_LOD_HEADER_GUARD
+#define COMPACT_LOD_HEADER_GUARD
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+/** Quantised 16-bit codes for lod values
+ *
+ * Lod values are non-negative, and only a few significant figures are ever used. So they are stored as round(scale * log1p(lod)), which has roughly constant relative error. The code 0xFFFF represents NA, and values too large to be represented are stored as the largest code.
+ * The default scale allows lod values up to 1e5, with a relative error in 1 + lod of less than 1e-4.
+ */
+typedef uint16_t lodCode;
+const lodCode naLodCode = 0xFFFF;
+const lodCode maxLodCode = 0xFFFE;
+const double defaultLodScale = 5692.0;
+inline lodCode encodeLod(double lod, double scale)
+{
+	if(lod != lod) return naLodCode;
+	if(lod <= 0) return 0;
+	double scaled = scale * std::log1p(lod) + 0.5;
+	if(scaled >= maxLodCode) return maxLodCode;
+	return (lodCode)scaled;
+}
+inline double decodeLod(lodCode code, double scale)
+{
+	if(code == naLodCode) return std::numeric_limits<double>::quiet_NaN();
+	return std::expm1(code / scale);
+}
+#endif
@@ -0,0 +1,106 @@
+#include "compactMarkerPairData.h"
+#include <cstring>
+#include <thread>
+#include <algorithm>
+#include <new>
+bool compactMarkerPairData::isValid(const unsigned char* data, std::size_t size, int nFirstAlleles, int nSecondAlleles, int nDifferentFunnels, int nDifferentAIGenerations, int nDifferentSelfingGenerations, int nRecombLevels)
+{
+	if(size < sizeof(header) || size % sizeof(double) != 0) return false;
+	header entryHeader;
+	memcpy(&entryHeader, data, sizeof(header));
+	if(entryHeader.size != size || entryHeader.nFirstAlleles != nFirstAlleles || entryHeader.nSecondAlleles != nSecondAlleles || entryHeader.nDifferentFunnels != nDifferentFunnels || entryHeader.nDifferentAIGenerations != nDifferentAIGenerations || entryHeader.nDifferentSelfingGenerations != nDifferentSelfingGenerations || entryHeader.nRecombLevels != nRecombLevels) return false;
+	int nCombinations = nDifferentSelfingGenerations * (nDifferentFunnels + nDifferentAIGenerations);
+	if(size < valuesOffset(nCombinations)) return false;
+	std::size_t nValues = (size - valuesOffset(nCombinations)) / sizeof(double);
+	std::size_t valuesPerCombination = (std::size_t)nFirstAlleles * nSecondAlleles * nRecombLevels;
+	for(int i = 0; i < nCombinations; i++)
+	{
+		int64_t offset;
+		memcpy(&offset, data + sizeof(header) + i * sizeof(int64_t), sizeof(int64_t));
+		if(offset >= 0 && (std::size_t)offset + valuesPerCombination > nValues) return false;
+	}
+	return true;
+}
+allMarkerPairData::allMarkerPairData(int nMarkerPatternIDs)
+	: nEntries((std::size_t)((nMarkerPatternIDs * nMarkerPatternIDs - nMarkerPatternIDs)/2 + nMarkerPatternIDs)), entries(new const unsigned char*[nEntries]), states(new std::atomic<char>[nEntries]), blockUsed(0), blockCapacity(0), allocatedBytes(0)
+{
+	for(std::size_t i = 0; i < nEntries; i++)
+	{
+		entries[i] = NULL;
+		states[i].store(notComputed, std::memory_order_relaxed);
+	}
+}
+const unsigned char* allMarkerPairData::store(const std::vector<unsigned char>& entry)
+{
+	std::size_t words = (entry.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+	unsigned char* destination = NULL;
+	//An exception can't leave a critical section, so a failed allocation is thrown afterwards
+	bool allocationFailed = false;
+#ifdef USE_OPENMP
+	#pragma omp critical (allMarkerPairDataStore)
+#endif
+	{
+		try
+		{
+			if(blockUsed + words > blockCapacity)
+			{
+				std::size_t capacity = std::max(words, blockSize / sizeof(uint64_t));
+				blocks.emplace_back(new uint64_t[capacity]);
+				blockCapacity = capacity;
+				blockUsed = 0;
+			}
+			destination = (unsigned char*)(blocks.back().get() + blockUsed);
+			blockUsed += words;
+			allocatedBytes += words * sizeof(uint64_t);
+		}
+		catch(...)
+		{
+			allocationFailed = true;
+		}
+	}
+	if(allocationFailed) throw std::bad_alloc();
+	if(entry.size() > 0) memcpy(destination, &(entry[0]), entry.size());
+	return destination;
+}
+compactMarkerPairData allMarkerPairData::operator()(int markerPattern1ID, int markerPattern2ID)
+{
+	if(markerPattern1ID < markerPattern2ID) std::swap(markerPattern1ID, markerPattern2ID);
+	//Ensure that nMarkerPattern1ID > nMarkerPattern2ID
+	std::size_t index = (std::size_t)markerPattern1ID * (markerPattern1ID + 1) / 2;
+	index += markerPattern2ID;
+	std::atomic<char>& state = states[index];
+	if(state.load(std::memory_order_acquire) == computed) return compactMarkerPairData(entries[index]);
+	char expected = notComputed;
+	if(state.compare_exchange_strong(expected, computing, std::memory_order_acq_rel))
+	{
+		try
+		{
+			std::vector<unsigned char> result;
+			compute(markerPattern2ID, markerPattern1ID, result);
+			entries[index] = store(result);
+		}
+		catch(...)
+		{
+#ifdef USE_OPENMP
+			#pragma omp critical (allMarkerPairDataFailure)
+#endif
+			if(!failure) failure = std::current_exception();
+			state.store(failed, std::memory_order_release);
+			throw computeFailed();
+		}
+		state.store(computed, std::memory_order_release);
+	}
+	else
+	{
+		char current;
+		while((current = state.load(std::memory_order_acquire)) == computing) std::this_thread::yield();
+		if(current == failed) throw computeFailed();
+	}
+	return compactMarkerPairData(entries[index]);
+}
+std::size_t allMarkerPairData::countComputed() const
+{
+	std::size_t result = 0;
+	for(std::size_t i = 0; i < nEntries; i++) result += states[i].load(std::memory_order_acquire) == computed;
+	return result;
+}
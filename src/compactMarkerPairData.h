@@ -0,0 +1,135 @@
+#ifndef COMPACT_MARKER_PAIR_DATA_HEADER_GUARD
+#define COMPACT_MARKER_PAIR_DATA_HEADER_GUARD
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <stdint.h>
+/** The lookup table entry for a pair of marker patterns, stored compactly
+ *
+ * Only the values for the observed alleles of the two marker patterns are stored, and only for the combinations of funnel (or generations of intercrossing) and generations of selfing which are allowable. The entry is a single block of memory, consisting of a header, one offset per combination, and then the values. The offset for a combination which is not allowable is -1.
+ * The values for a combination are ordered by first marker allele, then second marker allele, then recombination level. So the values for every recombination level for a fixed pair of alleles are contiguous.
+ * Combinations are numbered selfing * (nDifferentFunnels + nDifferentAIGenerations) + funnel for the funnels, and selfing * (nDifferentFunnels + nDifferentAIGenerations) + nDifferentFunnels + aiGenerations - 1 for the generations of intercrossing.
+ */
+class compactMarkerPairData
+{
+public:
+	struct header
+	{
+		//Total size of the entry in bytes
+		uint64_t size;
+		int32_t nFirstAlleles, nSecondAlleles, nDifferentFunnels, nDifferentAIGenerations, nDifferentSelfingGenerations, nRecombLevels;
+	};
+	compactMarkerPairData(const unsigned char* data)
+		: data(data)
+	{}
+	const header& getHeader() const
+	{
+		return *(const header*)data;
+	}
+	const unsigned char* getData() const
+	{
+		return data;
+	}
+	std::size_t size() const
+	{
+		return (std::size_t)getHeader().size;
+	}
+	int nFirstAlleles() const
+	{
+		return getHeader().nFirstAlleles;
+	}
+	int nSecondAlleles() const
+	{
+		return getHeader().nSecondAlleles;
+	}
+	//The values for a funnel, or NULL if the funnel is not allowable.
+	const double* funnelValues(int funnel, int selfing) const
+	{
+		const header& entryHeader = getHeader();
+		return values(selfing * (entryHeader.nDifferentFunnels + entryHeader.nDifferentAIGenerations) + funnel);
+	}
+	//The values for a number of generations of intercrossing (minus one), or NULL if it is not allowable.
+	const double* aiValues(int aiGenerationsMinusOne, int selfing) const
+	{
+		const header& entryHeader = getHeader();
+		return values(selfing * (entryHeader.nDifferentFunnels + entryHeader.nDifferentAIGenerations) + entryHeader.nDifferentFunnels + aiGenerationsMinusOne);
+	}
+	//The offset in bytes of the first value, for an entry with nCombinations combinations
+	static std::size_t valuesOffset(int nCombinations)
+	{
+		return sizeof(header) + nCombinations * sizeof(int64_t);
+	}
+	//Check that a block of memory (for example from the on-disk cache) is an entry with the given dimensions.
+	static bool isValid(const unsigned char* data, std::size_t size, int nFirstAlleles, int nSecondAlleles, int nDifferentFunnels, int nDifferentAIGenerations, int nDifferentSelfingGenerations, int nRecombLevels);
+private:
+	const double* values(int combination) const
+	{
+		int64_t offset = ((const int64_t*)(data + sizeof(header)))[combination];
+		if(offset < 0) return NULL;
+		const header& entryHeader = getHeader();
+		return (const double*)(data + valuesOffset(entryHeader.nDifferentSelfingGenerations * (entryHeader.nDifferentFunnels + entryHeader.nDifferentAIGenerations))) + offset;
+	}
+	const unsigned char* data;
+};
+/** The lookup table for every pair of marker patterns
+ *
+ * Entries are computed the first time they're requested, by the function passed to setCompute, so the cost depends only on the pairs of marker patterns that actually occur in the markers being estimated. Entries can be requested concurrently from different threads. Each entry is computed by exactly one thread, and any other thread requesting the same entry waits for it to finish.
+ * Entries are requested from inside OpenMP parallel regions, which exceptions can't leave. If computing an entry throws, the exception is recorded and the entry is marked as failed, so that threads waiting for it stop. Every request for a failed entry, including the one which failed, then throws computeFailed, which the caller should catch inside the parallel region and follow with a call to rethrowFailure after it.
+ * The entries are copied into large blocks of memory as they're computed, rather than being allocated separately.
+ */
+class allMarkerPairData
+{
+public:
+	//Compute the entry for the given marker patterns, in the format of compactMarkerPairData. The first pattern is always less than or equal to the second.
+	typedef std::function<void(int, int, std::vector<unsigned char>&)> computeFunction;
+	allMarkerPairData(int nMarkerPatternIDs);
+	void setCompute(computeFunction compute)
+	{
+		this->compute = compute;
+	}
+	const computeFunction& getCompute() const
+	{
+		return compute;
+	}
+	//Thrown by operator() when the requested entry could not be computed. The original exception is rethrown by rethrowFailure.
+	class computeFailed : public std::runtime_error
+	{
+	public:
+		computeFailed()
+			: std::runtime_error("Lookup table entry could not be computed")
+		{}
+	};
+	compactMarkerPairData operator()(int markerPattern1ID, int markerPattern2ID);
+	//Rethrow the first exception thrown while computing an entry, if there was one. This must not be called from a parallel region.
+	void rethrowFailure() const
+	{
+		if(failure) std::rethrow_exception(failure);
+	}
+	//The number of entries which have been computed so far
+	std::size_t countComputed() const;
+	//The number of bytes used by the entries computed so far
+	std::size_t getAllocatedBytes() const
+	{
+		return allocatedBytes;
+	}
+private:
+	allMarkerPairData(const allMarkerPairData&);
+	allMarkerPairData& operator=(const allMarkerPairData&);
+	//Copy an entry into the current block. Entries are aligned to 8 bytes.
+	const unsigned char* store(const std::vector<unsigned char>& entry);
+	static const char notComputed = 0, computing = 1, computed = 2, failed = 3;
+	static const std::size_t blockSize = 1 << 20;
+	std::size_t nEntries;
+	std::unique_ptr<const unsigned char*[]> entries;
+	std::unique_ptr<std::atomic<char>[]> states;
+	std::vector<std::unique_ptr<uint64_t[]> > blocks;
+	std::size_t blockUsed, blockCapacity, allocatedBytes;
+	computeFunction compute;
+	//The first exception thrown while computing an entry
+	std::exception_ptr failure;
+};
+#endif
@@ -1,5 +1,11 @@
 #include "compressedProbabilities_RInterface.h"
 #include "probabilities.hpp"
+#include "probabilities2.h"
+#include "probabilities4.h"
+#include "probabilities8.h"
+#include "probabilities16.h"
+#include "genericFunnelProbabilities.h"
+#include <memory>
 template<int nFounders, bool infiniteSelfing> Rcpp::NumericVector getCompressedProbabilities2(double r, int nFunnels, int intercrossingGenerations, int selfingGenerations)
 {
 	std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs> result;
@@ -48,9 +54,78 @@ BEGIN_RCPP
 	{
 		return getCompressedProbabilities1<16>(r, nFunnels, intercrossingGenerations, selfingGenerations, infiniteSelfing);
 	}
+	else if(nFounders >= 2 && nFounders <= 64)
+	{
+		//Other numbers of founders use the numerical probabilities for a single funnel, which are only available without intercrossing
+		if(intercrossingGenerations > 0) throw std::runtime_error("Intercrossing is only supported for 2, 4, 8 or 16 founders");
+		genericFunnelProbabilities probabilities(nFounders);
+		Rcpp::NumericVector retVal(probabilities.getNDifferentProbs(infiniteSelfing));
+		if(infiniteSelfing) probabilities.compressedInfiniteSelfing(r, &(retVal(0)));
+		else probabilities.compressedFiniteSelfing(r, selfingGenerations, &(retVal(0)));
+		return retVal;
+	}
 	else 
 	{
-		throw std::runtime_error("Input nFounders must be one of 2, 4, 8 or 16");
+		throw std::runtime_error("Input nFounders must be between 2 and 64");
+	}
+END_RCPP
+}
+//The closed forms for a single funnel, expanded to every state with the masks of probabilityData. Indexed the same way as the result of genericFunnelProbabilities_RInterface.
+template<int nFounders> Rcpp::NumericVector getExpandedProbabilities(double r, int selfingGenerations, bool infiniteSelfing)
+{
+	const int n = nFounders;
+	if(infiniteSelfing)
+	{
+		array2<nFounders> values;
+		expandedGenotypeProbabilities<nFounders, true, false>::noIntercross(values, r, selfingGenerations, 1);
+		Rcpp::NumericVector result(n * n);
+		for(int a = 0; a < n; a++)
+		{
+			for(int b = 0; b < n; b++) result(a + n * b) = values.values[a][b];
+		}
+		result.attr("dim") = Rcpp::IntegerVector::create(n, n);
+		return result;
+	}
+	std::unique_ptr<expandedProbabilitiesFiniteSelfing<nFounders> > values(new expandedProbabilitiesFiniteSelfing<nFounders>());
+	expandedGenotypeProbabilities<nFounders, false, false>::noIntercross(*values, r, selfingGenerations, 1);
+	Rcpp::NumericVector result(n * n * n * n);
+	for(int a1 = 0; a1 < n; a1++)
+	{
+		for(int a2 = 0; a2 < n; a2++)
+		{
+			for(int b1 = 0; b1 < n; b1++)
+			{
+				for(int b2 = 0; b2 < n; b2++) result(a1 + n * (a2 + n * (b1 + n * b2))) = values->values[a1][a2][b1][b2];
+			}
+		}
+	}
+	result.attr("dim") = Rcpp::IntegerVector::create(n, n, n, n);
+	return result;
+}
+SEXP expandedProbabilities_RInterface(SEXP nFounders_sexp, SEXP r_sexp, SEXP selfingGenerations_sexp, SEXP infiniteSelfing_sexp)
+{
+BEGIN_RCPP
+	int nFounders = Rcpp::as<int>(nFounders_sexp);
+	double r = Rcpp::as<double>(r_sexp);
+	int selfingGenerations = Rcpp::as<int>(selfingGenerations_sexp);
+	bool infiniteSelfing = Rcpp::as<bool>(infiniteSelfing_sexp);
+	if(!(r >= 0 && r <= 0.5)) throw std::runtime_error("Input r must be between 0 and 0.5");
+	if(nFounders == 2)
+	{
+		return getExpandedProbabilities<2>(r, selfingGenerations, infiniteSelfing);
+	}
+	else if(nFounders == 4)
+	{
+		return getExpandedProbabilities<4>(r, selfingGenerations, infiniteSelfing);
+	}
+	else if(nFounders == 8)
+	{
+		return getExpandedProbabilities<8>(r, selfingGenerations, infiniteSelfing);
+	}
+	else if(nFounders == 16)
+	{
+		return getExpandedProbabilities<16>(r, selfingGenerations, infiniteSelfing);
 	}
+	throw std::runtime_error("The closed forms are only available for 2, 4, 8 or 16 founders");
 END_RCPP
 }
@@ -2,4 +2,5 @@
 #define COMPRESSED_PROBABILITIES_HEADER_GUARD_R_INTERFACE
 #include <Rcpp.h>
 SEXP compressedProbabilities_RInterface(SEXP nFounders, SEXP r, SEXP nFunnels, SEXP intercrossingGenerations, SEXP selfingGenerations, SEXP infiniteSelfing);
+SEXP expandedProbabilities_RInterface(SEXP nFounders, SEXP r, SEXP selfingGenerations, SEXP infiniteSelfing);
 #endif
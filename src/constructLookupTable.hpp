@@ -4,6 +4,12 @@
 #include "probabilities.hpp"
 #include "intercrossingHaplotypeToMarker.hpp"
 #include "funnelHaplotypeToMarker.hpp"
+#include "compactMarkerPairData.h"
+#include "genericFunnelProbabilities.h"
+#include <functional>
+#include <memory>
+#include <cstring>
+//The working form of a lookup table entry, where every value is padded to maxAlleles x maxAlleles. Entries are stored as compactMarkerPairData.
 template<int maxAlleles> struct singleMarkerPairData
 {
 public:
@@ -23,29 +29,74 @@ public:
 	rowMajorMatrix<bool> allowableFunnel;
 	rowMajorMatrix<bool> allowableAI;
 };
-template<int maxAlleles> class allMarkerPairData : protected std::vector<singleMarkerPairData<maxAlleles> >
+//Copy the values for the observed alleles and allowable combinations out of the working form of an entry, into the format of compactMarkerPairData.
+template<int maxAlleles> void compactMarkerPairDataFromDense(singleMarkerPairData<maxAlleles>& dense, int nFirstAlleles, int nSecondAlleles, int nRecombLevels, int nDifferentFunnels, int nDifferentAIGenerations, int nDifferentSelfingGenerations, std::vector<unsigned char>& output)
 {
-public:
-	typedef typename std::vector<singleMarkerPairData<maxAlleles> > parent;
-	allMarkerPairData(int nMarkerPatternIDs)
-		: parent((std::size_t)((nMarkerPatternIDs * nMarkerPatternIDs - nMarkerPatternIDs)/2 + nMarkerPatternIDs), singleMarkerPairData<maxAlleles> (0, 0, 0, 0))
-	{}
-	singleMarkerPairData<maxAlleles>& operator()(int markerPattern1ID, int markerPattern2ID)
+	int nCombinationsPerSelfing = nDifferentFunnels + nDifferentAIGenerations;
+	int nCombinations = nDifferentSelfingGenerations * nCombinationsPerSelfing;
+	std::size_t valuesPerCombination = (std::size_t)nFirstAlleles * nSecondAlleles * nRecombLevels;
+	std::vector<int64_t> offsets(nCombinations, -1);
+	int64_t nValues = 0;
+	for(int selfingCounter = 0; selfingCounter < nDifferentSelfingGenerations; selfingCounter++)
 	{
-		if(markerPattern1ID < markerPattern2ID) std::swap(markerPattern1ID, markerPattern2ID);
-		//Ensure that nMarkerPattern1ID > nMarkerPattern2ID
-		int index = markerPattern1ID * (markerPattern1ID + 1) / 2;
-		index += markerPattern2ID;
-		return parent::operator[](index);
+		for(int funnelCounter = 0; funnelCounter < nDifferentFunnels; funnelCounter++)
+		{
+			if(dense.allowableFunnel(funnelCounter, selfingCounter))
+			{
+				offsets[selfingCounter * nCombinationsPerSelfing + funnelCounter] = nValues;
+				nValues += valuesPerCombination;
+			}
+		}
+		for(int aiCounter = 0; aiCounter < nDifferentAIGenerations; aiCounter++)
+		{
+			if(dense.allowableAI(aiCounter, selfingCounter))
+			{
+				offsets[selfingCounter * nCombinationsPerSelfing + nDifferentFunnels + aiCounter] = nValues;
+				nValues += valuesPerCombination;
+			}
+		}
 	}
-};
+	std::size_t valuesOffset = compactMarkerPairData::valuesOffset(nCombinations);
+	output.assign(valuesOffset + nValues * sizeof(double), 0);
+	compactMarkerPairData::header header;
+	header.size = output.size();
+	header.nFirstAlleles = nFirstAlleles;
+	header.nSecondAlleles = nSecondAlleles;
+	header.nDifferentFunnels = nDifferentFunnels;
+	header.nDifferentAIGenerations = nDifferentAIGenerations;
+	header.nDifferentSelfingGenerations = nDifferentSelfingGenerations;
+	header.nRecombLevels = nRecombLevels;
+	memcpy(&(output[0]), &header, sizeof(header));
+	if(nCombinations > 0) memcpy(&(output[sizeof(header)]), &(offsets[0]), nCombinations * sizeof(int64_t));
+	double* values = (double*)&(output[valuesOffset]);
+	for(int selfingCounter = 0; selfingCounter < nDifferentSelfingGenerations; selfingCounter++)
+	{
+		for(int combination = 0; combination < nCombinationsPerSelfing; combination++)
+		{
+			int64_t offset = offsets[selfingCounter * nCombinationsPerSelfing + combination];
+			if(offset < 0) continue;
+			const array2<maxAlleles>* source = combination < nDifferentFunnels ? &(dense.perFunnelData(0, combination, selfingCounter)) : &(dense.perAIGenerationData(0, combination - nDifferentFunnels, selfingCounter));
+			double* destination = values + offset;
+			for(int firstAllele = 0; firstAllele < nFirstAlleles; firstAllele++)
+			{
+				for(int secondAllele = 0; secondAllele < nSecondAlleles; secondAllele++)
+				{
+					for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+					{
+						*(destination++) = source[recombCounter].values[firstAllele][secondAllele];
+					}
+				}
+			}
+		}
+	}
+}
 template<int maxAlleles, int nFounders> struct constructLookupTableArgs
 {
 public:
-	constructLookupTableArgs(allMarkerPairData<maxAlleles>& computedContributions, markerPatternsToUniqueValuesArgs& markerPatternData)
+	constructLookupTableArgs(allMarkerPairData& computedContributions, markerPatternsToUniqueValuesArgs& markerPatternData)
 		: computedContributions(computedContributions), markerPatternData(markerPatternData)
 	{}
-	allMarkerPairData<maxAlleles>& computedContributions;
+	allMarkerPairData& computedContributions;
 	markerPatternsToUniqueValuesArgs& markerPatternData;
 	std::vector<funnelEncoding>* lineFunnelEncodings;
 	std::vector<funnelEncoding>* allFunnelEncodings;
@@ -53,6 +104,8 @@ public:
 	const std::vector<double>* recombinationFractions;
 	std::vector<int>* intercrossingGenerations;
 	std::vector<int>* selfingGenerations;
+	//The shape of every funnel, which is only used when nFounders is 0 (see lookupTableBuilder)
+	const std::vector<int>* funnelShape;
 };
 template<int maxAlleles> bool isValid(std::vector<array2<maxAlleles> >& markerProbabilities, int nPoints, int nFirstMarkerAlleles, int nSecondMarkerAlleles, std::vector<double>& recombLevels)
 {
@@ -80,108 +133,230 @@ template<int maxAlleles> bool isValid(std::vector<array2<maxAlleles> >& markerPr
 	}
 	return true;
 }
-template<int nFounders, int maxAlleles, bool infiniteSelfing> void constructLookupTable(constructLookupTableArgs<maxAlleles, nFounders>& args)
+//The haplotype probabilities shared by every entry of the lookup table, which are computed up front. The entries for individual pairs of marker patterns are computed from these on request. 
+template<int nFounders, int maxAlleles, bool infiniteSelfing> class lookupTableBuilder
 {
-	int nMarkerPatternIDs = (int)args.markerPatternData.allMarkerPatterns.size();
-	int nRecombLevels = (int)args.recombinationFractions->size();
-	int nDifferentFunnels = (int)args.lineFunnelEncodings->size();
-	int maxAIGenerations = *std::max_element(args.intercrossingGenerations->begin(), args.intercrossingGenerations->end());
-
-	int maxSelfing = *std::max_element(args.selfingGenerations->begin(), args.selfingGenerations->end());
-	int minSelfing = *std::min_element(args.selfingGenerations->begin(), args.selfingGenerations->end());
-
-	//Only compute the compressed haplotype probabilities once. This is for the no intercrossing case
-	typedef std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs> compressedProbabilitiesType;
-	rowMajorMatrix<compressedProbabilitiesType> funnelHaplotypeProbabilities(nRecombLevels, maxSelfing-minSelfing+1);
+public:
+	static const int nDifferentProbs = compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs;
+	typedef std::array<double, nDifferentProbs> compressedProbabilitiesType;
 	//In order to determine if a marker combination is informative, we use a much finer numerical grid.
-	const int nFinerPoints = 101;
-	std::vector<double> finerRecombLevels(nFinerPoints);
-	for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
-	{
-		finerRecombLevels[recombCounter] = 0.5 * ((double)recombCounter) / ((double)nFinerPoints - 1.0);
-	}
-
-	rowMajorMatrix<compressedProbabilitiesType> finerFunnelHaplotypeProbabilities(nFinerPoints, maxSelfing-minSelfing+1);
-	for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+	static const int nFinerPoints = 101;
+	lookupTableBuilder(constructLookupTableArgs<maxAlleles, nFounders>& args)
+		: markerPatternData(args.markerPatternData), lineFunnelEncodings(*args.lineFunnelEncodings), allFunnelEncodings(*args.allFunnelEncodings), nRecombLevels((int)args.recombinationFractions->size()), nDifferentFunnels((int)args.lineFunnelEncodings->size()), maxAIGenerations(*std::max_element(args.intercrossingGenerations->begin(), args.intercrossingGenerations->end())), maxSelfing(*std::max_element(args.selfingGenerations->begin(), args.selfingGenerations->end())), minSelfing(*std::min_element(args.selfingGenerations->begin(), args.selfingGenerations->end())), funnelHaplotypeProbabilities(nRecombLevels, maxSelfing-minSelfing+1), finerRecombLevels(nFinerPoints), finerFunnelHaplotypeProbabilities(nFinerPoints, maxSelfing-minSelfing+1), intercrossingHaplotypeProbabilities(nRecombLevels, maxAIGenerations, maxSelfing - minSelfing+1), finerIntercrossingHaplotypeProbabilities(nFinerPoints, maxAIGenerations, maxSelfing - minSelfing+1), transposedFunnelHaplotypeProbabilities(nRecombLevels, nDifferentProbs, maxSelfing - minSelfing + 1), transposedFinerFunnelHaplotypeProbabilities(nFinerPoints, nDifferentProbs, maxSelfing - minSelfing + 1)
 	{
-		for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+		const std::vector<double>& recombinationFractions = *args.recombinationFractions;
+		for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
 		{
-			genotypeProbabilitiesNoIntercross<nFounders, infiniteSelfing>(funnelHaplotypeProbabilities(recombCounter, selfingGenerations - minSelfing), (*args.recombinationFractions)[recombCounter], selfingGenerations, args.allFunnelEncodings->size());
+			finerRecombLevels[recombCounter] = 0.5 * ((double)recombCounter) / ((double)nFinerPoints - 1.0);
 		}
-		for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
+		//Only compute the compressed haplotype probabilities once. This is for the no intercrossing case. All the recombination fractions are done in a single call, so that terms which depend only on the generations of selfing are shared.
+		const std::size_t funnelStride = funnelHaplotypeProbabilities.getNColumns();
+		for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
 		{
-			genotypeProbabilitiesNoIntercross<nFounders, infiniteSelfing>(finerFunnelHaplotypeProbabilities(recombCounter, selfingGenerations - minSelfing), finerRecombLevels[recombCounter], selfingGenerations, args.allFunnelEncodings->size());
+			genotypeProbabilitiesNoIntercrossBatch<nFounders, infiniteSelfing>(&funnelHaplotypeProbabilities(0, selfingGenerations - minSelfing), funnelStride, &(recombinationFractions[0]), nRecombLevels, selfingGenerations, allFunnelEncodings.size());
+			genotypeProbabilitiesNoIntercrossBatch<nFounders, infiniteSelfing>(&finerFunnelHaplotypeProbabilities(0, selfingGenerations - minSelfing), funnelStride, &(finerRecombLevels[0]), nFinerPoints, selfingGenerations, allFunnelEncodings.size());
+			//The same values, with the recombination fraction varying fastest, as required by genotypeCountsToMarkerProbabilities
+			for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++)
+			{
+				for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+				{
+					transposedFunnelHaplotypeProbabilities(recombCounter, differentProbCounter, selfingGenerations - minSelfing) = funnelHaplotypeProbabilities(recombCounter, selfingGenerations - minSelfing)[differentProbCounter];
+				}
+				for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
+				{
+					transposedFinerFunnelHaplotypeProbabilities(recombCounter, differentProbCounter, selfingGenerations - minSelfing) = finerFunnelHaplotypeProbabilities(recombCounter, selfingGenerations - minSelfing)[differentProbCounter];
+				}
+			}
+		}
+		//Similarly for the intercrossing generation haplotype probabilities. Here the recombination fraction is the fastest varying index, so the values are contiguous.
+		for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+		{
+			for(int aiCounter = 1; aiCounter <= maxAIGenerations; aiCounter++)
+			{
+				genotypeProbabilitiesWithIntercrossBatch<nFounders, infiniteSelfing>(&intercrossingHaplotypeProbabilities(0, aiCounter-1, selfingGenerations-minSelfing), 1, aiCounter, &(recombinationFractions[0]), nRecombLevels, selfingGenerations, allFunnelEncodings.size());
+				genotypeProbabilitiesWithIntercrossBatch<nFounders, infiniteSelfing>(&finerIntercrossingHaplotypeProbabilities(0, aiCounter - 1, selfingGenerations - minSelfing), 1, aiCounter, &(finerRecombLevels[0]), nFinerPoints, selfingGenerations, allFunnelEncodings.size());
+			}
 		}
 	}
-	//Similarly for the intercrossing generation haplotype probabilities
-	xMajorMatrix<compressedProbabilitiesType> intercrossingHaplotypeProbabilities(nRecombLevels, maxAIGenerations, maxSelfing - minSelfing+1);
-	xMajorMatrix<compressedProbabilitiesType> finerIntercrossingHaplotypeProbabilities(nFinerPoints, maxAIGenerations, maxSelfing - minSelfing+1);
-	for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+	//Compute the lookup table entry for a pair of marker patterns, where firstPattern <= secondPattern, in the format of compactMarkerPairData. This only reads the members, so it can be called from several threads at once.
+	void operator()(int firstPattern, int secondPattern, std::vector<unsigned char>& result)
 	{
-		for(int aiCounter = 1; aiCounter <= maxAIGenerations; aiCounter++)
+		std::vector<array2<maxAlleles> > markerProbabilities(nFinerPoints);
+		markerData& firstMarkerPatternData = markerPatternData.allMarkerPatterns[firstPattern];
+		markerData& secondMarkerPatternData = markerPatternData.allMarkerPatterns[secondPattern];
+		//The data for this pair of markers
+		singleMarkerPairData<maxAlleles> thisMarkerPairData(nRecombLevels, nDifferentFunnels, maxAIGenerations, maxSelfing - minSelfing + 1);
+		const int nFirstMarkerValues = firstMarkerPatternData.nObservedValues, nSecondMarkerValues = secondMarkerPatternData.nObservedValues;
+		//The counts of founder genotypes only depend on the funnel, so they're computed once and used for every number of generations of selfing, and for both grids of recombination fractions.
+		std::vector<double> genotypeCounts;
+		for(int funnelCounter = 0; funnelCounter < nDifferentFunnels; funnelCounter++)
+		{
+			funnelHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::countGenotypes(genotypeCounts, lineFunnelEncodings[funnelCounter], firstMarkerPatternData, secondMarkerPatternData);
+			for(int selfingCounter = minSelfing; selfingCounter <= maxSelfing; selfingCounter++)
+			{
+				//Compute marker probabilities for a finer grid. If me seem to see a repeated probability model (numerically, up to a tolerance), then in that particular situtation this pair of markers is no good
+				genotypeCountsToMarkerProbabilities<maxAlleles, false>(genotypeCounts, nDifferentProbs, &(transposedFinerFunnelHaplotypeProbabilities(0, 0, selfingCounter - minSelfing)), nFinerPoints, &(markerProbabilities[0]), nFirstMarkerValues, nSecondMarkerValues);
+				bool allowable = isValid<maxAlleles>(markerProbabilities, nFinerPoints, nFirstMarkerValues, nSecondMarkerValues, finerRecombLevels);
+				thisMarkerPairData.allowableFunnel(funnelCounter, selfingCounter - minSelfing) = allowable;
+				//Now the input recombination fractions
+				array2<maxAlleles>* markerProbabilitiesThisFunnel = &(thisMarkerPairData.perFunnelData(0, funnelCounter, selfingCounter - minSelfing));
+				memset(markerProbabilitiesThisFunnel, 0, sizeof(array2<maxAlleles>));
+				if(allowable)
+				{
+					genotypeCountsToMarkerProbabilities<maxAlleles, true>(genotypeCounts, nDifferentProbs, &(transposedFunnelHaplotypeProbabilities(0, 0, selfingCounter - minSelfing)), nRecombLevels, markerProbabilitiesThisFunnel, nFirstMarkerValues, nSecondMarkerValues);
+				}
+			}
+		}
+		for(int selfingCounter = minSelfing; selfingCounter <= maxSelfing; selfingCounter++)
 		{
-			for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+			for(int intercrossingGeneration = 1; intercrossingGeneration <= maxAIGenerations; intercrossingGeneration++)
 			{
-				genotypeProbabilitiesWithIntercross<nFounders, infiniteSelfing>(intercrossingHaplotypeProbabilities(recombCounter, aiCounter-1, selfingGenerations-minSelfing), aiCounter, (*args.recombinationFractions)[recombCounter], selfingGenerations, args.allFunnelEncodings->size());
+				intercrossingHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<false>(finerIntercrossingHaplotypeProbabilities, &(markerProbabilities[0]), intercrossingGeneration, firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing, allFunnelEncodings[0]);
+				thisMarkerPairData.allowableAI(intercrossingGeneration-1, selfingCounter - minSelfing) = isValid<maxAlleles>(markerProbabilities, nFinerPoints, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues, finerRecombLevels);
 			}
-			for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
+			//The input recombination fractions
+			for(int intercrossingGeneration = 1; intercrossingGeneration <= maxAIGenerations; intercrossingGeneration++)
 			{
-				genotypeProbabilitiesWithIntercross<nFounders, infiniteSelfing>(finerIntercrossingHaplotypeProbabilities(recombCounter, aiCounter - 1, selfingGenerations - minSelfing), aiCounter, finerRecombLevels[recombCounter], selfingGenerations, args.allFunnelEncodings->size());
+				array2<maxAlleles>* markerProbabilitiesThisIntercrossing = &(thisMarkerPairData.perAIGenerationData(0, intercrossingGeneration-1, selfingCounter - minSelfing));
+				if(thisMarkerPairData.allowableAI(intercrossingGeneration-1, selfingCounter - minSelfing))
+				{
+					intercrossingHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<true>(intercrossingHaplotypeProbabilities, markerProbabilitiesThisIntercrossing, intercrossingGeneration, firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing, allFunnelEncodings[0]);
+				}
 			}
 		}
+		compactMarkerPairDataFromDense<maxAlleles>(thisMarkerPairData, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues, nRecombLevels, nDifferentFunnels, maxAIGenerations, maxSelfing - minSelfing + 1, result);
 	}
-#ifdef USE_OPENMP
-	#pragma omp parallel 
-#endif
+private:
+	markerPatternsToUniqueValuesArgs& markerPatternData;
+	const std::vector<funnelEncoding>& lineFunnelEncodings;
+	const std::vector<funnelEncoding>& allFunnelEncodings;
+	int nRecombLevels, nDifferentFunnels, maxAIGenerations, maxSelfing, minSelfing;
+	rowMajorMatrix<compressedProbabilitiesType> funnelHaplotypeProbabilities;
+	std::vector<double> finerRecombLevels;
+	rowMajorMatrix<compressedProbabilitiesType> finerFunnelHaplotypeProbabilities;
+	xMajorMatrix<compressedProbabilitiesType> intercrossingHaplotypeProbabilities;
+	xMajorMatrix<compressedProbabilitiesType> finerIntercrossingHaplotypeProbabilities;
+	//The funnel haplotype probabilities, indexed by recombination fraction, then compressed probability, then selfing generations
+	xMajorMatrix<double> transposedFunnelHaplotypeProbabilities;
+	xMajorMatrix<double> transposedFinerFunnelHaplotypeProbabilities;
+};
+/*
+ * The lookup table for other numbers of founders than 2, 4, 8 and 16, where nFounders is 0 and the actual number of founders is only known at run time. The compressed haplotype probabilities and the masks come from genericFunnelProbabilities, for the shape of the funnels of the design, in place of the closed forms and probabilityData. Intercrossing is not supported for these designs, so there are only entries for funnels. 
+ */
+template<int maxAlleles, bool infiniteSelfing> class lookupTableBuilder<0, maxAlleles, infiniteSelfing>
+{
+public:
+	static const int nFinerPoints = 101;
+	lookupTableBuilder(constructLookupTableArgs<maxAlleles, 0>& args)
+		: markerPatternData(args.markerPatternData), lineFunnelEncodings(*args.lineFunnelEncodings), nFounders(args.markerPatternData.nFounders), nRecombLevels((int)args.recombinationFractions->size()), nDifferentFunnels((int)args.lineFunnelEncodings->size()), maxSelfing(*std::max_element(args.selfingGenerations->begin(), args.selfingGenerations->end())), minSelfing(*std::min_element(args.selfingGenerations->begin(), args.selfingGenerations->end())), probabilities(args.funnelShape->size() > 0 ? genericFunnelProbabilities(nFounders, *args.funnelShape) : genericFunnelProbabilities(nFounders)), nDifferentProbs(probabilities.getNDifferentProbs(infiniteSelfing)), finerRecombLevels(nFinerPoints), transposedFunnelHaplotypeProbabilities(nRecombLevels, nDifferentProbs, maxSelfing - minSelfing + 1), transposedFinerFunnelHaplotypeProbabilities(nFinerPoints, nDifferentProbs, maxSelfing - minSelfing + 1)
+	{
+		if(*std::max_element(args.intercrossingGenerations->begin(), args.intercrossingGenerations->end()) > 0) throw std::runtime_error("Intercrossing is only supported for 2, 4, 8 or 16 founders");
+		for(int recombCounter = 0; recombCounter < nFinerPoints; recombCounter++)
+		{
+			finerRecombLevels[recombCounter] = 0.5 * ((double)recombCounter) / ((double)nFinerPoints - 1.0);
+		}
+		for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+		{
+			transpose(&((*args.recombinationFractions)[0]), nRecombLevels, selfingGenerations, &(transposedFunnelHaplotypeProbabilities(0, 0, selfingGenerations - minSelfing)));
+			transpose(&(finerRecombLevels[0]), nFinerPoints, selfingGenerations, &(transposedFinerFunnelHaplotypeProbabilities(0, 0, selfingGenerations - minSelfing)));
+		}
+	}
+	//See the general case
+	void operator()(int firstPattern, int secondPattern, std::vector<unsigned char>& result)
 	{
 		std::vector<array2<maxAlleles> > markerProbabilities(nFinerPoints);
-		//This next loop is a big chunk of code, but does NOT grow with problem size (number of markers, number of lines). Well, it grows but to some fixed limit, because there are only so many marker patterns. 
-#ifdef USE_OPENMP
-#pragma omp for schedule(dynamic)
-#endif
-		for(int firstPattern = 0; firstPattern < nMarkerPatternIDs; firstPattern++)
+		markerData& firstMarkerPatternData = markerPatternData.allMarkerPatterns[firstPattern];
+		markerData& secondMarkerPatternData = markerPatternData.allMarkerPatterns[secondPattern];
+		singleMarkerPairData<maxAlleles> thisMarkerPairData(nRecombLevels, nDifferentFunnels, 0, maxSelfing - minSelfing + 1);
+		const int nFirstMarkerValues = firstMarkerPatternData.nObservedValues, nSecondMarkerValues = secondMarkerPatternData.nObservedValues;
+		std::vector<double> genotypeCounts;
+		for(int funnelCounter = 0; funnelCounter < nDifferentFunnels; funnelCounter++)
 		{
-			markerData& firstMarkerPatternData = args.markerPatternData.allMarkerPatterns[firstPattern];
-			for(int secondPattern = firstPattern; secondPattern < nMarkerPatternIDs; secondPattern++)
+			countGenotypes(genotypeCounts, lineFunnelEncodings[funnelCounter], firstMarkerPatternData, secondMarkerPatternData);
+			for(int selfingCounter = minSelfing; selfingCounter <= maxSelfing; selfingCounter++)
 			{
-				markerData& secondMarkerPatternData = args.markerPatternData.allMarkerPatterns[secondPattern];
-				//The data for this pair of markers
-				singleMarkerPairData<maxAlleles> thisMarkerPairData(nRecombLevels, nDifferentFunnels, maxAIGenerations, maxSelfing - minSelfing + 1);
-				for(int selfingCounter = minSelfing; selfingCounter <= maxSelfing; selfingCounter++)
+				genotypeCountsToMarkerProbabilities<maxAlleles, false>(genotypeCounts, nDifferentProbs, &(transposedFinerFunnelHaplotypeProbabilities(0, 0, selfingCounter - minSelfing)), nFinerPoints, &(markerProbabilities[0]), nFirstMarkerValues, nSecondMarkerValues);
+				bool allowable = isValid<maxAlleles>(markerProbabilities, nFinerPoints, nFirstMarkerValues, nSecondMarkerValues, finerRecombLevels);
+				thisMarkerPairData.allowableFunnel(funnelCounter, selfingCounter - minSelfing) = allowable;
+				array2<maxAlleles>* markerProbabilitiesThisFunnel = &(thisMarkerPairData.perFunnelData(0, funnelCounter, selfingCounter - minSelfing));
+				memset(markerProbabilitiesThisFunnel, 0, sizeof(array2<maxAlleles>));
+				if(allowable)
 				{
-					//Compute marker probabilities for a finer grid. If me seem to see a repeated probability model (numerically, up to a tolerance), then in that particular situtation this pair of markers is no good
-					for(int funnelCounter = 0; funnelCounter < nDifferentFunnels; funnelCounter++)
-					{
-						funnelHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<false>(finerFunnelHaplotypeProbabilities, &(markerProbabilities[0]), (*args.lineFunnelEncodings)[funnelCounter], firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing);
-						thisMarkerPairData.allowableFunnel(funnelCounter, selfingCounter - minSelfing) = isValid<maxAlleles>(markerProbabilities, nFinerPoints, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues, finerRecombLevels);
-					}
-					for(int intercrossingGeneration = 1; intercrossingGeneration <= maxAIGenerations; intercrossingGeneration++)
-					{
-						intercrossingHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<false>(finerIntercrossingHaplotypeProbabilities, &(markerProbabilities[0]), intercrossingGeneration, firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing, (*args.allFunnelEncodings)[0]);
-						thisMarkerPairData.allowableAI(intercrossingGeneration-1, selfingCounter - minSelfing) = isValid<maxAlleles>(markerProbabilities, nFinerPoints, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues, finerRecombLevels);
-					}
-					//The next two loops relate to the input recombination fractions
-					for(int intercrossingGeneration = 1; intercrossingGeneration <= maxAIGenerations; intercrossingGeneration++)
-					{
-						array2<maxAlleles>* markerProbabilitiesThisIntercrossing = &(thisMarkerPairData.perAIGenerationData(0, intercrossingGeneration-1, selfingCounter - minSelfing));
-						if(thisMarkerPairData.allowableAI(intercrossingGeneration-1, selfingCounter - minSelfing))
-						{
-							intercrossingHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<true>(intercrossingHaplotypeProbabilities, markerProbabilitiesThisIntercrossing, intercrossingGeneration, firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing, (*args.allFunnelEncodings)[0]);
-						}
-					}
-					for(int funnelCounter = 0; funnelCounter < nDifferentFunnels; funnelCounter++)
-					{
-						array2<maxAlleles>* markerProbabilitiesThisFunnel = &(thisMarkerPairData.perFunnelData(0, funnelCounter, selfingCounter - minSelfing));
-						memset(markerProbabilitiesThisFunnel, 0, sizeof(array2<maxAlleles>));
-						if(thisMarkerPairData.allowableFunnel(funnelCounter, selfingCounter - minSelfing))
-						{
-							funnelHaplotypeToMarker<nFounders, maxAlleles, infiniteSelfing>::template convert<true>(funnelHaplotypeProbabilities, markerProbabilitiesThisFunnel, (*args.lineFunnelEncodings)[funnelCounter], firstMarkerPatternData, secondMarkerPatternData, selfingCounter - minSelfing);
-						}
-					}
+					genotypeCountsToMarkerProbabilities<maxAlleles, true>(genotypeCounts, nDifferentProbs, &(transposedFunnelHaplotypeProbabilities(0, 0, selfingCounter - minSelfing)), nRecombLevels, markerProbabilitiesThisFunnel, nFirstMarkerValues, nSecondMarkerValues);
 				}
-				args.computedContributions(firstPattern, secondPattern).swap(thisMarkerPairData);
 			}
 		}
+		compactMarkerPairDataFromDense<maxAlleles>(thisMarkerPairData, nFirstMarkerValues, nSecondMarkerValues, nRecombLevels, nDifferentFunnels, 0, maxSelfing - minSelfing + 1, result);
 	}
+private:
+	//The compressed probabilities for every recombination fraction, in the layout required by genotypeCountsToMarkerProbabilities
+	void transpose(const double* recombinationFractions, int nPoints, int selfingGenerations, double* transposed)
+	{
+		std::vector<double> compressed(nDifferentProbs);
+		for(int recombCounter = 0; recombCounter < nPoints; recombCounter++)
+		{
+			if(infiniteSelfing) probabilities.compressedInfiniteSelfing(recombinationFractions[recombCounter], &(compressed[0]));
+			else probabilities.compressedFiniteSelfing(recombinationFractions[recombCounter], selfingGenerations, &(compressed[0]));
+			for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++) transposed[differentProbCounter * nPoints + recombCounter] = compressed[differentProbCounter];
+		}
+	}
+	//The same as funnelHaplotypeToMarker::countGenotypes, with the masks of genericFunnelProbabilities. Genotypes are indexed as founder1 * nFounders + founder2. 
+	void countGenotypes(std::vector<double>& counts, const funnelEncoding& enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData) const
+	{
+		const int nFirstMarkerValues = firstMarkerPatternData.nObservedValues, nSecondMarkerValues = secondMarkerPatternData.nObservedValues;
+		//With infinite selfing only the homozygotes occur, so the states are single founders
+		const int nGenotypes = infiniteSelfing ? nFounders : nFounders * nFounders;
+		const std::vector<int>& mask = infiniteSelfing ? probabilities.getInfiniteMask() : probabilities.getFiniteMask();
+		std::vector<int> firstMarkerValues(nGenotypes), secondMarkerValues(nGenotypes), secondGenotypes(nGenotypes), secondBucketStart(nSecondMarkerValues + 1, 0);
+		for(int genotype = 0; genotype < nGenotypes; genotype++)
+		{
+			int founder1 = enc[infiniteSelfing ? genotype : genotype / nFounders], founder2 = enc[infiniteSelfing ? genotype : genotype % nFounders];
+			int firstMarkerValue = firstMarkerPatternData.hetData(founder1, founder2);
+			firstMarkerValues[genotype] = (firstMarkerValue >= 0 && firstMarkerValue < nFirstMarkerValues) ? firstMarkerValue : -1;
+			int secondMarkerValue = secondMarkerPatternData.hetData(founder1, founder2);
+			secondMarkerValues[genotype] = (secondMarkerValue >= 0 && secondMarkerValue < nSecondMarkerValues) ? secondMarkerValue : -1;
+			if(secondMarkerValues[genotype] >= 0) secondBucketStart[secondMarkerValue+1]++;
+		}
+		for(int secondMarkerValue = 0; secondMarkerValue < nSecondMarkerValues; secondMarkerValue++) secondBucketStart[secondMarkerValue+1] += secondBucketStart[secondMarkerValue];
+		{
+			std::vector<int> nextPosition(secondBucketStart.begin(), secondBucketStart.end() - 1);
+			for(int genotype = 0; genotype < nGenotypes; genotype++)
+			{
+				if(secondMarkerValues[genotype] >= 0) secondGenotypes[nextPosition[secondMarkerValues[genotype]]++] = genotype;
+			}
+		}
+		counts.assign((std::size_t)nFirstMarkerValues * nSecondMarkerValues * nDifferentProbs, 0);
+		for(int genotype1 = 0; genotype1 < nGenotypes; genotype1++)
+		{
+			const int firstMarkerValue = firstMarkerValues[genotype1];
+			if(firstMarkerValue < 0) continue;
+			const int* maskRow = &(mask[(std::size_t)genotype1 * nGenotypes]);
+			for(int secondMarkerValue = 0; secondMarkerValue < nSecondMarkerValues; secondMarkerValue++)
+			{
+				double* countsThisPair = &(counts[(firstMarkerValue * nSecondMarkerValues + secondMarkerValue) * nDifferentProbs]);
+				for(int position = secondBucketStart[secondMarkerValue]; position < secondBucketStart[secondMarkerValue+1]; position++)
+				{
+					countsThisPair[maskRow[secondGenotypes[position]]]++;
+				}
+			}
+		}
+	}
+	markerPatternsToUniqueValuesArgs& markerPatternData;
+	const std::vector<funnelEncoding>& lineFunnelEncodings;
+	int nFounders, nRecombLevels, nDifferentFunnels, maxSelfing, minSelfing;
+	genericFunnelProbabilities probabilities;
+	int nDifferentProbs;
+	std::vector<double> finerRecombLevels;
+	xMajorMatrix<double> transposedFunnelHaplotypeProbabilities;
+	xMajorMatrix<double> transposedFinerFunnelHaplotypeProbabilities;
+};
+//Set up the lookup table. Only the haplotype probabilities are computed here, and the entries for pairs of marker patterns are computed as they're requested.
+template<int nFounders, int maxAlleles, bool infiniteSelfing> void constructLookupTable(constructLookupTableArgs<maxAlleles, nFounders>& args)
+{
+	std::shared_ptr<lookupTableBuilder<nFounders, maxAlleles, infiniteSelfing> > builder(new lookupTableBuilder<nFounders, maxAlleles, infiniteSelfing>(args));
+	args.computedContributions.setCompute([builder](int firstPattern, int secondPattern, std::vector<unsigned char>& result)
+		{
+			(*builder)(firstPattern, secondPattern, result);
+		});
 }
 #endif
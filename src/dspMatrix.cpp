@@ -1,17 +1,18 @@
 #include "dspMatrix.h"
 #include "matrixChunks.h"
+#include "packedTriangleFile.h"
 SEXP assignDspMatrixFromEstimateRF(SEXP destination_, SEXP rowIndices_, SEXP columnIndices_, SEXP source_)
 {
 BEGIN_RCPP
 	Rcpp::S4 destination = destination_;
 	Rcpp::NumericVector source = source_;
-	Rcpp::NumericVector destinationData = destination.slot("x");
+	dspMatrixData view(destination, true);
 	Rcpp::IntegerVector rowIndices = rowIndices_;
 	Rcpp::IntegerVector columnIndices = columnIndices_;
 
-	if(&(source(0)) == &(destinationData(0)))
+	if(&(source(0)) == view.getData())
 	{
-		throw std::runtime_error("Source and destination cannot be the same in assignRawSymmetricMatrixDiagonal");
+		throw std::runtime_error("Source and destination cannot be the same in assignDspMatrixFromEstimateRF");
 	}
 
 	std::vector<int> markerRows, markerColumns;
@@ -28,9 +29,69 @@ BEGIN_RCPP
 	{
 		std::pair<int, int> markerPair = iterator.get();
 		int markerRow = markerPair.first, markerColumn = markerPair.second;
-		destinationData((markerColumn*(markerColumn-1))/2 + (markerRow - 1)) = source(counter);
+		view.set(((R_xlen_t)markerColumn*(markerColumn-1))/2 + (markerRow - 1), source(counter));
 		counter++;
 	}
 	return R_NilValue;
 END_RCPP
 }
+SEXP dspMatrixSubsetObject(SEXP object_, SEXP indices_)
+{
+BEGIN_RCPP
+	Rcpp::S4 object = object_;
+	dspMatrixData view(object, false);
+	Rcpp::IntegerVector indices = indices_;
+	R_xlen_t newNMarkers = indices.size();
+	Rcpp::NumericVector newData((indices.size() * (indices.size() + (R_xlen_t)1))/(R_xlen_t)2);
+	R_xlen_t counter = 0;
+	//Column
+	for(R_xlen_t j = 0; j < newNMarkers; j++)
+	{
+		//Row
+		for(R_xlen_t i = 0; i <= j; i++)
+		{
+			R_xlen_t indexJ = indices[j], indexI = indices[i];
+			if(indexI > indexJ) std::swap(indexI, indexJ);
+			newData(counter) = view.get((indexJ*(indexJ-(R_xlen_t)1))/(R_xlen_t)2 + indexI - (R_xlen_t)1);
+			counter++;
+		}
+	}
+	return newData;
+END_RCPP
+}
+SEXP compactLodMatrixSubsetObject(SEXP object_, SEXP indices_)
+{
+BEGIN_RCPP
+	Rcpp::S4 object = object_;
+	Rcpp::RawVector oldCodes = object.slot("codes");
+	const lodCode* oldData = (const lodCode*)oldCodes.begin();
+	Rcpp::IntegerVector indices = indices_;
+	R_xlen_t newNMarkers = indices.size();
+	Rcpp::RawVector newCodes(sizeof(lodCode) * (indices.size() * (indices.size() + (R_xlen_t)1))/(R_xlen_t)2);
+	lodCode* newData = (lodCode*)newCodes.begin();
+	R_xlen_t counter = 0;
+	for(R_xlen_t j = 0; j < newNMarkers; j++)
+	{
+		for(R_xlen_t i = 0; i <= j; i++)
+		{
+			R_xlen_t indexJ = indices[j], indexI = indices[i];
+			if(indexI > indexJ) std::swap(indexI, indexJ);
+			newData[counter] = oldData[(indexJ*(indexJ-(R_xlen_t)1))/(R_xlen_t)2 + indexI - (R_xlen_t)1];
+			counter++;
+		}
+	}
+	return newCodes;
+END_RCPP
+}
+SEXP encodeLodValues(SEXP values_, SEXP scale_)
+{
+BEGIN_RCPP
+	Rcpp::NumericVector values = values_;
+	double scale = Rcpp::as<double>(scale_);
+	if(scale <= 0 || scale != scale) throw std::runtime_error("Input scale must be a positive number");
+	Rcpp::RawVector result(sizeof(lodCode) * values.size());
+	lodCode* codes = (lodCode*)result.begin();
+	for(R_xlen_t i = 0; i < values.size(); i++) codes[i] = encodeLod(values[i], scale);
+	return result;
+END_RCPP
+}
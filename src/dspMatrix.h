@@ -2,4 +2,10 @@
 #define DSP_MATRIX_HEADER_GUARD
 #include <Rcpp.h>
 SEXP assignDspMatrixFromEstimateRF(SEXP destination, SEXP rowIndices, SEXP columnIndices, SEXP source);
+//The packed values of the submatrix with the given (one-based) marker indices. Works for a dspMatrix, dspMatrixFile or compactLodMatrix.
+SEXP dspMatrixSubsetObject(SEXP object, SEXP indices);
+//The same as dspMatrixSubsetObject, but for a compactLodMatrix, returning the codes without decoding them.
+SEXP compactLodMatrixSubsetObject(SEXP object, SEXP indices);
+//Encode a vector of lod values as 16-bit codes, stored in a raw vector.
+SEXP encodeLodValues(SEXP values, SEXP scale);
 #endif
@@ -4,346 +4,766 @@
 #include "estimateRFSpecificDesign.h"
 #include <stdexcept>
 #include "matrixChunks.h"
-SEXP estimateRF(SEXP object_, SEXP recombinationFractions_, SEXP markerRows_, SEXP markerColumns_, SEXP lineWeights_, SEXP keepLod_, SEXP keepLkhd_, SEXP gbLimit_, SEXP verbose_)
+#include "packedTriangleFile.h"
+#include "identicalMarkers.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include "compactMarkerPairData.h"
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+//Where the results are written. If packed is true, the values for a pair of markers are written to the position of that pair in a packed upper triangular matrix (column-major). Otherwise they are written in the order visited by triangularIterator. lod, lodCodes, lkhd and curves can be NULL. If lodCodes is not NULL the lod values are written as 16-bit codes, with scale lodScale.
+//If curves is not NULL the log likelihood curve for every pair is also written, at position * nRecombLevels. If accumulateCurves is true, the stored curve is first added to the curve for the current data, and the estimates are computed from the sum. This requires packed to be true.
+struct estimateRFDestination
 {
-	BEGIN_RCPP
-		Rcpp::NumericVector recombinationFractions;
-		try
-		{
-			recombinationFractions = recombinationFractions_;
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input recombinationFractions must be a numeric vector");
-		}
-		R_xlen_t nRecombLevels = recombinationFractions.size();
-		Rcpp::NumericVector::iterator halfIterator = std::find(recombinationFractions.begin(), recombinationFractions.end(), 0.5);
-		if(halfIterator == recombinationFractions.end()) throw std::runtime_error("Input recombinationFractions did not contain the value 0.5");
-		if(std::find(recombinationFractions.begin(), recombinationFractions.end(), 0.0) == recombinationFractions.end()) throw std::runtime_error("Input recombinationFractions did not contain the value 0");
-		int halfIndex = (int)std::distance(recombinationFractions.begin(), halfIterator);
+	estimateRFDestination()
+		: theta(NULL), lod(NULL), lodCodes(NULL), lodScale(0), lkhd(NULL), curves(NULL), accumulateCurves(false), packed(false)
+	{}
+	Rbyte* theta;
+	double* lod;
+	lodCode* lodCodes;
+	double lodScale;
+	double* lkhd;
+	double* curves;
+	bool accumulateCurves;
+	bool packed;
+};
+//Validates the inputs and does the estimation. Once everything has been validated, allocate is called with the marker pairs to estimate and the values of keepLod and keepLkhd, and returns the destination for the results.
+//If coarseToFine is true, the likelihood for each pair is first evaluated on a coarse subset of the recombination levels, and then at every level between the neighbours of the best coarse level. The estimate is the best level that was evaluated, which is the same as for the full search unless the likelihood has more than one local maximum.
+//If deduplicate is true, markers with exactly the same data are only estimated once (see identicalMarkerClasses). This must be false if curves are written, because the curves already stored for identical markers may be different.
+//If screenThreshold is positive, pairs for which the association statistic of the joint allele counts (summed over designs) is less than screenThreshold are assumed to be unlinked. Only the likelihood at 0.5 is computed for these pairs, so the estimate is 0.5 and the lod is 0.
+static void estimateRFInternal(SEXP object_, SEXP recombinationFractions_, SEXP markerRows_, SEXP markerColumns_, SEXP lineWeights_, SEXP keepLod_, SEXP keepLkhd_, SEXP gbLimit_, SEXP verbose_, SEXP coarseToFine_, SEXP screenThreshold_, bool deduplicate, std::function<estimateRFDestination(const triangularTiles&, bool, bool)> allocate)
+{
+	Rcpp::NumericVector recombinationFractions;
+	try
+	{
+		recombinationFractions = recombinationFractions_;
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input recombinationFractions must be a numeric vector");
+	}
+	R_xlen_t nRecombLevels = recombinationFractions.size();
+	Rcpp::NumericVector::iterator halfIterator = std::find(recombinationFractions.begin(), recombinationFractions.end(), 0.5);
+	if(halfIterator == recombinationFractions.end()) throw std::runtime_error("Input recombinationFractions did not contain the value 0.5");
+	if(std::find(recombinationFractions.begin(), recombinationFractions.end(), 0.0) == recombinationFractions.end()) throw std::runtime_error("Input recombinationFractions did not contain the value 0");
+	int halfIndex = (int)std::distance(recombinationFractions.begin(), halfIterator);
 
-		//Confirm that recombination fractions are in increasing order
-		for(int i = 0; i < recombinationFractions.size()-1; i++)
-		{
-			if(recombinationFractions[i] >= recombinationFractions[i+1]) throw std::runtime_error("Input recombinationFractions must be a vector of increasing values");
-		}
+	//Confirm that recombination fractions are in increasing order
+	for(int i = 0; i < recombinationFractions.size()-1; i++)
+	{
+		if(recombinationFractions[i] >= recombinationFractions[i+1]) throw std::runtime_error("Input recombinationFractions must be a vector of increasing values");
+	}
 
-		std::vector<double> recombinationFractionsDouble = Rcpp::as<std::vector<double> >(recombinationFractions);
-		Rcpp::S4 object;
-		try
-		{
-			object = object_;
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input object must be an S4 object");
-		}
-		std::vector<int> markerRows;
-		try
-		{
-			markerRows = Rcpp::as<std::vector<int> >(markerRows_);
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input markerRows must be an integer vector");
-		}
-		for(std::vector<int>::iterator markerRow = markerRows.begin(); markerRow != markerRows.end(); markerRow++)
-		{
-			(*markerRow)--;
-		}
+	std::vector<double> recombinationFractionsDouble = Rcpp::as<std::vector<double> >(recombinationFractions);
+	Rcpp::S4 object;
+	try
+	{
+		object = object_;
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input object must be an S4 object");
+	}
+	std::vector<int> markerRows;
+	try
+	{
+		markerRows = Rcpp::as<std::vector<int> >(markerRows_);
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input markerRows must be an integer vector");
+	}
+	for(std::vector<int>::iterator markerRow = markerRows.begin(); markerRow != markerRows.end(); markerRow++)
+	{
+		(*markerRow)--;
+	}
 
-		std::vector<int> markerColumns;
-		try
-		{
-			markerColumns = Rcpp::as<std::vector<int> >(markerColumns_);
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input markerColumns must be an integer vector");
-		}
-		for(std::vector<int>::iterator markerColumn = markerColumns.begin(); markerColumn != markerColumns.end(); markerColumn++)
-		{
-			(*markerColumn)--;
-		}
-		Rcpp::RObject lineWeights_noType = lineWeights_;
-		if(lineWeights_noType.sexp_type() != VECSXP)
-		{
-			throw Rcpp::not_compatible("Input lineWeights must be a list");
-		}
-		Rcpp::List lineWeights = lineWeights_;
-		double gbLimit;
-		try
-		{
-			gbLimit = Rcpp::as<double>(gbLimit_);
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input gbLimit must be a single numeric value");
-		}
-		R_xlen_t bytesLimit = (R_xlen_t)(gbLimit*1000000000LL + 1LL);
-	
-		Rcpp::List geneticData;
-		try
-		{
-			geneticData = object.slot("geneticData");
-		}
-		catch(...)
-		{
-			throw Rcpp::not_compatible("Input object must have a slot named \"geneticData\" which must be a list");
-		}
-		R_xlen_t nDesigns = geneticData.length();
-		if(lineWeights.size() != nDesigns) throw std::runtime_error("Input lineWeights had the wrong number of entries");
-		try
-		{
-			for(R_xlen_t i = 0; i < nDesigns; i++)
+	std::vector<int> markerColumns;
+	try
+	{
+		markerColumns = Rcpp::as<std::vector<int> >(markerColumns_);
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input markerColumns must be an integer vector");
+	}
+	for(std::vector<int>::iterator markerColumn = markerColumns.begin(); markerColumn != markerColumns.end(); markerColumn++)
+	{
+		(*markerColumn)--;
+	}
+	Rcpp::RObject lineWeights_noType = lineWeights_;
+	if(lineWeights_noType.sexp_type() != VECSXP)
+	{
+		throw Rcpp::not_compatible("Input lineWeights must be a list");
+	}
+	Rcpp::List lineWeights = lineWeights_;
+	double gbLimit;
+	try
+	{
+		gbLimit = Rcpp::as<double>(gbLimit_);
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input gbLimit must be a single numeric value");
+	}
+	//The results are written straight to their destination, so the working memory no longer depends on gbLimit. It's still validated, because it's stored in the rf object. 
+	(void)gbLimit;
+	bool coarseToFine;
+	try
+	{
+		coarseToFine = Rcpp::as<bool>(coarseToFine_);
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input coarseToFine must be a boolean");
+	}
+	double screenThreshold;
+	try
+	{
+		screenThreshold = Rcpp::as<double>(screenThreshold_);
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input screenThreshold must be a single numeric value");
+	}
+	if(!(screenThreshold >= 0)) throw std::runtime_error("Input screenThreshold must be non-negative");
+
+	Rcpp::List geneticData;
+	try
+	{
+		geneticData = object.slot("geneticData");
+	}
+	catch(...)
+	{
+		throw Rcpp::not_compatible("Input object must have a slot named \"geneticData\" which must be a list");
+	}
+	R_xlen_t nDesigns = geneticData.length();
+	if(lineWeights.size() != nDesigns) throw std::runtime_error("Input lineWeights had the wrong number of entries");
+	try
+	{
+		for(R_xlen_t i = 0; i < nDesigns; i++)
+		{
+			Rcpp::NumericVector currentDesignLineWeights = lineWeights(i);
+		}
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Input lineWeights must be a list of numeric vectors");
+	}
+	bool keepLod, keepLkhd;
+	try
+	{
+		keepLod = Rcpp::as<bool>(keepLod_);
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Input keepLod must be a boolean");
+	}
+	try
+	{
+		keepLkhd = Rcpp::as<bool>(keepLkhd_);
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Input keepLkhd must be a boolean");
+	}
+	Rcpp::List verboseList;
+	bool verbose;
+	int progressStyle;
+	try
+	{
+		verboseList = Rcpp::as<Rcpp::List>(verbose_);
+		verbose = Rcpp::as<bool>(verboseList("verbose"));
+		progressStyle = Rcpp::as<int>(verboseList("progressStyle"));
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Input verbose must be a boolean or a list with entries verbose and progressStyle");
+	}
+	if (progressStyle < 1 || progressStyle > 3)
+	{
+		throw std::runtime_error("Input verbose$progressStyle must be 1, 2 or 3");
+	}
+	if(nDesigns <= 0) throw std::runtime_error("There must be at least one design");
+	if(markerRows.size() == 0) throw std::runtime_error("Input markerRows must have at least one entry");
+	if(markerColumns.size() == 0) throw std::runtime_error("Input markerColumns must have at least one entry");
+
+	int markerRowMin = *std::min_element(markerRows.begin(), markerRows.end());
+	int markerColumnMin = *std::min_element(markerColumns.begin(), markerColumns.end());
+	if(markerRowMin < 0) throw std::runtime_error("Invalid values for input markerRows");
+	if(markerColumnMin < 0) throw std::runtime_error("Invalid value for input markerColumns");
+
+	//If the input values of markerRows and markerColumns give a region that's completely in the lower triangular region, then throw an error
+	R_xlen_t nValuesToEstimate = countValuesToEstimate(markerRows, markerColumns);
+	if(nValuesToEstimate == 0)
+	{
+		throw std::runtime_error("Input values of markerRows and markerColumns give a region that is contained in the lower triangular part of the matrix");
+	}
+
+	//Last bit of validation
+	for(int i = 0; i < nDesigns; i++)
+	{
+		Rcpp::S4 currentGeneticData = geneticData(i);
+		Rcpp::IntegerMatrix finals = currentGeneticData.slot("finals");
+		std::vector<double> lineWeightsThisDesign = Rcpp::as<std::vector<double> >(lineWeights[i]);
+		if((int)lineWeightsThisDesign.size() != finals.nrow())
+		{
+			throw std::runtime_error("An entry of input lineWeights had the wrong length");
+		}
+	}
+	//Construct vector of rfhaps_internal_args objects
+	//Tiles of 128 x 128 marker pairs. For a few thousand lines the bit planes for the markers of a tile fit comfortably in L2 cache. 
+	triangularTiles tiles(markerRows, markerColumns, 128);
+	//If the marker pairs are a triangle of increasing markers, markers with exactly the same data are only estimated once. The triangle of distinct markers is estimated, and the results are copied to every pair.
+	std::vector<int> distinctMarkers;
+	//For every position in markerRows, the position in distinctMarkers of the marker with the same data
+	std::vector<int> distinctPositions;
+	bool deduplicated = false;
+	if(deduplicate && markerRows == markerColumns && std::adjacent_find(markerRows.begin(), markerRows.end(), std::greater_equal<int>()) == markerRows.end())
+	{
+		std::vector<int> classes = identicalMarkerClasses(geneticData);
+		if(markerRows.back() < (int)classes.size())
+		{
+			std::vector<int> classPositions(classes.size(), -1);
+			for(std::vector<int>::iterator markerRow = markerRows.begin(); markerRow != markerRows.end(); markerRow++)
+			{
+				int& classPosition = classPositions[classes[*markerRow]];
+				if(classPosition == -1)
+				{
+					classPosition = (int)distinctMarkers.size();
+					distinctMarkers.push_back(*markerRow);
+				}
+				distinctPositions.push_back(classPosition);
+			}
+			deduplicated = distinctMarkers.size() < markerRows.size();
+			if(deduplicated && verbose)
 			{
-				Rcpp::NumericVector currentDesignLineWeights = lineWeights(i);
+				Rcpp::Rcout << markerRows.size() - distinctMarkers.size() << " markers were identical to another marker, and will not be estimated separately" << std::endl;
 			}
 		}
-		catch(...)
+	}
+	triangularTiles distinctTiles(distinctMarkers, distinctMarkers, 128);
+	//The marker pairs which are actually estimated
+	const triangularTiles& estimatedTiles = deduplicated ? distinctTiles : tiles;
+	const std::vector<int>& estimatedRows = estimatedTiles.getMarkerRows(), &estimatedColumns = estimatedTiles.getMarkerColumns();
+	//Lookup table entries are cached on disk, if a directory is given by option mpMap2.lookupCache
+	std::string lookupCacheDirectory;
+	{
+		Rcpp::Function getOption("getOption");
+		Rcpp::RObject lookupCacheOption = getOption("mpMap2.lookupCache");
+		if(!lookupCacheOption.isNULL())
 		{
-			throw std::runtime_error("Input lineWeights must be a list of numeric vectors");
+			try
+			{
+				lookupCacheDirectory = Rcpp::as<std::string>(lookupCacheOption);
+			}
+			catch(...)
+			{
+				throw std::runtime_error("Option mpMap2.lookupCache must be a single directory name");
+			}
 		}
-		bool keepLod, keepLkhd;
+	}
+	std::vector<rfhaps_internal_args> internalArgumentObjects;
+	for(int i = 0; i < nDesigns; i++)
+	{
+		Rcpp::S4 currentGeneticData = geneticData(i);
+		std::vector<double> lineWeightsThisDesign = Rcpp::as<std::vector<double> >(lineWeights[i]);
+		std::string error;
+		estimateRFSpecificDesignArgs args(recombinationFractionsDouble);
 		try
 		{
-			keepLod = Rcpp::as<bool>(keepLod_);
+			args.founders = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("founders"));
 		}
 		catch(...)
 		{
-			throw std::runtime_error("Input keepLod must be a boolean");
+			std::stringstream ss; 
+			ss << "Founders slot of design " << i << " was not an integer matrix";
+			throw std::runtime_error(ss.str().c_str());
 		}
 		try
 		{
-			keepLkhd = Rcpp::as<bool>(keepLkhd_);
+			args.finals = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("finals"));
 		}
 		catch(...)
 		{
-			throw std::runtime_error("Input keepLkhd must be a boolean");
+			std::stringstream ss; 
+			ss << "Finals slot of design " << i << " was not an integer matrix";
+			throw std::runtime_error(ss.str().c_str());
 		}
-		Rcpp::List verboseList;
-		bool verbose;
-		int progressStyle;
 		try
 		{
-			verboseList = Rcpp::as<Rcpp::List>(verbose_);
-			verbose = Rcpp::as<bool>(verboseList("verbose"));
-			progressStyle = Rcpp::as<int>(verboseList("progressStyle"));
+			args.pedigree = Rcpp::as<Rcpp::S4>(currentGeneticData.slot("pedigree"));
 		}
 		catch(...)
 		{
-			throw std::runtime_error("Input verbose must be a boolean or a list with entries verbose and progressStyle");
+			std::stringstream ss; 
+			ss << "Pedigree slot of design " << i << " was not an S4 object";
+			throw std::runtime_error(ss.str().c_str());
 		}
-		if (progressStyle < 1 || progressStyle > 3)
-		{
-			throw std::runtime_error("Input verbose$progressStyle must be 1, 2 or 3");
-		}
-		if(nDesigns <= 0) throw std::runtime_error("There must be at least one design");
-		if(markerRows.size() == 0) throw std::runtime_error("Input markerRows must have at least one entry");
-		if(markerColumns.size() == 0) throw std::runtime_error("Input markerColumns must have at least one entry");
-
-		int markerRowMin = *std::min_element(markerRows.begin(), markerRows.end());
-		int markerColumnMin = *std::min_element(markerColumns.begin(), markerColumns.end());
-		if(markerRowMin < 0) throw std::runtime_error("Invalid values for input markerRows");
-		if(markerColumnMin < 0) throw std::runtime_error("Invalid value for input markerColumns");
-
-		//If the input values of markerRows and markerColumns give a region that's completely in the lower triangular region, then throw an error
-		R_xlen_t nValuesToEstimate = countValuesToEstimate(markerRows, markerColumns);
-		if(nValuesToEstimate == 0)
-		{
-			throw std::runtime_error("Input values of markerRows and markerColumns give a region that is contained in the lower triangular part of the matrix");
-		}
-
-		//Warn if we're going to allocate over 4gb
-		R_xlen_t valuesToEstimateInChunk;
-		if(bytesLimit < 0)
-		{
-			valuesToEstimateInChunk = nValuesToEstimate;
-		}
-		else
+		try
 		{
-			valuesToEstimateInChunk = std::min(nValuesToEstimate, (R_xlen_t) bytesLimit / (R_xlen_t)(nRecombLevels * sizeof(double)) + (R_xlen_t)1LL);
+			args.hetData = Rcpp::as<Rcpp::S4>(currentGeneticData.slot("hetData"));
 		}
-		//Output a message detailing allocation size here, if either we're going to allocate more than 4gb, and the user didn't attempt to limit this, or the verbose option is specified. 
-		if((valuesToEstimateInChunk * (std::size_t)nRecombLevels * sizeof(double) > 4000000000ULL && bytesLimit < 0) || verbose)
+		catch(...)
 		{
-			Rcpp::Rcout << "Allocating results matrix of " << (valuesToEstimateInChunk * (std::size_t)nRecombLevels * sizeof(double)) << " bytes = " << ((valuesToEstimateInChunk * (std::size_t)nRecombLevels * sizeof(double))/1000000000ULL) << " gb" << std::endl;
-		}
-		//This is not an Rcpp::NumericVector because it can quite easily overflow the size of such a vector (signed int)
-		std::vector<double> result(valuesToEstimateInChunk * nRecombLevels, 0);
+			std::stringstream ss; 
+			ss << "hetData slot of design " << i << " was not an S4 object";
+			throw std::runtime_error(ss.str().c_str());
+		}
+		//This has to be copied / swapped in, because it's a local temporary at the moment
+		args.lineWeights.swap(lineWeightsThisDesign);
+		rfhaps_internal_args internalArgs(args.recombinationFractions, estimatedTiles);
+		bool converted = toInternalArgs(std::move(args), internalArgs, error);
+		if(!converted)
+		{
+			std::stringstream ss;
+			ss << "Error pre-processing data for dataset " << i << ": " << error;
+			throw std::runtime_error(ss.str().c_str());
+		}
+		internalArgs.lookupCacheDirectory = lookupCacheDirectory;
+		internalArgumentObjects.emplace_back(std::move(internalArgs));
+	}
+	//Estimate required memory usage
+	signed long long lookupBytes = 0;
+	for(int i = 0; i < nDesigns; i++)
+	{
+		unsigned long long currentLookupBytes = estimateLookup(internalArgumentObjects[i]);
+		lookupBytes += currentLookupBytes;
+	}
+	//Output a message giving the allocation size, if either it's more than a gb, or the verbose option is specified
+	if(lookupBytes > 1000000000 || verbose)
+	{
+		Rcpp::Rcout << "Lookup table size of at most " << lookupBytes << " bytes" << std::endl;
+	}
+	std::vector<std::unique_ptr<designLikelihood> > likelihoods;
+	for(int i = 0; i < nDesigns; i++)
+	{
+		likelihoods.emplace_back(createDesignLikelihood(internalArgumentObjects[i]));
+		if(!likelihoods.back()) throw std::runtime_error("Internal error");
+	}
+	estimateRFDestination destination = allocate(tiles, keepLod, keepLkhd);
+	if((coarseToFine || screenThreshold > 0) && destination.curves) throw std::runtime_error("Log likelihood curves cannot be stored for a coarse to fine search, or if pairs are screened");
+	if(deduplicated && destination.curves) throw std::runtime_error("Internal error");
+	//If markers were deduplicated, the estimates for the distinct markers are written to a packed triangle in memory first
+	estimateRFDestination estimatedDestination = destination;
+	std::vector<Rbyte> distinctTheta;
+	std::vector<double> distinctLod, distinctLkhd;
+	if(deduplicated)
+	{
+		std::size_t nDistinctValues = (std::size_t)distinctTiles.getNValues();
+		estimatedDestination = estimateRFDestination();
+		distinctTheta.resize(nDistinctValues);
+		estimatedDestination.theta = &(distinctTheta[0]);
+		if(destination.lod || destination.lodCodes)
+		{
+			distinctLod.resize(nDistinctValues);
+			estimatedDestination.lod = &(distinctLod[0]);
+		}
+		if(destination.lkhd)
+		{
+			distinctLkhd.resize(nDistinctValues);
+			estimatedDestination.lkhd = &(distinctLkhd[0]);
+		}
+	}
+	//The levels which are always evaluated by the coarse to fine search. These are evenly spaced, and include the first and last levels and 0.5, so the lod can always be computed. With a spacing of k there are about nRecombLevels / k coarse levels and at most 2(k - 1) refined levels, so the total is smallest for k around sqrt(nRecombLevels / 2).
+	std::vector<int> coarseLevels;
+	if(coarseToFine)
+	{
+		int spacing = std::max(1, (int)std::sqrt(nRecombLevels / 2.0));
+		for(int level = 0; level < nRecombLevels; level += spacing) coarseLevels.push_back(level);
+		if(coarseLevels.back() != nRecombLevels - 1) coarseLevels.push_back((int)nRecombLevels - 1);
+		if(!std::binary_search(coarseLevels.begin(), coarseLevels.end(), halfIndex)) coarseLevels.insert(std::lower_bound(coarseLevels.begin(), coarseLevels.end(), halfIndex), halfIndex);
+	}
+	const int nCoarseLevels = (int)coarseLevels.size();
 
-		//Last bit of validation
-		for(int i = 0; i < nDesigns; i++)
-		{
-			Rcpp::S4 currentGeneticData = geneticData(i);
-			Rcpp::IntegerMatrix finals = currentGeneticData.slot("finals");
-			std::vector<double> lineWeightsThisDesign = Rcpp::as<std::vector<double> >(lineWeights[i]);
-			if((int)lineWeightsThisDesign.size() != finals.nrow())
+	Rcpp::Function txtProgressBar("txtProgressBar");
+	Rcpp::Function setTxtProgressBar("setTxtProgressBar");
+	Rcpp::Function close("close");
+	Rcpp::RObject barHandle;
+	std::function<void(unsigned long long)> updateProgress = [](unsigned long long){};
+	if(verbose)
+	{
+		barHandle = txtProgressBar(Rcpp::Named("style") = progressStyle, Rcpp::Named("min") = 0, Rcpp::Named("max") = 1000, Rcpp::Named("initial") = 0);
+		unsigned long long nEstimatedValues = estimatedTiles.getNValues();
+		updateProgress = [barHandle,nEstimatedValues,setTxtProgressBar](unsigned long long value)
 			{
-				throw std::runtime_error("An entry of input lineWeights had the wrong length");
-			}
-		}
-		//Construct vector of rfhaps_internal_args objects
-		triangularIterator startPosition(markerRows, markerColumns);
-		std::vector<rfhaps_internal_args> internalArgumentObjects;
-		for(int i = 0; i < nDesigns; i++)
+				try
+				{
+#ifdef CUSTOM_STATIC_RCPP
+					setTxtProgressBar.topLevelExec(barHandle, (int)((double)(1000*value) / (double)nEstimatedValues));
+#else
+					setTxtProgressBar(barHandle, (int)((double)(1000*value) / (double)nEstimatedValues));
+#endif
+				}
+				catch(...)
+				{
+				}
+			};
+	}
+	std::vector<triangularTiles::tile> allTiles;
+	estimatedTiles.getTiles(0, estimatedTiles.getNValues(), allTiles);
+	int nTiles = (int)allTiles.size();
+	const bool sortedRows = estimatedTiles.hasSortedRows();
+	unsigned long long progressCounter = 0, screenedCounter = 0;
+	//An exception can't leave a parallel region, so the first exception is stored and rethrown after the region. Exceptions from computing the lookup tables are kept by the tables.
+	std::atomic<bool> failed(false);
+	std::exception_ptr tileException;
+#ifdef USE_OPENMP
+	#pragma omp parallel
+#endif
+	{
+		//The log likelihood curve for the current pair, summed over designs. This is the only working memory that depends on the number of recombination levels.
+		std::vector<double> curve(nRecombLevels);
+		//For the coarse to fine search, the levels refined around the best coarse level, and all the levels evaluated for the current pair in increasing order.
+		std::vector<int> fineLevels, evaluatedLevels;
+		//Tiles vary a lot in how much work they contain (tiles on the diagonal are half empty) so they're handed out one at a time.
+#ifdef USE_OPENMP
+		#pragma omp for schedule(dynamic, 1)
+#endif
+		for(int tileCounter = 0; tileCounter < nTiles; tileCounter++)
 		{
-			Rcpp::S4 currentGeneticData = geneticData(i);
-			std::vector<double> lineWeightsThisDesign = Rcpp::as<std::vector<double> >(lineWeights[i]);
-			std::string error;
-			estimateRFSpecificDesignArgs args(recombinationFractionsDouble);
+			//Once a tile has failed the remaining tiles are skipped
+			if(failed) continue;
 			try
 			{
-				args.founders = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("founders"));
-			}
-			catch(...)
-			{
-				std::stringstream ss; 
-				ss << "Founders slot of design " << i << " was not an integer matrix";
-				throw std::runtime_error(ss.str().c_str());
+				const triangularTiles::tile& currentTile = allTiles[tileCounter];
+				unsigned long long valuesInTile = 0, screenedInTile = 0;
+				for(int columnPosition = currentTile.columnStart; columnPosition < currentTile.columnEnd; columnPosition++)
+				{
+					int markerColumn = estimatedColumns[columnPosition];
+					//If the rows are sorted, every row before the start of the tile is also valid for this column. If they're not, the tile starts at the first row.
+					unsigned long long index = estimatedTiles.columnOffset(columnPosition) + currentTile.rowStart;
+					for(int rowPosition = currentTile.rowStart; rowPosition < currentTile.rowEnd; rowPosition++)
+					{
+						int markerRow = estimatedRows[rowPosition];
+						if(markerRow > markerColumn)
+						{
+							if(sortedRows) break;
+							continue;
+						}
+						std::fill(curve.begin(), curve.end(), 0);
+						for(int i = 0; i < nDesigns; i++)
+						{
+							likelihoods[i]->preparePair(markerRow, markerColumn);
+						}
+						//A pair is screened out if the joint allele counts show almost no association, in which case only the likelihood at 0.5 is computed.
+						bool screened = false;
+						if(screenThreshold > 0)
+						{
+							double statistic = 0;
+							for(int i = 0; i < nDesigns; i++) statistic += likelihoods[i]->associationStatistic();
+							screened = statistic < screenThreshold;
+						}
+						if(screened)
+						{
+							for(int i = 0; i < nDesigns; i++)
+							{
+								likelihoods[i]->addLikelihood(&halfIndex, 1, &(curve[0]));
+							}
+							evaluatedLevels.assign(1, halfIndex);
+							screenedInTile++;
+						}
+						else if(coarseToFine)
+						{
+							for(int i = 0; i < nDesigns; i++)
+							{
+								likelihoods[i]->addLikelihood(&(coarseLevels[0]), nCoarseLevels, &(curve[0]));
+							}
+							//Ties go to the smallest level, as for std::max_element
+							int bestCoarse = 0;
+							for(int coarseCounter = 1; coarseCounter < nCoarseLevels; coarseCounter++)
+							{
+								if(curve[coarseLevels[coarseCounter]] > curve[coarseLevels[bestCoarse]]) bestCoarse = coarseCounter;
+							}
+							int lower = bestCoarse > 0 ? coarseLevels[bestCoarse - 1] + 1 : 0;
+							int upper = bestCoarse < nCoarseLevels - 1 ? coarseLevels[bestCoarse + 1] : (int)nRecombLevels;
+							fineLevels.clear();
+							for(int level = lower; level < upper; level++)
+							{
+								if(level != coarseLevels[bestCoarse]) fineLevels.push_back(level);
+							}
+							if(fineLevels.size() > 0)
+							{
+								for(int i = 0; i < nDesigns; i++)
+								{
+									likelihoods[i]->addLikelihood(&(fineLevels[0]), (int)fineLevels.size(), &(curve[0]));
+								}
+							}
+							evaluatedLevels.assign(coarseLevels.begin(), coarseLevels.end());
+							evaluatedLevels.insert(evaluatedLevels.end(), fineLevels.begin(), fineLevels.end());
+							std::sort(evaluatedLevels.begin(), evaluatedLevels.end());
+						}
+						else
+						{
+							for(int i = 0; i < nDesigns; i++)
+							{
+								likelihoods[i]->addLikelihood(&(curve[0]));
+							}
+						}
+						R_xlen_t position;
+						if(estimatedDestination.packed) position = ((R_xlen_t)markerColumn * ((R_xlen_t)markerColumn + (R_xlen_t)1))/(R_xlen_t)2 + (R_xlen_t)markerRow;
+						else position = (R_xlen_t)index;
+						//The log likelihood is a sum over lines, so the curve for additional lines can be added to the stored curve.
+						if(estimatedDestination.curves)
+						{
+							double* storedCurve = estimatedDestination.curves + position * nRecombLevels;
+							if(estimatedDestination.accumulateCurves)
+							{
+								for(R_xlen_t recombCounter = 0; recombCounter < nRecombLevels; recombCounter++) curve[recombCounter] += storedCurve[recombCounter];
+							}
+							std::copy(curve.begin(), curve.end(), storedCurve);
+						}
+						//now for some post-processing to get out the MLE, lod (maybe) and lkhd (maybe)
+						int maxLevel;
+						double max, min;
+						if(coarseToFine || screened)
+						{
+							//Only the evaluated levels are considered. The others are still zero.
+							maxLevel = evaluatedLevels[0];
+							min = curve[maxLevel];
+							for(std::vector<int>::iterator level = evaluatedLevels.begin(); level != evaluatedLevels.end(); level++)
+							{
+								if(curve[*level] > curve[maxLevel]) maxLevel = *level;
+								min = std::min(min, curve[*level]);
+							}
+						}
+						else
+						{
+							maxLevel = (int)std::distance(curve.begin(), std::max_element(curve.begin(), curve.end()));
+							min = *std::min_element(curve.begin(), curve.end());
+						}
+						max = curve[maxLevel];
+						int currentTheta;
+						double currentLod;
+						//This is the case where no data was available, across any of the experiments. This is precise, no numerical error involved
+						if(max == 0 && min == 0)
+						{
+							max = currentLod = std::numeric_limits<double>::quiet_NaN();
+							currentTheta = 0xff;
+						}
+						else
+						{
+							currentTheta = maxLevel;
+							currentLod = max - curve[halfIndex];
+						}
+						estimatedDestination.theta[position] = (Rbyte)currentTheta;
+						if(estimatedDestination.lkhd) estimatedDestination.lkhd[position] = max;
+						if(estimatedDestination.lod) estimatedDestination.lod[position] = currentLod;
+						else if(estimatedDestination.lodCodes) estimatedDestination.lodCodes[position] = encodeLod(currentLod, estimatedDestination.lodScale);
+						index++;
+						valuesInTile++;
+					}
+				}
+#ifdef USE_OPENMP
+				#pragma omp critical
+#endif
+				{
+					progressCounter += valuesInTile;
+					screenedCounter += screenedInTile;
+				}
+#ifdef USE_OPENMP
+				if(omp_get_thread_num() == 0)
+#endif
+				{
+					updateProgress(progressCounter);
+				}
 			}
-			try
+			catch(allMarkerPairData::computeFailed&)
 			{
-				args.finals = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("finals"));
+				//The original exception is kept by the lookup table, and rethrown after the parallel region
+				failed = true;
 			}
 			catch(...)
 			{
-				std::stringstream ss; 
-				ss << "Finals slot of design " << i << " was not an integer matrix";
-				throw std::runtime_error(ss.str().c_str());
-			}
-			try
-			{
-				args.pedigree = Rcpp::as<Rcpp::S4>(currentGeneticData.slot("pedigree"));
+#ifdef USE_OPENMP
+				#pragma omp critical (estimateRFFailure)
+#endif
+				if(!tileException) tileException = std::current_exception();
+				failed = true;
 			}
-			catch(...)
+		}
+	}
+	if(verbose)
+	{
+		close(barHandle);
+	}
+	for(int i = 0; i < nDesigns; i++)
+	{
+		likelihoods[i]->rethrowLookupFailure();
+	}
+	if(tileException) std::rethrow_exception(tileException);
+	//Copy the estimates for the distinct markers to every pair. The markers are increasing, so the index of the pair at positions (row, column) in the triangle of distinct markers is column*(column+1)/2 + row.
+	if(deduplicated)
+	{
+		int nPositions = (int)markerRows.size();
+#ifdef USE_OPENMP
+		#pragma omp parallel for schedule(dynamic, 1)
+#endif
+		for(int columnPosition = 0; columnPosition < nPositions; columnPosition++)
+		{
+			int markerColumn = markerColumns[columnPosition];
+			for(int rowPosition = 0; rowPosition <= columnPosition; rowPosition++)
 			{
-				std::stringstream ss; 
-				ss << "Pedigree slot of design " << i << " was not an S4 object";
-				throw std::runtime_error(ss.str().c_str());
+				int markerRow = markerRows[rowPosition];
+				R_xlen_t distinctRow = distinctPositions[rowPosition], distinctColumn = distinctPositions[columnPosition];
+				if(distinctRow > distinctColumn) std::swap(distinctRow, distinctColumn);
+				R_xlen_t distinctIndex = (distinctColumn * (distinctColumn + (R_xlen_t)1))/(R_xlen_t)2 + distinctRow;
+				R_xlen_t position;
+				if(destination.packed) position = ((R_xlen_t)markerColumn * ((R_xlen_t)markerColumn + (R_xlen_t)1))/(R_xlen_t)2 + (R_xlen_t)markerRow;
+				else position = (R_xlen_t)(tiles.columnOffset(columnPosition) + rowPosition);
+				destination.theta[position] = distinctTheta[distinctIndex];
+				if(destination.lkhd) destination.lkhd[position] = distinctLkhd[distinctIndex];
+				if(destination.lod) destination.lod[position] = distinctLod[distinctIndex];
+				else if(destination.lodCodes) destination.lodCodes[position] = encodeLod(distinctLod[distinctIndex], destination.lodScale);
 			}
+		}
+	}
+	if(screenThreshold > 0 && verbose)
+	{
+		Rcpp::Rcout << screenedCounter << " of " << estimatedTiles.getNValues() << " marker pairs were screened out as unlinked" << std::endl;
+	}
+}
+SEXP estimateRF(SEXP object_, SEXP recombinationFractions_, SEXP markerRows_, SEXP markerColumns_, SEXP lineWeights_, SEXP keepLod_, SEXP keepLkhd_, SEXP gbLimit_, SEXP verbose_, SEXP lodScale_, SEXP coarseToFine_, SEXP screenThreshold_)
+{
+	BEGIN_RCPP
+		Rcpp::RawVector theta, lodCodes;
+		Rcpp::NumericVector lod, lkhd;
+		bool keepLod = false, keepLkhd = false;
+		//If a scale is given, the lod values are returned as 16-bit codes
+		bool compactLod = !Rf_isNull(lodScale_);
+		double lodScale = 0;
+		if(compactLod)
+		{
 			try
 			{
-				args.hetData = Rcpp::as<Rcpp::S4>(currentGeneticData.slot("hetData"));
+				lodScale = Rcpp::as<double>(lodScale_);
 			}
 			catch(...)
 			{
-				std::stringstream ss; 
-				ss << "hetData slot of design " << i << " was not an S4 object";
-				throw std::runtime_error(ss.str().c_str());
+				throw Rcpp::not_compatible("Input lodScale must be NULL or a single numeric value");
 			}
-			//This has to be copied / swapped in, because it's a local temporary at the moment
-			args.lineWeights.swap(lineWeightsThisDesign);
-			rfhaps_internal_args internalArgs(args.recombinationFractions, startPosition);
-			bool converted = toInternalArgs(std::move(args), internalArgs, error);
-			if(!converted)
-			{
-				std::stringstream ss;
-				ss << "Error pre-processing data for dataset " << i << ": " << error;
-				throw std::runtime_error(ss.str().c_str());
-			}
-			internalArgumentObjects.emplace_back(std::move(internalArgs));
+			if(!(lodScale > 0)) throw std::runtime_error("Input lodScale must be positive");
 		}
-		//Estimate required memory usage
-		signed long long lookupBytes = 0;
-		for(int i = 0; i < nDesigns; i++)
+		estimateRFInternal(object_, recombinationFractions_, markerRows_, markerColumns_, lineWeights_, keepLod_, keepLkhd_, gbLimit_, verbose_, coarseToFine_, screenThreshold_, true, [&](const triangularTiles& tiles, bool keepLodValue, bool keepLkhdValue)
+			{
+				estimateRFDestination destination;
+				R_xlen_t nValuesToEstimate = (R_xlen_t)tiles.getNValues();
+				keepLod = keepLodValue;
+				keepLkhd = keepLkhdValue;
+				theta = Rcpp::RawVector(nValuesToEstimate);
+				destination.theta = &(theta[0]);
+				if(keepLod && compactLod)
+				{
+					lodCodes = Rcpp::RawVector(nValuesToEstimate * sizeof(lodCode));
+					destination.lodCodes = (lodCode*)lodCodes.begin();
+					destination.lodScale = lodScale;
+				}
+				else if(keepLod)
+				{
+					lod = Rcpp::NumericVector(nValuesToEstimate);
+					destination.lod = &(lod[0]);
+				}
+				if(keepLkhd)
+				{
+					lkhd = Rcpp::NumericVector(nValuesToEstimate);
+					destination.lkhd = &(lkhd[0]);
+				}
+				return destination;
+			});
+		Rcpp::RObject lodRet, lkhdRet;
+		
+		if(keepLod && compactLod) lodRet = lodCodes;
+		else if(keepLod) lodRet = lod;
+		else lodRet = R_NilValue;
+
+		if(keepLkhd) lkhdRet = lkhd;
+		else lkhdRet = R_NilValue;
+
+		return Rcpp::List::create(Rcpp::Named("theta") = theta, Rcpp::Named("lod") = lodRet, Rcpp::Named("lkhd") = lkhdRet, Rcpp::Named("r") = Rcpp::NumericVector(recombinationFractions_));
+	END_RCPP
+}
+SEXP estimateRFAssign(SEXP object_, SEXP recombinationFractions_, SEXP markerRows_, SEXP markerColumns_, SEXP lineWeights_, SEXP theta_, SEXP lod_, SEXP lkhd_, SEXP verbose_, SEXP curves_, SEXP accumulateCurves_, SEXP coarseToFine_, SEXP screenThreshold_)
+{
+	BEGIN_RCPP
+		Rcpp::S4 theta;
+		try
 		{
-			unsigned long long currentLookupBytes = estimateLookup(internalArgumentObjects[i]);
-			lookupBytes += currentLookupBytes;
+			theta = theta_;
 		}
-		//Output a message giving the allocation size, if either it's more than a gb, or the verbose option is specified
-		if(lookupBytes > 1000000000 || verbose)
+		catch(...)
 		{
-			Rcpp::Rcout << "Total lookup table size of " << lookupBytes << " bytes" << std::endl;
+			throw Rcpp::not_compatible("Input theta must be a rawSymmetricMatrix");
 		}
-		Rcpp::NumericVector lod, lkhd;
-		Rcpp::RawVector theta(nValuesToEstimate);
-		if(keepLod) lod = Rcpp::NumericVector(nValuesToEstimate);
-		if(keepLkhd) lkhd = Rcpp::NumericVector(nValuesToEstimate);
-		double* resultPtr = &(result[0]);
+		//The destination can be held in memory or in a file.
+		rawSymmetricMatrixData thetaView(theta, true);
+		Rcpp::NumericVector levels = theta.slot("levels");
+		Rcpp::CharacterVector markers = theta.slot("markers");
+		R_xlen_t nMarkers = markers.size();
+		R_xlen_t packedSize = (nMarkers * (nMarkers + (R_xlen_t)1)) / (R_xlen_t)2;
+		if(thetaView.getNValues() != packedSize) throw std::runtime_error("Input theta had the wrong number of values");
 
-		Rcpp::Function txtProgressBar("txtProgressBar");
-		Rcpp::Function setTxtProgressBar("setTxtProgressBar");
-		Rcpp::Function close("close");
-		Rcpp::RObject barHandle;
-		std::function<void(unsigned long long)> updateProgress = [](unsigned long long){};
-		if(verbose)
+		bool keepLod = !Rf_isNull(lod_), keepLkhd = !Rf_isNull(lkhd_);
+		std::unique_ptr<dspMatrixData> lodView, lkhdView;
+		if(keepLod)
 		{
-			barHandle = txtProgressBar(Rcpp::Named("style") = progressStyle, Rcpp::Named("min") = 0, Rcpp::Named("max") = 1000, Rcpp::Named("initial") = 0);
-			updateProgress = [barHandle,nDesigns,nValuesToEstimate,setTxtProgressBar](unsigned long long value)
-				{
-					try
-					{
-#ifdef CUSTOM_STATIC_RCPP
-						setTxtProgressBar.topLevelExec(barHandle, (int)((double)(1000*value) / (double)(nDesigns*nValuesToEstimate)));
-#else
-						setTxtProgressBar(barHandle, (int)((double)(1000*value) / (double)(nDesigns*nValuesToEstimate)));
-#endif
-					}
-					catch(...)
-					{
-					}
-				};
+			lodView.reset(new dspMatrixData(Rcpp::S4(lod_), true));
+			if(lodView->getNValues() != packedSize) throw std::runtime_error("Input lod had the wrong number of values");
 		}
-		unsigned long long counter = 0;
-		for(R_xlen_t offset = 0; offset < nValuesToEstimate; offset += valuesToEstimateInChunk)
+		if(keepLkhd)
 		{
-			R_xlen_t valuesToEstimateInCurrentChunk = std::min(valuesToEstimateInChunk, nValuesToEstimate - offset);
-			if(offset != 0) memset(resultPtr, 0, result.size() * sizeof(double));
-			//Now the actual computation)
-			for(int i = 0; i < nDesigns; i++)
+			lkhdView.reset(new dspMatrixData(Rcpp::S4(lkhd_), true));
+			if(lkhdView->getNValues() != packedSize) throw std::runtime_error("Input lkhd had the wrong number of values");
+		}
+		std::unique_ptr<packedTriangleFile> curvesFile;
+		bool accumulateCurves = false;
+		if(!Rf_isNull(curves_))
+		{
+			std::string curvesPath;
+			try
 			{
-				internalArgumentObjects[i].result = resultPtr;
-				internalArgumentObjects[i].valuesToEstimateInChunk = valuesToEstimateInCurrentChunk;
-				internalArgumentObjects[i].startPosition = startPosition;
-				internalArgumentObjects[i].updateProgress = updateProgress;
-				std::string error;
-				bool successful = estimateRFSpecificDesign(internalArgumentObjects[i], counter);
-				if(!successful) throw std::runtime_error("Internal error");
+				curvesPath = Rcpp::as<std::string>(Rcpp::S4(curves_).slot("file"));
+				accumulateCurves = Rcpp::as<bool>(accumulateCurves_);
 			}
-			//now for some post-processing to get out the MLE, lod (maybe) and lkhd (maybe)
-			R_xlen_t endValue = std::min(nValuesToEstimate, offset + valuesToEstimateInCurrentChunk);
-			for(R_xlen_t counter = offset; counter < endValue; counter++)
+			catch(...)
+			{
+				throw std::runtime_error("Input curves must be NULL or an rfCurveFile object, and accumulateCurves must be a boolean");
+			}
+			curvesFile.reset(new packedTriangleFile(curvesPath, true));
+			if(curvesFile->getType() != packedTriangleFile::curveValues) throw std::runtime_error("File for an rfCurveFile object must contain curves");
+			if((R_xlen_t)curvesFile->getMarkers().size() != nMarkers) throw std::runtime_error("Input curves had the wrong number of markers");
+			const std::vector<double>& curveLevels = curvesFile->getLevels();
+			if(curveLevels.size() != (std::size_t)levels.size() || !std::equal(curveLevels.begin(), curveLevels.end(), levels.begin())) throw std::runtime_error("Input curves used different recombination fractions");
+		}
+		estimateRFInternal(object_, recombinationFractions_, markerRows_, markerColumns_, lineWeights_, Rcpp::wrap(keepLod), Rcpp::wrap(keepLkhd), Rcpp::wrap(-1.0), verbose_, coarseToFine_, screenThreshold_, !curvesFile, [&](const triangularTiles& tiles, bool, bool)
 			{
-				double* start = resultPtr + (counter - offset) * nRecombLevels;
-				double* end = resultPtr + (counter - offset + 1) * nRecombLevels;
-				double* maxPtr = std::max_element(start, end), *minPtr = std::min_element(start, end);
-				double max = *maxPtr, min = *minPtr;
-				int currentTheta;
-				double currentLod;
-				//This is the case where no data was available, across any of the experiments. This is precise, no numerical error involved
-				if(max == 0 && min == 0)
+				Rcpp::NumericVector recombinationFractions = recombinationFractions_;
+				if(levels.size() != recombinationFractions.size() || !std::equal(levels.begin(), levels.end(), recombinationFractions.begin()))
 				{
-					max = currentLod = std::numeric_limits<double>::quiet_NaN();
-					currentTheta = 0xff;
+					throw std::runtime_error("Input theta used different recombination fractions");
 				}
-				else
+				if(*std::max_element(tiles.getMarkerRows().begin(), tiles.getMarkerRows().end()) >= nMarkers || *std::max_element(tiles.getMarkerColumns().begin(), tiles.getMarkerColumns().end()) >= nMarkers)
 				{
-					currentTheta = (int)(maxPtr - start);
-					currentLod = max - resultPtr[(counter - offset)* (std::ptrdiff_t)nRecombLevels + halfIndex];
+					throw std::runtime_error("Input markerRows and markerColumns must be indices of markers in theta");
 				}
-				theta(counter) = currentTheta;
-				if(keepLkhd) lkhd(counter) = max;
-				if(keepLod) lod(counter) = currentLod;
-			}
-			while(valuesToEstimateInCurrentChunk > 0)
-			{
-				startPosition.next();
-				valuesToEstimateInCurrentChunk--;
-			}
-		}
-		if(verbose)
-		{
-			close(barHandle);
-		}
-		Rcpp::RObject lodRet, lkhdRet;
-		
-		if(keepLod) lodRet = lod;
-		else lodRet = R_NilValue;
-
-		if(keepLkhd) lkhdRet = lkhd;
-		else lkhdRet = R_NilValue;
-
-		return Rcpp::List::create(Rcpp::Named("theta") = theta, Rcpp::Named("lod") = lodRet, Rcpp::Named("lkhd") = lkhdRet, Rcpp::Named("r") = recombinationFractions);
+				estimateRFDestination destination;
+				destination.packed = true;
+				destination.theta = thetaView.getData();
+				if(keepLod)
+				{
+					destination.lod = lodView->getData();
+					destination.lodCodes = lodView->getCodes();
+					destination.lodScale = lodView->getScale();
+				}
+				destination.lkhd = keepLkhd ? lkhdView->getData() : NULL;
+				if(curvesFile)
+				{
+					destination.curves = (double*)curvesFile->getData();
+					destination.accumulateCurves = accumulateCurves;
+				}
+				return destination;
+			});
+		return R_NilValue;
 	END_RCPP
 }
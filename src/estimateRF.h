@@ -1,9 +1,10 @@
 #ifndef _RFHAPS_H
 #define _RFHAPS_H
 #include <Rcpp.h>
+#include "unitTypes.hpp"
 struct funnelType
 {
-	int val[16];
+	int val[funnelEncoding::maxFounders];
 };
 /** Estimate pairwise recombination fractions
   * 
@@ -14,10 +15,25 @@ struct funnelType
   * @param markerColumns The columns of markers (as a pair of indices) which we wish to consider
   * @param lineWeights The line weights, in case we wish to correct for some kind of distortion
   * @param keepLod Boolean telling whether or not to return the likelihood ratio statistic for testing the estimated value being different from 0.
-  * @param gbLimit The number of gigabytes to use for the results matrix. A value of negative 1 indicates no limit.
+  * @param gbLimit Retained for compatibility. The results are reduced as they are computed, so the working memory no longer depends on this value.
   * @param keepLkhd Boolean telling whether or not to return the maximum likelihood value
   * @param verbose Boolean telling whether or not to output diagnostic and progress information
+  * @param lodScale NULL, or the scale with which to encode the likelihood ratio statistics as 16-bit codes (see compactLod.h). In the second case the statistics are returned as a raw vector of codes.
+  * @param coarseToFine Boolean telling whether to evaluate the likelihood on a coarse subset of recombinationFractions, and then only around the best coarse value. This is faster when there are many recombination fractions, and gives the same estimates unless the likelihood has more than one local maximum.
+  * @param screenThreshold Pairs for which the log likelihood ratio for association of the joint allele counts (against independence) is less than this value are assumed to be unlinked, and are given an estimate of 0.5 and a lod of 0 without evaluating the full likelihood. Zero disables the screening.
   * @return A list returning the specified data. In the case of theta, the values are returned as a raw vector. Each entry is an index into the possible recombination fractions. This saves us a factor of 8 in terms of memory usage. The raw vector is indexed column-major, but only contains the values for the upper triangular part of the matrix. 
  **/
-SEXP estimateRF(SEXP object, SEXP recombinationFractions, SEXP markerRows, SEXP markerColumns, SEXP lineWeights, SEXP keepLod, SEXP keepLkhd, SEXP gbLimit, SEXP verbose);
+SEXP estimateRF(SEXP object, SEXP recombinationFractions, SEXP markerRows, SEXP markerColumns, SEXP lineWeights, SEXP keepLod, SEXP keepLkhd, SEXP gbLimit, SEXP verbose, SEXP lodScale, SEXP coarseToFine, SEXP screenThreshold);
+/** Estimate pairwise recombination fractions, writing them into existing matrices
+  *
+  * As for estimateRF, except that the results are written directly into the packed data of existing objects, at the position of each marker pair. The marker indices in markerRows and markerColumns are indices into the markers of theta. No other memory is allocated for the results.
+  * @param theta A rawSymmetricMatrix object, which is modified
+  * @param lod A dspMatrix or compactLodMatrix object, which is modified, or NULL
+  * @param lkhd A dspMatrix object, which is modified, or NULL
+  * @param curves An rfCurveFile object, to which the log likelihood curve for every marker pair is written, or NULL
+  * @param accumulateCurves If true, the curves already in the file are added to the curves for the input object, and the estimates are computed from the sums. This allows new lines to be added without re-estimating the existing lines.
+  * @param coarseToFine As for estimateRF. Must be false if curves is not NULL.
+  * @param screenThreshold As for estimateRF. Must be zero if curves is not NULL.
+ **/
+SEXP estimateRFAssign(SEXP object, SEXP recombinationFractions, SEXP markerRows, SEXP markerColumns, SEXP lineWeights, SEXP theta, SEXP lod, SEXP lkhd, SEXP verbose, SEXP curves, SEXP accumulateCurves, SEXP coarseToFine, SEXP screenThreshold);
 #endif
@@ -4,6 +4,7 @@
 #include "orderFunnel.h"
 #include "matrices.hpp"
 #include "sortPedigreeLineNames.h"
+#include "genericFunnelProbabilities.h"
 void getAICParentLines(Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father, long pedigreeRow, int intercrossingGenerations, std::vector<long>& individualsToCheckFunnels)
 {
 	//The lines that we currently need to check goes in individualsToCheckFunnels
@@ -35,7 +36,7 @@ void getAICParentLines(Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father,
 }
 /* This function specifically checks whether the observed data is consistent with the *pedigree*. It assumes that every observed value in the finals is already valid - That is, every observed value contained in the finals is also listed as a possibility in the hetData object
 */
-void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix founders, Rcpp::List hetData, Rcpp::S4 pedigree, std::vector<int>& intercrossingGenerations, std::vector<std::string>& warnings, std::vector<std::string>& errors, std::vector<funnelType>& allFunnels, std::vector<funnelType>& lineFunnels)
+void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix founders, Rcpp::List hetData, Rcpp::S4 pedigree, std::vector<int>& intercrossingGenerations, std::vector<std::string>& warnings, std::vector<std::string>& errors, std::vector<funnelType>& allFunnels, std::vector<funnelType>& lineFunnels, std::vector<int>& funnelShape)
 {
 	Rcpp::CharacterVector pedigreeLineNames = Rcpp::as<Rcpp::CharacterVector>(pedigree.slot("lineNames"));
 
@@ -51,10 +52,14 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 	Rcpp::CharacterVector markerNames = Rcpp::as<Rcpp::CharacterVector>(Rcpp::as<Rcpp::List>(finals.attr("dimnames"))[1]);
 	int nFinals = finals.nrow(), nFounders = founders.nrow(), nMarkers = finals.ncol();
 
-	if(nFounders != 2 && nFounders != 4 && nFounders != 8 && nFounders != 16)
+	if(nFounders < 2 || nFounders > funnelEncoding::maxFounders)
 	{
-		throw std::runtime_error("Number of founders must be 2, 4, 8, or 16");
+		throw std::runtime_error("Number of founders must be between 2 and 64");
 	}
+	//Other numbers of founders than 2, 4, 8 and 16 can have funnels of any shape, as long as every funnel has the same shape
+	bool genericFunnels = usesGenericFunnelProbabilities(nFounders);
+	funnelShape.clear();
+	std::vector<int> currentFunnelShape;
 
 	xMajorMatrix<int> foundersToMarkerAlleles(nFounders, nFounders, nMarkers, -1);
 	for(int markerCounter = 0; markerCounter < nMarkers; markerCounter++)
@@ -96,6 +101,13 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 		{
 			individualsToCheckFunnels.push_back(pedigreeRow);
 		}
+		else if(genericFunnels)
+		{
+			std::stringstream ss;
+			ss << "Line " << finalNames(finalCounter) << " has generations of intercrossing, which are only supported for 2, 4, 8 or 16 founders";
+			errors.push_back(ss.str());
+			goto nextLine;
+		}
 		else
 		{
 			try
@@ -111,13 +123,14 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 			}
 		}
 		//Now we know the lines for which we need to check the funnels from the pedigree (note: We don't necessarily have genotype data for all of these, it's purely a pedigree check)
-		//Fixed length arrays to store funnels. If we have less than 16 founders then part of this is garbage and we don't use that bit....
+		//Fixed length arrays to store funnels. If we have less than 64 founders then part of this is garbage and we don't use that bit....
 		funnelType funnel, copiedFunnel;
 		for(std::vector<long>::iterator i = individualsToCheckFunnels.begin(); i != individualsToCheckFunnels.end(); i++)
 		{
 			try
 			{
-				getFunnel(*i, mother, father, &(funnel.val[0]), nFounders);
+				if(genericFunnels) getFunnel(*i, mother, father, &(funnel.val[0]), nFounders, currentFunnelShape);
+				else getFunnel(*i, mother, father, &(funnel.val[0]), nFounders);
 			}
 			catch(...)
 			{
@@ -126,6 +139,20 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 				errors.push_back(ss.str());
 				goto nextLine;
 			}
+			if(genericFunnels)
+			{
+				if(funnelShape.size() == 0)
+				{
+					funnelShape = currentFunnelShape;
+				}
+				else if(currentFunnelShape != funnelShape)
+				{
+					std::stringstream ss;
+					ss << "Funnel for line " << pedigreeLineNames(*i) << " had a different shape to the funnels of the other lines. Every funnel must have the same shape, unless there are 2, 4, 8 or 16 founders";
+					errors.push_back(ss.str());
+					goto nextLine;
+				}
+			}
 			//insert these founders into the vector containing all the represented founders
 			representedFounders.insert(representedFounders.end(), &(funnel.val[0]), &(funnel.val[0]) + nFounders);
 			//Copy the funnel 
@@ -138,22 +165,8 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 				{
 					std::stringstream ss;
 					ss << "Funnel for line " << pedigreeLineNames(*i) << " contained founders {" << funnel.val[0];
-					if(nFounders == 2)
-					{
-						ss << ", " << funnel.val[1] << "}";
-					}
-					else if(nFounders == 4)
-					{
-						ss << ", " << funnel.val[1] << ", " << funnel.val[2] << ", " << funnel.val[3] << "}";
-					}
-					else if(nFounders == 8)
-					{
-						ss << ", " << funnel.val[1] << ", " << funnel.val[2] << ", " << funnel.val[3] << ", " << funnel.val[4] << ", " << funnel.val[5] << ", " << funnel.val[6] << ", " << funnel.val[7]<< "}";
-					}
-					else if (nFounders == 16)
-					{
-						ss << ", " << funnel.val[1] << ", " << funnel.val[2] << ", " << funnel.val[3] << ", " << funnel.val[4] << ", " << funnel.val[5] << ", " << funnel.val[6] << ", " << funnel.val[7] << ", " << funnel.val[8] << ", " << funnel.val[9] << ", " << funnel.val[10] << ", " << funnel.val[11] << ", " << funnel.val[12] << ", " << funnel.val[13] << ", " << funnel.val[14] << ", " << funnel.val[15] << "}";
-					}
+					for(int founderCounter = 1; founderCounter < nFounders; founderCounter++) ss << ", " << funnel.val[founderCounter];
+					ss << "}";
 					//In this case it's an error
 					if(intercrossingGenerations[finalCounter] != 0)
 					{
@@ -216,13 +229,14 @@ void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix foun
 		//In this case individualsToCheckFunnels contains one element => getFunnel was only called once => we can reuse the funnel variable
 		if(intercrossingGenerations[finalCounter] == 0)
 		{
-			orderFunnel(&(funnel.val[0]), nFounders);
+			//getFunnel already puts the funnels of any shape in canonical order
+			if(!genericFunnels) orderFunnel(&(funnel.val[0]), nFounders);
 			lineFunnels.push_back(funnel);
 		}
 		else
 		{
 			//Add a dummy value in lineFunnel
-			for(int i = 0; i < 16; i++) funnel.val[i] = 0;
+			for(int i = 0; i < funnelEncoding::maxFounders; i++) funnel.val[i] = 0;
 			lineFunnels.push_back(funnel);
 		}
 	nextLine:
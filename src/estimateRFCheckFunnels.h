@@ -4,5 +4,9 @@
 #include <vector>
 #include <string>
 #include "estimateRF.h"
-void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix founders, Rcpp::List hetData, Rcpp::S4 pedigree, std::vector<int>& intercrossingGenerations, std::vector<std::string>& warnings, std::vector<std::string>& errors, std::vector<funnelType>& allFunnels, std::vector<funnelType>& lineFunnels);
+/*
+ * Check that the pedigree gives a proper funnel for every line, and that the observed data is consistent with the funnels. 
+ * For other numbers of founders than 2, 4, 8 and 16 the funnels can have any shape (see getFunnel), as long as every funnel has the same shape, which is returned in funnelShape. Otherwise funnelShape is empty. 
+ */
+void estimateRFCheckFunnels(Rcpp::IntegerMatrix finals, Rcpp::IntegerMatrix founders, Rcpp::List hetData, Rcpp::S4 pedigree, std::vector<int>& intercrossingGenerations, std::vector<std::string>& warnings, std::vector<std::string>& errors, std::vector<funnelType>& allFunnels, std::vector<funnelType>& lineFunnels, std::vector<int>& funnelShape);
 #endif
@@ -15,412 +15,541 @@
 #include "recodeHetsAsNA.h"
 #include "estimateRF.h"
 #include "matrixChunks.h"
+#include "markerBitPlanes.h"
+#include "lookupTableCache.h"
 #ifdef USE_OPENMP
 #include "mpMap2_openmp.h"
 #include <omp.h>
 #endif
-template<int nFounders, int maxAlleles, bool infiniteSelfing> bool estimateRFSpecificDesign(rfhaps_internal_args& args, unsigned long long& progressCounter)
+//One non-zero entry of the joint count table for a marker pair, together with the lookup table values it multiplies. 
+struct pairContribution
 {
-	std::size_t nFinals = args.finals.nrow(), nRecombLevels = args.recombinationFractions.size();
-	std::vector<double>& lineWeights = args.lineWeights;
-	Rcpp::List finalDimNames = args.finals.attr("dimnames");
-	Rcpp::CharacterVector finalNames = finalDimNames[0];
-
-	int nMarkerPatternIDs = (int)args.markerPatternData.allMarkerPatterns.size();
-	int minSelfing = *std::min_element(args.selfingGenerations.begin(), args.selfingGenerations.end());
-
+	pairContribution(const double* values, double weight)
+		: values(values), weight(weight)
+	{}
+	//Values for every recombination level, which are contiguous.
+	const double* values;
+	double weight;
+};
+//Add the contributions for a single marker pair to the output, for every recombination level. 
+void addPairContributions(const std::vector<pairContribution>& contributions, int nRecombLevels, std::vector<double>& working, double* result)
+{
+	std::fill(working.begin(), working.end(), 0);
+	for(std::vector<pairContribution>::const_iterator contribution = contributions.begin(); contribution != contributions.end(); contribution++)
+	{
+		const double* values = contribution->values;
+		double weight = contribution->weight;
+		for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+		{
+			working[recombCounter] += weight * values[recombCounter];
+		}
+	}
+	for(int recombCounter = 0; recombCounter < nRecombLevels; recombCounter++)
+	{
+		//We get an NA from trying to take the logarithm of zero - That is, this parameter is completely impossible for the given data, so put in -Inf
+		if(working[recombCounter] != working[recombCounter] || working[recombCounter] == -std::numeric_limits<double>::infinity()) result[recombCounter] = -std::numeric_limits<double>::infinity();
+		else result[recombCounter] += working[recombCounter];
+	}
+}
+//Add the contributions for a single marker pair to the output, for only the given recombination levels. The values at each level are summed in the same order as addPairContributions, so the results are identical.
+void addPairContributions(const std::vector<pairContribution>& contributions, const int* levels, int nLevels, double* result)
+{
+	for(int levelCounter = 0; levelCounter < nLevels; levelCounter++)
+	{
+		int level = levels[levelCounter];
+		double sum = 0;
+		for(std::vector<pairContribution>::const_iterator contribution = contributions.begin(); contribution != contributions.end(); contribution++)
+		{
+			sum += contribution->weight * contribution->values[level];
+		}
+		if(sum != sum || sum == -std::numeric_limits<double>::infinity()) result[level] = -std::numeric_limits<double>::infinity();
+		else result[level] += sum;
+	}
+}
+//The likelihood for a single design. If useLineWeights is false, the line weights are assumed to all be 1.
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> class designLikelihoodImpl : public designLikelihood
+{
+public:
+	designLikelihoodImpl(rfhaps_internal_args& args);
+	virtual ~designLikelihoodImpl();
+	virtual void preparePair(int markerCounterRow, int markerCounterColumn);
+	virtual void addLikelihood(double* curve);
+	virtual void addLikelihood(const int* levels, int nLevels, double* curve);
+	virtual double associationStatistic();
+	virtual void rethrowLookupFailure()
+	{
+		computedContributions.rethrowFailure();
+	}
+private:
+	//Working memory for a single thread
+	struct workspace
+	{
+		//Indexing is of the form table[allele1 * product1 + allele2*product2 + selfingGenerations * product3 + (ai OR funnel)]. Funnels come first. Only the entries for observed alleles and non-empty classes are ever written, so the other entries stay at zero.
+		std::vector<int> table;
+		//The sum of the line weights, indexed in the same way.
+		std::vector<double> weightTable;
+		std::vector<pairContribution> contributions;
+		std::vector<double> working;
+		//The number of alleles of each marker of the prepared pair, which are the dimensions of the table
+		int firstMarkerAlleles, secondMarkerAlleles;
+	};
+	rfhaps_internal_args& args;
+	int nRecombLevels, nDifferentFunnels;
+	int minAIGenerations, maxAIGenerations, minSelfing, maxSelfing;
+	R_xlen_t product1, product2, product3;
 	//This is basically just a huge lookup table
-	allMarkerPairData<maxAlleles> computedContributions(nMarkerPatternIDs);
-	
+	allMarkerPairData computedContributions;
+	std::unique_ptr<markerBitPlanes> planes;
+	//The line weights, indexed by bit position rather than line.
+	std::vector<double> positionWeights;
+	//One per thread, allocated the first time the thread uses it.
+	std::vector<workspace> workspaces;
+	workspace& threadWorkspace();
+	//Entries of the lookup table are read from here if possible, and the entries that had to be computed are added to the cache on destruction.
+	void setupCache();
+	std::vector<std::vector<unsigned char> > patternSignatures;
+	std::unique_ptr<lookupTableCache> cache;
+	std::vector<std::pair<int, int> > uncachedEntries;
+};
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::designLikelihoodImpl(rfhaps_internal_args& args)
+	: args(args), nRecombLevels((int)args.recombinationFractions.size()), nDifferentFunnels((int)args.lineFunnelEncodings.size()), computedContributions((int)args.markerPatternData.allMarkerPatterns.size())
+{
+	std::size_t nFinals = args.finals.nrow();
+	maxAIGenerations = *std::max_element(args.intercrossingGenerations.begin(), args.intercrossingGenerations.end());
+	minAIGenerations = *std::min_element(args.intercrossingGenerations.begin(), args.intercrossingGenerations.end());
+	minSelfing = *std::min_element(args.selfingGenerations.begin(), args.selfingGenerations.end());
+	maxSelfing = *std::max_element(args.selfingGenerations.begin(), args.selfingGenerations.end());
+
 	constructLookupTableArgs<maxAlleles, nFounders> lookupArgs(computedContributions, args.markerPatternData);
 	lookupArgs.recombinationFractions = &args.recombinationFractions;
 	lookupArgs.lineFunnelEncodings = &args.lineFunnelEncodings;
 	lookupArgs.intercrossingGenerations = &args.intercrossingGenerations;
 	lookupArgs.selfingGenerations = &args.selfingGenerations;
 	lookupArgs.allFunnelEncodings = &args.allFunnelEncodings;
+	lookupArgs.funnelShape = &args.funnelShape;
 	constructLookupTable<nFounders, maxAlleles, infiniteSelfing>(lookupArgs);
+	if(args.lookupCacheDirectory != "") setupCache();
 
-	//We parallelise this array, even though it's over an iterator not an integer. So we use an integer and use that to work out how many steps forwards we need to move the iterator. We assume that the values are strictly increasing, otherwise this will never work. 
-	//Use this to only call setTxtProgressBar every 10 calls to updateProgress. Probably no point in updating status more frequently than that.
-	unsigned long long updateProgressCounter = 0;
-#ifdef USE_OPENMP
-	#pragma omp parallel 
-#endif
+	product1 = maxAlleles*(maxSelfing-minSelfing + 1) *(nDifferentFunnels + maxAIGenerations - minAIGenerations+1);
+	product2 = (maxSelfing - minSelfing + 1) *(nDifferentFunnels + maxAIGenerations - minAIGenerations + 1);
+	product3 = nDifferentFunnels + maxAIGenerations - minAIGenerations + 1;
+
+	//Transpose the finals into bit planes, with one class per combination of selfing generations and (funnel OR intercrossing generations). Class indices are the last part of the table index.
+	std::vector<int> lineClasses(nFinals, -1);
+	for(int finalCounter = 0; finalCounter < (int)nFinals; finalCounter++)
 	{
-		triangularIterator indexIterator = args.startPosition;
-		unsigned long long previousCounter = 0;
-#ifdef USE_OPENMP
-		#pragma omp for schedule(dynamic)
-#endif
-		for(unsigned long long counter = 0; counter < args.valuesToEstimateInChunk; counter++)
+		int intercrossingGenerations = args.intercrossingGenerations[finalCounter];
+		int selfingGenerations = args.selfingGenerations[finalCounter];
+		if(intercrossingGenerations == 0)
 		{
-			signed long long difference = counter - previousCounter;
-			if(difference < 0LL) throw std::runtime_error("Internal error");
-			while(difference > 0LL) 
-			{
-				indexIterator.next();
-				difference--;
-			}
-			previousCounter = counter;
-
-			std::pair<int, int> markerIndices = indexIterator.get();
-			int markerCounterRow = markerIndices.first, markerCounterColumn = markerIndices.second;
-
-			int markerPatternID1 = args.markerPatternData.markerPatternIDs[markerCounterRow];
-			int markerPatternID2 = args.markerPatternData.markerPatternIDs[markerCounterColumn];
+			lineClasses[finalCounter] = (int)((selfingGenerations - minSelfing)*product3 + args.lineFunnelIDs[finalCounter]);
+		}
+		else if(intercrossingGenerations > 0)
+		{
+			lineClasses[finalCounter] = (int)((selfingGenerations - minSelfing)*product3 + nDifferentFunnels + intercrossingGenerations - minAIGenerations);
+		}
+	}
+	const std::vector<int>& markerRows = args.tiles.getMarkerRows();
+	const std::vector<int>& markerColumns = args.tiles.getMarkerColumns();
+	std::vector<int> planeMarkers(markerRows);
+	planeMarkers.insert(planeMarkers.end(), markerColumns.begin(), markerColumns.end());
+	std::sort(planeMarkers.begin(), planeMarkers.end());
+	planeMarkers.erase(std::unique(planeMarkers.begin(), planeMarkers.end()), planeMarkers.end());
+	planes.reset(new markerBitPlanes(args.finals, lineClasses, (int)(product2), planeMarkers));
 
-			singleMarkerPairData<maxAlleles>& markerPairData = computedContributions(markerPatternID1, markerPatternID2);
-			//We only calculated tabels for markerPattern1 <= markerPattern2. So if we want things the other way around we have to swap the data for markers 1 and 2 later on. 
-			bool swap = markerPatternID1 > markerPatternID2;
-			for(int recombCounter = 0; recombCounter < (int)nRecombLevels; recombCounter++)
-			{
-				for(int finalCounter = 0; finalCounter < (int)nFinals; finalCounter++)
-				{
-					int marker1Value = args.finals(finalCounter, markerCounterRow);
-					int marker2Value = args.finals(finalCounter, markerCounterColumn);
-					//If necessary swap the data
-					if(swap) std::swap(marker1Value, marker2Value);
-					if(marker1Value != NA_INTEGER && marker2Value != NA_INTEGER)
-					{
-						double contribution = 0;
-						bool allowable = false;
-						int intercrossingGenerations = args.intercrossingGenerations[finalCounter];
-						int selfingGenerations = args.selfingGenerations[finalCounter];
-						if(intercrossingGenerations == 0)
-						{
-							funnelID currentLineFunnelID = args.lineFunnelIDs[finalCounter];
-							allowable = markerPairData.allowableFunnel(currentLineFunnelID, selfingGenerations - minSelfing);
-							if(allowable)
-							{
-								array2<maxAlleles>& perMarkerGenotypeValues = markerPairData.perFunnelData(recombCounter, currentLineFunnelID, selfingGenerations - minSelfing);
-								contribution = perMarkerGenotypeValues.values[marker1Value][marker2Value];
-							}
-						}
-						else if(intercrossingGenerations > 0)
-						{
-							allowable = markerPairData.allowableAI(intercrossingGenerations-1, selfingGenerations - minSelfing);
-							if(allowable)
-							{
-								array2<maxAlleles>& perMarkerGenotypeValues = markerPairData.perAIGenerationData(recombCounter, intercrossingGenerations-1, selfingGenerations-minSelfing);
-								contribution = perMarkerGenotypeValues.values[marker1Value][marker2Value];
-							}
-						}
-						//We get an NA from trying to take the logarithm of zero - That is, this parameter is completely impossible for the given data, so put in -Inf
-						if(contribution != contribution || contribution == -std::numeric_limits<double>::infinity()) args.result[(long)counter *(long)nRecombLevels + (long)recombCounter] = -std::numeric_limits<double>::infinity();
-						else if(contribution != 0 && allowable) args.result[(long)counter * (long)nRecombLevels + (long)recombCounter] += lineWeights[finalCounter] * contribution;
-					}
-				}
-			}
+	if(useLineWeights)
+	{
+		positionWeights.resize((std::size_t)planes->getNWords() * markerBitPlanes::bitsPerWord, 0);
+		const std::vector<int>& linePositions = planes->getLinePositions();
+		for(int finalCounter = 0; finalCounter < (int)nFinals; finalCounter++)
+		{
+			if(linePositions[finalCounter] >= 0) positionWeights[linePositions[finalCounter]] = args.lineWeights[finalCounter];
+		}
+	}
 #ifdef USE_OPENMP
-			#pragma omp critical
+	workspaces.resize(omp_get_max_threads());
+#else
+	workspaces.resize(1);
 #endif
+}
+template<typename T> void appendSignature(std::vector<unsigned char>& signature, const T& value)
+{
+	const unsigned char* bytes = (const unsigned char*)&value;
+	signature.insert(signature.end(), bytes, bytes + sizeof(T));
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> void designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::setupCache()
+{
+	int nDifferentSelfing = maxSelfing - minSelfing + 1;
+	//nFounders is 0 for designs which use genericFunnelProbabilities, so the number of founders is taken from the data
+	const int nDesignFounders = args.founders.nrow();
+	//Everything that the lookup table depends on, apart from the marker patterns. Funnels are identified by their position in lineFunnelEncodings, so the order matters.
+	std::vector<unsigned char> designSignature;
+	appendSignature(designSignature, nDesignFounders);
+	appendSignature(designSignature, (int)maxAlleles);
+	appendSignature(designSignature, (int)infiniteSelfing);
+	appendSignature(designSignature, maxAIGenerations);
+	appendSignature(designSignature, minSelfing);
+	appendSignature(designSignature, maxSelfing);
+	appendSignature(designSignature, args.lineFunnelEncodings.size());
+	for(std::vector<funnelEncoding>::iterator i = args.lineFunnelEncodings.begin(); i != args.lineFunnelEncodings.end(); i++) appendSignature(designSignature, *i);
+	appendSignature(designSignature, args.allFunnelEncodings.size());
+	for(std::vector<funnelEncoding>::iterator i = args.allFunnelEncodings.begin(); i != args.allFunnelEncodings.end(); i++) appendSignature(designSignature, *i);
+	appendSignature(designSignature, args.recombinationFractions.size());
+	for(std::vector<double>::const_iterator i = args.recombinationFractions.begin(); i != args.recombinationFractions.end(); i++) appendSignature(designSignature, *i);
+	if(args.funnelShape.size() > 0)
+	{
+		appendSignature(designSignature, args.funnelShape.size());
+		for(std::vector<int>::const_iterator i = args.funnelShape.begin(); i != args.funnelShape.end(); i++) appendSignature(designSignature, *i);
+	}
+
+	std::vector<markerData>& allMarkerPatterns = args.markerPatternData.allMarkerPatterns;
+	patternSignatures.resize(allMarkerPatterns.size());
+	for(std::size_t i = 0; i < allMarkerPatterns.size(); i++)
+	{
+		std::vector<unsigned char>& signature = patternSignatures[i];
+		appendSignature(signature, allMarkerPatterns[i].nObservedValues);
+		for(int row = 0; row < nDesignFounders; row++)
+		{
+			for(int column = 0; column < nDesignFounders; column++) appendSignature(signature, allMarkerPatterns[i].hetData(row, column));
+		}
+	}
+	//A cache that can't be read just means that every entry is computed
+	try
+	{
+		cache.reset(new lookupTableCache(args.lookupCacheDirectory, designSignature, patternSignatures));
+	}
+	catch(...)
+	{
+		return;
+	}
+	allMarkerPairData::computeFunction compute = computedContributions.getCompute();
+	computedContributions.setCompute([this, compute, nDifferentSelfing](int firstPattern, int secondPattern, std::vector<unsigned char>& result)
+		{
+			std::size_t size;
+			const unsigned char* cached = cache->find(firstPattern, secondPattern, size);
+			std::vector<markerData>& allMarkerPatterns = args.markerPatternData.allMarkerPatterns;
+			if(cached && compactMarkerPairData::isValid(cached, size, allMarkerPatterns[firstPattern].nObservedValues, allMarkerPatterns[secondPattern].nObservedValues, nDifferentFunnels, maxAIGenerations, nDifferentSelfing, nRecombLevels))
 			{
-				progressCounter++;
+				result.assign(cached, cached + size);
+				return;
 			}
+			compute(firstPattern, secondPattern, result);
 #ifdef USE_OPENMP
-			if(omp_get_thread_num() == 0)
+			#pragma omp critical (lookupTableCache)
 #endif
+			uncachedEntries.push_back(std::make_pair(firstPattern, secondPattern));
+		});
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::~designLikelihoodImpl()
+{
+	if(!cache || uncachedEntries.size() == 0) return;
+	//Failing to write the cache is not an error, the entries will just be computed again next time.
+	try
+	{
+		cache->save(uncachedEntries, [this](int firstPattern, int secondPattern)
 			{
-				updateProgressCounter++;
-				if(updateProgressCounter % 100 == 0) args.updateProgress(progressCounter);
-			}
-		}
+				compactMarkerPairData entry = computedContributions(firstPattern, secondPattern);
+				return std::make_pair(entry.getData(), entry.size());
+			});
+	}
+	catch(...)
+	{
 	}
-	return true;
 }
-template<int nFounders, int maxAlleles, bool infiniteSelfing> bool estimateRFSpecificDesignNoLineWeights(rfhaps_internal_args& args, unsigned long long& progressCounter)
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> typename designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::workspace& designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::threadWorkspace()
 {
-	std::size_t nFinals = args.finals.nrow(), nRecombLevels = args.recombinationFractions.size();
-	std::size_t nDifferentFunnels = args.lineFunnelEncodings.size();
-	Rcpp::List finalDimNames = args.finals.attr("dimnames");
-	Rcpp::CharacterVector finalNames = finalDimNames[0];
-
-	int nMarkerPatternIDs = (int)args.markerPatternData.allMarkerPatterns.size();
-	int maxAIGenerations = *std::max_element(args.intercrossingGenerations.begin(), args.intercrossingGenerations.end());
-	int minAIGenerations = *std::min_element(args.intercrossingGenerations.begin(), args.intercrossingGenerations.end());
-	int minSelfing = *std::min_element(args.selfingGenerations.begin(), args.selfingGenerations.end());
-	int maxSelfing = *std::max_element(args.selfingGenerations.begin(), args.selfingGenerations.end());
-
-	//This is basically just a huge lookup table
-	allMarkerPairData<maxAlleles> computedContributions(nMarkerPatternIDs);
-	
-	constructLookupTableArgs<maxAlleles, nFounders> lookupArgs(computedContributions, args.markerPatternData);
-	lookupArgs.recombinationFractions = &args.recombinationFractions;
-	lookupArgs.lineFunnelEncodings = &args.lineFunnelEncodings;
-	lookupArgs.intercrossingGenerations = &args.intercrossingGenerations;
-	lookupArgs.selfingGenerations = &args.selfingGenerations;
-	lookupArgs.allFunnelEncodings = &args.allFunnelEncodings;
-	constructLookupTable<nFounders, maxAlleles, infiniteSelfing>(lookupArgs);
-
-	const R_xlen_t product1 = maxAlleles*(maxSelfing-minSelfing + 1) *(nDifferentFunnels + maxAIGenerations - minAIGenerations+1);
-	const R_xlen_t product2 = (maxSelfing - minSelfing + 1) *(nDifferentFunnels + maxAIGenerations - minAIGenerations + 1);
-	const R_xlen_t product3 = nDifferentFunnels + maxAIGenerations - minAIGenerations + 1;
-
-	//We parallelise this array, even though it's over an iterator not an integer. So we use an integer and use that to work out how many steps forwards we need to move the iterator. We assume that the values are strictly increasing, otherwise this will never work.
-	//Use this to only call setTxtProgressBar every 10 calls to updateProgress. Probably no point in updating status more frequently than that.
-	unsigned long long updateProgressCounter = 0;
 #ifdef USE_OPENMP
-	#pragma omp parallel 
+	workspace& currentWorkspace = workspaces[omp_get_thread_num()];
+#else
+	workspace& currentWorkspace = workspaces[0];
 #endif
+	if(currentWorkspace.working.size() == 0)
 	{
-		triangularIterator indexIterator = args.startPosition;
-		//Indexing is of the form table[allele1 * product1 + allele2*product2 + selfingGenerations * product3 + (ai OR funnel)]. Funnels come first. 
-		std::vector<int> table(maxAlleles*product1);
+		currentWorkspace.table.resize(maxAlleles*product1, 0);
+		if(useLineWeights) currentWorkspace.weightTable.resize(maxAlleles*product1, 0);
+		currentWorkspace.working.resize(nRecombLevels);
+	}
+	return currentWorkspace;
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> void designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::preparePair(int markerCounterRow, int markerCounterColumn)
+{
+	workspace& currentWorkspace = threadWorkspace();
+	std::vector<int>& table = currentWorkspace.table;
+	std::vector<double>& weightTable = currentWorkspace.weightTable;
+	std::vector<pairContribution>& contributions = currentWorkspace.contributions;
+	const markerBitPlanes& bitPlanes = *planes;
+	const std::vector<int>& nonEmptyClasses = bitPlanes.getNonEmptyClasses();
 
-		int previousCounter = 0;
-#ifdef USE_OPENMP
-		#pragma omp for schedule(dynamic)
-#endif
-		for(int counter = 0; counter < (int)args.valuesToEstimateInChunk; counter++)
+	int markerPatternID1 = args.markerPatternData.markerPatternIDs[markerCounterRow];
+	int markerPatternID2 = args.markerPatternData.markerPatternIDs[markerCounterColumn];
+
+	compactMarkerPairData markerPairData = computedContributions(markerPatternID1, markerPatternID2);
+	//We only calculated tabels for markerPattern1 <= markerPattern2. So if we want things the other way around we have to swap the data for markers 1 and 2 later on. 
+	bool swap = markerPatternID1 > markerPatternID2;
+	int firstMarker = swap ? markerCounterColumn : markerCounterRow;
+	int secondMarker = swap ? markerCounterRow : markerCounterColumn;
+	//The joint counts for every class are popcounts of the intersection of the bit planes. The weighted counts visit the set bits of the intersection. 
+	//The lookup table only has values for the alleles in the marker patterns, which always includes every allele in the finals.
+	int firstMarkerAlleles = std::min(bitPlanes.nAlleles(firstMarker), markerPairData.nFirstAlleles()), secondMarkerAlleles = std::min(bitPlanes.nAlleles(secondMarker), markerPairData.nSecondAlleles());
+	std::size_t alleleStride = (std::size_t)markerPairData.nSecondAlleles() * nRecombLevels;
+	currentWorkspace.firstMarkerAlleles = firstMarkerAlleles;
+	currentWorkspace.secondMarkerAlleles = secondMarkerAlleles;
+	for(int marker1Value = 0; marker1Value < firstMarkerAlleles; marker1Value++)
+	{
+		const markerBitPlanes::word* plane1 = bitPlanes.plane(firstMarker, marker1Value);
+		for(int marker2Value = 0; marker2Value < secondMarkerAlleles; marker2Value++)
 		{
-			std::fill(table.begin(), table.end(), 0);
-			int difference = counter - previousCounter;
-			if(difference < 0) throw std::runtime_error("Internal error");
-			while(difference > 0) 
+			const markerBitPlanes::word* plane2 = bitPlanes.plane(secondMarker, marker2Value);
+			int* tableEntries = &(table[marker1Value*product1 + marker2Value*product2]);
+			for(std::vector<int>::const_iterator lineClass = nonEmptyClasses.begin(); lineClass != nonEmptyClasses.end(); lineClass++)
 			{
-				indexIterator.next();
-				difference--;
+				if(useLineWeights)
+				{
+					weightTable[marker1Value*product1 + marker2Value*product2 + *lineClass] = sumIntersectionWeights(plane1, plane2, bitPlanes.classStart(*lineClass), bitPlanes.classEnd(*lineClass), &(positionWeights[0]), tableEntries[*lineClass]);
+				}
+				else
+				{
+					tableEntries[*lineClass] = countIntersection(plane1, plane2, bitPlanes.classStart(*lineClass), bitPlanes.classEnd(*lineClass));
+				}
 			}
-			previousCounter = counter;
-
-			std::pair<int, int> markerIndices = indexIterator.get();
-			int markerCounterRow = markerIndices.first, markerCounterColumn = markerIndices.second;
-
-			int markerPatternID1 = args.markerPatternData.markerPatternIDs[markerCounterRow];
-			int markerPatternID2 = args.markerPatternData.markerPatternIDs[markerCounterColumn];
-
-			singleMarkerPairData<maxAlleles>& markerPairData = computedContributions(markerPatternID1, markerPatternID2);
-			//We only calculated tabels for markerPattern1 <= markerPattern2. So if we want things the other way around we have to swap the data for markers 1 and 2 later on. 
-			bool swap = markerPatternID1 > markerPatternID2;
-			for(int finalCounter = 0; finalCounter < (int)nFinals; finalCounter++)
+		}
+	}
+	//Gather up the non-zero entries of the table, along with the matching slices of the lookup table. 
+	contributions.clear();
+	for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+	{
+		for(int marker1Value = 0; marker1Value < firstMarkerAlleles; marker1Value++)
+		{
+			for(int marker2Value = 0; marker2Value < secondMarkerAlleles; marker2Value++)
 			{
-				int marker1Value = args.finals(finalCounter, markerCounterRow);
-				int marker2Value = args.finals(finalCounter, markerCounterColumn);
-				//If necessary swap the data
-				if(swap) std::swap(marker1Value, marker2Value);
-				if(marker1Value != NA_INTEGER && marker2Value != NA_INTEGER)
+				R_xlen_t tableIndex = marker1Value*product1 + marker2Value * product2 + (selfingGenerations - minSelfing)*product3;
+				std::size_t valuesOffset = marker1Value * alleleStride + (std::size_t)marker2Value * nRecombLevels;
+				for(int intercrossingGenerations = std::max(minAIGenerations,1); intercrossingGenerations <= maxAIGenerations; intercrossingGenerations++)
 				{
-					int intercrossingGenerations = args.intercrossingGenerations[finalCounter];
-					int selfingGenerations = args.selfingGenerations[finalCounter];
-					if(intercrossingGenerations == 0)
+					int count = table[tableIndex + nDifferentFunnels + intercrossingGenerations - minAIGenerations];
+					if(count == 0) continue;
+					//NULL if this number of generations of intercrossing is not allowable
+					const double* values = markerPairData.aiValues(intercrossingGenerations-1, selfingGenerations - minSelfing);
+					if(values)
 					{
-						funnelID currentLineFunnelID = args.lineFunnelIDs[finalCounter];
-						table[marker1Value*product1 + marker2Value*product2 + (selfingGenerations - minSelfing)*product3 + currentLineFunnelID]++;
-					}
-					else if(intercrossingGenerations > 0)
-					{
-						table[marker1Value*product1 + marker2Value*product2 + (selfingGenerations - minSelfing)*product3 + nDifferentFunnels + intercrossingGenerations - minAIGenerations]++;
+						double weight = useLineWeights ? weightTable[tableIndex + nDifferentFunnels + intercrossingGenerations - minAIGenerations] : count;
+						contributions.push_back(pairContribution(values + valuesOffset, weight));
 					}
 				}
-			}
-			for(int recombCounter = 0; recombCounter < (int)nRecombLevels; recombCounter++)
-			{
-				double contribution = 0;
-				for(int selfingGenerations = minSelfing; selfingGenerations <= maxSelfing; selfingGenerations++)
+				for(int funnelID = 0; funnelID < (int)nDifferentFunnels; funnelID++)
 				{
-					for(int marker1Value = 0; marker1Value < maxAlleles; marker1Value++)
+					int count = table[tableIndex + funnelID];
+					if(count == 0) continue;
+					const double* values = markerPairData.funnelValues(funnelID, selfingGenerations - minSelfing);
+					if(values)
 					{
-						for(int marker2Value = 0; marker2Value < maxAlleles; marker2Value++)
-						{
-							for(int intercrossingGenerations = std::max(minAIGenerations,1); intercrossingGenerations <= maxAIGenerations; intercrossingGenerations++)
-							{
-								int count = table[marker1Value*product1 + marker2Value * product2 + (selfingGenerations - minSelfing)*product3 + nDifferentFunnels + intercrossingGenerations - minAIGenerations];
-								if(count == 0) continue;
-								bool allowable = markerPairData.allowableAI(intercrossingGenerations-1, selfingGenerations - minSelfing);
-								if(allowable)
-								{
-									array2<maxAlleles>& perMarkerGenotypeValues = markerPairData.perAIGenerationData(recombCounter, intercrossingGenerations-1, selfingGenerations - minSelfing);
-									contribution += count * perMarkerGenotypeValues.values[marker1Value][marker2Value];
-								}
-							}
-							for(int funnelID = 0; funnelID < (int)nDifferentFunnels; funnelID++)
-							{
-								int count = table[marker1Value*product1 + marker2Value * product2 + (selfingGenerations - minSelfing)*product3 + funnelID];
-								if(count == 0) continue;
-								bool allowable = markerPairData.allowableFunnel(funnelID, selfingGenerations - minSelfing);
-								if(allowable)
-								{
-									array2<maxAlleles>& perMarkerGenotypeValues = markerPairData.perFunnelData(recombCounter, funnelID, selfingGenerations - minSelfing);
-									contribution += count * perMarkerGenotypeValues.values[marker1Value][marker2Value];
-								}
-							}
-
-						}
+						double weight = useLineWeights ? weightTable[tableIndex + funnelID] : count;
+						contributions.push_back(pairContribution(values + valuesOffset, weight));
 					}
 				}
-				//We get an NA from trying to take the logarithm of zero - That is, this parameter is completely impossible for the given data, so put in -Inf
-				if(contribution != contribution || contribution == -std::numeric_limits<double>::infinity()) args.result[(long)counter *(long)nRecombLevels + (long)recombCounter] = -std::numeric_limits<double>::infinity();
-				else args.result[(long)counter * (long)nRecombLevels + (long)recombCounter] += contribution;
 			}
-#ifdef USE_OPENMP
-			#pragma omp critical
-#endif
+		}
+	}
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> void designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::addLikelihood(double* curve)
+{
+	workspace& currentWorkspace = threadWorkspace();
+	//Recombination levels are the inner loop here, and the lookup table values for consecutive levels are contiguous.
+	addPairContributions(currentWorkspace.contributions, nRecombLevels, currentWorkspace.working, curve);
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> void designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::addLikelihood(const int* levels, int nLevels, double* curve)
+{
+	workspace& currentWorkspace = threadWorkspace();
+	addPairContributions(currentWorkspace.contributions, levels, nLevels, curve);
+}
+template<int nFounders, int maxAlleles, bool infiniteSelfing, bool useLineWeights> double designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, useLineWeights>::associationStatistic()
+{
+	workspace& currentWorkspace = threadWorkspace();
+	const std::vector<int>& table = currentWorkspace.table;
+	const std::vector<int>& nonEmptyClasses = planes->getNonEmptyClasses();
+	int firstMarkerAlleles = currentWorkspace.firstMarkerAlleles, secondMarkerAlleles = currentWorkspace.secondMarkerAlleles;
+	//Only the unweighted counts are used. The line weights correct for distortion of the marginal allele frequencies, which doesn't affect a test of independence.
+	double result = 0;
+	int rowSums[maxAlleles], columnSums[maxAlleles];
+	for(std::vector<int>::const_iterator lineClass = nonEmptyClasses.begin(); lineClass != nonEmptyClasses.end(); lineClass++)
+	{
+		std::fill(rowSums, rowSums + firstMarkerAlleles, 0);
+		std::fill(columnSums, columnSums + secondMarkerAlleles, 0);
+		int total = 0;
+		for(int marker1Value = 0; marker1Value < firstMarkerAlleles; marker1Value++)
+		{
+			for(int marker2Value = 0; marker2Value < secondMarkerAlleles; marker2Value++)
 			{
-				progressCounter++;
+				int count = table[marker1Value*product1 + marker2Value*product2 + *lineClass];
+				rowSums[marker1Value] += count;
+				columnSums[marker2Value] += count;
+				total += count;
 			}
-#ifdef USE_OPENMP
-			if(omp_get_thread_num() == 0)
-#endif
+		}
+		if(total == 0) continue;
+		for(int marker1Value = 0; marker1Value < firstMarkerAlleles; marker1Value++)
+		{
+			for(int marker2Value = 0; marker2Value < secondMarkerAlleles; marker2Value++)
 			{
-				updateProgressCounter++;
-				if(updateProgressCounter % 100 == 0) args.updateProgress(progressCounter);
+				int count = table[marker1Value*product1 + marker2Value*product2 + *lineClass];
+				if(count > 0) result += count * std::log(((double)count * total) / ((double)rowSums[marker1Value] * columnSums[marker2Value]));
 			}
 		}
 	}
-	return true;
+	return result;
 }
-template<int nFounders, int maxAlleles, bool infiniteSelfing> bool estimateRFSpecificDesign3(rfhaps_internal_args& args, unsigned long long& counter)
+template<int nFounders, int maxAlleles, bool infiniteSelfing> std::unique_ptr<designLikelihood> createDesignLikelihood3(rfhaps_internal_args& args)
 {
 	for(std::vector<double>::iterator i = args.lineWeights.begin(); i != args.lineWeights.end(); i++)
 	{
-		if(*i != 1) return estimateRFSpecificDesign<nFounders, maxAlleles, infiniteSelfing>(args, counter);
+		if(*i != 1) return std::unique_ptr<designLikelihood>(new designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, true>(args));
 	}
-	return estimateRFSpecificDesignNoLineWeights<nFounders, maxAlleles, infiniteSelfing>(args, counter);
+	return std::unique_ptr<designLikelihood>(new designLikelihoodImpl<nFounders, maxAlleles, infiniteSelfing, false>(args));
 }
-template<int nFounders, int maxAlleles> bool estimateRFSpecificDesignInternal2(rfhaps_internal_args& args, unsigned long long& counter)
+template<int nFounders, int maxAlleles> std::unique_ptr<designLikelihood> createDesignLikelihoodInternal2(rfhaps_internal_args& args)
 {
 	bool infiniteSelfing = Rcpp::as<std::string>(args.pedigree.slot("selfing")) == "infinite";
 	if(infiniteSelfing)
 	{
 		std::fill(args.selfingGenerations.begin(), args.selfingGenerations.end(), 0);
-		return estimateRFSpecificDesign3<nFounders, maxAlleles, true>(args, counter);
+		return createDesignLikelihood3<nFounders, maxAlleles, true>(args);
 	}
-	else return estimateRFSpecificDesign3<nFounders, maxAlleles, false>(args, counter);
+	else return createDesignLikelihood3<nFounders, maxAlleles, false>(args);
 }
 //here we transfer maxAlleles over to the templated parameter section - This can make a BIG difference to memory usage if this is smaller, and it's going into a type so it has to be templated.
-template<int nFounders> bool estimateRFSpecificDesignInternal1(rfhaps_internal_args& args, unsigned long long& counter)
+template<int nFounders> std::unique_ptr<designLikelihood> createDesignLikelihoodInternal1(rfhaps_internal_args& args)
 {
-	//for i in `seq 1 64`; do echo -e "case $i:\n\t\treturn estimateRFSpecificDesignInternal2<nFounders, $i>(args, counter);"; done
+	//for i in `seq 1 64`; do echo -e "case $i:\n\t\treturn createDesignLikelihoodInternal2<nFounders, $i>(args);"; done
 	switch(args.maxAlleles)
 	{
 		case 1:
-			return estimateRFSpecificDesignInternal2<nFounders, 1>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 1>(args);
 		case 2:
-			return estimateRFSpecificDesignInternal2<nFounders, 2>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 2>(args);
 		case 3:
-			return estimateRFSpecificDesignInternal2<nFounders, 3>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 3>(args);
 		case 4:
-			return estimateRFSpecificDesignInternal2<nFounders, 4>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 4>(args);
 		case 5:
-			return estimateRFSpecificDesignInternal2<nFounders, 5>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 5>(args);
 		case 6:
-			return estimateRFSpecificDesignInternal2<nFounders, 6>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 6>(args);
 		case 7:
-			return estimateRFSpecificDesignInternal2<nFounders, 7>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 7>(args);
 		case 8:
-			return estimateRFSpecificDesignInternal2<nFounders, 8>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 8>(args);
 		case 9:
-			return estimateRFSpecificDesignInternal2<nFounders, 9>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 9>(args);
 		case 10:
-			return estimateRFSpecificDesignInternal2<nFounders, 10>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 10>(args);
 		case 11:
-			return estimateRFSpecificDesignInternal2<nFounders, 11>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 11>(args);
 		case 12:
-			return estimateRFSpecificDesignInternal2<nFounders, 12>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 12>(args);
 		case 13:
-			return estimateRFSpecificDesignInternal2<nFounders, 13>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 13>(args);
 		case 14:
-			return estimateRFSpecificDesignInternal2<nFounders, 14>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 14>(args);
 		case 15:
-			return estimateRFSpecificDesignInternal2<nFounders, 15>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 15>(args);
 		case 16:
-			return estimateRFSpecificDesignInternal2<nFounders, 16>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 16>(args);
 		case 17:
-			return estimateRFSpecificDesignInternal2<nFounders, 17>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 17>(args);
 		case 18:
-			return estimateRFSpecificDesignInternal2<nFounders, 18>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 18>(args);
 		case 19:
-			return estimateRFSpecificDesignInternal2<nFounders, 19>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 19>(args);
 		case 20:
-			return estimateRFSpecificDesignInternal2<nFounders, 20>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 20>(args);
 		case 21:
-			return estimateRFSpecificDesignInternal2<nFounders, 21>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 21>(args);
 		case 22:
-			return estimateRFSpecificDesignInternal2<nFounders, 22>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 22>(args);
 		case 23:
-			return estimateRFSpecificDesignInternal2<nFounders, 23>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 23>(args);
 		case 24:
-			return estimateRFSpecificDesignInternal2<nFounders, 24>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 24>(args);
 		case 25:
-			return estimateRFSpecificDesignInternal2<nFounders, 25>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 25>(args);
 		case 26:
-			return estimateRFSpecificDesignInternal2<nFounders, 26>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 26>(args);
 		case 27:
-			return estimateRFSpecificDesignInternal2<nFounders, 27>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 27>(args);
 		case 28:
-			return estimateRFSpecificDesignInternal2<nFounders, 28>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 28>(args);
 		case 29:
-			return estimateRFSpecificDesignInternal2<nFounders, 29>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 29>(args);
 		case 30:
-			return estimateRFSpecificDesignInternal2<nFounders, 30>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 30>(args);
 		case 31:
-			return estimateRFSpecificDesignInternal2<nFounders, 31>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 31>(args);
 		case 32:
-			return estimateRFSpecificDesignInternal2<nFounders, 32>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 32>(args);
 		case 33:
-			return estimateRFSpecificDesignInternal2<nFounders, 33>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 33>(args);
 		case 34:
-			return estimateRFSpecificDesignInternal2<nFounders, 34>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 34>(args);
 		case 35:
-			return estimateRFSpecificDesignInternal2<nFounders, 35>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 35>(args);
 		case 36:
-			return estimateRFSpecificDesignInternal2<nFounders, 36>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 36>(args);
 		case 37:
-			return estimateRFSpecificDesignInternal2<nFounders, 37>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 37>(args);
 		case 38:
-			return estimateRFSpecificDesignInternal2<nFounders, 38>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 38>(args);
 		case 39:
-			return estimateRFSpecificDesignInternal2<nFounders, 39>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 39>(args);
 		case 40:
-			return estimateRFSpecificDesignInternal2<nFounders, 40>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 40>(args);
 		case 41:
-			return estimateRFSpecificDesignInternal2<nFounders, 41>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 41>(args);
 		case 42:
-			return estimateRFSpecificDesignInternal2<nFounders, 42>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 42>(args);
 		case 43:
-			return estimateRFSpecificDesignInternal2<nFounders, 43>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 43>(args);
 		case 44:
-			return estimateRFSpecificDesignInternal2<nFounders, 44>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 44>(args);
 		case 45:
-			return estimateRFSpecificDesignInternal2<nFounders, 45>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 45>(args);
 		case 46:
-			return estimateRFSpecificDesignInternal2<nFounders, 46>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 46>(args);
 		case 47:
-			return estimateRFSpecificDesignInternal2<nFounders, 47>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 47>(args);
 		case 48:
-			return estimateRFSpecificDesignInternal2<nFounders, 48>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 48>(args);
 		case 49:
-			return estimateRFSpecificDesignInternal2<nFounders, 49>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 49>(args);
 		case 50:
-			return estimateRFSpecificDesignInternal2<nFounders, 50>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 50>(args);
 		case 51:
-			return estimateRFSpecificDesignInternal2<nFounders, 51>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 51>(args);
 		case 52:
-			return estimateRFSpecificDesignInternal2<nFounders, 52>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 52>(args);
 		case 53:
-			return estimateRFSpecificDesignInternal2<nFounders, 53>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 53>(args);
 		case 54:
-			return estimateRFSpecificDesignInternal2<nFounders, 54>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 54>(args);
 		case 55:
-			return estimateRFSpecificDesignInternal2<nFounders, 55>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 55>(args);
 		case 56:
-			return estimateRFSpecificDesignInternal2<nFounders, 56>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 56>(args);
 		case 57:
-			return estimateRFSpecificDesignInternal2<nFounders, 57>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 57>(args);
 		case 58:
-			return estimateRFSpecificDesignInternal2<nFounders, 58>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 58>(args);
 		case 59:
-			return estimateRFSpecificDesignInternal2<nFounders, 59>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 59>(args);
 		case 60:
-			return estimateRFSpecificDesignInternal2<nFounders, 60>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 60>(args);
 		case 61:
-			return estimateRFSpecificDesignInternal2<nFounders, 61>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 61>(args);
 		case 62:
-			return estimateRFSpecificDesignInternal2<nFounders, 62>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 62>(args);
 		case 63:
-			return estimateRFSpecificDesignInternal2<nFounders, 63>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 63>(args);
 		case 64:
-			return estimateRFSpecificDesignInternal2<nFounders, 64>(args, counter);
+			return createDesignLikelihoodInternal2<nFounders, 64>(args);
 		default:
 			throw std::runtime_error("Internal error");
 	}
@@ -432,207 +561,19 @@ unsigned long long estimateLookup(rfhaps_internal_args& internal_args)
 	int maxSelfing = *std::max_element(internal_args.selfingGenerations.begin(), internal_args.selfingGenerations.end());
 	std::size_t nDifferentFunnels = internal_args.lineFunnelEncodings.size();
 	std::size_t nRecombLevels = internal_args.recombinationFractions.size();
+	std::size_t nCombinations = (maxSelfing - minSelfing + 1) * (nDifferentFunnels + maxAIGenerations);
 
-	std::size_t arraySize;
-	//for i in `seq 1 64`; do echo -e "\t\tcase $i:\n\t\t\tarraySize = sizeof(array2<$i>);\n\t\t\tbreak;"; done > tmp
-	switch(internal_args.maxAlleles)
+	//Entries only store the observed alleles of each pattern, so summing over pairs of patterns with firstPattern <= secondPattern gives ((sum of alleles)^2 + sum of squared alleles) / 2 pairs of alleles. This is an upper bound, because entries are only computed for pairs of patterns which occur, and combinations which are not allowable are not stored.
+	unsigned long long sumAlleles = 0, sumSquaredAlleles = 0;
+	const std::vector<markerData>& allMarkerPatterns = internal_args.markerPatternData.allMarkerPatterns;
+	for(std::vector<markerData>::const_iterator pattern = allMarkerPatterns.begin(); pattern != allMarkerPatterns.end(); pattern++)
 	{
-		case 1:
-			arraySize = sizeof(array2<1>);
-			break;
-		case 2:
-			arraySize = sizeof(array2<2>);
-			break;
-		case 3:
-			arraySize = sizeof(array2<3>);
-			break;
-		case 4:
-			arraySize = sizeof(array2<4>);
-			break;
-		case 5:
-			arraySize = sizeof(array2<5>);
-			break;
-		case 6:
-			arraySize = sizeof(array2<6>);
-			break;
-		case 7:
-			arraySize = sizeof(array2<7>);
-			break;
-		case 8:
-			arraySize = sizeof(array2<8>);
-			break;
-		case 9:
-			arraySize = sizeof(array2<9>);
-			break;
-		case 10:
-			arraySize = sizeof(array2<10>);
-			break;
-		case 11:
-			arraySize = sizeof(array2<11>);
-			break;
-		case 12:
-			arraySize = sizeof(array2<12>);
-			break;
-		case 13:
-			arraySize = sizeof(array2<13>);
-			break;
-		case 14:
-			arraySize = sizeof(array2<14>);
-			break;
-		case 15:
-			arraySize = sizeof(array2<15>);
-			break;
-		case 16:
-			arraySize = sizeof(array2<16>);
-			break;
-		case 17:
-			arraySize = sizeof(array2<17>);
-			break;
-		case 18:
-			arraySize = sizeof(array2<18>);
-			break;
-		case 19:
-			arraySize = sizeof(array2<19>);
-			break;
-		case 20:
-			arraySize = sizeof(array2<20>);
-			break;
-		case 21:
-			arraySize = sizeof(array2<21>);
-			break;
-		case 22:
-			arraySize = sizeof(array2<22>);
-			break;
-		case 23:
-			arraySize = sizeof(array2<23>);
-			break;
-		case 24:
-			arraySize = sizeof(array2<24>);
-			break;
-		case 25:
-			arraySize = sizeof(array2<25>);
-			break;
-		case 26:
-			arraySize = sizeof(array2<26>);
-			break;
-		case 27:
-			arraySize = sizeof(array2<27>);
-			break;
-		case 28:
-			arraySize = sizeof(array2<28>);
-			break;
-		case 29:
-			arraySize = sizeof(array2<29>);
-			break;
-		case 30:
-			arraySize = sizeof(array2<30>);
-			break;
-		case 31:
-			arraySize = sizeof(array2<31>);
-			break;
-		case 32:
-			arraySize = sizeof(array2<32>);
-			break;
-		case 33:
-			arraySize = sizeof(array2<33>);
-			break;
-		case 34:
-			arraySize = sizeof(array2<34>);
-			break;
-		case 35:
-			arraySize = sizeof(array2<35>);
-			break;
-		case 36:
-			arraySize = sizeof(array2<36>);
-			break;
-		case 37:
-			arraySize = sizeof(array2<37>);
-			break;
-		case 38:
-			arraySize = sizeof(array2<38>);
-			break;
-		case 39:
-			arraySize = sizeof(array2<39>);
-			break;
-		case 40:
-			arraySize = sizeof(array2<40>);
-			break;
-		case 41:
-			arraySize = sizeof(array2<41>);
-			break;
-		case 42:
-			arraySize = sizeof(array2<42>);
-			break;
-		case 43:
-			arraySize = sizeof(array2<43>);
-			break;
-		case 44:
-			arraySize = sizeof(array2<44>);
-			break;
-		case 45:
-			arraySize = sizeof(array2<45>);
-			break;
-		case 46:
-			arraySize = sizeof(array2<46>);
-			break;
-		case 47:
-			arraySize = sizeof(array2<47>);
-			break;
-		case 48:
-			arraySize = sizeof(array2<48>);
-			break;
-		case 49:
-			arraySize = sizeof(array2<49>);
-			break;
-		case 50:
-			arraySize = sizeof(array2<50>);
-			break;
-		case 51:
-			arraySize = sizeof(array2<51>);
-			break;
-		case 52:
-			arraySize = sizeof(array2<52>);
-			break;
-		case 53:
-			arraySize = sizeof(array2<53>);
-			break;
-		case 54:
-			arraySize = sizeof(array2<54>);
-			break;
-		case 55:
-			arraySize = sizeof(array2<55>);
-			break;
-		case 56:
-			arraySize = sizeof(array2<56>);
-			break;
-		case 57:
-			arraySize = sizeof(array2<57>);
-			break;
-		case 58:
-			arraySize = sizeof(array2<58>);
-			break;
-		case 59:
-			arraySize = sizeof(array2<59>);
-			break;
-		case 60:
-			arraySize = sizeof(array2<60>);
-			break;
-		case 61:
-			arraySize = sizeof(array2<61>);
-			break;
-		case 62:
-			arraySize = sizeof(array2<62>);
-			break;
-		case 63:
-			arraySize = sizeof(array2<63>);
-			break;
-		case 64:
-			arraySize = sizeof(array2<64>);
-			break;
-		default:
-			throw std::runtime_error("Internal error");
+		sumAlleles += pattern->nObservedValues;
+		sumSquaredAlleles += pattern->nObservedValues * pattern->nObservedValues;
 	}
-	return nRecombLevels * (maxSelfing - minSelfing + 1) * (nDifferentFunnels + maxAIGenerations) * arraySize;
+	unsigned long long nPatterns = allMarkerPatterns.size();
+	unsigned long long allelePairs = (sumAlleles * sumAlleles + sumSquaredAlleles) / 2;
+	return allelePairs * nCombinations * nRecombLevels * sizeof(double) + (nPatterns * (nPatterns + 1) / 2) * compactMarkerPairData::valuesOffset((int)nCombinations);
 }
 bool toInternalArgs(estimateRFSpecificDesignArgs&& args, rfhaps_internal_args& internal_args, std::string& error)
 {
@@ -658,11 +599,32 @@ bool toInternalArgs(estimateRFSpecificDesignArgs&& args, rfhaps_internal_args& i
 		return false;
 	}
 
+	//re-code the founder and final marker genotypes so that they always start at 0 and go up to n-1 where n is the number of distinct marker alleles
+	//We do this to make it easier to identify markers with identical segregation patterns. recodedFounders = column major matrix
+	Rcpp::IntegerMatrix recodedFounders(nFounders, nMarkers), recodedFinals(nFinals, nMarkers);
+	Rcpp::List recodedHetData(nMarkers);
+	recodedHetData.attr("names") = args.hetData.attr("names");
+	recodedFinals.attr("dimnames") = args.finals.attr("dimnames");
+	
+	recodeDataStruct recoded;
+	recoded.recodedFounders = recodedFounders;
+	recoded.recodedFinals = recodedFinals;
+	recoded.founders = args.founders;
+	recoded.finals = args.finals;
+	recoded.hetData = args.hetData;
+	recoded.recodedHetData = recodedHetData;
+	recodeFoundersFinalsHets(recoded);
+
+	unsigned int maxAlleles = recoded.maxAlleles;
+	error = checkMaxAlleles(recoded);
+	if(error != "") return false;
+
 	//Check that everything has proper funnels - For the case of the lines which are just selfing, we just check that one funnel. For AIC lines, we check the funnels of all the parent lines
 	//allFunnels stores a vector of all the funnels involved in any way. lineFunnels stores a value per line, specifying the funnel per line, if the line is not an intercrossing line. If it is a dummy value is inserted. 
 	std::vector<funnelType> allFunnels, lineFunnels;
+	std::vector<int> funnelShape;
 	{
-		estimateRFCheckFunnels(args.finals, args.founders,  Rcpp::as<Rcpp::List>(args.hetData), args.pedigree, intercrossingGenerations, warnings, errors, allFunnels, lineFunnels);
+		estimateRFCheckFunnels(args.finals, args.founders,  Rcpp::as<Rcpp::List>(args.hetData), args.pedigree, intercrossingGenerations, warnings, errors, allFunnels, lineFunnels, funnelShape);
 		for(std::size_t errorIndex = 0; errorIndex < errors.size() && errorIndex < 6; errorIndex++)
 		{
 			ss << errors[errorIndex] << std::endl;;
@@ -681,29 +643,6 @@ bool toInternalArgs(estimateRFSpecificDesignArgs&& args, rfhaps_internal_args& i
 			Rcpp::Rcout << "Supressing further funnel warnings" << std::endl;
 		}
 	}
-	//re-code the founder and final marker genotypes so that they always start at 0 and go up to n-1 where n is the number of distinct marker alleles
-	//We do this to make it easier to identify markers with identical segregation patterns. recodedFounders = column major matrix
-	Rcpp::IntegerMatrix recodedFounders(nFounders, nMarkers), recodedFinals(nFinals, nMarkers);
-	Rcpp::List recodedHetData(nMarkers);
-	recodedHetData.attr("names") = args.hetData.attr("names");
-	recodedFinals.attr("dimnames") = args.finals.attr("dimnames");
-	
-	recodeDataStruct recoded;
-	recoded.recodedFounders = recodedFounders;
-	recoded.recodedFinals = recodedFinals;
-	recoded.founders = args.founders;
-	recoded.finals = args.finals;
-	recoded.hetData = args.hetData;
-	recoded.recodedHetData = recodedHetData;
-	recodeFoundersFinalsHets(recoded);
-
-	unsigned int maxAlleles = recoded.maxAlleles;
-	if(maxAlleles > 64)
-	{
-		error = "Internal error - Cannot have more than 64 alleles per marker";
-		return false;
-	}
-
 	//We need to assign a unique ID to each marker pattern - Where by pattern we mean the combination of hetData and founder alleles. Note that this is possible because we just recoded everything to a standardised format.
 	//Marker IDs are guaranteed to be contiguous numbers starting from 0 - So the set of all valid [0, markerPatterns.size()]. 
 	//Note that markerPatternID is defined in unitTypes.hpp. It's just an integer (and automatically convertible to an integer), but it's represented by a unique type - This stops us from confusing it with an ordinary integer.
@@ -753,31 +692,36 @@ bool toInternalArgs(estimateRFSpecificDesignArgs&& args, rfhaps_internal_args& i
 	internal_args.lineFunnelIDs.swap(lineFunnelIDs);
 	internal_args.lineFunnelEncodings.swap(lineFunnelEncodings);
 	internal_args.allFunnelEncodings.swap(allFunnelEncodings);
+	internal_args.funnelShape.swap(funnelShape);
 	return true;
 }
-bool estimateRFSpecificDesign(rfhaps_internal_args& internal_args, unsigned long long& counter)
+std::unique_ptr<designLikelihood> createDesignLikelihood(rfhaps_internal_args& internal_args)
 {
 	int nFounders = internal_args.founders.nrow();
 	if(nFounders == 2)
 	{
-		return estimateRFSpecificDesignInternal1<2>(internal_args, counter);
+		return createDesignLikelihoodInternal1<2>(internal_args);
 	}
 	else if(nFounders == 4)
 	{
-		return estimateRFSpecificDesignInternal1<4>(internal_args, counter);
+		return createDesignLikelihoodInternal1<4>(internal_args);
 	}
 	else if(nFounders == 8)
 	{
-		return estimateRFSpecificDesignInternal1<8>(internal_args, counter);
+		return createDesignLikelihoodInternal1<8>(internal_args);
 	}
 	else if(nFounders == 16)
 	{
-		return estimateRFSpecificDesignInternal1<16>(internal_args, counter);
+		return createDesignLikelihoodInternal1<16>(internal_args);
+	}
+	else if(nFounders >= 2 && nFounders <= funnelEncoding::maxFounders)
+	{
+		//Other numbers of founders use genericFunnelProbabilities, with the number of founders given at run time
+		return createDesignLikelihoodInternal1<0>(internal_args);
 	}
 	else
 	{
-		Rprintf("Number of founders must be 2, 4, 8 or 16\n");
-		return false;
+		Rprintf("Number of founders must be between 2 and %d\n", funnelEncoding::maxFounders);
+		return std::unique_ptr<designLikelihood>();
 	}
-	return true;
 }
@@ -6,6 +6,7 @@
 #include "funnelsToUniqueValues.h"
 #include "matrixChunks.h"
 #include <functional>
+#include <memory>
 struct estimateRFSpecificDesignArgs
 {
 	estimateRFSpecificDesignArgs(std::vector<double>& recombinationFractions)
@@ -24,11 +25,11 @@ struct estimateRFSpecificDesignArgs
 };
 struct rfhaps_internal_args
 {
-	rfhaps_internal_args(const std::vector<double>& recombinationFractions, triangularIterator& startPosition)
-	: recombinationFractions(recombinationFractions), startPosition(startPosition)
+	rfhaps_internal_args(const std::vector<double>& recombinationFractions, const triangularTiles& tiles)
+	: recombinationFractions(recombinationFractions), tiles(tiles)
 	{}
 	rfhaps_internal_args(rfhaps_internal_args&& other)
-		:finals(other.finals), founders(other.founders), pedigree(other.pedigree), recombinationFractions(other.recombinationFractions), intercrossingGenerations(std::move(other.intercrossingGenerations)), selfingGenerations(std::move(other.selfingGenerations)), lineWeights(std::move(other.lineWeights)), markerPatternData(std::move(other.markerPatternData)), hasAI(other.hasAI), maxAlleles(other.maxAlleles), result(other.result), lineFunnelIDs(std::move(other.lineFunnelIDs)), lineFunnelEncodings(std::move(other.lineFunnelEncodings)), allFunnelEncodings(std::move(other.allFunnelEncodings)), startPosition(other.startPosition)
+		:finals(other.finals), founders(other.founders), pedigree(other.pedigree), recombinationFractions(other.recombinationFractions), intercrossingGenerations(std::move(other.intercrossingGenerations)), selfingGenerations(std::move(other.selfingGenerations)), lineWeights(std::move(other.lineWeights)), markerPatternData(std::move(other.markerPatternData)), hasAI(other.hasAI), maxAlleles(other.maxAlleles), lineFunnelIDs(std::move(other.lineFunnelIDs)), lineFunnelEncodings(std::move(other.lineFunnelEncodings)), allFunnelEncodings(std::move(other.allFunnelEncodings)), funnelShape(std::move(other.funnelShape)), tiles(other.tiles), lookupCacheDirectory(std::move(other.lookupCacheDirectory))
 	{}
 	Rcpp::IntegerMatrix finals, founders;
 	Rcpp::S4 pedigree;
@@ -41,17 +42,35 @@ struct rfhaps_internal_args
 	bool hasAI;
 	//maximum number of marker alleles present
 	int maxAlleles;
-	//zeroed by the calling code. Must be added to, not overwritten. 
-	double* result;
-	unsigned long long valuesToEstimateInChunk;
 	std::vector<funnelID> lineFunnelIDs;
 	std::vector<funnelEncoding> lineFunnelEncodings;
 	std::vector<funnelEncoding> allFunnelEncodings;
-	triangularIterator startPosition;
-	std::function<void(unsigned long long)> updateProgress;
+	//The shape of every funnel, for other numbers of founders than 2, 4, 8 and 16. See getFunnel. 
+	std::vector<int> funnelShape;
+	//The marker pairs which are going to be estimated
+	const triangularTiles& tiles;
+	//Directory for the on-disk cache of lookup table entries. Empty if there is no cache.
+	std::string lookupCacheDirectory;
+};
+//The log likelihood of a pair of markers for a single design, as a function of the recombination fraction. All the per-design work (the lookup table and the bit planes) is done on construction.
+class designLikelihood
+{
+public:
+	virtual ~designLikelihood() {}
+	//Compute the joint counts for a pair of markers, which are kept in the working memory of the current thread until the next call. This can be called concurrently from the threads of a single OpenMP parallel region.
+	virtual void preparePair(int markerRow, int markerColumn) = 0;
+	//Add the log likelihood of the pair most recently prepared by the current thread, at every recombination level, to curve. Levels which are impossible for this design are set to -Inf.
+	virtual void addLikelihood(double* curve) = 0;
+	//Add the log likelihood of the pair most recently prepared by the current thread, at only the given recombination levels.
+	virtual void addLikelihood(const int* levels, int nLevels, double* curve) = 0;
+	//The log likelihood ratio of the joint allele counts of the prepared pair, for a saturated model against independence of the two markers, within each class of lines. This is zero if the alleles are exactly independent, and large for closely linked markers. It only depends on the counts, so it's much cheaper than the likelihood.
+	virtual double associationStatistic() = 0;
+	//Rethrow the exception from computing a lookup table entry, if preparePair threw allMarkerPairData::computeFailed. Call this after the parallel region.
+	virtual void rethrowLookupFailure() = 0;
 };
 unsigned long long estimateLookup(rfhaps_internal_args& internal_args);
-bool estimateRFSpecificDesign(rfhaps_internal_args& internal_args, unsigned long long& counter);
+//Returns an empty pointer if the design is not supported.
+std::unique_ptr<designLikelihood> createDesignLikelihood(rfhaps_internal_args& internal_args);
 /* Preprocess inputs
  *
  * Preprocess inputs in preparation for estimating recombination fractions
@@ -1,6 +1,63 @@
 #ifndef FUNNEL_HAPLOTYPE_TO_MARKER_HEADER_GUARD
 #define FUNNEL_HAPLOTYPE_TO_MARKER_HEADER_GUARD
+#include "matrices.hpp"
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 template<int nFounders, int maxAlleles, bool infiniteSelfing> struct funnelHaplotypeToMarker;
+/*
+ * Convert counts of founder genotypes into marker probabilities, for every recombination fraction at once. counts is as computed by funnelHaplotypeToMarker::countGenotypes, and has index (firstMarkerValue * nSecondMarkerValues + secondMarkerValue) * nDifferentProbs + differentProbCounter.
+ * transposedHaplotypeProbabilities has index differentProbCounter * nPoints + recombCounter, so the inner loop is over contiguous recombination fractions and can be vectorised. The values are summed in the same order as for a single recombination fraction, so the results don't depend on the vectorisation.
+ */
+template<int maxAlleles, bool takeLogs> void genotypeCountsToMarkerProbabilities(const std::vector<double>& counts, int nDifferentProbs, const double* transposedHaplotypeProbabilities, int nPoints, array2<maxAlleles>* markerProbabilities, int nFirstMarkerValues, int nSecondMarkerValues)
+{
+	std::vector<double> markerProbabilitiesThisPair(nPoints);
+	for(int firstMarkerValue = 0; firstMarkerValue < nFirstMarkerValues; firstMarkerValue++)
+	{
+		for(int secondMarkerValue = 0; secondMarkerValue < nSecondMarkerValues; secondMarkerValue++)
+		{
+			const double* countsThisPair = &(counts[(firstMarkerValue * nSecondMarkerValues + secondMarkerValue) * nDifferentProbs]);
+			std::fill(markerProbabilitiesThisPair.begin(), markerProbabilitiesThisPair.end(), 0.0);
+			double* destination = &(markerProbabilitiesThisPair[0]);
+			for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++)
+			{
+				const double count = countsThisPair[differentProbCounter];
+				if(count > 0)
+				{
+					const double* source = transposedHaplotypeProbabilities + differentProbCounter * nPoints;
+					for(int recombCounter = 0; recombCounter < nPoints; recombCounter++) destination[recombCounter] += count * source[recombCounter];
+				}
+			}
+			for(int recombCounter = 0; recombCounter < nPoints; recombCounter++)
+			{
+				double currentMarkerProb = destination[recombCounter];
+				if(takeLogs)
+				{
+					if(currentMarkerProb == 0) currentMarkerProb = -std::numeric_limits<double>::infinity();
+					else currentMarkerProb = log10(currentMarkerProb);
+				}
+				markerProbabilities[recombCounter].values[firstMarkerValue][secondMarkerValue] = currentMarkerProb;
+			}
+		}
+	}
+}
+//Copy the compressed haplotype probabilities for a single number of generations of selfing into the layout required by genotypeCountsToMarkerProbabilities.
+template<typename compressedProbabilitiesType> void transposeHaplotypeProbabilities(rowMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, int selfingGenerationsIndex, std::vector<double>& transposed)
+{
+	int nPoints = haplotypeProbabilities.getNRows();
+	int nDifferentProbs = (int)std::tuple_size<compressedProbabilitiesType>::value;
+	transposed.resize((std::size_t)nPoints * nDifferentProbs);
+	for(int recombCounter = 0; recombCounter < nPoints; recombCounter++)
+	{
+		const compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb = haplotypeProbabilities(recombCounter, selfingGenerationsIndex);
+		for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++)
+		{
+			transposed[differentProbCounter * nPoints + recombCounter] = haplotypeProbabilitiesThisRecomb[differentProbCounter];
+		}
+	}
+}
 #include "funnelHaplotypeToMarkerInfiniteSelfing.hpp"
 #include "funnelHaplotypeToMarkerFiniteSelfing.hpp"
 #endif
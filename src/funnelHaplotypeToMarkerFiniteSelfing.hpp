@@ -7,67 +7,68 @@ private:
 public:
 	static const int nDifferentProbs = compressedProbabilities<nFounders, false>::nDifferentProbs;
 	typedef typename std::array<double, nDifferentProbs> compressedProbabilitiesType;
-	template<bool takeLogs> static void convert(rowMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, funnelEncoding enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
+	/*
+	 * Count the pairs of founder genotypes which give each pair of marker values, for each of the compressed probabilities. These counts depend on the funnel, but not on the recombination fraction or the number of generations of selfing, so they only need to be computed once per funnel. See genotypeCountsToMarkerProbabilities for the layout of counts. 
+	 * The marker value of every founder genotype is looked up once, with the founders permuted by the funnel, and the genotypes at the second marker are bucketed by marker value. So every pair of genotypes is visited exactly once, without the data-dependent branches of testing each genotype against each marker value. 
+	 */
+	static void countGenotypes(std::vector<double>& counts, const funnelEncoding& enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData)
 	{
+		const int nGenotypes = nFounders*nFounders;
 		int funnel[nFounders];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			funnel[founderCounter] = ((enc & ((std::size_t)15 << (4*founderCounter))) >> (4*founderCounter));
+			funnel[founderCounter] = enc[founderCounter];
 		}
-		int table[maxAlleles][maxAlleles][nDifferentProbs];
-		memset(table, 0, sizeof(int)*maxAlleles*maxAlleles*nDifferentProbs);
-		for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
+		const int nFirstMarkerValues = firstMarkerPatternData.nObservedValues, nSecondMarkerValues = secondMarkerPatternData.nObservedValues;
+		//The marker value for each genotype, indexed by intermediateAllelesMask. Genotypes which don't give an observed value are -1.
+		int firstMarkerValues[nGenotypes];
+		//The genotypes at the second marker, sorted by marker value. The genotypes with marker value v are secondGenotypes[secondBucketStart[v]] to secondGenotypes[secondBucketStart[v+1] - 1]
+		int secondGenotypes[nGenotypes];
+		std::vector<int> secondBucketStart(nSecondMarkerValues + 1, 0);
+		int secondMarkerValues[nGenotypes];
+		for(int founder1 = 0; founder1 < nFounders; founder1++)
 		{
-			//firstFounder is the index of the founder within the current funnel
-			for(int firstFounder1 = 0; firstFounder1 < nFounders; firstFounder1++)
+			for(int founder2 = 0; founder2 < nFounders; founder2++)
 			{
-				for(int firstFounder2 = 0; firstFounder2 < nFounders; firstFounder2++)
-				{
-					if(firstMarkerPatternData.hetData(funnel[firstFounder1], funnel[firstFounder2]) == firstMarkerValue)
-					{
-						int index1 = probabilityData<nFounders>::intermediateAllelesMask[firstFounder1][firstFounder2];
-						for(int secondMarkerValue = 0; secondMarkerValue < secondMarkerPatternData.nObservedValues; secondMarkerValue++)
-						{
-							for(int secondFounder1 = 0; secondFounder1 < nFounders; secondFounder1++)
-							{
-								for(int secondFounder2 = 0; secondFounder2 < nFounders; secondFounder2++)
-								{
-									if(secondMarkerPatternData.hetData(funnel[secondFounder1],funnel[secondFounder2]) == secondMarkerValue)
-									{
-										int index2 = probabilityData<nFounders>::intermediateAllelesMask[secondFounder1][secondFounder2];
-										table[firstMarkerValue][secondMarkerValue][probabilityData<nFounders>::intermediateProbabilitiesMask[index1][index2]]++;
-									}
-								}
-							}
-						}
-					}
-				}
+				const int index = probabilityData<nFounders>::intermediateAllelesMask[founder1][founder2];
+				int firstMarkerValue = firstMarkerPatternData.hetData(funnel[founder1], funnel[founder2]);
+				firstMarkerValues[index] = (firstMarkerValue >= 0 && firstMarkerValue < nFirstMarkerValues) ? firstMarkerValue : -1;
+				int secondMarkerValue = secondMarkerPatternData.hetData(funnel[founder1], funnel[founder2]);
+				secondMarkerValues[index] = (secondMarkerValue >= 0 && secondMarkerValue < nSecondMarkerValues) ? secondMarkerValue : -1;
+				if(secondMarkerValues[index] >= 0) secondBucketStart[secondMarkerValue+1]++;
 			}
 		}
-		int nPoints = haplotypeProbabilities.getNRows();
-		for(int recombCounter = 0; recombCounter < nPoints; recombCounter++)
+		for(int secondMarkerValue = 0; secondMarkerValue < nSecondMarkerValues; secondMarkerValue++) secondBucketStart[secondMarkerValue+1] += secondBucketStart[secondMarkerValue];
 		{
-			array2<maxAlleles>& markerProbabilitiesThisRecomb = markerProbabilities[recombCounter];
-			compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb = haplotypeProbabilities(recombCounter, selfingGenerationsIndex);
-			for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
+			std::vector<int> nextPosition(secondBucketStart.begin(), secondBucketStart.end() - 1);
+			for(int index = 0; index < nGenotypes; index++)
 			{
-				for(int secondMarkerValue = 0; secondMarkerValue < secondMarkerPatternData.nObservedValues; secondMarkerValue++)
+				if(secondMarkerValues[index] >= 0) secondGenotypes[nextPosition[secondMarkerValues[index]]++] = index;
+			}
+		}
+		counts.assign((std::size_t)nFirstMarkerValues * nSecondMarkerValues * nDifferentProbs, 0);
+		for(int index1 = 0; index1 < nGenotypes; index1++)
+		{
+			const int firstMarkerValue = firstMarkerValues[index1];
+			if(firstMarkerValue < 0) continue;
+			const int* maskRow = probabilityData<nFounders>::intermediateProbabilitiesMask[index1];
+			for(int secondMarkerValue = 0; secondMarkerValue < nSecondMarkerValues; secondMarkerValue++)
+			{
+				double* countsThisPair = &(counts[(firstMarkerValue * nSecondMarkerValues + secondMarkerValue) * nDifferentProbs]);
+				for(int position = secondBucketStart[secondMarkerValue]; position < secondBucketStart[secondMarkerValue+1]; position++)
 				{
-					double currentMarkerProb = 0;
-					for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++)
-					{
-						if(table[firstMarkerValue][secondMarkerValue][differentProbCounter] > 0) currentMarkerProb += table[firstMarkerValue][secondMarkerValue][differentProbCounter]*haplotypeProbabilitiesThisRecomb[differentProbCounter];
-					}
-					if(takeLogs)
-					{
-						if(currentMarkerProb == 0) currentMarkerProb = -std::numeric_limits<double>::infinity();
-						else currentMarkerProb = log10(currentMarkerProb);
-					}
-					markerProbabilitiesThisRecomb.values[firstMarkerValue][secondMarkerValue] = currentMarkerProb;
+					countsThisPair[maskRow[secondGenotypes[position]]]++;
 				}
 			}
 		}
 	}
+	template<bool takeLogs> static void convert(rowMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, const funnelEncoding& enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
+	{
+		std::vector<double> counts, transposedHaplotypeProbabilities;
+		countGenotypes(counts, enc, firstMarkerPatternData, secondMarkerPatternData);
+		transposeHaplotypeProbabilities(haplotypeProbabilities, selfingGenerationsIndex, transposedHaplotypeProbabilities);
+		genotypeCountsToMarkerProbabilities<maxAlleles, takeLogs>(counts, nDifferentProbs, &(transposedHaplotypeProbabilities[0]), haplotypeProbabilities.getNRows(), markerProbabilities, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues);
+	}
 	template<bool takeLogs> static void convert16MarkerAlleles(array2<16>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int funnel[16], const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
 	{
 		memset(&markerProbabilitiesThisRecomb, 0, sizeof(array2<16>));
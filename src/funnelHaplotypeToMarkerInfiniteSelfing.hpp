@@ -8,58 +8,41 @@ private:
 public:
 	static const int nDifferentProbs = compressedProbabilities<nFounders, true>::nDifferentProbs;
 	typedef typename std::array<double, nDifferentProbs> compressedProbabilitiesType;
-	template<bool takeLogs> static void convert(rowMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, funnelEncoding enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
+	//Count the pairs of founders which give each pair of marker values, for each of the compressed probabilities. See the finite selfing case. 
+	static void countGenotypes(std::vector<double>& counts, const funnelEncoding& enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData)
 	{
 		int funnel[16];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			funnel[founderCounter] = ((enc & ((std::size_t)15 << (4*founderCounter))) >> (4*founderCounter));
+			funnel[founderCounter] = enc[founderCounter];
 		}
-		int nPoints = haplotypeProbabilities.getNRows();
-		int table[maxAlleles][maxAlleles][nDifferentProbs];
-		memset(table, 0, sizeof(int)*maxAlleles*maxAlleles*nDifferentProbs);
-		for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
+		const int nFirstMarkerValues = firstMarkerPatternData.nObservedValues, nSecondMarkerValues = secondMarkerPatternData.nObservedValues;
+		int firstMarkerValues[nFounders], secondMarkerValues[nFounders];
+		for(int founder = 0; founder < nFounders; founder++)
 		{
-			for(int firstFounder = 0; firstFounder < nFounders; firstFounder++)
-			{
-				if(firstMarkerPatternData.hetData(funnel[firstFounder], funnel[firstFounder]) == firstMarkerValue)
-				{
-					for(int secondMarkerValue = 0; secondMarkerValue < secondMarkerPatternData.nObservedValues; secondMarkerValue++)
-					{
-						for(int secondFounder = 0; secondFounder < nFounders; secondFounder++)
-						{
-							if(secondMarkerPatternData.hetData(funnel[secondFounder], funnel[secondFounder]) == secondMarkerValue)
-							{
-								table[firstMarkerValue][secondMarkerValue][probabilityData<nFounders>::infiniteMask[firstFounder][secondFounder]]++;
-							}
-						}
-					}
-				}
-			}
+			int firstMarkerValue = firstMarkerPatternData.hetData(funnel[founder], funnel[founder]);
+			firstMarkerValues[founder] = (firstMarkerValue >= 0 && firstMarkerValue < nFirstMarkerValues) ? firstMarkerValue : -1;
+			int secondMarkerValue = secondMarkerPatternData.hetData(funnel[founder], funnel[founder]);
+			secondMarkerValues[founder] = (secondMarkerValue >= 0 && secondMarkerValue < nSecondMarkerValues) ? secondMarkerValue : -1;
 		}
-		for(int recombCounter = 0; recombCounter < nPoints; recombCounter++)
+		counts.assign((std::size_t)nFirstMarkerValues * nSecondMarkerValues * nDifferentProbs, 0);
+		for(int firstFounder = 0; firstFounder < nFounders; firstFounder++)
 		{
-			array2<maxAlleles>& markerProbabilitiesThisRecomb = markerProbabilities[recombCounter];
-			compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb = haplotypeProbabilities(recombCounter, selfingGenerationsIndex);
-			for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
+			if(firstMarkerValues[firstFounder] < 0) continue;
+			for(int secondFounder = 0; secondFounder < nFounders; secondFounder++)
 			{
-				for(int secondMarkerValue = 0; secondMarkerValue < secondMarkerPatternData.nObservedValues; secondMarkerValue++)
-				{
-					double currentMarkerProb = 0;
-					for(int differentProbCounter = 0; differentProbCounter < nDifferentProbs; differentProbCounter++)
-					{
-						if(table[firstMarkerValue][secondMarkerValue][differentProbCounter] > 0) currentMarkerProb += table[firstMarkerValue][secondMarkerValue][differentProbCounter]*haplotypeProbabilitiesThisRecomb[differentProbCounter];
-					}
-					if(takeLogs)
-					{
-						if(currentMarkerProb == 0) currentMarkerProb = -std::numeric_limits<double>::infinity();
-						else currentMarkerProb = log10(currentMarkerProb);
-					}
-					markerProbabilitiesThisRecomb.values[firstMarkerValue][secondMarkerValue] = currentMarkerProb;
-				}
+				if(secondMarkerValues[secondFounder] < 0) continue;
+				counts[(firstMarkerValues[firstFounder] * nSecondMarkerValues + secondMarkerValues[secondFounder]) * nDifferentProbs + probabilityData<nFounders>::infiniteMask[firstFounder][secondFounder]]++;
 			}
 		}
 	}
+	template<bool takeLogs> static void convert(rowMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, const funnelEncoding& enc, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
+	{
+		std::vector<double> counts, transposedHaplotypeProbabilities;
+		countGenotypes(counts, enc, firstMarkerPatternData, secondMarkerPatternData);
+		transposeHaplotypeProbabilities(haplotypeProbabilities, selfingGenerationsIndex, transposedHaplotypeProbabilities);
+		genotypeCountsToMarkerProbabilities<maxAlleles, takeLogs>(counts, nDifferentProbs, &(transposedHaplotypeProbabilities[0]), haplotypeProbabilities.getNRows(), markerProbabilities, firstMarkerPatternData.nObservedValues, secondMarkerPatternData.nObservedValues);
+	}
 	template<bool takeLogs> static void convert16MarkerAlleles(array2<16>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int funnel[16], const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex)
 	{
 		memset(&markerProbabilitiesThisRecomb, 0, sizeof(array2<16>));
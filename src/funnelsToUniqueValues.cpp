@@ -6,11 +6,11 @@ void funnelsToUniqueValues(std::map<funnelEncoding, funnelID>& funnelTranslation
 	for(std::vector<funnelType>::iterator i = lineFunnels.begin(); i != lineFunnels.end(); i++)
 	{
 		funnelType funnel = *i;
-		std::size_t encoded = 0;
+		funnelEncoding encoded;
 		bool isZero = true;
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			encoded += (((std::size_t)funnel.val[founderCounter]-(std::size_t)1) << (4 * founderCounter));
+			encoded.founders[founderCounter] = (unsigned char)(funnel.val[founderCounter] - 1);
 			isZero &= (funnel.val[founderCounter] == 0);
 		}
 		//If it's a dummy value, ignore it
@@ -37,10 +37,10 @@ void funnelsToUniqueValues(std::map<funnelEncoding, funnelID>& funnelTranslation
 	for(std::vector<funnelType>::iterator i = allFunnels.begin(); i != allFunnels.end(); i++)
 	{
 		funnelType funnel = *i;
-		std::size_t encoded = 0;
+		funnelEncoding encoded;
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			encoded += (((std::size_t)funnel.val[founderCounter]-(std::size_t)1) << (4 * founderCounter));
+			encoded.founders[founderCounter] = (unsigned char)(funnel.val[founderCounter] - 1);
 		}
 		if(funnelTranslation.find(encoded) == funnelTranslation.end())
 		{
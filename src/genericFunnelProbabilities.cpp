@@ -0,0 +1,332 @@
+#include "genericFunnelProbabilities.h"
+#include <stdexcept>
+#include <algorithm>
+#include <map>
+//The shape of the funnel which splits the founders into two halves, with the extra founder in the first half
+static void appendHalvingShape(int count, std::vector<int>& shape)
+{
+	shape.push_back(count);
+	if(count == 1) return;
+	int leftCount = (count + 1) / 2;
+	appendHalvingShape(leftCount, shape);
+	appendHalvingShape(count - leftCount, shape);
+}
+//Check that the subtree at position node of the shape is a valid tree of crosses, and return the position after it
+static int checkShape(const std::vector<int>& shape, int node)
+{
+	if(node >= (int)shape.size() || shape[node] < 1) throw std::runtime_error("Invalid funnel shape");
+	if(shape[node] == 1) return node + 1;
+	int right = checkShape(shape, node + 1);
+	if(right >= (int)shape.size() || shape[node + 1] + shape[right] != shape[node]) throw std::runtime_error("Invalid funnel shape");
+	return checkShape(shape, right);
+}
+/*
+ * For crosses of the funnel where the two parents have the same shape, the permutation of the founders that swaps the two parents. These generate every permutation of the founders that leaves the funnel unchanged. 
+ * If the parents have the same shape then a swap within the second parent is a swap within the first parent, conjugated by the swap of the two parents. So only the crosses within the first parent are needed, which for 64 founders gives 6 permutations instead of 63. 
+ */
+static void symmetricCrosses(const std::vector<int>& shape, int node, int first, int nFounders, std::vector<std::vector<int> >& permutations)
+{
+	int count = shape[node];
+	if(count == 1) return;
+	int left = node + 1, leftCount = shape[left], right = node + 2 * leftCount;
+	if(2 * leftCount == count && std::equal(shape.begin() + left, shape.begin() + right, shape.begin() + right))
+	{
+		std::vector<int> permutation(nFounders);
+		for(int founder = 0; founder < nFounders; founder++) permutation[founder] = founder;
+		for(int founder = first; founder < first + leftCount; founder++) std::swap(permutation[founder], permutation[founder + leftCount]);
+		permutations.push_back(permutation);
+		symmetricCrosses(shape, left, first, nFounders, permutations);
+	}
+	else
+	{
+		symmetricCrosses(shape, left, first, nFounders, permutations);
+		symmetricCrosses(shape, right, first + leftCount, nFounders, permutations);
+	}
+}
+static int findClass(std::vector<int>& parent, int state)
+{
+	while(parent[state] != state)
+	{
+		parent[state] = parent[parent[state]];
+		state = parent[state];
+	}
+	return state;
+}
+static void joinClasses(std::vector<int>& parent, int state1, int state2)
+{
+	state1 = findClass(parent, state1);
+	state2 = findClass(parent, state2);
+	if(state1 < state2) parent[state2] = state1;
+	else if(state2 < state1) parent[state1] = state2;
+}
+//Number the classes in order of their first state, and count the states in each
+static void classesToMask(std::vector<int>& parent, std::vector<int>& mask, std::vector<int>& classSizes, std::vector<int>& representatives)
+{
+	mask.resize(parent.size());
+	classSizes.clear();
+	representatives.clear();
+	for(int state = 0; state < (int)parent.size(); state++)
+	{
+		int root = findClass(parent, state);
+		if(root == state)
+		{
+			mask[state] = (int)classSizes.size();
+			classSizes.push_back(0);
+			representatives.push_back(state);
+		}
+		else mask[state] = mask[root];
+		classSizes[mask[state]]++;
+	}
+}
+genericFunnelProbabilities::genericFunnelProbabilities(int nFounders)
+	: nFounders(nFounders)
+{
+	if(nFounders < 2) throw std::runtime_error("Number of founders must be at least 2");
+	appendHalvingShape(nFounders, shape);
+	initialise();
+}
+genericFunnelProbabilities::genericFunnelProbabilities(int nFounders, const std::vector<int>& shape)
+	: nFounders(nFounders), shape(shape)
+{
+	if(nFounders < 2) throw std::runtime_error("Number of founders must be at least 2");
+	if(shape.size() == 0 || shape[0] != nFounders || checkShape(shape, 0) != (int)shape.size()) throw std::runtime_error("Invalid funnel shape");
+	initialise();
+}
+void genericFunnelProbabilities::initialise()
+{
+	const int n = nFounders, nGenotypes = n * n, nStates = nGenotypes * nGenotypes;
+	std::vector<std::vector<int> > permutations;
+	symmetricCrosses(shape, 0, 0, nFounders, permutations);
+
+	std::vector<int> parent(nStates), unusedRepresentatives;
+	for(int state = 0; state < nStates; state++) parent[state] = state;
+	for(int state = 0; state < nStates; state++)
+	{
+		int b2 = state % n, b1 = (state / n) % n, a2 = (state / nGenotypes) % n, a1 = state / nGenotypes / n;
+		//Swap the haplotypes, and swap the loci
+		joinClasses(parent, state, (a2 * n + a1) * nGenotypes + b2 * n + b1);
+		joinClasses(parent, state, (b1 * n + b2) * nGenotypes + a1 * n + a2);
+		for(std::vector<std::vector<int> >::iterator permutation = permutations.begin(); permutation != permutations.end(); permutation++)
+		{
+			const std::vector<int>& p = *permutation;
+			joinClasses(parent, state, (p[a1] * n + p[a2]) * nGenotypes + p[b1] * n + p[b2]);
+		}
+	}
+	classesToMask(parent, finiteMask, finiteClassSizes, finiteRepresentatives);
+
+	parent.resize(nGenotypes);
+	for(int state = 0; state < nGenotypes; state++) parent[state] = state;
+	for(int state = 0; state < nGenotypes; state++)
+	{
+		int b = state % n, a = state / n;
+		joinClasses(parent, state, b * n + a);
+		for(std::vector<std::vector<int> >::iterator permutation = permutations.begin(); permutation != permutations.end(); permutation++)
+		{
+			joinClasses(parent, state, (*permutation)[a] * n + (*permutation)[b]);
+		}
+	}
+	classesToMask(parent, infiniteMask, infiniteClassSizes, unusedRepresentatives);
+
+	const int nClasses = (int)finiteClassSizes.size();
+	transitionStart.assign(1, 0);
+	transitionTarget.clear();
+	transitionCounts.clear();
+	fixedClasses.resize(nClasses);
+	for(int classCounter = 0; classCounter < nClasses; classCounter++)
+	{
+		int state = finiteRepresentatives[classCounter];
+		int b2 = state % n, b1 = (state / n) % n, a2 = (state / nGenotypes) % n, a1 = state / nGenotypes / n;
+		//The four possible gametes, being the two haplotypes and the two recombinants
+		const int gameteFirst[4] = {a1, a2, a1, a2};
+		const int gameteSecond[4] = {b1, b2, b2, b1};
+		std::map<int, std::array<int, 3> > counts;
+		for(int i = 0; i < 4; i++)
+		{
+			for(int j = 0; j < 4; j++)
+			{
+				int target = finiteMask[(gameteFirst[i] * n + gameteFirst[j]) * nGenotypes + gameteSecond[i] * n + gameteSecond[j]];
+				std::map<int, std::array<int, 3> >::iterator current = counts.find(target);
+				if(current == counts.end())
+				{
+					std::array<int, 3> zero = {{0, 0, 0}};
+					current = counts.insert(std::make_pair(target, zero)).first;
+				}
+				current->second[(i >= 2) + (j >= 2)]++;
+			}
+		}
+		for(std::map<int, std::array<int, 3> >::iterator i = counts.begin(); i != counts.end(); i++)
+		{
+			transitionTarget.push_back(i->first);
+			transitionCounts.push_back(i->second);
+		}
+		transitionStart.push_back((int)transitionTarget.size());
+		std::array<int, 4> fixed = {{infiniteMask[a1 * n + b1], infiniteMask[a2 * n + b2], infiniteMask[a1 * n + b2], infiniteMask[a2 * n + b1]}};
+		fixedClasses[classCounter] = fixed;
+	}
+}
+void genericFunnelProbabilities::gametes(int node, int first, double r, std::vector<double>& result) const
+{
+	result.assign((std::size_t)nFounders * nFounders, 0);
+	int count = shape[node];
+	if(count == 1)
+	{
+		result[(std::size_t)first * nFounders + first] = 1;
+		return;
+	}
+	int leftCount = shape[node + 1];
+	std::vector<double> left, right;
+	gametes(node + 1, first, r, left);
+	gametes(node + 2 * leftCount, first + leftCount, r, right);
+	//The distributions of the founder at each locus, for a gamete from each side
+	std::vector<double> leftFirst(nFounders, 0), leftSecond(nFounders, 0), rightFirst(nFounders, 0), rightSecond(nFounders, 0);
+	for(int x = 0; x < nFounders; x++)
+	{
+		for(int y = 0; y < nFounders; y++)
+		{
+			leftFirst[x] += left[x * nFounders + y];
+			leftSecond[y] += left[x * nFounders + y];
+			rightFirst[x] += right[x * nFounders + y];
+			rightSecond[y] += right[x * nFounders + y];
+		}
+	}
+	//A gamete is either one of the two haplotypes, or a recombinant of the two
+	for(int x = 0; x < nFounders; x++)
+	{
+		for(int y = 0; y < nFounders; y++)
+		{
+			std::size_t index = (std::size_t)x * nFounders + y;
+			result[index] = (1 - r) * (left[index] + right[index]) / 2 + r * (leftFirst[x] * rightSecond[y] + rightFirst[x] * leftSecond[y]) / 2;
+		}
+	}
+}
+void genericFunnelProbabilities::initialClassProbabilities(double r, std::vector<double>& result) const
+{
+	const int n = nFounders, nGenotypes = n * n;
+	int leftCount = shape[1];
+	std::vector<double> left, right;
+	gametes(1, 0, r, left);
+	gametes(2 * leftCount, leftCount, r, right);
+	result.resize(finiteClassSizes.size());
+	for(std::size_t classCounter = 0; classCounter < finiteClassSizes.size(); classCounter++)
+	{
+		int state = finiteRepresentatives[classCounter];
+		int b2 = state % n, b1 = (state / n) % n, a2 = (state / nGenotypes) % n, a1 = state / nGenotypes / n;
+		//Either haplotype can be the first, so the distribution is symmetric
+		result[classCounter] = finiteClassSizes[classCounter] * (left[a1 * n + b1] * right[a2 * n + b2] + right[a1 * n + b1] * left[a2 * n + b2]) / 2;
+	}
+}
+void genericFunnelProbabilities::compressedFiniteSelfing(double r, int selfingGenerations, double* result) const
+{
+	if(selfingGenerations < 0) throw std::runtime_error("Number of generations of selfing cannot be negative");
+	std::vector<double> current, next;
+	initialClassProbabilities(r, current);
+	const int nClasses = (int)current.size();
+	//The probability of a pair of gametes with no, one or two recombinant gametes
+	const double weights[3] = {(1 - r) * (1 - r) / 4, r * (1 - r) / 4, r * r / 4};
+	for(int generation = 0; generation < selfingGenerations; generation++)
+	{
+		next.assign(nClasses, 0);
+		for(int classCounter = 0; classCounter < nClasses; classCounter++)
+		{
+			double probability = current[classCounter];
+			if(probability == 0) continue;
+			for(int transition = transitionStart[classCounter]; transition < transitionStart[classCounter + 1]; transition++)
+			{
+				const std::array<int, 3>& counts = transitionCounts[transition];
+				next[transitionTarget[transition]] += probability * (counts[0] * weights[0] + counts[1] * weights[1] + counts[2] * weights[2]);
+			}
+		}
+		current.swap(next);
+	}
+	for(int classCounter = 0; classCounter < nClasses; classCounter++) result[classCounter] = current[classCounter] / finiteClassSizes[classCounter];
+}
+void genericFunnelProbabilities::compressedInfiniteSelfing(double r, double* result) const
+{
+	std::vector<double> initial;
+	initialClassProbabilities(r, initial);
+	const int nClasses = (int)infiniteClassSizes.size();
+	std::vector<double> total(nClasses, 0);
+	//Selfing to fixation gives each of the two haplotypes with probability 1/(2(1+2r)), and each of the two recombinants with probability r/(1+2r)
+	const double haplotypeProbability = 1 / (2 * (1 + 2 * r)), recombinantProbability = r / (1 + 2 * r);
+	for(std::size_t classCounter = 0; classCounter < initial.size(); classCounter++)
+	{
+		const std::array<int, 4>& fixed = fixedClasses[classCounter];
+		total[fixed[0]] += initial[classCounter] * haplotypeProbability;
+		total[fixed[1]] += initial[classCounter] * haplotypeProbability;
+		total[fixed[2]] += initial[classCounter] * recombinantProbability;
+		total[fixed[3]] += initial[classCounter] * recombinantProbability;
+	}
+	for(int classCounter = 0; classCounter < nClasses; classCounter++) result[classCounter] = total[classCounter] / infiniteClassSizes[classCounter];
+}
+void genericFunnelProbabilities::singleLocus(int selfingGenerations, bool infiniteSelfing, std::vector<double>& result) const
+{
+	//Without recombination the alleles at the second locus are the same as at the first
+	const int n = nFounders, nGenotypes = n * n;
+	result.assign(nGenotypes, 0);
+	std::vector<double> compressed(getNDifferentProbs(infiniteSelfing));
+	if(infiniteSelfing)
+	{
+		compressedInfiniteSelfing(0, &(compressed[0]));
+		for(int a = 0; a < n; a++) result[a * n + a] = compressed[infiniteMask[a * n + a]];
+	}
+	else
+	{
+		compressedFiniteSelfing(0, selfingGenerations, &(compressed[0]));
+		for(int genotype = 0; genotype < nGenotypes; genotype++) result[genotype] = compressed[finiteMask[genotype * nGenotypes + genotype]];
+	}
+}
+void genericFunnelProbabilities::finiteSelfing(double r, int selfingGenerations, std::vector<double>& result) const
+{
+	if(selfingGenerations < 0) throw std::runtime_error("Number of generations of selfing cannot be negative");
+	std::vector<double> compressed(getNDifferentProbs(false));
+	compressedFiniteSelfing(r, selfingGenerations, &(compressed[0]));
+	result.resize(finiteMask.size());
+	for(std::size_t state = 0; state < finiteMask.size(); state++) result[state] = compressed[finiteMask[state]];
+}
+void genericFunnelProbabilities::infiniteSelfing(double r, std::vector<double>& result) const
+{
+	std::vector<double> compressed(getNDifferentProbs(true));
+	compressedInfiniteSelfing(r, &(compressed[0]));
+	result.resize(infiniteMask.size());
+	for(std::size_t state = 0; state < infiniteMask.size(); state++) result[state] = compressed[infiniteMask[state]];
+}
+SEXP genericFunnelProbabilities_RInterface(SEXP nFounders_sexp, SEXP r_sexp, SEXP selfingGenerations_sexp, SEXP infiniteSelfing_sexp)
+{
+BEGIN_RCPP
+	int nFounders = Rcpp::as<int>(nFounders_sexp);
+	double r = Rcpp::as<double>(r_sexp);
+	int selfingGenerations = Rcpp::as<int>(selfingGenerations_sexp);
+	bool infiniteSelfing = Rcpp::as<bool>(infiniteSelfing_sexp);
+	if(nFounders < 2 || nFounders > 64) throw std::runtime_error("Input nFounders must be between 2 and 64");
+	if(!(r >= 0 && r <= 0.5)) throw std::runtime_error("Input r must be between 0 and 0.5");
+	genericFunnelProbabilities probabilities(nFounders);
+	std::vector<double> values;
+	//Reorder the values so that they can be indexed as result[a1, a2, b1, b2] (or result[a, b]) in R
+	if(infiniteSelfing)
+	{
+		probabilities.infiniteSelfing(r, values);
+		Rcpp::NumericVector result(values.size());
+		for(int a = 0; a < nFounders; a++)
+		{
+			for(int b = 0; b < nFounders; b++) result(a + nFounders * b) = values[a * nFounders + b];
+		}
+		result.attr("dim") = Rcpp::IntegerVector::create(nFounders, nFounders);
+		return result;
+	}
+	probabilities.finiteSelfing(r, selfingGenerations, values);
+	Rcpp::NumericVector result(values.size());
+	std::size_t n = nFounders;
+	for(std::size_t a1 = 0; a1 < n; a1++)
+	{
+		for(std::size_t a2 = 0; a2 < n; a2++)
+		{
+			for(std::size_t b1 = 0; b1 < n; b1++)
+			{
+				for(std::size_t b2 = 0; b2 < n; b2++) result(a1 + n * (a2 + n * (b1 + n * b2))) = values[((a1 * n + a2) * n + b1) * n + b2];
+			}
+		}
+	}
+	result.attr("dim") = Rcpp::IntegerVector::create(nFounders, nFounders, nFounders, nFounders);
+	return result;
+END_RCPP
+}
@@ -0,0 +1,70 @@
+#ifndef GENERIC_FUNNEL_PROBABILITIES_HEADER_GUARD
+#define GENERIC_FUNNEL_PROBABILITIES_HEADER_GUARD
+#include <Rcpp.h>
+#include <vector>
+#include <array>
+/** Two-point haplotype probabilities for a funnel with any number of founders, computed numerically
+ *
+ * The specialisations in probabilities2.cpp - probabilities16.cpp give closed forms for 2, 4, 8 and 16 founders. This class instead follows the pedigree one generation at a time. The funnel is a tree of crosses, given by its shape (see getFunnel), and by default the founders are split into two halves (the first half having the extra founder if there are an odd number) which are crossed recursively, in the same way as the funnels of the closed forms. The distribution of the two haplotypes of the resulting individual is then pushed through each generation of selfing.
+ * The states (a1, a2, b1, b2) are lumped into classes which always have the same probability. Two states are in the same class if one can be obtained from the other by swapping the founders of two crosses of the funnel which have the same shape, by swapping the two haplotypes, or by swapping the two loci. Selfing preserves these classes, so only one state of each class is followed through the generations of selfing. This gives the compressed probabilities, which play the same role as those of the closed forms, with finiteMask and infiniteMask in place of the masks of probabilityData.
+ * Probabilities are for a single funnel, with the founders in funnel order, and without intercrossing. Nothing is cached, and an object can be used from several threads at once. The lookup table and the Viterbi algorithm compute the compressed probabilities once for each recombination fraction and interval, so there is nothing to be gained by caching them here.
+ */
+class genericFunnelProbabilities
+{
+public:
+	genericFunnelProbabilities(int nFounders);
+	genericFunnelProbabilities(int nFounders, const std::vector<int>& shape);
+	int getNFounders() const
+	{
+		return nFounders;
+	}
+	//The number of classes of states, which is the number of compressed probabilities
+	int getNDifferentProbs(bool infiniteSelfing) const
+	{
+		return infiniteSelfing ? (int)infiniteClassSizes.size() : (int)finiteClassSizes.size();
+	}
+	//The class of alleles a1, a2 at the first locus and b1, b2 at the second, at index (a1 * nFounders + a2) * nFounders * nFounders + b1 * nFounders + b2.
+	const std::vector<int>& getFiniteMask() const
+	{
+		return finiteMask;
+	}
+	//The class of a line fixed for founder a at the first locus and founder b at the second, at index a * nFounders + b.
+	const std::vector<int>& getInfiniteMask() const
+	{
+		return infiniteMask;
+	}
+	//The probability of a single state of each class, for finite and infinite selfing. result must have getNDifferentProbs entries.
+	void compressedFiniteSelfing(double r, int selfingGenerations, double* result) const;
+	void compressedInfiniteSelfing(double r, double* result) const;
+	//The probability of alleles a1, a2 at a single locus, at index a1 * nFounders + a2. For infinite selfing only the homozygotes have non-zero probability.
+	void singleLocus(int selfingGenerations, bool infiniteSelfing, std::vector<double>& result) const;
+	//The probability of alleles a1, a2 at the first locus and b1, b2 at the second, where the haplotypes are (a1, b1) and (a2, b2). The value is at index ((a1 * nFounders + a2) * nFounders + b1) * nFounders + b2.
+	void finiteSelfing(double r, int selfingGenerations, std::vector<double>& result) const;
+	//The probability that a line is fixed for founder a at the first locus and founder b at the second, after infinite generations of selfing. The value is at index a * nFounders + b.
+	void infiniteSelfing(double r, std::vector<double>& result) const;
+private:
+	void initialise();
+	//The two-locus distribution of a gamete from the individual obtained by crossing the founders of the subtree at position node of the shape, which starts at founder first. The value is at index x * nFounders + y.
+	void gametes(int node, int first, double r, std::vector<double>& result) const;
+	//The total probability of each finite selfing class, for the individual obtained by crossing all the founders
+	void initialClassProbabilities(double r, std::vector<double>& result) const;
+	int nFounders;
+	//The number of founders descended from each cross of the funnel, in depth first order. See getFunnel.
+	std::vector<int> shape;
+	std::vector<int> finiteMask, infiniteMask;
+	std::vector<int> finiteClassSizes, infiniteClassSizes;
+	//A single state of each finite selfing class
+	std::vector<int> finiteRepresentatives;
+	//The transitions from the representative of each finite selfing class to every class, in one generation of selfing. The transitions from class c are at transitionStart[c] to transitionStart[c+1] - 1, and give the number of ways of reaching transitionTarget with no, one and two recombinant gametes. These don't depend on the recombination fraction.
+	std::vector<int> transitionStart, transitionTarget;
+	std::vector<std::array<int, 3> > transitionCounts;
+	//The infinite selfing classes of the two haplotypes and the two recombinant haplotypes of the representative of each finite selfing class
+	std::vector<std::array<int, 4> > fixedClasses;
+};
+//The closed forms are for 2, 4, 8 and 16 founders, and every other number of founders uses genericFunnelProbabilities
+inline bool usesGenericFunnelProbabilities(int nFounders)
+{
+	return nFounders != 2 && nFounders != 4 && nFounders != 8 && nFounders != 16;
+}
+SEXP genericFunnelProbabilities_RInterface(SEXP nFounders, SEXP r, SEXP selfingGenerations, SEXP infiniteSelfing);
+#endif
@@ -63,3 +63,46 @@ void getFunnel(long line, Rcpp::IntegerVector& mother, Rcpp::IntegerVector& fath
 		throw std::runtime_error("Input nFounders of getFunnel must be 2, 4, 8 or 16");
 	}
 }
+
+//The founders and shape of the funnel descended from a single row of the pedigree
+void traceFunnel(int row, Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father, int nFounders, std::vector<int>& funnel, std::vector<int>& shape)
+{
+	funnel.clear();
+	shape.clear();
+	if(mother(row) == 0 && father(row) == 0)
+	{
+		funnel.push_back(row+1);
+		shape.push_back(1);
+		return;
+	}
+	if(mother(row) == 0 || father(row) == 0 || mother(row) == father(row))
+	{
+		throw std::runtime_error("Funnel contained a line which was not a cross of two different lines");
+	}
+	std::vector<int> firstFunnel, firstShape, secondFunnel, secondShape;
+	traceFunnel(mother(row)-1, mother, father, nFounders, firstFunnel, firstShape);
+	traceFunnel(father(row)-1, mother, father, nFounders, secondFunnel, secondShape);
+	if(firstShape < secondShape || (firstShape == secondShape && secondFunnel < firstFunnel))
+	{
+		firstFunnel.swap(secondFunnel);
+		firstShape.swap(secondShape);
+	}
+	funnel.swap(firstFunnel);
+	funnel.insert(funnel.end(), secondFunnel.begin(), secondFunnel.end());
+	if((int)funnel.size() > nFounders) throw std::runtime_error("Funnel contained too many founders");
+	shape.push_back((int)funnel.size());
+	shape.insert(shape.end(), firstShape.begin(), firstShape.end());
+	shape.insert(shape.end(), secondShape.begin(), secondShape.end());
+}
+void getFunnel(long line, Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father, int* funnel, int nFounders, std::vector<int>& shape)
+{
+	int currentLine = line;
+	while(father(currentLine) == mother(currentLine) && mother(currentLine) != 0)
+	{
+		currentLine = father(currentLine)-1;
+	}
+	std::vector<int> founders;
+	traceFunnel(currentLine, mother, father, nFounders, founders, shape);
+	if((int)founders.size() != nFounders) throw std::runtime_error("Funnel contained the wrong number of founders");
+	std::copy(founders.begin(), founders.end(), funnel);
+}
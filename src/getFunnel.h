@@ -1,5 +1,11 @@
 #ifndef GET_FUNNEL_HEADER_GUARD
 #define GET_FUNNEL_HEADER_GUARD
 #include <Rcpp.h>
+#include <vector>
 void getFunnel(long line, Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father, int* funnel, int nFounders);
-#endif
\ No newline at end of file
+/*
+ * Get the funnel for other numbers of founders than 2, 4, 8 and 16, where the funnel can have any shape. The shape is the number of founders descended from each cross of the funnel, in depth first order with the first parent of a cross before the second, and with each founder counted as a cross of a single founder. 
+ * The parents of each cross are put in a canonical order, with the parent that has the larger shape first, and parents with the same shape ordered by their founders. So funnels which only differ in the order of the parents of some crosses are the same funnel, and have the same shape. 
+ */
+void getFunnel(long line, Rcpp::IntegerVector& mother, Rcpp::IntegerVector& father, int* funnel, int nFounders, std::vector<int>& shape);
+#endif
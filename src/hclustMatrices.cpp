@@ -1,4 +1,5 @@
 #include "hclustMatrices.h"
+#include "packedTriangleFile.h"
 R_xlen_t countPreClusterMarkers(SEXP preClusterResults_, bool& noDuplicates)
 {
 	Rcpp::List preClusterResults = preClusterResults_;
@@ -33,7 +34,8 @@ BEGIN_RCPP
 	Rcpp::S4 rf = mpcrossRF.slot("rf");
 
 	Rcpp::S4 theta = rf.slot("theta");
-	Rcpp::RawVector data = theta.slot("data");
+	rawSymmetricMatrixData thetaView(theta, false);
+	const Rbyte* data = thetaView.getData();
 	Rcpp::NumericVector levels = theta.slot("levels");
 	Rcpp::CharacterVector markers = theta.slot("markers");
 	if(markers.size() != preClusterMarkers)
@@ -59,7 +61,7 @@ BEGIN_RCPP
 					R_xlen_t marker2 = rowMarkers[rowMarkerCounter]-(R_xlen_t)1;
 					R_xlen_t column = std::max(marker1, marker2);
 					R_xlen_t row = std::min(marker1, marker2);
-					Rbyte thetaDataValue = data((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
+					Rbyte thetaDataValue = data[(column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row];
 					if(thetaDataValue != 0xFF)
 					{
 						total += levels(thetaDataValue);
@@ -96,11 +98,12 @@ BEGIN_RCPP
 	}
 	Rcpp::S4 lod = Rcpp::as<Rcpp::S4>(lodObject);
 	Rcpp::S4 theta = rf.slot("theta");
-	Rcpp::RawVector data = theta.slot("data");
+	rawSymmetricMatrixData thetaView(theta, false);
+	const Rbyte* data = thetaView.getData();
 	Rcpp::NumericVector levels = theta.slot("levels");
 	Rcpp::CharacterVector markers = theta.slot("markers");
-	Rcpp::NumericVector lodData = lod.slot("x");
-	if(markers.size() != preClusterMarkers || lodData.size() != (preClusterMarkers*(preClusterMarkers+(R_xlen_t)1))/(R_xlen_t)2)
+	dspMatrixData lodView(lod, false);
+	if(markers.size() != preClusterMarkers || lodView.getNValues() != (preClusterMarkers*(preClusterMarkers+(R_xlen_t)1))/(R_xlen_t)2)
 	{
 		throw std::runtime_error("Number of markers in precluster object was inconsistent with number of markers in mpcrossRF object");
 	}
@@ -111,7 +114,7 @@ BEGIN_RCPP
 	{
 		minDifference = std::min(minDifference, levels[i+1] - levels[i]);
 	}
-	double maxLod = *std::max_element(lodData.begin(), lodData.end());
+	double maxLod = lodView.max();
 	double lodMultiplier = minDifference/maxLod;
 	//Allocate enough storage. This symmetric matrix stores the *LOWER* triangular part, in column-major storage. Excluding the diagonal. 
 	Rcpp::NumericVector result(((resultDimension-(R_xlen_t)1)*resultDimension)/(R_xlen_t)2);
@@ -131,8 +134,8 @@ BEGIN_RCPP
 					R_xlen_t marker2 = rowMarkers[rowMarkerCounter]-(R_xlen_t)1;
 					R_xlen_t column = std::max(marker1, marker2);
 					R_xlen_t row = std::min(marker1, marker2);
-					Rbyte thetaDataValue = data((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
-					double currentLodDataValue = lodData((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
+					Rbyte thetaDataValue = data[(column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row];
+					double currentLodDataValue = lodView.get((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
 					if(thetaDataValue != 0xFF && currentLodDataValue != NA_REAL && currentLodDataValue == currentLodDataValue)
 					{
 						total += levels(thetaDataValue) + (maxLod - currentLodDataValue) *lodMultiplier;
@@ -168,13 +171,13 @@ BEGIN_RCPP
 		throw std::runtime_error("Slot mpcrossRF@rf@lod cannot be NULL if clusterBy is equal to \"combined\"");
 	}
 	Rcpp::S4 lod = Rcpp::as<Rcpp::S4>(lodObject);
-	Rcpp::NumericVector lodData = lod.slot("x");
-	if(lodData.size() != (preClusterMarkers*(preClusterMarkers+(R_xlen_t)1))/(R_xlen_t)2)
+	dspMatrixData lodView(lod, false);
+	if(lodView.getNValues() != (preClusterMarkers*(preClusterMarkers+(R_xlen_t)1))/(R_xlen_t)2)
 	{
 		throw std::runtime_error("Number of markers in precluster object was inconsistent with number of markers in mpcrossRF object");
 	}
 	R_xlen_t resultDimension = preClusterResults.size();
-	double maxLod = *std::max_element(lodData.begin(), lodData.end());
+	double maxLod = lodView.max();
 	//Allocate enough storage. This symmetric matrix stores the *LOWER* triangular part, in column-major storage. Excluding the diagonal. 
 	Rcpp::NumericVector result(((resultDimension-(R_xlen_t)1)*resultDimension)/(R_xlen_t)2);
 	for(R_xlen_t column = 0; column < resultDimension; column++)
@@ -193,7 +196,7 @@ BEGIN_RCPP
 					R_xlen_t marker2 = rowMarkers[rowMarkerCounter]-(R_xlen_t)1;
 					R_xlen_t column = std::max(marker1, marker2);
 					R_xlen_t row = std::min(marker1, marker2);
-					double currentLodDataValue = lodData((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
+					double currentLodDataValue = lodView.get((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
 					if(currentLodDataValue != NA_REAL && currentLodDataValue == currentLodDataValue)
 					{
 						total += currentLodDataValue;
@@ -0,0 +1,92 @@
+#include "identicalMarkers.h"
+#include "crc32.h"
+#include <cstring>
+#include <unordered_map>
+namespace
+{
+	struct designData
+	{
+		Rcpp::IntegerMatrix founders, finals;
+		std::vector<Rcpp::IntegerMatrix> hetData;
+	};
+	bool sameMarker(const std::vector<designData>& designs, int marker1, int marker2)
+	{
+		for(std::vector<designData>::const_iterator design = designs.begin(); design != designs.end(); design++)
+		{
+			int nFounders = design->founders.nrow(), nFinals = design->finals.nrow();
+			if(memcmp(&(design->founders(0, marker1)), &(design->founders(0, marker2)), sizeof(int) * nFounders) != 0) return false;
+			if(nFinals > 0 && memcmp(&(design->finals(0, marker1)), &(design->finals(0, marker2)), sizeof(int) * nFinals) != 0) return false;
+			const Rcpp::IntegerMatrix& hetData1 = design->hetData[marker1], &hetData2 = design->hetData[marker2];
+			if(hetData1.nrow() != hetData2.nrow() || hetData1.ncol() != hetData2.ncol()) return false;
+			if(hetData1.size() > 0 && memcmp(&(hetData1[0]), &(hetData2[0]), sizeof(int) * hetData1.size()) != 0) return false;
+		}
+		return true;
+	}
+}
+std::vector<int> identicalMarkerClasses(Rcpp::List geneticData)
+{
+	std::vector<designData> designs(geneticData.size());
+	int nMarkers = -1;
+	for(R_xlen_t i = 0; i < geneticData.size(); i++)
+	{
+		Rcpp::S4 currentGeneticData = geneticData(i);
+		designData& design = designs[i];
+		Rcpp::List hetData;
+		try
+		{
+			design.founders = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("founders"));
+			design.finals = Rcpp::as<Rcpp::IntegerMatrix>(currentGeneticData.slot("finals"));
+			hetData = Rcpp::as<Rcpp::List>(currentGeneticData.slot("hetData"));
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Slots founders and finals of a geneticData object must be integer matrices, and slot hetData must be a list");
+		}
+		if(nMarkers == -1) nMarkers = design.finals.ncol();
+		if(design.founders.ncol() != nMarkers || design.finals.ncol() != nMarkers || hetData.size() != nMarkers) throw std::runtime_error("Every design must have the same number of markers");
+		design.hetData.reserve(nMarkers);
+		for(int marker = 0; marker < nMarkers; marker++)
+		{
+			try
+			{
+				design.hetData.push_back(Rcpp::as<Rcpp::IntegerMatrix>(hetData(marker)));
+			}
+			catch(...)
+			{
+				throw std::runtime_error("Every entry of slot hetData must be an integer matrix");
+			}
+		}
+	}
+	if(nMarkers <= 0) return std::vector<int>();
+	std::vector<int> classes(nMarkers);
+	//The first marker of each class with a given hash
+	std::unordered_map<uint32_t, std::vector<int> > representatives;
+	int nClasses = 0;
+	for(int marker = 0; marker < nMarkers; marker++)
+	{
+		uint32_t hash = 0;
+		for(std::vector<designData>::iterator design = designs.begin(); design != designs.end(); design++)
+		{
+			hash = crc32(&(design->founders(0, marker)), sizeof(int) * design->founders.nrow(), hash);
+			if(design->finals.nrow() > 0) hash = crc32(&(design->finals(0, marker)), sizeof(int) * design->finals.nrow(), hash);
+			const Rcpp::IntegerMatrix& currentHetData = design->hetData[marker];
+			if(currentHetData.size() > 0) hash = crc32(&(currentHetData[0]), sizeof(int) * currentHetData.size(), hash);
+		}
+		std::vector<int>& candidates = representatives[hash];
+		classes[marker] = -1;
+		for(std::vector<int>::iterator candidate = candidates.begin(); candidate != candidates.end(); candidate++)
+		{
+			if(sameMarker(designs, *candidate, marker))
+			{
+				classes[marker] = classes[*candidate];
+				break;
+			}
+		}
+		if(classes[marker] == -1)
+		{
+			classes[marker] = nClasses++;
+			candidates.push_back(marker);
+		}
+	}
+	return classes;
+}
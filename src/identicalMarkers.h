@@ -0,0 +1,11 @@
+#ifndef IDENTICAL_MARKERS_HEADER_GUARD
+#define IDENTICAL_MARKERS_HEADER_GUARD
+#include <Rcpp.h>
+#include <vector>
+/** Find the markers which have exactly the same data
+ *
+ * Assign a class to every marker, so that two markers are in the same class exactly when they have the same founder alleles, the same heterozygote encoding and the same value for every line, in every design of the input list of geneticData objects. Classes are numbered from zero in order of first appearance.
+ * Each marker is hashed first, so only markers with the same hash are compared in full. Markers in the same class give identical recombination fraction estimates with every other marker, and an estimate of zero with each other (unless there is no data).
+ */
+std::vector<int> identicalMarkerClasses(Rcpp::List geneticData);
+#endif
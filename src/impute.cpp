@@ -1,146 +1,328 @@
 #include "impute.h"
+#include "packedTriangleFile.h"
 #include <vector>
-#include <map>
 #include <math.h>
 #include <limits>
 #include <sstream>
+#include <algorithm>
+#include <utility>
 #ifdef USE_OPENMP
 #include <omp.h>
 #endif
-template<bool hasLOD, bool hasLKHD> bool imputeInternal(unsigned char* theta, std::vector<double>& levels, double* lod, double* lkhd, std::vector<int>& markersThisGroup, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction)
+//Decode the part of the row of theta for a marker between positions start and end - 1 into the levels, with a value of 0 and present set to 0 for missing values. 
+static void decodeRow(const unsigned char* theta, const std::vector<double>& levels, const std::vector<int>& markersThisGroup, unsigned long long marker, int start, int end, float* values, float* present)
 {
-	unsigned long done = 0;
-	unsigned long total = (unsigned long)markersThisGroup.size();
-	unsigned long doneThreadZero = 0;
-	bool hasError = false;
+	values -= start;
+	present -= start;
+	for(int position = start; position < end; position++)
+	{
+		unsigned long long row = marker, column = markersThisGroup[position];
+		if(row > column) std::swap(row, column);
+		unsigned char value = theta[(column * (column + 1ULL))/2ULL + row];
+		if(value == 0xff)
+		{
+			values[position] = 0;
+			present[position] = 0;
+		}
+		else
+		{
+			values[position] = (float)levels[value];
+			present[position] = 1;
+		}
+	}
+}
+/*
+ * The average absolute difference between two decoded rows, over the positions where both have a value, or NaN if there are no such positions.
+ * Missing values are masked by multiplying, rather than branching, and the sums are split over several accumulators, so that the loop can be vectorised without reordering the floating point operations of any single accumulator. 
+ */
+static float averageRowDifference(const float* values1, const float* present1, const float* values2, const float* present2, int nMarkers)
+{
+	const int nAccumulators = 8;
+	float totals[nAccumulators] = {0, 0, 0, 0, 0, 0, 0, 0}, counts[nAccumulators] = {0, 0, 0, 0, 0, 0, 0, 0};
+	int position = 0;
+	for(; position + nAccumulators <= nMarkers; position += nAccumulators)
+	{
+		for(int accumulator = 0; accumulator < nAccumulators; accumulator++)
+		{
+			float both = present1[position + accumulator] * present2[position + accumulator];
+			totals[accumulator] += both * fabs(values1[position + accumulator] - values2[position + accumulator]);
+			counts[accumulator] += both;
+		}
+	}
+	for(; position < nMarkers; position++)
+	{
+		float both = present1[position] * present2[position];
+		totals[0] += both * fabs(values1[position] - values2[position]);
+		counts[0] += both;
+	}
+	float total = 0, count = 0;
+	for(int accumulator = 0; accumulator < nAccumulators; accumulator++)
+	{
+		total += totals[accumulator];
+		count += counts[accumulator];
+	}
+	if(count == 0) return std::numeric_limits<float>::quiet_NaN();
+	return total / count;
+}
+//Order candidate donors by average difference, then by position. Candidates with no usable positions go last. 
+static bool candidateBefore(const std::pair<float, int>& first, const std::pair<float, int>& second)
+{
+	bool firstNaN = first.first != first.first, secondNaN = second.first != second.first;
+	if(firstNaN != secondNaN) return secondNaN;
+	if(!firstNaN && first.first != second.first) return first.first < second.first;
+	return first.second < second.second;
+}
+//For every missing value of a marker which doesn't yet have a donor, go through the candidates from most similar to least similar, looking for something which has a value there. 
+static void chooseDonors(const unsigned char* theta, const std::vector<int>& markersThisGroup, const std::vector<std::pair<float, int> >& candidates, std::vector<std::pair<int, unsigned long long> >& donorsThisMarker, unsigned long long noDonor)
+{
+	for(std::vector<std::pair<int, unsigned long long> >::iterator missing = donorsThisMarker.begin(); missing != donorsThisMarker.end(); missing++)
+	{
+		if(missing->second != noDonor) continue;
+		for(std::vector<std::pair<float, int> >::const_iterator candidate = candidates.begin(); candidate != candidates.end(); candidate++)
+		{
+			unsigned long long pair2Row = markersThisGroup[candidate->second];
+			unsigned long long pair2Column = markersThisGroup[missing->first];
+			if(pair2Row > pair2Column) std::swap(pair2Row, pair2Column);
+			unsigned long long donorIndex = (pair2Column * (pair2Column + 1ULL))/2ULL + pair2Row;
+			if(theta[donorIndex] != 0xff)
+			{
+				//We only need the value from the best other similar marker, so we can break here
+				missing->second = donorIndex;
+				break;
+			}
+		}
+	}
+}
+/*
+ * Imputation is done in two phases, so that the result doesn't depend on the number of threads or the order in which the threads run.
+ * In the first phase the input is not modified. For every marker with a missing value, we rank the other markers by similarity, and for every missing value in that row choose a donor, being the most similar marker with a value in that position. Each marker only writes to its own list of donors.
+ * The similarities are computed for a block of markers with missing values at a time. The rows for the block are decoded once, and each other row is decoded once per block, so the rows are read contiguously and the packed matrix is traversed nMarkers / blockSize times, rather than once per pair of markers. Blocks are handled in parallel.
+ * If window is positive, markersThisGroup is assumed to be in map order, and donors are first looked for among the markers at most window positions away, with the similarities computed only over those same positions. Any marker which still has a missing value without a donor then goes through the search over the whole group, which only fills in the missing donors. 
+ * In the second phase the donors are copied in. A missing value is shared between the row and column markers, and is imputed using the donor of whichever comes first in markersThisGroup. If that marker has no donor, the other one is used. Donors always have a value in the input, so they're never overwritten, and every missing value is written once.
+ */
+template<bool hasLOD, bool hasLKHD> bool imputeInternal(unsigned char* theta, std::vector<double>& levels, double* lod, double* lkhd, std::vector<int>& markersThisGroup, int window, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction)
+{
+	const unsigned long long noDonor = std::numeric_limits<unsigned long long>::max();
+	const int nMarkers = (int)markersThisGroup.size();
+	const int blockSize = 32;
+	//For each marker (by position in markersThisGroup), the positions of the missing values in that row, and the index of the value to copy in, or noDonor. Sorted by position.
+	std::vector<std::vector<std::pair<int, unsigned long long> > > donors(nMarkers);
 	//This is a marker row
 #ifdef USE_OPENMP
-	#pragma omp parallel for schedule(dynamic)
+	#pragma omp parallel for schedule(static)
 #endif
-	for(std::vector<int>::iterator marker1 = markersThisGroup.begin(); marker1 < markersThisGroup.end(); marker1++)
+	for(int position1 = 0; position1 < nMarkers; position1++)
 	{
-		bool missing = false;
-		for(std::vector<int>::iterator marker2 = markersThisGroup.begin(); marker2 != markersThisGroup.end(); marker2++)
+		unsigned long long marker1 = markersThisGroup[position1];
+		std::vector<std::pair<int, unsigned long long> >& donorsThisMarker = donors[position1];
+		for(int position2 = 0; position2 < nMarkers; position2++)
 		{
-			unsigned long long copiedMarker1 = *marker1;
-			unsigned long long copiedMarker2 = *marker2;
+			unsigned long long copiedMarker1 = marker1;
+			unsigned long long copiedMarker2 = markersThisGroup[position2];
 			if(copiedMarker1 > copiedMarker2) std::swap(copiedMarker1, copiedMarker2);
-			//record whether there's a missing value for marker1 anywhere.
-			float val = theta[(copiedMarker2 * (copiedMarker2 + 1ULL))/2ULL + copiedMarker1];
-			if(val == 0xff) 
-			{
-				missing = true;
-				break;
-			}
+			//record the missing values for marker1
+			if(theta[(copiedMarker2 * (copiedMarker2 + 1ULL))/2ULL + copiedMarker1] == 0xff) donorsThisMarker.push_back(std::make_pair(position2, noDonor));
 		}
-		if(missing)
+	}
+	std::vector<int> missingPositions;
+	for(int position = 0; position < nMarkers; position++)
+	{
+		if(donors[position].size() > 0) missingPositions.push_back(position);
+	}
+	unsigned long done = 0;
+	//A window covering the whole group still only considers nearby markers first, but there's no need for the buffers to be any larger
+	window = std::min(window, nMarkers);
+	if(window > 0)
+	{
+		unsigned long total = (unsigned long)missingPositions.size();
+#ifdef USE_OPENMP
+		#pragma omp parallel
+#endif
 		{
-			//There's a missing value for *marker1. So find the closest matching column and overwrite any missing values from that column.
-			//Map with the difference as the key and the marker index as the value. These are sorted internally so we can go from smallest difference to lowest difference
-			std::map<float, int> averageDifferences;
-			//marker 2 is the candidate other marker (another row)
-			for(std::vector<int>::iterator marker2 = markersThisGroup.begin(); marker2 != markersThisGroup.end(); marker2++)
+			std::vector<float> values1(2 * window + 1), present1(2 * window + 1), values2(2 * window + 1), present2(2 * window + 1);
+			std::vector<std::pair<float, int> > candidates;
+#ifdef USE_OPENMP
+			#pragma omp for schedule(dynamic)
+#endif
+			for(int missingCounter = 0; missingCounter < (int)missingPositions.size(); missingCounter++)
 			{
-				if(marker2 == marker1) continue;
-				
-				float totalDifference = 0;
-				int usableLocations = 0;
-				//This iterates over the other markers in the column/row
-				for(std::vector<int>::iterator marker3 = markersThisGroup.begin(); marker3 != markersThisGroup.end(); marker3++)
+				const int position1 = missingPositions[missingCounter];
+				const int start = std::max(0, position1 - window), end = std::min(nMarkers, position1 + window + 1);
+				decodeRow(theta, levels, markersThisGroup, markersThisGroup[position1], start, end, &(values1[0]), &(present1[0]));
+				candidates.clear();
+				for(int position2 = start; position2 < end; position2++)
 				{
-					unsigned long long pair1Row = *marker1, pair1Column = *marker3;
-					unsigned long long pair2Row = *marker2, pair2Column = *marker3;
-					if(pair1Row > pair1Column) std::swap(pair1Row, pair1Column);
-					if(pair2Row > pair2Column) std::swap(pair2Row, pair2Column);
-					unsigned char value1 = theta[(pair1Column * (pair1Column + 1ULL))/2ULL + pair1Row];
-					unsigned char value2 = theta[(pair2Column * (pair2Column + 1ULL))/2ULL + pair2Row];
-					if(value1 != 0xff && value2 != 0xff)
-					{
-						float val = (float)fabs(levels[value1] - levels[value2]);
-						totalDifference += val;
-						usableLocations++;
-					}
+					if(position2 == position1) continue;
+					decodeRow(theta, levels, markersThisGroup, markersThisGroup[position2], start, end, &(values2[0]), &(present2[0]));
+					candidates.push_back(std::make_pair(averageRowDifference(&(values1[0]), &(present1[0]), &(values2[0]), &(present2[0]), end - start), position2));
 				}
-				if(usableLocations != 0)
+				std::sort(candidates.begin(), candidates.end(), candidateBefore);
+				chooseDonors(theta, markersThisGroup, candidates, donors[position1], noDonor);
+#ifdef USE_OPENMP
+				#pragma omp critical
+#endif
 				{
-					averageDifferences.insert(std::make_pair(totalDifference/usableLocations, *marker2));
+					done++;
+				}
+#ifdef USE_OPENMP
+				if(omp_get_thread_num() == 0)
+#endif
+				{
+					statusFunction(done, total);
 				}
-				else averageDifferences.insert(std::make_pair(std::numeric_limits<float>::quiet_NaN(), *marker2));
 			}
-			for(std::vector<int>::iterator marker2 = markersThisGroup.begin(); marker2 != markersThisGroup.end(); marker2++)
+		}
+		//Only the markers with a missing value that has no donor within the window need the search over the whole group
+		std::vector<int> remainingPositions;
+		for(std::vector<int>::iterator position = missingPositions.begin(); position != missingPositions.end(); position++)
+		{
+			const std::vector<std::pair<int, unsigned long long> >& donorsThisMarker = donors[*position];
+			for(std::vector<std::pair<int, unsigned long long> >::const_iterator missing = donorsThisMarker.begin(); missing != donorsThisMarker.end(); missing++)
 			{
-				unsigned long long pair1Row = *marker1;
-				unsigned long long pair1Column = *marker2;
-				if(pair1Row > pair1Column) std::swap(pair1Row, pair1Column);
-				unsigned char& toReplace = theta[(pair1Column*(pair1Column + 1ULL))/2ULL+ pair1Row];
-				//if this is missing, we need to impute it
-				if(toReplace == 0xff) 
+				if(missing->second == noDonor)
 				{
-					//go through the other markers from most similar to least similar, looking for something which has a value here. So marker3 is the 
-					bool replacementFound = false;
-					for(std::map<float, int>::iterator marker3 = averageDifferences.begin(); marker3 != averageDifferences.end(); marker3++)
-					{
-						unsigned long long pair2Row = marker3->second;
-						unsigned long long pair2Column = *marker2;
-						if(pair2Row > pair2Column) std::swap(pair2Row, pair2Column);
-						unsigned char& newValue = theta[(pair2Column * (pair2Column + 1ULL))/2ULL + pair2Row];
-						if(newValue != 0xff)
-						{
-							toReplace = newValue;
-							if(hasLOD) lod[(pair1Column*(pair1Column + 1ULL))/2ULL + pair1Row] = lod[(pair2Column * (pair2Column + 1ULL))/2ULL + pair2Row];
-							if(hasLKHD) lkhd[(pair1Column*(pair1Column + 1ULL))/2ULL + pair1Row] = lkhd[(pair2Column * (pair2Column + 1ULL))/2ULL + pair2Row];
-							//We only need to copy the value from the best other similar marker, so we can break here
-							replacementFound = true;
-							break;
-						}
-					}
-					if(!replacementFound)
-					{
-						std::stringstream ss;
-						ss << "Unable to impute a value for marker " << (*marker1+1) << " and marker " << (*marker2+1);
-						error = ss.str();
-						hasError = true;
-#ifndef USE_OPENMP
-						//We can't return early if we're using openmp
-						return false;
-#endif
-					}
+					remainingPositions.push_back(*position);
+					break;
 				}
 			}
 		}
+		missingPositions.swap(remainingPositions);
+		done = 0;
+	}
+	const int nBlocks = ((int)missingPositions.size() + blockSize - 1) / blockSize;
+	unsigned long total = (unsigned long)nBlocks;
 #ifdef USE_OPENMP
-		#pragma omp critical
+	#pragma omp parallel
 #endif
+	{
+		std::vector<float> blockValues((std::size_t)blockSize * nMarkers), blockPresent((std::size_t)blockSize * nMarkers), otherValues(nMarkers), otherPresent(nMarkers);
+		//The average differences for each marker in the block, against every marker
+		std::vector<float> differences((std::size_t)blockSize * nMarkers);
+		std::vector<std::pair<float, int> > candidates;
+#ifdef USE_OPENMP
+		#pragma omp for schedule(dynamic)
+#endif
+		for(int block = 0; block < nBlocks; block++)
 		{
-			done++;
+			const int blockStart = block * blockSize;
+			const int blockEnd = std::min(blockStart + blockSize, (int)missingPositions.size());
+			for(int blockCounter = blockStart; blockCounter < blockEnd; blockCounter++)
+			{
+				std::size_t offset = (std::size_t)(blockCounter - blockStart) * nMarkers;
+				decodeRow(theta, levels, markersThisGroup, markersThisGroup[missingPositions[blockCounter]], 0, nMarkers, &(blockValues[offset]), &(blockPresent[offset]));
+			}
+			//position2 is the candidate other marker (another row)
+			for(int position2 = 0; position2 < nMarkers; position2++)
+			{
+				decodeRow(theta, levels, markersThisGroup, markersThisGroup[position2], 0, nMarkers, &(otherValues[0]), &(otherPresent[0]));
+				for(int blockCounter = blockStart; blockCounter < blockEnd; blockCounter++)
+				{
+					std::size_t offset = (std::size_t)(blockCounter - blockStart) * nMarkers;
+					differences[offset + position2] = averageRowDifference(&(blockValues[offset]), &(blockPresent[offset]), &(otherValues[0]), &(otherPresent[0]), nMarkers);
+				}
+			}
+			for(int blockCounter = blockStart; blockCounter < blockEnd; blockCounter++)
+			{
+				const int position1 = missingPositions[blockCounter];
+				std::size_t offset = (std::size_t)(blockCounter - blockStart) * nMarkers;
+				//Rank the other markers from most similar to least similar. Markers with the same average difference are all kept, in order of position.
+				candidates.clear();
+				for(int position2 = 0; position2 < nMarkers; position2++)
+				{
+					if(position2 != position1) candidates.push_back(std::make_pair(differences[offset + position2], position2));
+				}
+				std::sort(candidates.begin(), candidates.end(), candidateBefore);
+				chooseDonors(theta, markersThisGroup, candidates, donors[position1], noDonor);
+			}
+#ifdef USE_OPENMP
+			#pragma omp critical
+#endif
+			{
+				done++;
+			}
+#ifdef USE_OPENMP
+			if(omp_get_thread_num() == 0)
+#endif
+			{
+				statusFunction(done, total);
+			}
 		}
+	}
+	//The first marker (by position) with a value that couldn't be imputed, and the other marker for that value. 
+	int errorPosition1 = nMarkers, errorPosition2 = nMarkers;
 #ifdef USE_OPENMP
-		if(omp_get_thread_num() == 0)
+	#pragma omp parallel for schedule(dynamic)
 #endif
+	for(int position1 = 0; position1 < nMarkers; position1++)
+	{
+		unsigned long long marker1 = markersThisGroup[position1];
+		const std::vector<std::pair<int, unsigned long long> >& donorsThisMarker = donors[position1];
+		for(std::vector<std::pair<int, unsigned long long> >::const_iterator missing = donorsThisMarker.begin(); missing != donorsThisMarker.end(); missing++)
 		{
-			doneThreadZero++;
-			statusFunction(done, total);
+			int position2 = missing->first;
+			//The other marker comes first, so this value is imputed from there
+			if(position2 < position1) continue;
+			//The donor of the other marker for this value. 
+			unsigned long long otherDonor = noDonor;
+			if(position2 != position1)
+			{
+				const std::vector<std::pair<int, unsigned long long> >& donorsOtherMarker = donors[position2];
+				otherDonor = std::lower_bound(donorsOtherMarker.begin(), donorsOtherMarker.end(), std::make_pair(position1, 0ULL))->second;
+			}
+			unsigned long long donorIndex = missing->second == noDonor ? otherDonor : missing->second;
+			if(donorIndex == noDonor)
+			{
+#ifdef USE_OPENMP
+				#pragma omp critical
+#endif
+				{
+					if(position1 < errorPosition1 || (position1 == errorPosition1 && position2 < errorPosition2))
+					{
+						errorPosition1 = position1;
+						errorPosition2 = position2;
+					}
+				}
+				continue;
+			}
+			unsigned long long pair1Row = marker1;
+			unsigned long long pair1Column = markersThisGroup[position2];
+			if(pair1Row > pair1Column) std::swap(pair1Row, pair1Column);
+			unsigned long long toReplace = (pair1Column*(pair1Column + 1ULL))/2ULL+ pair1Row;
+			theta[toReplace] = theta[donorIndex];
+			if(hasLOD) lod[toReplace] = lod[donorIndex];
+			if(hasLKHD) lkhd[toReplace] = lkhd[donorIndex];
 		}
 	}
-	return !hasError;
+	if(errorPosition1 != nMarkers)
+	{
+		std::stringstream ss;
+		ss << "Unable to impute a value for marker " << (markersThisGroup[errorPosition1]+1) << " and marker " << (markersThisGroup[errorPosition2]+1);
+		error = ss.str();
+		return false;
+	}
+	return true;
 }
 bool impute(unsigned char* theta, std::vector<double>& thetaLevels, double* lod, double* lkhd, std::vector<int>& markers, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction)
+{
+	return imputeWindow(theta, thetaLevels, lod, lkhd, markers, 0, error, statusFunction);
+}
+bool imputeWindow(unsigned char* theta, std::vector<double>& thetaLevels, double* lod, double* lkhd, std::vector<int>& markers, int window, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction)
 {
 	if(lod != NULL && lkhd != NULL)
 	{
-		return imputeInternal<true, true>(theta, thetaLevels, lod, lkhd, markers, error, statusFunction);
+		return imputeInternal<true, true>(theta, thetaLevels, lod, lkhd, markers, window, error, statusFunction);
 	}
 	else if(lod != NULL && lkhd == NULL)
 	{
-		return imputeInternal<true, false>(theta, thetaLevels, lod, lkhd, markers, error, statusFunction);
+		return imputeInternal<true, false>(theta, thetaLevels, lod, lkhd, markers, window, error, statusFunction);
 	}
 	else if(lod == NULL && lkhd != NULL)
 	{
-		return imputeInternal<false, true>(theta, thetaLevels, lod, lkhd, markers, error, statusFunction);
+		return imputeInternal<false, true>(theta, thetaLevels, lod, lkhd, markers, window, error, statusFunction);
 	}
 	else
 	{
-		return imputeInternal<false, false>(theta, thetaLevels, lod, lkhd, markers, error, statusFunction);
+		return imputeInternal<false, false>(theta, thetaLevels, lod, lkhd, markers, window, error, statusFunction);
 	}
 }
 SEXP imputeWholeObject(SEXP mpcrossLG_sexp, SEXP verbose_sexp)
@@ -176,18 +358,10 @@ BEGIN_RCPP
 		 throw std::runtime_error("Slot mpcrossLG@rf@theta must be an S4 object");
 	}
 
-	Rcpp::RawVector thetaData;
-	try
-	{
-		thetaData = Rcpp::as<Rcpp::RawVector>(theta.slot("data"));
-	}
-	catch(...)
-	{
-		throw std::runtime_error("Slot mpcrossLG@rf@theta@data must be a raw vector");
-	}
-	
-	Rcpp::RawVector copiedThetaData(thetaData.size());
-	memcpy(&(copiedThetaData[0]), &(thetaData[0]), sizeof(Rbyte)*thetaData.size());
+	//theta may be held in a file, so it's read through a view
+	rawSymmetricMatrixData thetaData(theta, false);
+	Rcpp::RawVector copiedThetaData(thetaData.getNValues());
+	memcpy(&(copiedThetaData[0]), thetaData.getData(), sizeof(Rbyte)*thetaData.getNValues());
 
 	std::vector<double> levels;
 	try
@@ -212,17 +386,10 @@ BEGIN_RCPP
 			throw std::runtime_error("Slot mpcrossLG@rf@lkhd must be an S4 object or NULL");
 		}
 		
-		Rcpp::NumericVector lkhdS4Data;
-		try
-		{
-			lkhdS4Data = Rcpp::as<Rcpp::NumericVector>(lkhdS4.slot("x"));
-		}
-		catch(...)
-		{
-			throw std::runtime_error("Slot mpcrossLG@rf@lkhd@x must be a numeric vector");
-		}
-		copiedLkhd = Rcpp::NumericVector(lkhdS4Data.size());
-		memcpy(&(copiedLkhd[0]), &(lkhdS4Data[0]), sizeof(double)*lkhdS4Data.size());
+		//The values may be held in a file, or stored compactly, so they're read through a view
+		dspMatrixData lkhdView(lkhdS4, false);
+		copiedLkhd = Rcpp::NumericVector(lkhdView.getNValues());
+		for(R_xlen_t i = 0; i < lkhdView.getNValues(); i++) copiedLkhd[i] = lkhdView.get(i);
 	}
 
 	if(!Rcpp::as<Rcpp::RObject>(rf.slot("lod")).isNULL())
@@ -237,17 +404,10 @@ BEGIN_RCPP
 			throw std::runtime_error("Slot mpcrossLG@rf@lod must be an S4 object or NULL");
 		}
 		
-		Rcpp::NumericVector lodS4Data;
-		try
-		{
-			lodS4Data = Rcpp::as<Rcpp::NumericVector>(lodS4.slot("x"));
-		}
-		catch(...)
-		{
-			throw std::runtime_error("Slot mpcrossLG@rf@lod@x must be a numeric vector");
-		}
-		copiedLod = Rcpp::NumericVector(lodS4Data.size());
-		memcpy(&(copiedLod[0]), &(lodS4Data[0]), sizeof(double)*lodS4Data.size());
+		//The values may be held in a file, or stored compactly, so they're read through a view
+		dspMatrixData lodView(lodS4, false);
+		copiedLod = Rcpp::NumericVector(lodView.getNValues());
+		for(R_xlen_t i = 0; i < lodView.getNValues(); i++) copiedLod[i] = lodView.get(i);
 	}
 
 	Rcpp::S4 lg;
@@ -270,6 +430,14 @@ BEGIN_RCPP
 	{
 		throw std::runtime_error("Slot mpcross@lg@groups must be an integer vector");
 	}
+	if((unsigned long long)copiedThetaData.size() != ((unsigned long long)groups.size() * ((unsigned long long)groups.size() + 1ULL)) / 2ULL)
+	{
+		throw std::runtime_error("Slot mpcrossLG@rf@theta had the wrong number of values");
+	}
+	if((copiedLod.size() != 0 && copiedLod.size() != copiedThetaData.size()) || (copiedLkhd.size() != 0 && copiedLkhd.size() != copiedThetaData.size()))
+	{
+		throw std::runtime_error("Slots mpcrossLG@rf@lod and mpcrossLG@rf@lkhd must have the same number of values as mpcrossLG@rf@theta");
+	}
 
 	try
 	{
@@ -348,7 +516,7 @@ BEGIN_RCPP
 	return Rcpp::List::create(Rcpp::Named("theta") = copiedThetaData, Rcpp::Named("lod") = copiedLod, Rcpp::Named("lkhd") = copiedLkhd);
 END_RCPP
 }
-SEXP imputeGroup(SEXP mpcrossLG_sexp, SEXP verbose_sexp, SEXP group_sexp)
+SEXP imputeGroup(SEXP mpcrossLG_sexp, SEXP verbose_sexp, SEXP group_sexp, SEXP window_sexp)
 {
 BEGIN_RCPP
 	Rcpp::S4 mpcrossLG;
@@ -381,16 +549,10 @@ BEGIN_RCPP
 		 throw std::runtime_error("Slot mpcrossLG@rf@theta must be an S4 object");
 	}
 
-	Rcpp::RawVector thetaData;
-	try
-	{
-		thetaData = Rcpp::as<Rcpp::RawVector>(theta.slot("data"));
-	}
-	catch(...)
-	{
-		throw std::runtime_error("Slot mpcrossLG@rf@theta@data must be a raw vector");
-	}
-	
+	//theta may be held in a file, so it's read through a view
+	rawSymmetricMatrixData thetaView(theta, false);
+	const Rbyte* thetaData = thetaView.getData();
+
 	std::vector<double> levels;
 	try
 	{
@@ -403,7 +565,8 @@ BEGIN_RCPP
 
 	Rcpp::NumericVector copiedLod, copiedLkhd;
 	double *copiedLodPtr = NULL, *copiedLkhdPtr = NULL;
-	Rcpp::NumericVector lodS4Data, lkhdS4Data;
+	//lod and lkhd may be held in files, or stored compactly, so they're read through views
+	std::unique_ptr<dspMatrixData> lodView, lkhdView;
 	if(!Rcpp::as<Rcpp::RObject>(rf.slot("lkhd")).isNULL())
 	{
 		Rcpp::S4 lkhdS4;
@@ -416,15 +579,8 @@ BEGIN_RCPP
 			throw std::runtime_error("Slot mpcrossLG@rf@lkhd must be an S4 object or NULL");
 		}
 		
-		try
-		{
-			lkhdS4Data = Rcpp::as<Rcpp::NumericVector>(lkhdS4.slot("x"));
-		}
-		catch(...)
-		{
-			throw std::runtime_error("Slot mpcrossLG@rf@lkhd@x must be a numeric vector");
-		}
-		copiedLkhd = Rcpp::NumericVector(lkhdS4Data.size());
+		lkhdView.reset(new dspMatrixData(lkhdS4, false));
+		copiedLkhd = Rcpp::NumericVector(lkhdView->getNValues());
 		copiedLkhdPtr = &(copiedLkhd[0]);
 	}
 
@@ -440,15 +596,8 @@ BEGIN_RCPP
 			throw std::runtime_error("Slot mpcrossLG@rf@lod must be an S4 object or NULL");
 		}
 		
-		try
-		{
-			lodS4Data = Rcpp::as<Rcpp::NumericVector>(lodS4.slot("x"));
-		}
-		catch(...)
-		{
-			throw std::runtime_error("Slot mpcrossLG@rf@lod@x must be a numeric vector");
-		}
-		copiedLod = Rcpp::NumericVector(lodS4Data.size());
+		lodView.reset(new dspMatrixData(lodS4, false));
+		copiedLod = Rcpp::NumericVector(lodView->getNValues());
 		copiedLodPtr = &(copiedLod[0]);
 	}
 
@@ -471,6 +620,14 @@ BEGIN_RCPP
 	{
 		throw std::runtime_error("Slot mpcross@lg@groups must be an integer vector");
 	}
+	if((unsigned long long)thetaView.getNValues() != ((unsigned long long)groups.size() * ((unsigned long long)groups.size() + 1ULL)) / 2ULL)
+	{
+		throw std::runtime_error("Slot mpcrossLG@rf@theta had the wrong number of values");
+	}
+	if((lodView && lodView->getNValues() != thetaView.getNValues()) || (lkhdView && lkhdView->getNValues() != thetaView.getNValues()))
+	{
+		throw std::runtime_error("Slots mpcrossLG@rf@lod and mpcrossLG@rf@lkhd must have the same number of values as mpcrossLG@rf@theta");
+	}
 
 	int group;
 	try
@@ -482,6 +639,20 @@ BEGIN_RCPP
 		throw std::runtime_error("Input group must be an integer");
 	}
 
+	int window = 0;
+	if(!Rcpp::as<Rcpp::RObject>(window_sexp).isNULL())
+	{
+		try
+		{
+			window = Rcpp::as<int>(window_sexp);
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Input window must be an integer or NULL");
+		}
+		if(window < 1) throw std::runtime_error("Input window must be positive");
+	}
+
 	std::vector<int> markersCurrentGroup;
 	for(R_xlen_t markerCounter = 0; markerCounter < groups.size(); markerCounter++)
 	{
@@ -517,8 +688,8 @@ BEGIN_RCPP
 		for(unsigned long long marker2Counter = 0; marker2Counter <= marker1Counter; marker2Counter++)
 		{
 			copiedTheta[(marker1Counter*(marker1Counter+1ULL))/2ULL + marker2Counter] = thetaData[((unsigned long long)markersCurrentGroup[marker1Counter] *((unsigned long long)markersCurrentGroup[marker1Counter] + 1ULL))/2ULL + (unsigned long long)markersCurrentGroup[marker2Counter]];
-			if(copiedLodPtr) copiedLodPtr[(marker1Counter*(marker1Counter+1))/2 + marker2Counter] = lodS4Data[((unsigned long long)markersCurrentGroup[marker1Counter] *(markersCurrentGroup[marker1Counter] + 1))/2 + markersCurrentGroup[marker2Counter]];
-			if(copiedLkhdPtr) copiedLkhdPtr[(marker1Counter*(marker1Counter+1))/2 + marker2Counter] = lkhdS4Data[((unsigned long long)markersCurrentGroup[marker1Counter] *((unsigned long long)markersCurrentGroup[marker1Counter] + 1ULL))/2ULL + (unsigned long long)markersCurrentGroup[marker2Counter]];
+			if(copiedLodPtr) copiedLodPtr[(marker1Counter*(marker1Counter+1))/2 + marker2Counter] = lodView->get((R_xlen_t)(((unsigned long long)markersCurrentGroup[marker1Counter] *((unsigned long long)markersCurrentGroup[marker1Counter] + 1ULL))/2ULL + (unsigned long long)markersCurrentGroup[marker2Counter]));
+			if(copiedLkhdPtr) copiedLkhdPtr[(marker1Counter*(marker1Counter+1))/2 + marker2Counter] = lkhdView->get((R_xlen_t)(((unsigned long long)markersCurrentGroup[marker1Counter] *((unsigned long long)markersCurrentGroup[marker1Counter] + 1ULL))/2ULL + (unsigned long long)markersCurrentGroup[marker2Counter]));
 		}
 	}
 
@@ -544,7 +715,7 @@ BEGIN_RCPP
 		markersCurrentGroup[i] = i;
 	}
 	std::string error;
-	bool ok = impute(&(copiedTheta[0]), levels, copiedLodPtr, copiedLkhdPtr, markersCurrentGroup, error, progressFunction);
+	bool ok = imputeWindow(&(copiedTheta[0]), levels, copiedLodPtr, copiedLkhdPtr, markersCurrentGroup, window, error, progressFunction);
 	if(!ok)
 	{
 		std::stringstream ss;
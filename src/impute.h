@@ -5,6 +5,8 @@
 #include <functional>
 #include <Rcpp.h>
 bool impute(unsigned char* theta, std::vector<double>& thetaLevels, double* lod, double* lkhd, std::vector<int>& markers, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction);
+//As for impute, but if window is positive the markers are assumed to be in map order, and donors are first looked for among the markers at most window positions away.
+bool imputeWindow(unsigned char* theta, std::vector<double>& thetaLevels, double* lod, double* lkhd, std::vector<int>& markers, int window, std::string& error, std::function<void(unsigned long, unsigned long)> statusFunction);
 SEXP imputeWholeObject(SEXP mpcrossLG, SEXP verbose);
-SEXP imputeGroup(SEXP mpcrossLG_sexp, SEXP verbose_sexp, SEXP group_sexp);
+SEXP imputeGroup(SEXP mpcrossLG_sexp, SEXP verbose_sexp, SEXP group_sexp, SEXP window_sexp);
 #endif
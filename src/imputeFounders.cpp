@@ -14,30 +14,51 @@
 #include "funnelHaplotypeToMarker.hpp"
 #include "viterbi.hpp"
 #include "recodeHetsAsNA.h"
-template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp::IntegerMatrix founders, Rcpp::IntegerMatrix finals, Rcpp::S4 pedigree, Rcpp::List hetData, Rcpp::List map, Rcpp::IntegerMatrix results, double homozygoteMissingProb, double heterozygoteMissingProb, Rcpp::IntegerMatrix key)
+#include "genericFunnelProbabilities.h"
+#include <exception>
+#include <array>
+#include <algorithm>
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+//The inputs after recoding, and the generations and funnels of each line. These are the same for every number of founders.
+struct imputeFoundersInputs
+{
+	Rcpp::IntegerMatrix recodedFounders, recodedFinals;
+	Rcpp::List recodedHetData;
+	std::vector<int> intercrossingGenerations, selfingGenerations;
+	int minSelfing, maxSelfing, minAIGenerations, maxAIGenerations;
+	//The shape of the funnels, which is only set when there are other numbers of founders than 2, 4, 8 and 16. See getFunnel. 
+	std::vector<int> funnelShape;
+	//vector giving the funnel ID for each individual
+	std::vector<funnelID> lineFunnelIDs;
+	//vector giving the encoded value for each individual
+	std::vector<funnelEncoding> lineFunnelEncodings;
+	//vector giving the encoded value for each value in allFunnels
+	std::vector<funnelEncoding> allFunnelEncodings;
+	markerPatternsToUniqueValuesArgs markerPatternData;
+	int maxChromosomeMarkers;
+};
+void prepareImputeFoundersInputs(Rcpp::IntegerMatrix founders, Rcpp::IntegerMatrix finals, Rcpp::S4 pedigree, Rcpp::List hetData, Rcpp::List map, int nFounders, bool infiniteSelfing, imputeFoundersInputs& inputs)
 {
 	//Work out maximum number of markers per chromosome
-	int maxChromosomeMarkers = 0;
+	inputs.maxChromosomeMarkers = 0;
 	for(int i = 0; i < map.size(); i++)
 	{
 		Rcpp::NumericVector chromosome = map(i);
-		maxChromosomeMarkers = std::max((int)chromosome.size(), maxChromosomeMarkers);
+		inputs.maxChromosomeMarkers = std::max((int)chromosome.size(), inputs.maxChromosomeMarkers);
 	}
 
-	typedef typename expandedProbabilities<nFounders, infiniteSelfing>::type expandedProbabilitiesType;
-	//expandedProbabilitiesType haplotypeProbabilities;
-
-	Rcpp::Function diff("diff"), haldaneToRf("haldaneToRf");
-
 	//Get out generations of selfing and intercrossing
-	std::vector<int> intercrossingGenerations, selfingGenerations;
+	std::vector<int>& intercrossingGenerations = inputs.intercrossingGenerations, &selfingGenerations = inputs.selfingGenerations;
 	getIntercrossingAndSelfingGenerations(pedigree, finals, nFounders, intercrossingGenerations, selfingGenerations);
 
-	int maxSelfing = *std::max_element(selfingGenerations.begin(), selfingGenerations.end());
-	int minSelfing = *std::min_element(selfingGenerations.begin(), selfingGenerations.end());
-	int maxAIGenerations = *std::max_element(intercrossingGenerations.begin(), intercrossingGenerations.end());
-	int minAIGenerations = *std::min_element(intercrossingGenerations.begin(), intercrossingGenerations.end());
-	minAIGenerations = std::max(minAIGenerations, 1);
+	inputs.maxSelfing = *std::max_element(selfingGenerations.begin(), selfingGenerations.end());
+	inputs.minSelfing = *std::min_element(selfingGenerations.begin(), selfingGenerations.end());
+	inputs.maxAIGenerations = *std::max_element(intercrossingGenerations.begin(), intercrossingGenerations.end());
+	inputs.minAIGenerations = *std::min_element(intercrossingGenerations.begin(), intercrossingGenerations.end());
+	inputs.minAIGenerations = std::max(inputs.minAIGenerations, 1);
+
 	int nMarkers = founders.ncol();
 	int nFinals = finals.nrow();
 
@@ -47,6 +68,9 @@ template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp
 	Rcpp::List recodedHetData(nMarkers);
 	recodedHetData.attr("names") = hetData.attr("names");
 	recodedFinals.attr("dimnames") = finals.attr("dimnames");
+	inputs.recodedFounders = recodedFounders;
+	inputs.recodedFinals = recodedFinals;
+	inputs.recodedHetData = recodedHetData;
 
 	recodeDataStruct recoded;
 	recoded.recodedFounders = recodedFounders;
@@ -56,6 +80,8 @@ template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp
 	recoded.hetData = hetData;
 	recoded.recodedHetData = recodedHetData;
 	recodeFoundersFinalsHets(recoded);
+	std::string tooManyAlleles = checkMaxAlleles(recoded);
+	if(tooManyAlleles != "") throw std::runtime_error(tooManyAlleles.c_str());
 
 	if(infiniteSelfing)
 	{
@@ -78,7 +104,7 @@ template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp
 	std::vector<std::string> errors, warnings;
 	std::vector<funnelType> allFunnels, lineFunnels;
 	{
-		estimateRFCheckFunnels(recodedFinals, recodedFounders, recodedHetData, pedigree, intercrossingGenerations, warnings, errors, allFunnels, lineFunnels);
+		estimateRFCheckFunnels(recodedFinals, recodedFounders, recodedHetData, pedigree, intercrossingGenerations, warnings, errors, allFunnels, lineFunnels, inputs.funnelShape);
 		if(errors.size() > 0)
 		{
 			std::stringstream ss;
@@ -92,39 +118,96 @@ template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp
 	}
 	//map containing encodings of the funnels involved in the experiment (as key), and an associated unique index (again, using the encoded values directly is no good because they'll be all over the place). Unique indices are contiguous again.
 	std::map<funnelEncoding, funnelID> funnelTranslation;
-	//vector giving the funnel ID for each individual
-	std::vector<funnelID> lineFunnelIDs;
-	//vector giving the encoded value for each individual
-	std::vector<funnelEncoding> lineFunnelEncodings;
-	//vector giving the encoded value for each value in allFunnels
-	std::vector<funnelEncoding> allFunnelEncodings;
-	funnelsToUniqueValues(funnelTranslation, lineFunnelIDs, lineFunnelEncodings, allFunnelEncodings, lineFunnels, allFunnels, nFounders);
-	
-	unsigned int maxAlleles = recoded.maxAlleles;
-	if(maxAlleles > 64)
-	{
-		throw std::runtime_error("Internal error - Cannot have more than 64 alleles per marker");
-	}
+	funnelsToUniqueValues(funnelTranslation, inputs.lineFunnelIDs, inputs.lineFunnelEncodings, inputs.allFunnelEncodings, lineFunnels, allFunnels, nFounders);
 
-	markerPatternsToUniqueValuesArgs markerPatternData;
+	markerPatternsToUniqueValuesArgs& markerPatternData = inputs.markerPatternData;
 	markerPatternData.nFounders = nFounders;
 	markerPatternData.nMarkers = nMarkers;
 	markerPatternData.recodedFounders = recodedFounders;
 	markerPatternData.recodedHetData = recodedHetData;
 	markerPatternsToUniqueValues(markerPatternData);
+}
+//The lines are sorted by class, so that lines with the same generations of intercrossing and selfing, and the same funnel, are together. The lines of each chromosome are then split into blocks, each containing lines of a single class, which are imputed in parallel. For finite selfing the lines of a block are imputed as a batch. 
+void sortLinesIntoBlocks(const imputeFoundersInputs& inputs, std::vector<int>& lineOrder, std::vector<int>& blockStarts)
+{
+	const int nFinals = (int)inputs.selfingGenerations.size();
+	lineOrder.resize(nFinals);
+	for(int finalCounter = 0; finalCounter < nFinals; finalCounter++) lineOrder[finalCounter] = finalCounter;
+	std::vector<std::array<int, 3> > lineClasses(nFinals);
+	for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+	{
+		std::array<int, 3> lineClass = {{inputs.intercrossingGenerations[finalCounter], inputs.selfingGenerations[finalCounter], inputs.intercrossingGenerations[finalCounter] == 0 ? (int)inputs.lineFunnelIDs[finalCounter] : -1}};
+		lineClasses[finalCounter] = lineClass;
+	}
+	std::stable_sort(lineOrder.begin(), lineOrder.end(), [&lineClasses](int line1, int line2){ return lineClasses[line1] < lineClasses[line2]; });
+	const int linesPerBlock = 16;
+	blockStarts.clear();
+	for(int lineCounter = 0; lineCounter < nFinals; lineCounter++)
+	{
+		if(blockStarts.size() == 0 || lineCounter - blockStarts.back() == linesPerBlock || lineClasses[lineOrder[lineCounter]] != lineClasses[lineOrder[lineCounter - 1]]) blockStarts.push_back(lineCounter);
+	}
+	blockStarts.push_back(nFinals);
+}
+//Impute the markers from start to end - 1 for every block of lines, with a Viterbi object for each thread. 
+template<typename viterbiType> void imputeBlocks(std::vector<viterbiType>& threadViterbi, int start, int end, std::vector<int>& lineOrder, const std::vector<int>& blockStarts)
+{
+	const int nLineBlocks = (int)blockStarts.size() - 1;
+	//An exception can't leave a parallel region, so the exception for each block is stored along with the line it refers to, and the one for the smallest line is rethrown. This is the exception that imputing the lines in order would have thrown.
+	std::vector<std::exception_ptr> blockExceptions(nLineBlocks);
+	std::vector<int> blockExceptionLines(nLineBlocks);
+#ifdef USE_OPENMP
+	#pragma omp parallel for schedule(dynamic)
+#endif
+	for(int blockCounter = 0; blockCounter < nLineBlocks; blockCounter++)
+	{
+		int threadNum = 0;
+#ifdef USE_OPENMP
+		threadNum = omp_get_thread_num();
+#endif
+		try
+		{
+			threadViterbi[threadNum].apply(start, end, &(lineOrder[blockStarts[blockCounter]]), blockStarts[blockCounter + 1] - blockStarts[blockCounter]);
+		}
+		catch(impossibleDataException& err)
+		{
+			blockExceptions[blockCounter] = std::current_exception();
+			blockExceptionLines[blockCounter] = err.line;
+		}
+		catch(...)
+		{
+			blockExceptions[blockCounter] = std::current_exception();
+			blockExceptionLines[blockCounter] = lineOrder[blockStarts[blockCounter]];
+		}
+	}
+	int failedBlock = -1;
+	for(int blockCounter = 0; blockCounter < nLineBlocks; blockCounter++)
+	{
+		if(blockExceptions[blockCounter] && (failedBlock == -1 || blockExceptionLines[blockCounter] < blockExceptionLines[failedBlock])) failedBlock = blockCounter;
+	}
+	if(failedBlock != -1) std::rethrow_exception(blockExceptions[failedBlock]);
+}
+template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp::IntegerMatrix founders, Rcpp::IntegerMatrix finals, Rcpp::S4 pedigree, Rcpp::List hetData, Rcpp::List map, Rcpp::IntegerMatrix results, double homozygoteMissingProb, double heterozygoteMissingProb, Rcpp::IntegerMatrix key)
+{
+	imputeFoundersInputs inputs;
+	prepareImputeFoundersInputs(founders, finals, pedigree, hetData, map, nFounders, infiniteSelfing, inputs);
+	const int maxChromosomeMarkers = inputs.maxChromosomeMarkers;
+	const int minSelfing = inputs.minSelfing, maxSelfing = inputs.maxSelfing, minAIGenerations = inputs.minAIGenerations, maxAIGenerations = inputs.maxAIGenerations;
+
+	//The two-point log probabilities are kept in compressed form, rather than being expanded to every combination of founders
+	typedef typename logCompressedGenotypeProbabilities<nFounders, infiniteSelfing>::type logCompressedProbabilitiesType;
+
+	Rcpp::Function diff("diff"), haldaneToRf("haldaneToRf");
 
-	//Intermediate results. These give the most likely paths from the start of the chromosome to a marker, assuming some value for the underlying founder at the marker
-	Rcpp::IntegerMatrix intermediate(nFounders, maxChromosomeMarkers);
 	int cumulativeMarkerCounter = 0;
 
-	xMajorMatrix<expandedProbabilitiesType> intercrossingHaplotypeProbabilities(maxChromosomeMarkers-1, maxAIGenerations - minAIGenerations + 1, maxSelfing - minSelfing+1);
-	rowMajorMatrix<expandedProbabilitiesType> funnelHaplotypeProbabilities(maxChromosomeMarkers-1, maxSelfing - minSelfing + 1);
+	xMajorMatrix<logCompressedProbabilitiesType> intercrossingHaplotypeProbabilities(maxChromosomeMarkers-1, maxAIGenerations - minAIGenerations + 1, maxSelfing - minSelfing+1);
+	rowMajorMatrix<logCompressedProbabilitiesType> funnelHaplotypeProbabilities(maxChromosomeMarkers-1, maxSelfing - minSelfing + 1);
 
 	//The single loci probabilities are different depending on whether there are zero or one generations of intercrossing. But once you have non-zero generations, it doesn't matter how many
 	std::vector<array2<nFounders> > intercrossingSingleLociHaplotypeProbabilities(maxSelfing - minSelfing+1);
 	std::vector<array2<nFounders> > funnelSingleLociHaplotypeProbabilities(maxSelfing - minSelfing + 1);
 
-	int nFunnels = (int)allFunnelEncodings.size();
+	int nFunnels = (int)inputs.allFunnelEncodings.size();
 	//Generate single loci genetic data
 	for(int selfingGenerationCounter = minSelfing; selfingGenerationCounter <= maxSelfing; selfingGenerationCounter++)
 	{
@@ -146,45 +229,145 @@ template<int nFounders, bool infiniteSelfing> void imputedFoundersInternal2(Rcpp
 	}
 
 	//We'll do a dispath based on whether or not we have infinite generations of selfing. Which requires partial template specialization, which requires a struct/class
-	viterbiAlgorithm<nFounders, infiniteSelfing> viterbi(markerPatternData, intercrossingHaplotypeProbabilities, funnelHaplotypeProbabilities, maxChromosomeMarkers);
-	viterbi.recodedHetData = recodedHetData;
-	viterbi.recodedFounders = recodedFounders;
-	viterbi.recodedFinals = recodedFinals;
-	viterbi.lineFunnelIDs = &lineFunnelIDs;
-	viterbi.lineFunnelEncodings = &lineFunnelEncodings;
-	viterbi.intercrossingGenerations = &intercrossingGenerations;
-	viterbi.selfingGenerations = &selfingGenerations;
-	viterbi.results = results;
-	viterbi.key = key;
-	viterbi.homozygoteMissingProb = homozygoteMissingProb;
-	viterbi.heterozygoteMissingProb = heterozygoteMissingProb;
-	viterbi.intercrossingSingleLociHaplotypeProbabilities = &intercrossingSingleLociHaplotypeProbabilities;
-	viterbi.funnelSingleLociHaplotypeProbabilities = &funnelSingleLociHaplotypeProbabilities;
+	//Each thread gets its own Viterbi object, as these contain the working memory. They're set up here, as copying the Rcpp members isn't thread safe. Everything else, including the haplotype probabilities for the current chromosome, is shared and only read. 
+	int nThreads = 1;
+#ifdef USE_OPENMP
+	nThreads = omp_get_max_threads();
+#endif
+	std::vector<viterbiAlgorithm<nFounders, infiniteSelfing> > threadViterbi;
+	threadViterbi.reserve(nThreads);
+	for(int threadCounter = 0; threadCounter < nThreads; threadCounter++)
+	{
+		threadViterbi.push_back(viterbiAlgorithm<nFounders, infiniteSelfing>(inputs.markerPatternData, intercrossingHaplotypeProbabilities, funnelHaplotypeProbabilities, maxChromosomeMarkers));
+		viterbiAlgorithm<nFounders, infiniteSelfing>& viterbi = threadViterbi.back();
+		viterbi.recodedHetData = inputs.recodedHetData;
+		viterbi.recodedFounders = inputs.recodedFounders;
+		viterbi.recodedFinals = inputs.recodedFinals;
+		viterbi.lineFunnelIDs = &inputs.lineFunnelIDs;
+		viterbi.lineFunnelEncodings = &inputs.lineFunnelEncodings;
+		viterbi.intercrossingGenerations = &inputs.intercrossingGenerations;
+		viterbi.selfingGenerations = &inputs.selfingGenerations;
+		viterbi.results = results;
+		viterbi.key = key;
+		viterbi.homozygoteMissingProb = homozygoteMissingProb;
+		viterbi.heterozygoteMissingProb = heterozygoteMissingProb;
+		viterbi.intercrossingSingleLociHaplotypeProbabilities = &intercrossingSingleLociHaplotypeProbabilities;
+		viterbi.funnelSingleLociHaplotypeProbabilities = &funnelSingleLociHaplotypeProbabilities;
+	}
+	std::vector<int> lineOrder, blockStarts;
+	sortLinesIntoBlocks(inputs, lineOrder, blockStarts);
 
 	//Now actually run the Viterbi algorithm. To cut down on memory usage we run a single chromosome at a time
 	for(int chromosomeCounter = 0; chromosomeCounter < map.size(); chromosomeCounter++)
 	{
 		Rcpp::NumericVector positions = Rcpp::as<Rcpp::NumericVector>(map(chromosomeCounter));
 		Rcpp::NumericVector recombinationFractions = haldaneToRf(diff(positions));
-		//Generate haplotype probability data. 
-		for(int markerCounter = 0; markerCounter < recombinationFractions.size(); markerCounter++)
+		//Generate haplotype probability data. Every marker interval is done in a single call, so that terms which depend only on the generations of selfing are shared, and intervals with the same recombination fraction are only computed once.
+		const int nIntervals = (int)recombinationFractions.size();
+		if(nIntervals > 0)
 		{
-			double recombination = recombinationFractions(markerCounter);
 			for(int selfingGenerationCounter = minSelfing; selfingGenerationCounter <= maxSelfing; selfingGenerationCounter++)
 			{
-				expandedGenotypeProbabilities<nFounders, infiniteSelfing, true>::noIntercross(funnelHaplotypeProbabilities(markerCounter, selfingGenerationCounter - minSelfing), recombination, selfingGenerationCounter, nFunnels);
+				logCompressedGenotypeProbabilities<nFounders, infiniteSelfing>::noIntercrossBatch(&funnelHaplotypeProbabilities(0, selfingGenerationCounter - minSelfing), funnelHaplotypeProbabilities.getNColumns(), recombinationFractions.begin(), nIntervals, selfingGenerationCounter, nFunnels);
 			}
 			for(int selfingGenerationCounter = minSelfing; selfingGenerationCounter <= maxSelfing; selfingGenerationCounter++)
 			{
 				for(int intercrossingGenerations =  minAIGenerations; intercrossingGenerations <= maxAIGenerations; intercrossingGenerations++)
 				{
-					expandedGenotypeProbabilities<nFounders, infiniteSelfing, true>::withIntercross(intercrossingHaplotypeProbabilities(markerCounter, intercrossingGenerations - minAIGenerations, selfingGenerationCounter - minSelfing), intercrossingGenerations, recombination, selfingGenerationCounter, nFunnels);
+					logCompressedGenotypeProbabilities<nFounders, infiniteSelfing>::withIntercrossBatch(&intercrossingHaplotypeProbabilities(0, intercrossingGenerations - minAIGenerations, selfingGenerationCounter - minSelfing), 1, intercrossingGenerations, recombinationFractions.begin(), nIntervals, selfingGenerationCounter, nFunnels);
 				}
 			}
-
 		}
 		//dispatch based on whether we have infinite generations of selfing or not. 
-		viterbi.apply(cumulativeMarkerCounter, cumulativeMarkerCounter+(int)positions.size());
+		const int start = cumulativeMarkerCounter, end = cumulativeMarkerCounter+(int)positions.size();
+		imputeBlocks(threadViterbi, start, end, lineOrder, blockStarts);
+		cumulativeMarkerCounter += (int)positions.size();
+	}
+}
+//Other numbers of founders than 2, 4, 8 and 16. The probabilities come from genericFunnelProbabilities, for the shape of the funnels of the design, and there's no intercrossing. 
+template<bool infiniteSelfing> void imputedFoundersGenericFunnels(Rcpp::IntegerMatrix founders, Rcpp::IntegerMatrix finals, Rcpp::S4 pedigree, Rcpp::List hetData, Rcpp::List map, Rcpp::IntegerMatrix results, double homozygoteMissingProb, double heterozygoteMissingProb, Rcpp::IntegerMatrix key)
+{
+	const int nFounders = founders.nrow();
+	imputeFoundersInputs inputs;
+	prepareImputeFoundersInputs(founders, finals, pedigree, hetData, map, nFounders, infiniteSelfing, inputs);
+	const int maxChromosomeMarkers = inputs.maxChromosomeMarkers;
+	const int minSelfing = inputs.minSelfing, maxSelfing = inputs.maxSelfing;
+	//estimateRFCheckFunnels has already rejected lines with intercrossing, but check anyway
+	if(inputs.maxAIGenerations > 0) throw std::runtime_error("Intercrossing is only supported for 2, 4, 8 or 16 founders");
+
+	genericFunnelProbabilities probabilities = inputs.funnelShape.size() > 0 ? genericFunnelProbabilities(nFounders, inputs.funnelShape) : genericFunnelProbabilities(nFounders);
+	const int nDifferentProbs = probabilities.getNDifferentProbs(infiniteSelfing);
+	const std::vector<int>& mask = infiniteSelfing ? probabilities.getInfiniteMask() : probabilities.getFiniteMask();
+
+	Rcpp::Function diff("diff"), haldaneToRf("haldaneToRf");
+
+	int cumulativeMarkerCounter = 0;
+
+	//The compressed log probabilities, with index (class, marker interval, selfing generations - minimum selfing generations)
+	xMajorMatrix<double> funnelHaplotypeProbabilities(nDifferentProbs, maxChromosomeMarkers-1, maxSelfing - minSelfing + 1);
+	//The single locus log probabilities, with index (selfing generations - minimum selfing generations, founder1 * nFounders + founder2)
+	rowMajorMatrix<double> funnelSingleLociHaplotypeProbabilities(maxSelfing - minSelfing + 1, nFounders * nFounders);
+	std::vector<double> singleLocus;
+	for(int selfingGenerationCounter = minSelfing; selfingGenerationCounter <= maxSelfing; selfingGenerationCounter++)
+	{
+		probabilities.singleLocus(selfingGenerationCounter, infiniteSelfing, singleLocus);
+		for(int i = 0; i < nFounders * nFounders; i++)
+		{
+			if(singleLocus[i] == 0) funnelSingleLociHaplotypeProbabilities(selfingGenerationCounter - minSelfing, i) = -std::numeric_limits<double>::infinity();
+			else funnelSingleLociHaplotypeProbabilities(selfingGenerationCounter - minSelfing, i) = log(singleLocus[i]);
+		}
+	}
+
+	int nThreads = 1;
+#ifdef USE_OPENMP
+	nThreads = omp_get_max_threads();
+#endif
+	std::vector<viterbiAlgorithm<0, infiniteSelfing> > threadViterbi;
+	threadViterbi.reserve(nThreads);
+	for(int threadCounter = 0; threadCounter < nThreads; threadCounter++)
+	{
+		threadViterbi.push_back(viterbiAlgorithm<0, infiniteSelfing>(inputs.markerPatternData, mask, funnelHaplotypeProbabilities, maxChromosomeMarkers));
+		viterbiAlgorithm<0, infiniteSelfing>& viterbi = threadViterbi.back();
+		viterbi.recodedHetData = inputs.recodedHetData;
+		viterbi.recodedFounders = inputs.recodedFounders;
+		viterbi.recodedFinals = inputs.recodedFinals;
+		viterbi.lineFunnelIDs = &inputs.lineFunnelIDs;
+		viterbi.lineFunnelEncodings = &inputs.lineFunnelEncodings;
+		viterbi.selfingGenerations = &inputs.selfingGenerations;
+		viterbi.results = results;
+		viterbi.key = key;
+		viterbi.homozygoteMissingProb = homozygoteMissingProb;
+		viterbi.heterozygoteMissingProb = heterozygoteMissingProb;
+		viterbi.funnelSingleLociHaplotypeProbabilities = &funnelSingleLociHaplotypeProbabilities;
+	}
+	std::vector<int> lineOrder, blockStarts;
+	sortLinesIntoBlocks(inputs, lineOrder, blockStarts);
+
+	for(int chromosomeCounter = 0; chromosomeCounter < map.size(); chromosomeCounter++)
+	{
+		Rcpp::NumericVector positions = Rcpp::as<Rcpp::NumericVector>(map(chromosomeCounter));
+		std::vector<double> recombinationFractions = Rcpp::as<std::vector<double> >(haldaneToRf(diff(positions)));
+		const int nIntervals = (int)recombinationFractions.size();
+		//genericFunnelProbabilities has no mutable state, so the intervals can be done in parallel
+#ifdef USE_OPENMP
+		#pragma omp parallel for schedule(dynamic)
+#endif
+		for(int intervalCounter = 0; intervalCounter < nIntervals; intervalCounter++)
+		{
+			for(int selfingGenerationCounter = minSelfing; selfingGenerationCounter <= maxSelfing; selfingGenerationCounter++)
+			{
+				double* logProbabilities = &(funnelHaplotypeProbabilities(0, intervalCounter, selfingGenerationCounter - minSelfing));
+				if(infiniteSelfing) probabilities.compressedInfiniteSelfing(recombinationFractions[intervalCounter], logProbabilities);
+				else probabilities.compressedFiniteSelfing(recombinationFractions[intervalCounter], selfingGenerationCounter, logProbabilities);
+				for(int i = 0; i < nDifferentProbs; i++)
+				{
+					if(logProbabilities[i] == 0) logProbabilities[i] = -std::numeric_limits<double>::infinity();
+					else logProbabilities[i] = log(logProbabilities[i]);
+				}
+			}
+		}
+		const int start = cumulativeMarkerCounter, end = cumulativeMarkerCounter+(int)positions.size();
+		imputeBlocks(threadViterbi, start, end, lineOrder, blockStarts);
 		cumulativeMarkerCounter += (int)positions.size();
 	}
 }
@@ -392,9 +575,22 @@ BEGIN_RCPP
 		{
 			imputedFoundersInternal1<16>(founders, finals, pedigree, hetData, map, results, infiniteSelfing, homozygoteMissingProb, heterozygoteMissingProb, key);
 		}
+		else if(nFounders >= 2 && nFounders <= funnelEncoding::maxFounders)
+		{
+			if(infiniteSelfing)
+			{
+				imputedFoundersGenericFunnels<true>(founders, finals, pedigree, hetData, map, results, homozygoteMissingProb, heterozygoteMissingProb, key);
+			}
+			else
+			{
+				imputedFoundersGenericFunnels<false>(founders, finals, pedigree, hetData, map, results, homozygoteMissingProb, heterozygoteMissingProb, key);
+			}
+		}
 		else
 		{
-			throw std::runtime_error("Number of founders must be 2, 4, 8 or 16");
+			std::stringstream ss;
+			ss << "Number of founders must be between 2 and " << funnelEncoding::maxFounders;
+			throw std::runtime_error(ss.str().c_str());
 		}
 	}
 	catch(impossibleDataException err)
@@ -1,5 +1,6 @@
 #include "intercrossingAndSelfingGenerations.h"
 #include "sortPedigreeLineNames.h"
+#include "genericFunnelProbabilities.h"
 bool getIntercrossingAndSelfingGenerations(Rcpp::S4 pedigree, Rcpp::IntegerMatrix finals, int nFounders, std::vector<int>& intercrossing, std::vector<int>& selfing)
 {
 	Rcpp::CharacterVector pedigreeLineNames = Rcpp::as<Rcpp::CharacterVector>(pedigree.slot("lineNames"));
@@ -19,6 +20,19 @@ bool getIntercrossingAndSelfingGenerations(Rcpp::S4 pedigree, Rcpp::IntegerMatri
 	selfing.clear();
 	selfing.resize(nFinals);
 	int log2Founders = (int)((log(nFounders) / log(2)) + 0.5);
+	//With 2, 4, 8 or 16 founders the funnels take log2(nFounders) generations. Otherwise the funnels can have any shape, so instead the founders that each line descends from are counted (with repeats), and every generation of intercrossing doubles this count. 
+	bool genericFunnels = usesGenericFunnelProbabilities(nFounders);
+	std::vector<double> descendedFounders;
+	if(genericFunnels)
+	{
+		descendedFounders.resize(nPedigreeRows);
+		for(R_xlen_t row = 0; row < nPedigreeRows; row++)
+		{
+			if(mother(row) == 0 && father(row) == 0) descendedFounders[row] = 1;
+			else if(mother(row) == father(row)) descendedFounders[row] = descendedFounders[mother(row)-1];
+			else descendedFounders[row] = (mother(row) > 0 ? descendedFounders[mother(row)-1] : 0) + (father(row) > 0 ? descendedFounders[father(row)-1] : 0);
+		}
+	}
 	for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
 	{
 		std::string currentLineName = Rcpp::as<std::string>(finalNames(finalCounter));
@@ -34,6 +48,14 @@ bool getIntercrossingAndSelfingGenerations(Rcpp::S4 pedigree, Rcpp::IntegerMatri
 			if(currentPedRow < 0 || currentPedRow > nPedigreeRows) return false;
 			currentSelfing++;
 		}
+		if(genericFunnels)
+		{
+			int nAIC = 0;
+			for(double count = descendedFounders[currentPedRow]; count > nFounders; count /= 2) nAIC++;
+			intercrossing[finalCounter] = nAIC;
+			selfing[finalCounter] = currentSelfing;
+			continue;
+		}
 		//Now the AIC generations
 		int nAIC = 0;
 		while(mother(currentPedRow) > 0)
@@ -8,13 +8,13 @@ private:
 public:
 	static const int nDifferentProbs = compressedProbabilities<nFounders, false>::nDifferentProbs;
 	typedef typename std::array<double, nDifferentProbs> compressedProbabilitiesType;
-	template<bool takeLogs> static void convert(xMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, funnelEncoding enc)
+	template<bool takeLogs> static void convert(xMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, const funnelEncoding& enc)
 	{
 		/*The funnel input only makes a difference to the result if there is a single funnel - If there was more than one funnel we assumed random funnels, in which case every choice of funnel here gives the same result. */
 		int funnel[nFounders];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			funnel[founderCounter] = ((enc & ((std::size_t)15 << (4*founderCounter))) >> (4*founderCounter));
+			funnel[founderCounter] = enc[founderCounter];
 		}
 		int nPoints = haplotypeProbabilities.getSizeX();
 		int table[maxAlleles][maxAlleles][nDifferentProbs];
@@ -79,12 +79,12 @@ public:
 #endif
 		}
 	}
-	template<bool takeLogs> static void convert16MarkerAlleles(array2<16>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, funnelEncoding enc)
+	template<bool takeLogs> static void convert16MarkerAlleles(array2<16>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, const funnelEncoding& enc)
 	{
 		int funnel[nFounders];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			funnel[founderCounter] = ((enc & ((std::size_t)15 << (4*founderCounter))) >> (4*founderCounter));
+			funnel[founderCounter] = enc[founderCounter];
 		}
 		memset(&markerProbabilitiesThisRecomb, 0, sizeof(array2<16>));
 		for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
@@ -8,7 +8,7 @@ private:
 public:
 	static const int nDifferentProbs = compressedProbabilities<nFounders, true>::nDifferentProbs;
 	typedef typename std::array<double, nDifferentProbs> compressedProbabilitiesType;
-	template<bool takeLogs> static void convert(xMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, funnelEncoding enc)
+	template<bool takeLogs> static void convert(xMajorMatrix<compressedProbabilitiesType>& haplotypeProbabilities, array2<maxAlleles>* markerProbabilities, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, const funnelEncoding& enc)
 	{
 		int nPoints = haplotypeProbabilities.getSizeX();
 		int table[maxAlleles][maxAlleles][nDifferentProbs];
@@ -56,7 +56,7 @@ public:
 			}
 		}
 	}
-	template<bool takeLogs> static void convert(array2<maxAlleles>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, funnelEncoding enc)
+	template<bool takeLogs> static void convert(array2<maxAlleles>& markerProbabilitiesThisRecomb, compressedProbabilitiesType& haplotypeProbabilitiesThisRecomb, int intercrossingGeneration, const markerData& firstMarkerPatternData, const markerData& secondMarkerPatternData, int selfingGenerationsIndex, const funnelEncoding& enc)
 	{
 		memset(&markerProbabilitiesThisRecomb, 0, sizeof(array2<maxAlleles>));
 		for(int firstMarkerValue = 0; firstMarkerValue < firstMarkerPatternData.nObservedValues; firstMarkerValue++)
@@ -0,0 +1,63 @@
+#ifndef INTERMEDIATE_PROBABILITIES_MASK_HEADER_GUARD
+#define INTERMEDIATE_PROBABILITIES_MASK_HEADER_GUARD
+#include <vector>
+#include <algorithm>
+/*
+ * Generates the intermediateProbabilitiesMask of probabilityData, for designs where nFounders founders (4, 8 or 16) are combined through a funnel. The mask converts the genotypes at two loci (each encoded as firstFounder * nFounders + secondFounder) into an index into the compressed two-point probabilities.
+ *
+ * Two pairs of genotypes have the same probability if one can be transformed into the other by a symmetry of the funnel (swapping the two founders or the two halves of the funnel, at any level), by swapping the two haplotypes, or by swapping the two loci. So the class of a pair of genotypes is determined by the level in the funnel at which each of the six pairs of founders are joined. The level for founders i and j is the number of bits in i XOR j, as founders 2k and 2k+1 are crossed first, and so on.
+ * The classes are numbered in the order in which they are first encountered, scanning the mask row by row. This is the numbering used by genotypeProbabilitiesNoIntercross and genotypeProbabilitiesWithIntercross.
+ */
+template<int nFounders> class intermediateProbabilitiesMaskGenerator
+{
+public:
+	static const int nGenotypes = nFounders * nFounders;
+	typedef int type[nGenotypes][nGenotypes];
+	//The mask is generated the first time it's requested
+	static const type& get()
+	{
+		static const intermediateProbabilitiesMaskGenerator generated;
+		return generated.mask;
+	}
+private:
+	static int level(int founder1, int founder2)
+	{
+		int result = 0;
+		for(int difference = founder1 ^ founder2; difference > 0; difference >>= 1) result++;
+		return result;
+	}
+	//Encode the levels as a number in base nLevels
+	static int encode(int aa, int a1b1, int a1b2, int a2b1, int a2b2, int bb)
+	{
+		return ((((aa * nLevels + a1b1) * nLevels + a1b2) * nLevels + a2b1) * nLevels + a2b2) * nLevels + bb;
+	}
+	intermediateProbabilitiesMaskGenerator()
+	{
+		std::vector<int> classes(nLevels * nLevels * nLevels * nLevels * nLevels * nLevels, -1);
+		int nClasses = 0;
+		for(int a1 = 0; a1 < nFounders; a1++)
+		{
+			for(int a2 = 0; a2 < nFounders; a2++)
+			{
+				for(int b1 = 0; b1 < nFounders; b1++)
+				{
+					for(int b2 = 0; b2 < nFounders; b2++)
+					{
+						int aa = level(a1, a2), a1b1 = level(a1, b1), a1b2 = level(a1, b2), a2b1 = level(a2, b1), a2b2 = level(a2, b2), bb = level(b1, b2);
+						//The key is the smallest encoding over the symmetries of the haplotypes and loci
+						int key = encode(aa, a1b1, a1b2, a2b1, a2b2, bb);
+						key = std::min(key, encode(aa, a2b2, a2b1, a1b2, a1b1, bb));
+						key = std::min(key, encode(bb, a1b1, a2b1, a1b2, a2b2, aa));
+						key = std::min(key, encode(bb, a2b2, a1b2, a2b1, a1b1, aa));
+						if(classes[key] == -1) classes[key] = nClasses++;
+						mask[a1 * nFounders + a2][b1 * nFounders + b2] = classes[key];
+					}
+				}
+			}
+		}
+	}
+	//The number of levels is one more than the number of rounds of crossing in the funnel
+	static const int nLevels = nFounders == 4 ? 3 : (nFounders == 8 ? 4 : 5);
+	type mask;
+};
+#endif
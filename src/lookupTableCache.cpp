@@ -0,0 +1,185 @@
+#include "lookupTableCache.h"
+#include "crc32.h"
+#include <errno.h>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+namespace
+{
+	const char magic[8] = {'m', 'p', 'M', 'a', 'p', '2', 'L', 'k'};
+	//Values are written in the native byte order.
+	struct fileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t patternSignatureSize;
+		uint64_t designSignatureSize;
+		uint64_t nEntries;
+	};
+	std::size_t roundUp(std::size_t value)
+	{
+		return ((value + 7) / 8) * 8;
+	}
+}
+lookupTableCache::lookupTableCache(const std::string& directory, const std::vector<unsigned char>& designSignature, const std::vector<std::vector<unsigned char> >& patternSignatures)
+	: designSignature(designSignature), patternSignatures(patternSignatures), patternSignatureSize(patternSignatures.size() > 0 ? patternSignatures[0].size() : 0), nExistingEntries(0), keysOffset(0), offsetsOffset(0), recordsOffset(0)
+{
+	std::stringstream ss;
+	char hash[9];
+	snprintf(hash, sizeof(hash), "%08x", (unsigned int)crc32(&(designSignature[0]), designSignature.size()));
+	ss << directory << "/" << hash << ".lookup";
+	path = ss.str();
+
+	patternHashes.resize(patternSignatures.size());
+	for(std::size_t i = 0; i < patternSignatures.size(); i++)
+	{
+		if(patternSignatures[i].size() != patternSignatureSize) throw std::runtime_error("Internal error");
+		patternHashes[i] = crc32(&(patternSignatures[i][0]), patternSignatureSize);
+	}
+	//If there's no usable cache file this is just a cache miss, so any problem with the existing file is ignored.
+	std::unique_ptr<mappedFile> file;
+	try
+	{
+		file.reset(new mappedFile(path, false));
+	}
+	catch(...)
+	{
+		return;
+	}
+	if(file->getSize() < sizeof(fileHeader)) return;
+	fileHeader header;
+	memcpy(&header, file->getData(), sizeof(fileHeader));
+	if(memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != layoutVersion || header.patternSignatureSize != patternSignatureSize || header.designSignatureSize != designSignature.size()) return;
+	std::size_t keys = sizeof(fileHeader) + roundUp(designSignature.size());
+	std::size_t offsets = keys + header.nEntries * sizeof(uint64_t);
+	std::size_t records = offsets + (header.nEntries + 1) * sizeof(uint64_t);
+	if(records > file->getSize()) return;
+	if(memcmp(file->getData() + sizeof(fileHeader), &(designSignature[0]), designSignature.size()) != 0) return;
+	//The offsets must be increasing, and every record must contain at least the two pattern signatures
+	const uint64_t* offsetData = (const uint64_t*)(file->getData() + offsets);
+	if(offsetData[0] != 0 || records + offsetData[header.nEntries] > file->getSize()) return;
+	for(std::size_t i = 0; i < header.nEntries; i++)
+	{
+		if(offsetData[i+1] < offsetData[i] + 2 * patternSignatureSize) return;
+	}
+	existing.swap(file);
+	nExistingEntries = header.nEntries;
+	keysOffset = keys;
+	offsetsOffset = offsets;
+	recordsOffset = records;
+}
+uint64_t lookupTableCache::key(int firstPattern, int secondPattern) const
+{
+	return ((uint64_t)patternHashes[firstPattern] << 32) | (uint64_t)patternHashes[secondPattern];
+}
+const uint64_t* lookupTableCache::existingKeys() const
+{
+	return (const uint64_t*)(existing->getData() + keysOffset);
+}
+const uint64_t* lookupTableCache::existingOffsets() const
+{
+	return (const uint64_t*)(existing->getData() + offsetsOffset);
+}
+const unsigned char* lookupTableCache::existingRecord(std::size_t index) const
+{
+	return existing->getData() + recordsOffset + existingOffsets()[index];
+}
+std::size_t lookupTableCache::existingRecordSize(std::size_t index) const
+{
+	return (std::size_t)(existingOffsets()[index+1] - existingOffsets()[index]);
+}
+const unsigned char* lookupTableCache::find(int firstPattern, int secondPattern, std::size_t& size) const
+{
+	if(nExistingEntries == 0) return NULL;
+	uint64_t currentKey = key(firstPattern, secondPattern);
+	const uint64_t* keys = existingKeys();
+	const uint64_t* start = std::lower_bound(keys, keys + nExistingEntries, currentKey);
+	//Different marker patterns can have the same hash, so the full signatures are checked.
+	for(const uint64_t* position = start; position != keys + nExistingEntries && *position == currentKey; position++)
+	{
+		const unsigned char* record = existingRecord(position - keys);
+		if(memcmp(record, &(patternSignatures[firstPattern][0]), patternSignatureSize) == 0 && memcmp(record + patternSignatureSize, &(patternSignatures[secondPattern][0]), patternSignatureSize) == 0)
+		{
+			size = existingRecordSize(position - keys) - 2 * patternSignatureSize;
+			return record + 2 * patternSignatureSize;
+		}
+	}
+	return NULL;
+}
+void lookupTableCache::save(const std::vector<std::pair<int, int> >& newEntries, const std::function<std::pair<const unsigned char*, std::size_t>(int, int)>& serialize)
+{
+	if(newEntries.size() == 0) return;
+	//Each record comes either from the existing file (non-negative values) or from newEntries (negative values, offset by one).
+	std::vector<std::pair<uint64_t, std::ptrdiff_t> > sources;
+	sources.reserve(nExistingEntries + newEntries.size());
+	for(std::size_t i = 0; i < nExistingEntries; i++) sources.push_back(std::make_pair(existingKeys()[i], (std::ptrdiff_t)i));
+	for(std::size_t i = 0; i < newEntries.size(); i++) sources.push_back(std::make_pair(key(newEntries[i].first, newEntries[i].second), -(std::ptrdiff_t)i - 1));
+	std::stable_sort(sources.begin(), sources.end(), [](const std::pair<uint64_t, std::ptrdiff_t>& first, const std::pair<uint64_t, std::ptrdiff_t>& second){ return first.first < second.first; });
+
+	std::stringstream temporaryName;
+	temporaryName << path << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_" << std::chrono::steady_clock::now().time_since_epoch().count();
+	std::string temporary = temporaryName.str();
+	{
+		std::ofstream output(temporary.c_str(), std::ios::binary | std::ios::trunc);
+		if(!output) return;
+		fileHeader header;
+		memcpy(header.magic, magic, sizeof(magic));
+		header.version = layoutVersion;
+		header.patternSignatureSize = (uint32_t)patternSignatureSize;
+		header.designSignatureSize = designSignature.size();
+		header.nEntries = sources.size();
+		std::vector<unsigned char> buffer(roundUp(sizeof(fileHeader) + designSignature.size()), 0);
+		memcpy(&(buffer[0]), &header, sizeof(fileHeader));
+		memcpy(&(buffer[sizeof(fileHeader)]), &(designSignature[0]), designSignature.size());
+		output.write((const char*)&(buffer[0]), buffer.size());
+		for(std::size_t i = 0; i < sources.size(); i++) output.write((const char*)&(sources[i].first), sizeof(uint64_t));
+		//The new entries are only serialized once, so their sizes are stored for the offsets.
+		std::vector<std::pair<const unsigned char*, std::size_t> > serialized(newEntries.size());
+		for(std::size_t i = 0; i < newEntries.size(); i++) serialized[i] = serialize(newEntries[i].first, newEntries[i].second);
+		uint64_t offset = 0;
+		output.write((const char*)&offset, sizeof(uint64_t));
+		for(std::size_t i = 0; i < sources.size(); i++)
+		{
+			if(sources[i].second >= 0) offset += existingRecordSize(sources[i].second);
+			else offset += 2 * patternSignatureSize + serialized[-sources[i].second - 1].second;
+			output.write((const char*)&offset, sizeof(uint64_t));
+		}
+		for(std::size_t i = 0; i < sources.size(); i++)
+		{
+			if(sources[i].second >= 0)
+			{
+				output.write((const char*)existingRecord(sources[i].second), existingRecordSize(sources[i].second));
+			}
+			else
+			{
+				const std::pair<int, int>& entry = newEntries[-sources[i].second - 1];
+				const std::pair<const unsigned char*, std::size_t>& data = serialized[-sources[i].second - 1];
+				output.write((const char*)&(patternSignatures[entry.first][0]), patternSignatureSize);
+				output.write((const char*)&(patternSignatures[entry.second][0]), patternSignatureSize);
+				output.write((const char*)data.first, data.second);
+			}
+		}
+		output.close();
+		if(!output)
+		{
+			std::remove(temporary.c_str());
+			return;
+		}
+	}
+	//The existing file has to be unmapped before it can be replaced on Windows
+	existing.reset();
+	nExistingEntries = 0;
+	try
+	{
+		mappedFile::replace(temporary, path);
+	}
+	catch(...)
+	{
+		std::remove(temporary.c_str());
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef LOOKUP_TABLE_CACHE_HEADER_GUARD
+#define LOOKUP_TABLE_CACHE_HEADER_GUARD
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <stdint.h>
+#include "mappedFile.h"
+/** A cache of lookup table entries on disk
+ *
+ * The lookup table entry for a pair of marker patterns depends only on the design (number of founders, funnels, generations of intercrossing and selfing, and the recombination fractions) and on the two marker patterns. So entries computed by one call to estimateRF can be reused by later calls on overlapping or different sets of markers.
+ * There is one file per design, named after the crc32 of the design signature. The file contains the complete design signature, which is checked when the file is opened, so a hash collision can never give the wrong entries. Entries can have different sizes. Each entry is stored along with the signatures of its two marker patterns, and the entries are sorted by the crc32 values of the pattern signatures so that they can be found with a binary search of the memory mapped file.
+ * A new file is written to a temporary file and then renamed, so processes sharing a cache directory never see a partially written file.
+ */
+class lookupTableCache
+{
+public:
+	/*
+	 * @param directory The cache directory, which must already exist
+	 * @param designSignature Bytes which identify the design
+	 * @param patternSignatures Bytes which identify each marker pattern. These must all be the same length.
+	 */
+	lookupTableCache(const std::string& directory, const std::vector<unsigned char>& designSignature, const std::vector<std::vector<unsigned char> >& patternSignatures);
+	//Returns a pointer to the serialized entry for the given pair of marker patterns and sets size to its size, or returns NULL if it's not in the cache. This can be called concurrently. The entry is not necessarily aligned.
+	const unsigned char* find(int firstPattern, int secondPattern, std::size_t& size) const;
+	/* Write a new cache file, containing the existing entries and the new entries, and replace the existing file with it.
+	 * @param newEntries The pairs of marker patterns for the new entries
+	 * @param serialize Function which returns the serialized entry for a pair of marker patterns, and its size
+	 */
+	void save(const std::vector<std::pair<int, int> >& newEntries, const std::function<std::pair<const unsigned char*, std::size_t>(int, int)>& serialize);
+	std::size_t getNExistingEntries() const
+	{
+		return nExistingEntries;
+	}
+	static const uint32_t layoutVersion = 2;
+private:
+	lookupTableCache(const lookupTableCache&);
+	lookupTableCache& operator=(const lookupTableCache&);
+	uint64_t key(int firstPattern, int secondPattern) const;
+	const uint64_t* existingKeys() const;
+	//Offsets of the records relative to the first record. There is one more offset than there are records.
+	const uint64_t* existingOffsets() const;
+	const unsigned char* existingRecord(std::size_t index) const;
+	std::size_t existingRecordSize(std::size_t index) const;
+	std::string path;
+	std::vector<unsigned char> designSignature;
+	const std::vector<std::vector<unsigned char> >& patternSignatures;
+	std::vector<uint32_t> patternHashes;
+	std::size_t patternSignatureSize;
+	std::unique_ptr<mappedFile> existing;
+	std::size_t nExistingEntries;
+	std::size_t keysOffset, offsetsOffset, recordsOffset;
+};
+#endif
@@ -0,0 +1,141 @@
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <errno.h>
+#include "mappedFile.h"
+#include <cstring>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+void mappedFile::throwError(const std::string& message, const std::string& path)
+{
+	std::stringstream ss;
+	ss << message << " " << path;
+	if(errno != 0) ss << ": " << strerror(errno);
+	throw std::runtime_error(ss.str().c_str());
+}
+void mappedFile::create(const std::string& path, const void* data, std::size_t length, uint64_t totalSize)
+{
+	errno = 0;
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(handle == INVALID_HANDLE_VALUE) throwError("Unable to create file", path);
+	DWORD written;
+	LARGE_INTEGER size;
+	size.QuadPart = (LONGLONG)totalSize;
+	bool successful = WriteFile(handle, data, (DWORD)length, &written, NULL) && written == length && SetFilePointerEx(handle, size, NULL, FILE_BEGIN) && SetEndOfFile(handle);
+	CloseHandle(handle);
+	if(!successful) throwError("Unable to write file", path);
+#else
+	int descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if(descriptor < 0) throwError("Unable to create file", path);
+	std::size_t totalWritten = 0;
+	while(totalWritten < length)
+	{
+		ssize_t written = write(descriptor, (const char*)data + totalWritten, length - totalWritten);
+		if(written <= 0)
+		{
+			::close(descriptor);
+			throwError("Unable to write file", path);
+		}
+		totalWritten += written;
+	}
+	if(ftruncate(descriptor, (off_t)totalSize) != 0)
+	{
+		::close(descriptor);
+		throwError("Unable to resize file", path);
+	}
+	::close(descriptor);
+#endif
+}
+void mappedFile::replace(const std::string& temporary, const std::string& path)
+{
+	errno = 0;
+#ifdef _WIN32
+	if(!MoveFileExA(temporary.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) throwError("Unable to replace file", path);
+#else
+	if(std::rename(temporary.c_str(), path.c_str()) != 0) throwError("Unable to replace file", path);
+#endif
+}
+mappedFile::mappedFile(const std::string& path, bool writable)
+	: mapped(NULL), mappedSize(0)
+{
+	errno = 0;
+#ifdef _WIN32
+	mappingHandle = NULL;
+	fileHandle = CreateFileA(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, FILE_SHARE_READ | (writable ? 0 : FILE_SHARE_WRITE), NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(fileHandle == INVALID_HANDLE_VALUE) throwError("Unable to open file", path);
+	LARGE_INTEGER size;
+	if(!GetFileSizeEx(fileHandle, &size))
+	{
+		close();
+		throwError("Unable to determine the size of file", path);
+	}
+	mappedSize = (uint64_t)size.QuadPart;
+	if(mappedSize == 0)
+	{
+		close();
+		throwError("Empty file", path);
+	}
+	mappingHandle = CreateFileMappingA(fileHandle, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+	if(mappingHandle == NULL)
+	{
+		close();
+		throwError("Unable to map file", path);
+	}
+	mapped = (unsigned char*)MapViewOfFile(mappingHandle, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+	if(mapped == NULL)
+	{
+		close();
+		throwError("Unable to map file", path);
+	}
+#else
+	fileDescriptor = open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+	if(fileDescriptor < 0) throwError("Unable to open file", path);
+	struct stat fileStatus;
+	if(fstat(fileDescriptor, &fileStatus) != 0)
+	{
+		close();
+		throwError("Unable to determine the size of file", path);
+	}
+	mappedSize = (uint64_t)fileStatus.st_size;
+	if(mappedSize == 0)
+	{
+		close();
+		throwError("Empty file", path);
+	}
+	void* result = mmap(NULL, (std::size_t)mappedSize, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fileDescriptor, 0);
+	if(result == MAP_FAILED)
+	{
+		close();
+		throwError("Unable to map file", path);
+	}
+	mapped = (unsigned char*)result;
+#endif
+}
+void mappedFile::close()
+{
+#ifdef _WIN32
+	if(mapped != NULL) UnmapViewOfFile(mapped);
+	if(mappingHandle != NULL) CloseHandle(mappingHandle);
+	if(fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+	mappingHandle = NULL;
+	fileHandle = INVALID_HANDLE_VALUE;
+#else
+	if(mapped != NULL) munmap(mapped, (std::size_t)mappedSize);
+	if(fileDescriptor >= 0) ::close(fileDescriptor);
+	fileDescriptor = -1;
+#endif
+	mapped = NULL;
+}
+mappedFile::~mappedFile()
+{
+	close();
+}
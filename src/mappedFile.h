@@ -0,0 +1,39 @@
+#ifndef MAPPED_FILE_HEADER_GUARD
+#define MAPPED_FILE_HEADER_GUARD
+#include <string>
+#include <stdint.h>
+#include <cstddef>
+//A whole file mapped into memory. Changes to a writable mapping are written back to the file.
+class mappedFile
+{
+public:
+	mappedFile(const std::string& path, bool writable);
+	~mappedFile();
+	unsigned char* getData()
+	{
+		return mapped;
+	}
+	uint64_t getSize() const
+	{
+		return mappedSize;
+	}
+	//Create a file (overwriting any existing file) which starts with the given data, and is extended with zeros to totalSize bytes. The extension is sparse on most filesystems, so this is quick even for very large files.
+	static void create(const std::string& path, const void* data, std::size_t length, uint64_t totalSize);
+	//Replace the file at path with the file at temporary, so that other processes see either the old or the new file, but never a partially written one.
+	static void replace(const std::string& temporary, const std::string& path);
+	//Throw an exception with the given message and path, including the reason for the last failed system call if there is one.
+	static void throwError(const std::string& message, const std::string& path);
+private:
+	mappedFile(const mappedFile&);
+	mappedFile& operator=(const mappedFile&);
+	void close();
+	unsigned char* mapped;
+	uint64_t mappedSize;
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#else
+	int fileDescriptor;
+#endif
+};
+#endif
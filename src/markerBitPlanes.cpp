@@ -0,0 +1,70 @@
+#include "markerBitPlanes.h"
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+markerBitPlanes::markerBitPlanes(Rcpp::IntegerMatrix finals, const std::vector<int>& lineClasses, int nClasses, const std::vector<int>& markers)
+	: markerSlots(finals.ncol(), -1), markerNAlleles(markers.size(), 0), planeOffsets(markers.size()+1, 0), classStartWords(nClasses+1, 0)
+{
+	int nFinals = finals.nrow();
+	if((int)lineClasses.size() != nFinals) throw std::runtime_error("Internal error");
+	//Work out how many lines there are in each class, and therefore where each class starts
+	std::vector<int> classSizes(nClasses, 0);
+	for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+	{
+		if(lineClasses[finalCounter] >= 0) classSizes[lineClasses[finalCounter]]++;
+	}
+	for(int classCounter = 0; classCounter < nClasses; classCounter++)
+	{
+		classStartWords[classCounter+1] = classStartWords[classCounter] + (classSizes[classCounter] + bitsPerWord - 1) / bitsPerWord;
+		if(classSizes[classCounter] > 0) nonEmptyClasses.push_back(classCounter);
+	}
+	nWords = classStartWords[nClasses];
+	//Assign every line a bit position, preserving the order of the lines within each class
+	linePositions.resize(nFinals, -1);
+	std::vector<int> classFilled(nClasses, 0);
+	for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+	{
+		int lineClass = lineClasses[finalCounter];
+		if(lineClass < 0) continue;
+		linePositions[finalCounter] = classStartWords[lineClass] * bitsPerWord + classFilled[lineClass];
+		classFilled[lineClass]++;
+	}
+
+	const int* finalsData = &(finals(0, 0));
+	int nMarkers = (int)markers.size();
+	//First pass works out the number of planes required for each marker
+#ifdef USE_OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for(int markerCounter = 0; markerCounter < nMarkers; markerCounter++)
+	{
+		const int* column = finalsData + (std::size_t)markers[markerCounter] * nFinals;
+		int maxValue = -1;
+		for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+		{
+			if(column[finalCounter] != NA_INTEGER && linePositions[finalCounter] >= 0) maxValue = std::max(maxValue, column[finalCounter]);
+		}
+		markerNAlleles[markerCounter] = maxValue + 1;
+	}
+	for(int markerCounter = 0; markerCounter < nMarkers; markerCounter++)
+	{
+		markerSlots[markers[markerCounter]] = markerCounter;
+		planeOffsets[markerCounter+1] = planeOffsets[markerCounter] + (std::size_t)markerNAlleles[markerCounter] * nWords;
+	}
+	planes.resize(planeOffsets[nMarkers], 0);
+	//Second pass sets the bits
+#ifdef USE_OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for(int markerCounter = 0; markerCounter < nMarkers; markerCounter++)
+	{
+		const int* column = finalsData + (std::size_t)markers[markerCounter] * nFinals;
+		word* markerPlanes = planes.data() + planeOffsets[markerCounter];
+		for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+		{
+			int position = linePositions[finalCounter];
+			if(column[finalCounter] == NA_INTEGER || position < 0) continue;
+			markerPlanes[(std::size_t)column[finalCounter] * nWords + position / bitsPerWord] |= ((word)1) << (position % bitsPerWord);
+		}
+	}
+}
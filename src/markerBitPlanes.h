@@ -0,0 +1,118 @@
+#ifndef MARKER_BIT_PLANES_HEADER_GUARD
+#define MARKER_BIT_PLANES_HEADER_GUARD
+#include <Rcpp.h>
+#include <vector>
+#include <stdint.h>
+/** Bit-packed copy of the finals, used to compute joint allele counts for a pair of markers
+ *
+ * For every marker there is one bitset (plane) per allele value, with bit i set if line i has that allele. Missing values have no bit set in any plane, so they drop out of every intersection automatically.
+ * The lines are permuted so that all the lines of a class (a combination of selfing generations and funnel or intercrossing generations) are adjacent, and the lines of every class start at a new word. So the number of lines of a class having allele a1 at marker 1 and a2 at marker 2 is a popcount of (plane1 & plane2) over a contiguous range of words.
+ */
+class markerBitPlanes
+{
+public:
+	typedef uint64_t word;
+	static const int bitsPerWord = 64;
+	/*
+	 * @param finals The recoded finals. All non-NA values must be non-negative.
+	 * @param lineClasses The class of each line. A value of -1 indicates that the line is excluded completely.
+	 * @param nClasses The number of classes
+	 * @param markers The indices of the markers for which planes should be constructed.
+	 */
+	markerBitPlanes(Rcpp::IntegerMatrix finals, const std::vector<int>& lineClasses, int nClasses, const std::vector<int>& markers);
+	//The plane for the given marker and allele. The marker must have been included in the constructor argument markers.
+	const word* plane(int marker, int allele) const
+	{
+		return &(planes[planeOffsets[markerSlots[marker]] + (std::size_t)allele * nWords]);
+	}
+	//The number of planes for this marker, which is one more than the largest observed allele.
+	int nAlleles(int marker) const
+	{
+		return markerNAlleles[markerSlots[marker]];
+	}
+	//The number of words per plane
+	int getNWords() const
+	{
+		return nWords;
+	}
+	//Classes which contain at least one line
+	const std::vector<int>& getNonEmptyClasses() const
+	{
+		return nonEmptyClasses;
+	}
+	//The range of words [classStart, classEnd) containing the lines of the given class
+	int classStart(int lineClass) const
+	{
+		return classStartWords[lineClass];
+	}
+	int classEnd(int lineClass) const
+	{
+		return classStartWords[lineClass+1];
+	}
+	//The bit position of each line within a plane, or -1 if the line is excluded
+	const std::vector<int>& getLinePositions() const
+	{
+		return linePositions;
+	}
+private:
+	int nWords;
+	std::vector<int> markerSlots;
+	std::vector<int> markerNAlleles;
+	std::vector<std::size_t> planeOffsets;
+	std::vector<int> classStartWords;
+	std::vector<int> nonEmptyClasses;
+	std::vector<int> linePositions;
+	std::vector<word> planes;
+};
+inline int popcount(markerBitPlanes::word x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(x);
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+//Number of bits set in both planes, in the word range [start, end). Unrolled so that the compiler can use wider registers.
+inline int countIntersection(const markerBitPlanes::word* plane1, const markerBitPlanes::word* plane2, int start, int end)
+{
+	int count1 = 0, count2 = 0, count3 = 0, count4 = 0;
+	int i = start;
+	for(; i + 4 <= end; i += 4)
+	{
+		count1 += popcount(plane1[i] & plane2[i]);
+		count2 += popcount(plane1[i+1] & plane2[i+1]);
+		count3 += popcount(plane1[i+2] & plane2[i+2]);
+		count4 += popcount(plane1[i+3] & plane2[i+3]);
+	}
+	for(; i < end; i++) count1 += popcount(plane1[i] & plane2[i]);
+	return count1 + count2 + count3 + count4;
+}
+inline int countTrailingZeros(markerBitPlanes::word x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(x);
+#else
+	return popcount((x & (~x + 1)) - 1);
+#endif
+}
+//Sum of the weights of the bits set in both planes, in the word range [start, end). The weights are indexed by bit position. The number of bits set is returned in count.
+inline double sumIntersectionWeights(const markerBitPlanes::word* plane1, const markerBitPlanes::word* plane2, int start, int end, const double* weights, int& count)
+{
+	double sum = 0;
+	count = 0;
+	for(int i = start; i < end; i++)
+	{
+		markerBitPlanes::word intersection = plane1[i] & plane2[i];
+		while(intersection)
+		{
+			sum += weights[i * markerBitPlanes::bitsPerWord + countTrailingZeros(intersection)];
+			count++;
+			intersection &= intersection - 1;
+		}
+	}
+	return sum;
+}
+#endif
@@ -1,4 +1,6 @@
 #include "matrixChunks.h"
+#include <algorithm>
+#include <cmath>
 triangularIterator::triangularIterator(const std::vector<int>& markerRows, const std::vector<int>& markerColumns)
 	: markerRows(markerRows), markerColumns(markerColumns), markerRow(markerRows.begin()), markerColumn(markerColumns.begin())
 {
@@ -34,6 +36,110 @@ bool triangularIterator::isDone() const
 {
 	return markerColumn == markerColumns.end();
 }
+const std::vector<int>& triangularIterator::getMarkerRows() const
+{
+	return markerRows;
+}
+const std::vector<int>& triangularIterator::getMarkerColumns() const
+{
+	return markerColumns;
+}
+triangularTiles::triangularTiles(const std::vector<int>& markerRows, const std::vector<int>& markerColumns, int tileSize)
+	: markerRows(markerRows), markerColumns(markerColumns), tileSize(tileSize), nValidRows(markerColumns.size()), columnOffsets(markerColumns.size() + 1, 0)
+{
+	if(tileSize < 1) throw std::runtime_error("Internal error");
+	sortedRows = std::is_sorted(markerRows.begin(), markerRows.end());
+	contiguousTriangle = sortedRows && markerRows == markerColumns && markerRows.size() > 0 && markerRows.back() - markerRows.front() == (int)markerRows.size() - 1;
+	std::vector<int> markerRowsCopied = markerRows;
+	std::sort(markerRowsCopied.begin(), markerRowsCopied.end());
+	for(std::size_t columnPosition = 0; columnPosition < markerColumns.size(); columnPosition++)
+	{
+		nValidRows[columnPosition] = (int)std::distance(markerRowsCopied.begin(), std::upper_bound(markerRowsCopied.begin(), markerRowsCopied.end(), markerColumns[columnPosition]));
+		columnOffsets[columnPosition + 1] = columnOffsets[columnPosition] + nValidRows[columnPosition];
+	}
+}
+const std::vector<int>& triangularTiles::getMarkerRows() const
+{
+	return markerRows;
+}
+const std::vector<int>& triangularTiles::getMarkerColumns() const
+{
+	return markerColumns;
+}
+unsigned long long triangularTiles::getNValues() const
+{
+	return columnOffsets.back();
+}
+bool triangularTiles::hasSortedRows() const
+{
+	return sortedRows;
+}
+std::pair<int, int> triangularTiles::indexToPair(unsigned long long index) const
+{
+	if(index >= getNValues()) throw std::runtime_error("Index was out of range");
+	int columnPosition;
+	if(contiguousTriangle)
+	{
+		//The first value in column c has index c(c+1)/2, so invert that. The floating point result can be off by one for very large indices. 
+		columnPosition = (int)((std::sqrt(8.0 * (double)index + 1.0) - 1.0) / 2.0);
+		columnPosition = std::max(0, std::min(columnPosition, (int)markerColumns.size() - 1));
+		while(columnOffsets[columnPosition] > index) columnPosition--;
+		while(columnOffsets[columnPosition + 1] <= index) columnPosition++;
+	}
+	else
+	{
+		//Columns with no values have the same offset as the next column, so this always gives a column that contains the index
+		columnPosition = (int)std::distance(columnOffsets.begin(), std::upper_bound(columnOffsets.begin(), columnOffsets.end(), index)) - 1;
+	}
+	unsigned long long withinColumn = index - columnOffsets[columnPosition];
+	int rowPosition;
+	if(sortedRows)
+	{
+		rowPosition = (int)withinColumn;
+	}
+	else
+	{
+		for(rowPosition = 0; ; rowPosition++)
+		{
+			if(markerRows[rowPosition] <= markerColumns[columnPosition])
+			{
+				if(withinColumn == 0) break;
+				withinColumn--;
+			}
+		}
+	}
+	return std::make_pair(markerRows[rowPosition], markerColumns[columnPosition]);
+}
+void triangularTiles::getTiles(unsigned long long start, unsigned long long end, std::vector<tile>& tiles) const
+{
+	tiles.clear();
+	end = std::min(end, getNValues());
+	if(start >= end) return;
+	int firstColumn = (int)std::distance(columnOffsets.begin(), std::upper_bound(columnOffsets.begin(), columnOffsets.end(), start)) - 1;
+	int lastColumn = (int)std::distance(columnOffsets.begin(), std::upper_bound(columnOffsets.begin(), columnOffsets.end(), end - 1)) - 1;
+	for(int columnStart = firstColumn; columnStart <= lastColumn; columnStart += tileSize)
+	{
+		tile current;
+		current.columnStart = columnStart;
+		current.columnEnd = std::min(columnStart + tileSize, lastColumn + 1);
+		if(sortedRows)
+		{
+			int maxValidRows = *std::max_element(nValidRows.begin() + current.columnStart, nValidRows.begin() + current.columnEnd);
+			for(int rowStart = 0; rowStart < maxValidRows; rowStart += tileSize)
+			{
+				current.rowStart = rowStart;
+				current.rowEnd = std::min(rowStart + tileSize, maxValidRows);
+				tiles.push_back(current);
+			}
+		}
+		else
+		{
+			current.rowStart = 0;
+			current.rowEnd = (int)markerRows.size();
+			tiles.push_back(current);
+		}
+	}
+}
 SEXP countValuesToEstimateExported(SEXP markerRows_, SEXP markerColumns_)
 {
 BEGIN_RCPP
@@ -70,15 +176,42 @@ SEXP singleIndexToPairExported(SEXP markerRows_, SEXP markerColumns_, SEXP index
 BEGIN_RCPP
 	std::vector<int> markerRows = Rcpp::as<std::vector<int> >(markerRows_);
 	std::vector<int> markerColumns = Rcpp::as<std::vector<int> >(markerColumns_);
-	triangularIterator iterator(markerRows, markerColumns);
+	triangularTiles tiles(markerRows, markerColumns, 1);
 	unsigned long long index = (unsigned long long)Rcpp::as<int>(index_) - 1;
-	while(index > 0)
-	{
-		iterator.next();
-		index--;
-	}
-	std::pair<int, int> markerPair = iterator.get();
+	std::pair<int, int> markerPair = tiles.indexToPair(index);
 	return Rcpp::IntegerVector::create(markerPair.first, markerPair.second);
 END_RCPP
 }
 
+SEXP triangleShardColumns(SEXP nMarkers_, SEXP nShards_)
+{
+BEGIN_RCPP
+	int nMarkers, nShards;
+	try
+	{
+		nMarkers = Rcpp::as<int>(nMarkers_);
+		nShards = Rcpp::as<int>(nShards_);
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Inputs nMarkers and nShards must be integers");
+	}
+	if(nMarkers < 1) throw std::runtime_error("Input nMarkers must be positive");
+	if(nShards < 1) throw std::runtime_error("Input nShards must be positive");
+	std::vector<int> markers(nMarkers);
+	for(int i = 0; i < nMarkers; i++) markers[i] = i;
+	triangularTiles tiles(markers, markers, 1);
+	unsigned long long nValues = tiles.getNValues();
+	//Each shard starts at the column containing its share of the values, so shards are balanced to within a single column.
+	Rcpp::IntegerVector result(nShards + 1);
+	result[0] = 1;
+	for(int shard = 1; shard < nShards; shard++)
+	{
+		unsigned long long start = (unsigned long long)(((long double)nValues * shard) / nShards);
+		int column = start >= nValues ? nMarkers : tiles.indexToPair(start).second;
+		result[shard] = std::max(result[shard - 1], column + 1);
+	}
+	result[nShards] = nMarkers + 1;
+	return result;
+END_RCPP
+}
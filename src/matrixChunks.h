@@ -9,13 +9,52 @@ public:
 	std::pair<int, int> get() const;
 	void next();
 	bool isDone() const;
+	const std::vector<int>& getMarkerRows() const;
+	const std::vector<int>& getMarkerColumns() const;
 	triangularIterator& operator=(const triangularIterator& other);
 private:
 	const std::vector<int>& markerRows;
 	const std::vector<int>& markerColumns;
 	std::vector<int>::const_iterator markerRow, markerColumn;
 };
+//Splits the region visited by triangularIterator into rectangular tiles of marker pairs, so that the markers involved in a tile can stay in cache. The index of a marker pair is its position in the order visited by triangularIterator, and can be computed directly for any pair. 
+//If markerRows is sorted the tiles are square blocks of positions in markerRows and markerColumns. Otherwise every tile contains all the rows, for a block of columns. 
+class triangularTiles
+{
+public:
+	struct tile
+	{
+		//Positions within markerRows and markerColumns, of the form [start, end)
+		int rowStart, rowEnd;
+		int columnStart, columnEnd;
+	};
+	triangularTiles(const std::vector<int>& markerRows, const std::vector<int>& markerColumns, int tileSize);
+	const std::vector<int>& getMarkerRows() const;
+	const std::vector<int>& getMarkerColumns() const;
+	unsigned long long getNValues() const;
+	bool hasSortedRows() const;
+	//The index of the first value in the given column. If markerRows is sorted the index of the pair at row position r is columnOffset(c) + r. 
+	unsigned long long columnOffset(int columnPosition) const
+	{
+		return columnOffsets[columnPosition];
+	}
+	//The marker pair with the given index
+	std::pair<int, int> indexToPair(unsigned long long index) const;
+	//The tiles containing values with indices in [start, end). A returned tile may also contain values outside this range. 
+	void getTiles(unsigned long long start, unsigned long long end, std::vector<tile>& tiles) const;
+private:
+	const std::vector<int>& markerRows;
+	const std::vector<int>& markerColumns;
+	int tileSize;
+	bool sortedRows;
+	//True if markerRows and markerColumns are both the same range of consecutive markers, in which case the column offsets are triangular numbers
+	bool contiguousTriangle;
+	std::vector<int> nValidRows;
+	std::vector<unsigned long long> columnOffsets;
+};
 SEXP countValuesToEstimateExported(SEXP markerRows, SEXP markerColumns);
 unsigned long long countValuesToEstimate(const std::vector<int>& markerRows, const std::vector<int>& markerColumns);
 SEXP singleIndexToPairExported(SEXP markerRows, SEXP markerColumns, SEXP index);
+//Split the upper triangle of nMarkers markers into nShards blocks of consecutive columns, each with about the same number of values. Returns the first column of each block (one-based), followed by nMarkers + 1.
+SEXP triangleShardColumns(SEXP nMarkers, SEXP nShards);
 #endif
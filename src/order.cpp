@@ -1,6 +1,7 @@
 #include "order.h"
 #include "impute.h"
 #include "arsaRaw.h"
+#include "packedTriangleFile.h"
 #ifdef USE_OPENMP
 #include <omp.h>
 #endif
@@ -156,7 +157,9 @@ BEGIN_RCPP
 		throw std::runtime_error("Internal error accessing slot mpcrossLG@lg@imputedTheta");
 	}
 	bool hasImputedTheta = !imputedTheta_robject.isNULL();
-	Rcpp::RawVector thetaRawData;
+	//The values of theta, which may be held in a file
+	std::unique_ptr<rawSymmetricMatrixData> thetaView;
+	const Rbyte* thetaRawData = NULL;
 	Rcpp::List imputedTheta;
 	if(hasImputedTheta)
 	{
@@ -196,14 +199,13 @@ BEGIN_RCPP
 			throw std::runtime_error("Slot mpcrossLG@rf@theta must be an S4 object");
 		}
 
-		try
-		{
-			thetaRawData = theta.slot("data");
-		}
-		catch(...)
+		thetaView.reset(new rawSymmetricMatrixData(theta, false));
+		unsigned long long nMarkersTheta = (unsigned long long)groups.size();
+		if((unsigned long long)thetaView->getNValues() != (nMarkersTheta * (nMarkersTheta + 1ULL)) / 2ULL)
 		{
-			throw std::runtime_error("Slot mpcrossLG@rf@theta@data must be a raw vector");
+			throw std::runtime_error("Slot mpcrossLG@rf@theta had the wrong number of values");
 		}
+		thetaRawData = thetaView->getData();
 
 		try
 		{
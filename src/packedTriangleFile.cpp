@@ -0,0 +1,287 @@
+#include "packedTriangleFile.h"
+#include <errno.h>
+#include <cstring>
+namespace
+{
+	const char magic[8] = {'m', 'p', 'M', 'a', 'p', '2', 'T', 'r'};
+	//Values are written in the native byte order.
+	struct fileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t type;
+		uint64_t nMarkers;
+		uint64_t nLevels;
+		//Total size of the marker names, including a terminating zero for each
+		uint64_t markerBytes;
+		uint64_t dataOffset;
+	};
+	std::size_t valueSize(packedTriangleFile::valueType type)
+	{
+		return type == packedTriangleFile::rawValues ? sizeof(Rbyte) : sizeof(double);
+	}
+}
+void packedTriangleFile::create(const std::string& path, const std::vector<std::string>& markers, const std::vector<double>& levels, valueType type)
+{
+	fileHeader header;
+	memcpy(header.magic, magic, sizeof(magic));
+	header.version = layoutVersion;
+	header.type = (uint32_t)type;
+	header.nMarkers = markers.size();
+	header.nLevels = levels.size();
+	header.markerBytes = 0;
+	for(std::vector<std::string>::const_iterator marker = markers.begin(); marker != markers.end(); marker++) header.markerBytes += marker->size() + 1;
+	uint64_t headerBytes = sizeof(fileHeader) + header.nLevels * sizeof(double) + header.markerBytes;
+	header.dataOffset = ((headerBytes + 7) / 8) * 8;
+	uint64_t nValues = (header.nMarkers * (header.nMarkers + 1)) / 2;
+	if(type == curveValues) nValues *= header.nLevels;
+	uint64_t totalSize = header.dataOffset + nValues * valueSize(type);
+
+	std::vector<unsigned char> headerData(header.dataOffset, 0);
+	memcpy(&(headerData[0]), &header, sizeof(fileHeader));
+	if(levels.size() > 0) memcpy(&(headerData[sizeof(fileHeader)]), &(levels[0]), levels.size() * sizeof(double));
+	std::size_t position = sizeof(fileHeader) + levels.size() * sizeof(double);
+	for(std::vector<std::string>::const_iterator marker = markers.begin(); marker != markers.end(); marker++)
+	{
+		memcpy(&(headerData[position]), marker->c_str(), marker->size() + 1);
+		position += marker->size() + 1;
+	}
+	//The header is written, and then the file is extended to the full size.
+	mappedFile::create(path, &(headerData[0]), headerData.size(), totalSize);
+}
+packedTriangleFile::packedTriangleFile(const std::string& path, bool writable)
+	: mapping(path, writable)
+{
+	const unsigned char* mapped = mapping.getData();
+	uint64_t mappedSize = mapping.getSize();
+	errno = 0;
+	fileHeader header;
+	if(mappedSize < sizeof(fileHeader)) mappedFile::throwError("Invalid header in file", path);
+	memcpy(&header, mapped, sizeof(fileHeader));
+	uint64_t nMarkers = header.nMarkers;
+	if(memcmp(header.magic, magic, sizeof(magic)) != 0 || header.type > (uint32_t)curveValues || sizeof(fileHeader) + header.nLevels * sizeof(double) + header.markerBytes > header.dataOffset || header.dataOffset % 8 != 0)
+	{
+		mappedFile::throwError("Invalid header in file", path);
+	}
+	if(header.version != layoutVersion) mappedFile::throwError("Unsupported layout version in file", path);
+	version = header.version;
+	type = (valueType)header.type;
+	nValues = (R_xlen_t)((nMarkers * (nMarkers + 1)) / 2);
+	if(type == curveValues) nValues *= (R_xlen_t)header.nLevels;
+	if(header.dataOffset + (uint64_t)nValues * valueSize(type) > mappedSize) mappedFile::throwError("File was truncated", path);
+	levels.resize(header.nLevels);
+	if(header.nLevels > 0) memcpy(&(levels[0]), mapped + sizeof(fileHeader), header.nLevels * sizeof(double));
+	const char* markerData = (const char*)(mapped + sizeof(fileHeader) + header.nLevels * sizeof(double));
+	const char* markerDataEnd = markerData + header.markerBytes;
+	markers.reserve(nMarkers);
+	while(markerData < markerDataEnd && markers.size() < nMarkers)
+	{
+		const char* end = (const char*)memchr(markerData, 0, markerDataEnd - markerData);
+		if(end == NULL) break;
+		markers.push_back(std::string(markerData, end));
+		markerData = end + 1;
+	}
+	if(markers.size() != nMarkers) mappedFile::throwError("Invalid marker names in file", path);
+	dataOffset = header.dataOffset;
+}
+packedTriangleFile::valueType packedTriangleFile::getType() const
+{
+	return type;
+}
+uint32_t packedTriangleFile::getVersion() const
+{
+	return version;
+}
+const std::vector<std::string>& packedTriangleFile::getMarkers() const
+{
+	return markers;
+}
+const std::vector<double>& packedTriangleFile::getLevels() const
+{
+	return levels;
+}
+R_xlen_t packedTriangleFile::getNValues() const
+{
+	return nValues;
+}
+void* packedTriangleFile::getData()
+{
+	return mapping.getData() + dataOffset;
+}
+rawSymmetricMatrixData::rawSymmetricMatrixData(Rcpp::S4 object, bool writable)
+{
+	if(object.is("rawSymmetricMatrixFile"))
+	{
+		file.reset(new packedTriangleFile(Rcpp::as<std::string>(object.slot("file")), writable));
+		if(file->getType() != packedTriangleFile::rawValues) throw std::runtime_error("File for a rawSymmetricMatrixFile object must contain raw values");
+		if((R_xlen_t)file->getMarkers().size() != Rcpp::as<Rcpp::CharacterVector>(object.slot("markers")).size()) throw std::runtime_error("Number of markers in file was inconsistent with the rawSymmetricMatrixFile object");
+		data = (Rbyte*)file->getData();
+		nValues = file->getNValues();
+	}
+	else
+	{
+		try
+		{
+			inMemory = Rcpp::as<Rcpp::RawVector>(object.slot("data"));
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Slot data of a rawSymmetricMatrix must be a raw vector");
+		}
+		data = inMemory.begin();
+		nValues = inMemory.size();
+	}
+}
+dspMatrixData::dspMatrixData(Rcpp::S4 object, bool writable)
+	: data(NULL), codes(NULL), scale(0)
+{
+	if(object.is("dspMatrixFile"))
+	{
+		file.reset(new packedTriangleFile(Rcpp::as<std::string>(object.slot("file")), writable));
+		if(file->getType() != packedTriangleFile::doubleValues) throw std::runtime_error("File for a dspMatrixFile object must contain double precision values");
+		if((R_xlen_t)file->getMarkers().size() != Rcpp::as<Rcpp::CharacterVector>(object.slot("markers")).size()) throw std::runtime_error("Number of markers in file was inconsistent with the dspMatrixFile object");
+		data = (double*)file->getData();
+		nValues = file->getNValues();
+	}
+	else if(object.is("compactLodMatrix"))
+	{
+		try
+		{
+			inMemoryCodes = Rcpp::as<Rcpp::RawVector>(object.slot("codes"));
+			scale = Rcpp::as<double>(object.slot("scale"));
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Slot codes of a compactLodMatrix must be a raw vector, and slot scale must be a number");
+		}
+		if(inMemoryCodes.size() % sizeof(lodCode) != 0) throw std::runtime_error("Slot codes of a compactLodMatrix must contain two bytes per value");
+		codes = (lodCode*)inMemoryCodes.begin();
+		nValues = inMemoryCodes.size() / sizeof(lodCode);
+	}
+	else
+	{
+		try
+		{
+			inMemory = Rcpp::as<Rcpp::NumericVector>(object.slot("x"));
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Slot x of a dspMatrix must be a numeric vector");
+		}
+		data = inMemory.begin();
+		nValues = inMemory.size();
+	}
+}
+double dspMatrixData::max() const
+{
+	double result = -std::numeric_limits<double>::infinity();
+	if(codes)
+	{
+		//The decoding is monotone, so the largest code gives the largest value
+		lodCode maxCode = 0;
+		bool found = false;
+		for(R_xlen_t i = 0; i < nValues; i++)
+		{
+			if(codes[i] != naLodCode)
+			{
+				maxCode = std::max(maxCode, codes[i]);
+				found = true;
+			}
+		}
+		if(found) result = decodeLod(maxCode, scale);
+	}
+	else
+	{
+		for(R_xlen_t i = 0; i < nValues; i++)
+		{
+			if(data[i] == data[i]) result = std::max(result, data[i]);
+		}
+	}
+	return result;
+}
+SEXP createPackedTriangleFile(SEXP file_, SEXP markers_, SEXP levels_, SEXP type_)
+{
+BEGIN_RCPP
+	std::string file = Rcpp::as<std::string>(file_);
+	std::vector<std::string> markers = Rcpp::as<std::vector<std::string> >(markers_);
+	std::vector<double> levels = Rcpp::as<std::vector<double> >(levels_);
+	std::string type = Rcpp::as<std::string>(type_);
+	if(type == "raw")
+	{
+		packedTriangleFile::create(file, markers, levels, packedTriangleFile::rawValues);
+	}
+	else if(type == "double")
+	{
+		packedTriangleFile::create(file, markers, levels, packedTriangleFile::doubleValues);
+	}
+	else if(type == "curves")
+	{
+		packedTriangleFile::create(file, markers, levels, packedTriangleFile::curveValues);
+	}
+	else throw std::runtime_error("Input type must be \"raw\", \"double\" or \"curves\"");
+	return R_NilValue;
+END_RCPP
+}
+SEXP packedTriangleFileHeader(SEXP file_)
+{
+BEGIN_RCPP
+	packedTriangleFile file(Rcpp::as<std::string>(file_), false);
+	std::string type = file.getType() == packedTriangleFile::rawValues ? "raw" : (file.getType() == packedTriangleFile::doubleValues ? "double" : "curves");
+	return Rcpp::List::create(Rcpp::Named("version") = (int)file.getVersion(), Rcpp::Named("type") = type, Rcpp::Named("markers") = Rcpp::wrap(file.getMarkers()), Rcpp::Named("levels") = Rcpp::wrap(file.getLevels()));
+END_RCPP
+}
+SEXP readPackedTriangleFile(SEXP file_)
+{
+BEGIN_RCPP
+	packedTriangleFile file(Rcpp::as<std::string>(file_), false);
+	if(file.getType() == packedTriangleFile::rawValues)
+	{
+		Rbyte* data = (Rbyte*)file.getData();
+		return Rcpp::RawVector(data, data + file.getNValues());
+	}
+	double* data = (double*)file.getData();
+	return Rcpp::NumericVector(data, data + file.getNValues());
+END_RCPP
+}
+SEXP assignPackedTriangleRange(SEXP object_, SEXP start_, SEXP values_)
+{
+BEGIN_RCPP
+	Rcpp::S4 object;
+	double startDouble;
+	try
+	{
+		object = object_;
+		startDouble = Rcpp::as<double>(start_);
+	}
+	catch(...)
+	{
+		throw std::runtime_error("Input object must be an S4 object, and input start must be a number");
+	}
+	if(!(startDouble >= 0) || startDouble != std::floor(startDouble)) throw std::runtime_error("Input start must be a non-negative integer");
+	R_xlen_t start = (R_xlen_t)startDouble;
+	if(object.is("rawSymmetricMatrix"))
+	{
+		if(Rcpp::RObject(values_).sexp_type() != RAWSXP) throw std::runtime_error("Values for a rawSymmetricMatrix must be a raw vector");
+		Rcpp::RawVector values = values_;
+		rawSymmetricMatrixData view(object, true);
+		if(start + values.size() > view.getNValues()) throw std::runtime_error("Values extend past the end of the matrix");
+		std::copy(values.begin(), values.end(), view.getData() + start);
+	}
+	else
+	{
+		Rcpp::NumericVector values;
+		try
+		{
+			values = values_;
+		}
+		catch(...)
+		{
+			throw std::runtime_error("Values for a dspMatrix must be a numeric vector");
+		}
+		dspMatrixData view(object, true);
+		if(start + values.size() > view.getNValues()) throw std::runtime_error("Values extend past the end of the matrix");
+		for(R_xlen_t i = 0; i < values.size(); i++) view.set(start + i, values[i]);
+	}
+	return R_NilValue;
+END_RCPP
+}
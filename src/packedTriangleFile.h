@@ -0,0 +1,113 @@
+#ifndef PACKED_TRIANGLE_FILE_HEADER_GUARD
+#define PACKED_TRIANGLE_FILE_HEADER_GUARD
+#include <Rcpp.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+#include "compactLod.h"
+#include "mappedFile.h"
+/** A packed symmetric matrix, stored in a memory mapped file
+ *
+ * The values are stored in exactly the same way as the data slot of a rawSymmetricMatrix or the x slot of a dspMatrix. That is, column-major for the upper triangle including the diagonal, so the value for (zero-based) markers i <= j is at position j*(j+1)/2 + i.
+ * The file starts with a header giving the layout version, the type of the values, the markers and the levels. The values start at the next multiple of 8 bytes.
+ * For curve values there is one double precision value per level for every pair of markers, so the values for the pair at position p are at positions p*nLevels to (p+1)*nLevels - 1. Values are paged in by the operating system as they're accessed, so a matrix can be read without ever being loaded completely.
+ */
+class packedTriangleFile
+{
+public:
+	enum valueType
+	{
+		rawValues = 0, doubleValues = 1, curveValues = 2
+	};
+	static const uint32_t layoutVersion = 1;
+	//Create a new file, with every value initially zero. Any existing file is overwritten.
+	static void create(const std::string& path, const std::vector<std::string>& markers, const std::vector<double>& levels, valueType type);
+	packedTriangleFile(const std::string& path, bool writable);
+	valueType getType() const;
+	uint32_t getVersion() const;
+	const std::vector<std::string>& getMarkers() const;
+	const std::vector<double>& getLevels() const;
+	//The total number of values, which for curve values is the number of marker pairs multiplied by the number of levels.
+	R_xlen_t getNValues() const;
+	void* getData();
+private:
+	packedTriangleFile(const packedTriangleFile&);
+	packedTriangleFile& operator=(const packedTriangleFile&);
+	mappedFile mapping;
+	uint32_t version;
+	valueType type;
+	std::vector<std::string> markers;
+	std::vector<double> levels;
+	R_xlen_t nValues;
+	uint64_t dataOffset;
+};
+//The packed values of a rawSymmetricMatrix, which is either held in memory or is a rawSymmetricMatrixFile.
+class rawSymmetricMatrixData
+{
+public:
+	rawSymmetricMatrixData(Rcpp::S4 object, bool writable);
+	Rbyte* getData()
+	{
+		return data;
+	}
+	R_xlen_t getNValues() const
+	{
+		return nValues;
+	}
+private:
+	Rcpp::RawVector inMemory;
+	std::unique_ptr<packedTriangleFile> file;
+	Rbyte* data;
+	R_xlen_t nValues;
+};
+//The packed values of a dspMatrix, a dspMatrixFile or a compactLodMatrix. The values of a compactLodMatrix are stored as 16-bit codes, so they can only be accessed through get and set, and getData returns NULL.
+class dspMatrixData
+{
+public:
+	dspMatrixData(Rcpp::S4 object, bool writable);
+	double* getData()
+	{
+		return data;
+	}
+	R_xlen_t getNValues() const
+	{
+		return nValues;
+	}
+	double get(R_xlen_t index) const
+	{
+		if(codes) return decodeLod(codes[index], scale);
+		return data[index];
+	}
+	void set(R_xlen_t index, double value)
+	{
+		if(codes) codes[index] = encodeLod(value, scale);
+		else data[index] = value;
+	}
+	//The codes of a compactLodMatrix, or NULL.
+	lodCode* getCodes()
+	{
+		return codes;
+	}
+	double getScale() const
+	{
+		return scale;
+	}
+	//The largest value which is not NA.
+	double max() const;
+private:
+	Rcpp::NumericVector inMemory;
+	Rcpp::RawVector inMemoryCodes;
+	std::unique_ptr<packedTriangleFile> file;
+	double* data;
+	lodCode* codes;
+	double scale;
+	R_xlen_t nValues;
+};
+SEXP createPackedTriangleFile(SEXP file, SEXP markers, SEXP levels, SEXP type);
+SEXP packedTriangleFileHeader(SEXP file);
+//Read all the values into memory
+SEXP readPackedTriangleFile(SEXP file);
+//Overwrite the packed values of a rawSymmetricMatrix, dspMatrix or compactLodMatrix (in memory or in a file) starting at the zero-based position start. The object is modified in place.
+SEXP assignPackedTriangleRange(SEXP object, SEXP start, SEXP values);
+#endif
@@ -0,0 +1,24 @@
+#ifndef POWER_DIFFERENCES_HEADER_GUARD
+#define POWER_DIFFERENCES_HEADER_GUARD
+#include <cmath>
+#include <algorithm>
+/*
+ * The closed form probabilities contain differences of powers, such as (1 - 2r + 2r^2)^n - 1 and (1 - 2r + 2r^2)^n - (1 - 2r)^n. When r is small the two powers are almost equal, so subtracting them loses most of the significant digits, and can give zero or a small negative number instead of a small positive probability. 
+ * These functions take the powers, which the caller has already computed, and return the plain difference if at most two digits were lost. Otherwise the difference is recomputed using log1p and expm1, which are accurate for any r. So the slower evaluation is only used for the values of r which need it. 
+ */
+//(1 + x)^n - 1, where power = (1 + x)^n
+inline double powMinusOne(double power, double x, int n)
+{
+	double difference = power - 1;
+	if(1 + x == 0 || std::fabs(difference) >= 0.01) return difference;
+	return std::expm1(n * std::log1p(x));
+}
+//(1 + x + difference)^n - (1 + x)^n, where power1 = (1 + x + difference)^n and power2 = (1 + x)^n. The difference of the bases is an input so that it never has to be recovered by subtraction. 
+inline double powDifference(double power1, double power2, double x, double difference, int n)
+{
+	double result = power1 - power2;
+	//There's no cancellation when 1 + x is zero, as power2 is zero (or both powers are one)
+	if(1 + x == 0 || std::fabs(result) >= 0.01 * std::max(std::fabs(power1), std::fabs(power2))) return result;
+	return power2 * std::expm1(n * std::log1p(difference / (1 + x)));
+}
+#endif
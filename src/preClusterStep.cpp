@@ -1,11 +1,14 @@
 #include "preClusterStep.h"
+#include "packedTriangleFile.h"
+#include "identicalMarkers.h"
 SEXP preClusterStep(SEXP mpcrossRF_)
 {
 BEGIN_RCPP
 	Rcpp::S4 mpcrossRF = mpcrossRF_;
 	Rcpp::S4 rf = mpcrossRF.slot("rf");
 	Rcpp::S4 theta = rf.slot("theta");
-	Rcpp::RawVector data = theta.slot("data");
+	rawSymmetricMatrixData thetaView(theta, false);
+	const Rbyte* data = thetaView.getData();
 	Rcpp::CharacterVector markers = theta.slot("markers");
 	Rcpp::NumericVector levels = theta.slot("levels");
 
@@ -42,8 +45,27 @@ BEGIN_RCPP
 	//The groups that we will consider in the next step
 	std::vector<group> newContinuingGroups(nMarkers);
 
-	//Initially every marker is in its own group
-	for(R_xlen_t i = 0; i < nMarkers; i++) continuingGroups[i].data.push_back((int)i);
+	//Markers with exactly the same data start in the same group, as long as their estimated recombination fraction is zero. Every pair within such a group has the same estimate, so only the first marker needs to be checked. Otherwise markers start in their own group.
+	std::vector<int> classes = identicalMarkerClasses(Rcpp::as<Rcpp::List>(mpcrossRF.slot("geneticData")));
+	if((R_xlen_t)classes.size() != nMarkers) throw std::runtime_error("Markers of mpcrossRF@rf@theta were inconsistent with the genetic data");
+	std::vector<int> classGroups(nMarkers, -1);
+	std::size_t nGroups = 0;
+	for(R_xlen_t i = 0; i < nMarkers; i++)
+	{
+		int& classGroup = classGroups[classes[i]];
+		if(classGroup != -1)
+		{
+			R_xlen_t firstMarker = continuingGroups[classGroup].data[0];
+			if(data[(i * (i+(R_xlen_t)1))/(R_xlen_t)2 + firstMarker] == zeroLevel)
+			{
+				continuingGroups[classGroup].data.push_back((int)i);
+				continue;
+			}
+		}
+		else classGroup = (int)nGroups;
+		continuingGroups[nGroups++].data.push_back((int)i);
+	}
+	continuingGroups.resize(nGroups);
 	while(continuingGroups.size() > 0)
 	{
 		for(std::size_t i = 0; i < continuingGroups.size(); i++)
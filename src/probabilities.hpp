@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <limits>
 #include <array>
+#include <vector>
+#include <algorithm>
 /*
  * Struct that will contain arrays relevant for probability calculations
  */
@@ -43,6 +45,26 @@ template<int nFounders> struct expandedProbabilities<nFounders, false>
  */
 template<int nFounders, bool infiniteSelfing> void genotypeProbabilitiesNoIntercross(std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs>& prob, double recombinationFraction, int selfingGenerations, std::size_t nFunnels);
 template<int nFounders, bool infiniteSelfing> void genotypeProbabilitiesWithIntercross(std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs>& prob, int nAIGenerations, double recombinationFraction, int selfingGenerations, std::size_t nFunnels);
+/*
+ * Batch versions of the above, which compute the probabilities for every one of nRecombinationFractions recombination fractions in a single call. The probabilities for recombinationFractions[i] are written to prob[i * stride], so a column of a rowMajorMatrix can be filled directly. By default these call the single recombination fraction versions, but they can be specialised to share the terms which don't depend on the recombination fraction. The results are identical to those of the single recombination fraction versions.
+ */
+template<int nFounders, bool infiniteSelfing> void genotypeProbabilitiesNoIntercrossBatch(std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs>* prob, std::size_t stride, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels)
+{
+	for(int i = 0; i < nRecombinationFractions; i++)
+	{
+		genotypeProbabilitiesNoIntercross<nFounders, infiniteSelfing>(prob[i * stride], recombinationFractions[i], selfingGenerations, nFunnels);
+	}
+}
+template<int nFounders, bool infiniteSelfing> void genotypeProbabilitiesWithIntercrossBatch(std::array<double, compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs>* prob, std::size_t stride, int nAIGenerations, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels)
+{
+	for(int i = 0; i < nRecombinationFractions; i++)
+	{
+		genotypeProbabilitiesWithIntercross<nFounders, infiniteSelfing>(prob[i * stride], nAIGenerations, recombinationFractions[i], selfingGenerations, nFunnels);
+	}
+}
+//The sixteen founder finite selfing case has the most expensive probabilities, so these are specialised (see probabilities16.cpp)
+template<> void genotypeProbabilitiesNoIntercrossBatch<16, false>(std::array<double, 95>* prob, std::size_t stride, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels);
+template<> void genotypeProbabilitiesWithIntercrossBatch<16, false>(std::array<double, 95>* prob, std::size_t stride, int nAIGenerations, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels);
 /*
  * Templated function to work out the single locus probabilities. This is needed for imputation / the Viterbi algorithm
  */
@@ -58,32 +80,23 @@ template<int nFounders, bool infiniteSelfing, bool takeLogs> struct expandedGeno
 template<int nFounders, bool takeLogs> struct expandedGenotypeProbabilities<nFounders, true, takeLogs>
 {
 public:
+	static const int nDifferentProbs = compressedProbabilities<nFounders, true>::nDifferentProbs;
+	typedef std::array<double, nDifferentProbs> compressedProbabilitiesType;
 	static void noIntercross(array2<nFounders>& expandedProbabilities, double r, int selfingGenerations, std::size_t nFunnels)
 	{
-		const int nDifferentProbs = compressedProbabilities<nFounders, true>::nDifferentProbs;
-		std::array<double, nDifferentProbs> probabilities;
+		compressedProbabilitiesType probabilities;
 		genotypeProbabilitiesNoIntercross<nFounders, true>(probabilities, r, selfingGenerations, nFunnels);
-		if(takeLogs)
-		{
-			for(int i = 0; i < nDifferentProbs; i++)
-			{
-				if(probabilities[i] == 0) probabilities[i] = -std::numeric_limits<double>::infinity();
-				else probabilities[i] = log(probabilities[i]);
-			}
-		}
-		for(int i = 0; i < nFounders; i++)
-		{
-			for(int j = 0; j < nFounders; j++)
-			{
-				expandedProbabilities.values[i][j] = probabilities[probabilityData<nFounders>::infiniteMask[i][j]];
-			}
-		}
+		expand(expandedProbabilities, probabilities);
 	}
 	static void withIntercross(array2<nFounders>& expandedProbabilities, int nAIGenerations, double r, int selfingGenerations, std::size_t nFunnels)
 	{
-		const int nDifferentProbs = compressedProbabilities<nFounders, true>::nDifferentProbs;
-		std::array<double, nDifferentProbs> probabilities;
+		compressedProbabilitiesType probabilities;
 		genotypeProbabilitiesWithIntercross<nFounders, true>(probabilities, nAIGenerations, r, selfingGenerations, nFunnels);
+		expand(expandedProbabilities, probabilities);
+	}
+private:
+	static void expand(array2<nFounders>& expandedProbabilities, compressedProbabilitiesType& probabilities)
+	{
 		if(takeLogs)
 		{
 			for(int i = 0; i < nDifferentProbs; i++)
@@ -107,11 +120,23 @@ public:
 template<int nFounders, bool takeLogs> struct expandedGenotypeProbabilities<nFounders, false, takeLogs>
 {
 public:
+	static const int nDifferentProbs = compressedProbabilities<nFounders, false>::nDifferentProbs;
+	typedef std::array<double, nDifferentProbs> compressedProbabilitiesType;
 	static void noIntercross(expandedProbabilitiesFiniteSelfing<nFounders>& expandedProbabilities, double r, int selfingGenerations, std::size_t nFunnels)
 	{
-		const int nDifferentProbs = compressedProbabilities<nFounders, false>::nDifferentProbs;
-		std::array<double, nDifferentProbs> probabilities;
+		compressedProbabilitiesType probabilities;
 		genotypeProbabilitiesNoIntercross<nFounders, false>(probabilities, r, selfingGenerations, nFunnels);
+		expand(expandedProbabilities, probabilities);
+	}
+	static void withIntercross(expandedProbabilitiesFiniteSelfing<nFounders>& expandedProbabilities, int nAIGenerations, double r, int selfingGenerations, std::size_t nFunnels)
+	{
+		compressedProbabilitiesType probabilities;
+		genotypeProbabilitiesWithIntercross<nFounders, false>(probabilities, nAIGenerations, r, selfingGenerations, nFunnels);
+		expand(expandedProbabilities, probabilities);
+	}
+private:
+	static void expand(expandedProbabilitiesFiniteSelfing<nFounders>& expandedProbabilities, compressedProbabilitiesType& probabilities)
+	{
 		memset(&expandedProbabilities, 0, sizeof(expandedProbabilitiesFiniteSelfing<nFounders>));
 		if(takeLogs)
 		{
@@ -146,44 +171,60 @@ public:
 		if(!takeLogs && fabs(sum - 1) > 1e-6) throw std::runtime_error("Haplotype probabilities did not sum to 1");
 #endif
 	}
-	static void withIntercross(expandedProbabilitiesFiniteSelfing<nFounders>& expandedProbabilities, int nAIGenerations, double r, int selfingGenerations, std::size_t nFunnels)
+};
+/*
+ * The log probabilities in compressed form, for the Viterbi algorithm. For finite selfing the log probability of genotypes (a1, a2) and (b1, b2) at the two loci is 
+ * logProbabilities[probabilityData<nFounders>::intermediateProbabilitiesMask[probabilityData<nFounders>::intermediateAllelesMask[a1][a2]][probabilityData<nFounders>::intermediateAllelesMask[b1][b2]]]
+ * and for infinite selfing the log probability of founders a and b is logProbabilities[probabilityData<nFounders>::infiniteMask[a][b]]. So the expanded nFounders^4 array is never formed. 
+ * The values for recombinationFractions[i] are written to logProbabilities[i * stride]. Recombination fractions which occur more than once (for example between co-located markers) are only computed once. 
+ */
+template<int nFounders, bool infiniteSelfing> struct logCompressedGenotypeProbabilities
+{
+public:
+	static const int nDifferentProbs = compressedProbabilities<nFounders, infiniteSelfing>::nDifferentProbs;
+	typedef std::array<double, nDifferentProbs> type;
+	static void noIntercrossBatch(type* logProbabilities, std::size_t stride, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels)
 	{
-		const int nDifferentProbs = compressedProbabilities<nFounders, false>::nDifferentProbs;
-		std::array<double, nDifferentProbs> probabilities;
-		genotypeProbabilitiesWithIntercross<nFounders, false>(probabilities, nAIGenerations, r, selfingGenerations, nFunnels);
-		memset(&expandedProbabilities, 0, sizeof(expandedProbabilitiesFiniteSelfing<nFounders>));
-		if(takeLogs)
+		std::vector<double> distinct;
+		std::vector<int> distinctIndices;
+		distinctValues(recombinationFractions, nRecombinationFractions, distinct, distinctIndices);
+		std::vector<type> values(distinct.size());
+		if(distinct.size() > 0) genotypeProbabilitiesNoIntercrossBatch<nFounders, infiniteSelfing>(&(values[0]), 1, &(distinct[0]), (int)distinct.size(), selfingGenerations, nFunnels);
+		scatterLogs(values, distinctIndices, logProbabilities, stride);
+	}
+	static void withIntercrossBatch(type* logProbabilities, std::size_t stride, int nAIGenerations, const double* recombinationFractions, int nRecombinationFractions, int selfingGenerations, std::size_t nFunnels)
+	{
+		std::vector<double> distinct;
+		std::vector<int> distinctIndices;
+		distinctValues(recombinationFractions, nRecombinationFractions, distinct, distinctIndices);
+		std::vector<type> values(distinct.size());
+		if(distinct.size() > 0) genotypeProbabilitiesWithIntercrossBatch<nFounders, infiniteSelfing>(&(values[0]), 1, nAIGenerations, &(distinct[0]), (int)distinct.size(), selfingGenerations, nFunnels);
+		scatterLogs(values, distinctIndices, logProbabilities, stride);
+	}
+private:
+	//The distinct recombination fractions, and for each input the index of its value in distinct
+	static void distinctValues(const double* recombinationFractions, int nRecombinationFractions, std::vector<double>& distinct, std::vector<int>& distinctIndices)
+	{
+		distinct.assign(recombinationFractions, recombinationFractions + nRecombinationFractions);
+		std::sort(distinct.begin(), distinct.end());
+		distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+		distinctIndices.resize(nRecombinationFractions);
+		for(int i = 0; i < nRecombinationFractions; i++)
 		{
-			for(int i = 0; i < nDifferentProbs; i++)
-			{
-				if(probabilities[i] == 0) probabilities[i] = -std::numeric_limits<double>::infinity();
-				else probabilities[i] = log(probabilities[i]);
-			}
+			distinctIndices[i] = (int)(std::lower_bound(distinct.begin(), distinct.end(), recombinationFractions[i]) - distinct.begin());
 		}
-#ifndef NDEBUG
-		double sum = 0;
-#endif
-		for(int marker1Allele1 = 0; marker1Allele1 < nFounders; marker1Allele1++)
+	}
+	static void scatterLogs(std::vector<type>& values, const std::vector<int>& distinctIndices, type* logProbabilities, std::size_t stride)
+	{
+		for(typename std::vector<type>::iterator i = values.begin(); i != values.end(); i++)
 		{
-			for(int marker1Allele2 = 0; marker1Allele2 < nFounders; marker1Allele2++)
+			for(int j = 0; j < nDifferentProbs; j++)
 			{
-				for(int marker2Allele1 = 0; marker2Allele1 < nFounders; marker2Allele1++)
-				{
-					for(int marker2Allele2 = 0; marker2Allele2 < nFounders; marker2Allele2++)
-					{
-						const int index1 = probabilityData<nFounders>::intermediateAllelesMask[marker1Allele1][marker1Allele2];
-						const int index2 = probabilityData<nFounders>::intermediateAllelesMask[marker2Allele1][marker2Allele2];
-						expandedProbabilities.values[marker1Allele1][marker1Allele2][marker2Allele1][marker2Allele2] = probabilities[probabilityData<nFounders>::intermediateProbabilitiesMask[index1][index2]];
-#ifndef NDEBUG
-						sum += expandedProbabilities.values[marker1Allele1][marker1Allele2][marker2Allele1][marker2Allele2];
-#endif
-					}
-				}
+				if((*i)[j] == 0) (*i)[j] = -std::numeric_limits<double>::infinity();
+				else (*i)[j] = log((*i)[j]);
 			}
 		}
-#ifndef NDEBUG
-		if(!takeLogs && fabs(sum - 1) > 1e-6) throw std::runtime_error("Haplotype probabilities did not sum to 1");
-#endif
+		for(std::size_t i = 0; i < distinctIndices.size(); i++) logProbabilities[i * stride] = values[distinctIndices[i]];
 	}
 };
 #endif
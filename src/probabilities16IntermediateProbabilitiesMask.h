@@ -1,3857 +0,0 @@
-{{0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 1, 5, 6, 6, 7, 7, 7,
-   7, 8, 8, 8, 8, 8, 8, 8, 8, 2, 6, 9, 10, 11, 11, 11, 11, 12, 12, 12,
-   12, 12, 12, 12, 12, 2, 6, 10, 9, 11, 11, 11, 11, 12, 12, 12, 12, 
-  12, 12, 12, 12, 3, 7, 11, 11, 13, 14, 15, 15, 16, 16, 16, 16, 16, 
-  16, 16, 16, 3, 7, 11, 11, 14, 13, 15, 15, 16, 16, 16, 16, 16, 16, 
-  16, 16, 3, 7, 11, 11, 15, 15, 13, 14, 16, 16, 16, 16, 16, 16, 16, 
-  16, 3, 7, 11, 11, 15, 15, 14, 13, 16, 16, 16, 16, 16, 16, 16, 16, 4,
-   8, 12, 12, 16, 16, 16, 16, 17, 18, 19, 19, 20, 20, 20, 20, 4, 8, 
-  12, 12, 16, 16, 16, 16, 18, 17, 19, 19, 20, 20, 20, 20, 4, 8, 12, 
-  12, 16, 16, 16, 16, 19, 19, 17, 18, 20, 20, 20, 20, 4, 8, 12, 12, 
-  16, 16, 16, 16, 19, 19, 18, 17, 20, 20, 20, 20, 4, 8, 12, 12, 16, 
-  16, 16, 16, 20, 20, 20, 20, 17, 18, 19, 19, 4, 8, 12, 12, 16, 16, 
-  16, 16, 20, 20, 20, 20, 18, 17, 19, 19, 4, 8, 12, 12, 16, 16, 16, 
-  16, 20, 20, 20, 20, 19, 19, 17, 18, 4, 8, 12, 12, 16, 16, 16, 16, 
-  20, 20, 20, 20, 19, 19, 18, 17}, {1, 21, 22, 22, 23, 23, 23, 23, 24,
-   24, 24, 24, 24, 24, 24, 24, 25, 1, 26, 26, 27, 27, 27, 27, 28, 28, 
-  28, 28, 28, 28, 28, 28, 26, 22, 10, 29, 30, 30, 30, 30, 31, 31, 31, 
-  31, 31, 31, 31, 31, 26, 22, 29, 10, 30, 30, 30, 30, 31, 31, 31, 31, 
-  31, 31, 31, 31, 27, 23, 30, 30, 14, 32, 33, 33, 34, 34, 34, 34, 34, 
-  34, 34, 34, 27, 23, 30, 30, 32, 14, 33, 33, 34, 34, 34, 34, 34, 34, 
-  34, 34, 27, 23, 30, 30, 33, 33, 14, 32, 34, 34, 34, 34, 34, 34, 34, 
-  34, 27, 23, 30, 30, 33, 33, 32, 14, 34, 34, 34, 34, 34, 34, 34, 34, 
-  28, 24, 31, 31, 34, 34, 34, 34, 18, 35, 36, 36, 37, 37, 37, 37, 28, 
-  24, 31, 31, 34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 28, 24, 
-  31, 31, 34, 34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 28, 24, 31, 
-  31, 34, 34, 34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 28, 24, 31, 31, 
-  34, 34, 34, 34, 37, 37, 37, 37, 18, 35, 36, 36, 28, 24, 31, 31, 34, 
-  34, 34, 34, 37, 37, 37, 37, 35, 18, 36, 36, 28, 24, 31, 31, 34, 34, 
-  34, 34, 37, 37, 37, 37, 36, 36, 18, 35, 28, 24, 31, 31, 34, 34, 34, 
-  34, 37, 37, 37, 37, 36, 36, 35, 18}, {2, 22, 38, 39, 40, 40, 40, 40,
-   41, 41, 41, 41, 41, 41, 41, 41, 26, 6, 39, 42, 43, 43, 43, 43, 44, 
-  44, 44, 44, 44, 44, 44, 44, 45, 46, 2, 26, 47, 47, 47, 47, 48, 48, 
-  48, 48, 48, 48, 48, 48, 46, 49, 22, 6, 50, 50, 50, 50, 51, 51, 51, 
-  51, 51, 51, 51, 51, 47, 50, 40, 43, 15, 33, 52, 52, 53, 53, 53, 53, 
-  53, 53, 53, 53, 47, 50, 40, 43, 33, 15, 52, 52, 53, 53, 53, 53, 53, 
-  53, 53, 53, 47, 50, 40, 43, 52, 52, 15, 33, 53, 53, 53, 53, 53, 53, 
-  53, 53, 47, 50, 40, 43, 52, 52, 33, 15, 53, 53, 53, 53, 53, 53, 53, 
-  53, 48, 51, 41, 44, 53, 53, 53, 53, 19, 36, 54, 54, 55, 55, 55, 55, 
-  48, 51, 41, 44, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 55, 55, 48, 
-  51, 41, 44, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 55, 48, 51, 
-  41, 44, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 48, 51, 41, 
-  44, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 48, 51, 41, 44, 
-  53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 48, 51, 41, 44, 53, 
-  53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 48, 51, 41, 44, 53, 53, 
-  53, 53, 55, 55, 55, 55, 54, 54, 36, 19}, {2, 22, 39, 38, 40, 40, 40,
-   40, 41, 41, 41, 41, 41, 41, 41, 41, 26, 6, 42, 39, 43, 43, 43, 43, 
-  44, 44, 44, 44, 44, 44, 44, 44, 46, 49, 6, 22, 50, 50, 50, 50, 51, 
-  51, 51, 51, 51, 51, 51, 51, 45, 46, 26, 2, 47, 47, 47, 47, 48, 48, 
-  48, 48, 48, 48, 48, 48, 47, 50, 43, 40, 15, 33, 52, 52, 53, 53, 53, 
-  53, 53, 53, 53, 53, 47, 50, 43, 40, 33, 15, 52, 52, 53, 53, 53, 53, 
-  53, 53, 53, 53, 47, 50, 43, 40, 52, 52, 15, 33, 53, 53, 53, 53, 53, 
-  53, 53, 53, 47, 50, 43, 40, 52, 52, 33, 15, 53, 53, 53, 53, 53, 53, 
-  53, 53, 48, 51, 44, 41, 53, 53, 53, 53, 19, 36, 54, 54, 55, 55, 55, 
-  55, 48, 51, 44, 41, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 55, 55, 
-  48, 51, 44, 41, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 55, 48, 
-  51, 44, 41, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 48, 51, 
-  44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 48, 51, 44, 
-  41, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 48, 51, 44, 41, 
-  53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 48, 51, 44, 41, 53, 
-  53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19}, {3, 23, 40, 40, 56, 57,
-   58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 27, 7, 43, 43, 57, 60, 61, 
-  61, 62, 62, 62, 62, 62, 62, 62, 62, 47, 50, 11, 30, 58, 61, 63, 63, 
-  64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 30, 11, 58, 61, 63, 63, 64, 
-  64, 64, 64, 64, 64, 64, 64, 65, 66, 67, 67, 3, 27, 47, 47, 68, 68, 
-  68, 68, 68, 68, 68, 68, 66, 69, 70, 70, 23, 7, 50, 50, 71, 71, 71, 
-  71, 71, 71, 71, 71, 67, 70, 72, 72, 40, 43, 11, 30, 73, 73, 73, 73, 
-  73, 73, 73, 73, 67, 70, 72, 72, 40, 43, 30, 11, 73, 73, 73, 73, 73, 
-  73, 73, 73, 68, 71, 73, 73, 59, 62, 64, 64, 20, 37, 55, 55, 74, 74, 
-  74, 74, 68, 71, 73, 73, 59, 62, 64, 64, 37, 20, 55, 55, 74, 74, 74, 
-  74, 68, 71, 73, 73, 59, 62, 64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 
-  68, 71, 73, 73, 59, 62, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 68, 
-  71, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 68, 71, 
-  73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 68, 71, 73, 
-  73, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 68, 71, 73, 73, 
-  59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20}, {3, 23, 40, 40, 57,
-   56, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 27, 7, 43, 43, 60, 57, 
-  61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 47, 50, 11, 30, 61, 58, 63, 
-  63, 64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 30, 11, 61, 58, 63, 63, 
-  64, 64, 64, 64, 64, 64, 64, 64, 66, 69, 70, 70, 7, 23, 50, 50, 71, 
-  71, 71, 71, 71, 71, 71, 71, 65, 66, 67, 67, 27, 3, 47, 47, 68, 68, 
-  68, 68, 68, 68, 68, 68, 67, 70, 72, 72, 43, 40, 11, 30, 73, 73, 73, 
-  73, 73, 73, 73, 73, 67, 70, 72, 72, 43, 40, 30, 11, 73, 73, 73, 73, 
-  73, 73, 73, 73, 68, 71, 73, 73, 62, 59, 64, 64, 20, 37, 55, 55, 74, 
-  74, 74, 74, 68, 71, 73, 73, 62, 59, 64, 64, 37, 20, 55, 55, 74, 74, 
-  74, 74, 68, 71, 73, 73, 62, 59, 64, 64, 55, 55, 20, 37, 74, 74, 74, 
-  74, 68, 71, 73, 73, 62, 59, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 
-  68, 71, 73, 73, 62, 59, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 68, 
-  71, 73, 73, 62, 59, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 68, 71, 
-  73, 73, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 68, 71, 73, 
-  73, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20}, {3, 23, 40, 40,
-   58, 58, 56, 57, 59, 59, 59, 59, 59, 59, 59, 59, 27, 7, 43, 43, 61, 
-  61, 57, 60, 62, 62, 62, 62, 62, 62, 62, 62, 47, 50, 11, 30, 63, 63, 
-  58, 61, 64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 30, 11, 63, 63, 58, 
-  61, 64, 64, 64, 64, 64, 64, 64, 64, 67, 70, 72, 72, 11, 30, 40, 43, 
-  73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 30, 11, 40, 43, 73, 
-  73, 73, 73, 73, 73, 73, 73, 65, 66, 67, 67, 47, 47, 3, 27, 68, 68, 
-  68, 68, 68, 68, 68, 68, 66, 69, 70, 70, 50, 50, 23, 7, 71, 71, 71, 
-  71, 71, 71, 71, 71, 68, 71, 73, 73, 64, 64, 59, 62, 20, 37, 55, 55, 
-  74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 59, 62, 37, 20, 55, 55, 74, 
-  74, 74, 74, 68, 71, 73, 73, 64, 64, 59, 62, 55, 55, 20, 37, 74, 74, 
-  74, 74, 68, 71, 73, 73, 64, 64, 59, 62, 55, 55, 37, 20, 74, 74, 74, 
-  74, 68, 71, 73, 73, 64, 64, 59, 62, 74, 74, 74, 74, 20, 37, 55, 55, 
-  68, 71, 73, 73, 64, 64, 59, 62, 74, 74, 74, 74, 37, 20, 55, 55, 68, 
-  71, 73, 73, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 20, 37, 68, 71, 
-  73, 73, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 37, 20}, {3, 23, 40,
-   40, 58, 58, 57, 56, 59, 59, 59, 59, 59, 59, 59, 59, 27, 7, 43, 43, 
-  61, 61, 60, 57, 62, 62, 62, 62, 62, 62, 62, 62, 47, 50, 11, 30, 63, 
-  63, 61, 58, 64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 30, 11, 63, 63, 
-  61, 58, 64, 64, 64, 64, 64, 64, 64, 64, 67, 70, 72, 72, 11, 30, 43, 
-  40, 73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 30, 11, 43, 40, 
-  73, 73, 73, 73, 73, 73, 73, 73, 66, 69, 70, 70, 50, 50, 7, 23, 71, 
-  71, 71, 71, 71, 71, 71, 71, 65, 66, 67, 67, 47, 47, 27, 3, 68, 68, 
-  68, 68, 68, 68, 68, 68, 68, 71, 73, 73, 64, 64, 62, 59, 20, 37, 55, 
-  55, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 62, 59, 37, 20, 55, 55, 
-  74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 62, 59, 55, 55, 20, 37, 74, 
-  74, 74, 74, 68, 71, 73, 73, 64, 64, 62, 59, 55, 55, 37, 20, 74, 74, 
-  74, 74, 68, 71, 73, 73, 64, 64, 62, 59, 74, 74, 74, 74, 20, 37, 55, 
-  55, 68, 71, 73, 73, 64, 64, 62, 59, 74, 74, 74, 74, 37, 20, 55, 55, 
-  68, 71, 73, 73, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 20, 37, 68, 
-  71, 73, 73, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 37, 20}, {4, 24,
-   41, 41, 59, 59, 59, 59, 75, 76, 77, 77, 78, 78, 78, 78, 28, 8, 44, 
-  44, 62, 62, 62, 62, 76, 79, 80, 80, 81, 81, 81, 81, 48, 51, 12, 31, 
-  64, 64, 64, 64, 77, 80, 82, 82, 83, 83, 83, 83, 48, 51, 31, 12, 64, 
-  64, 64, 64, 77, 80, 82, 82, 83, 83, 83, 83, 68, 71, 73, 73, 16, 34, 
-  53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 34, 16, 53, 
-  53, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 53, 53, 16, 34, 
-  78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 53, 53, 34, 16, 78, 
-  81, 83, 83, 84, 84, 84, 84, 85, 86, 87, 87, 88, 88, 88, 88, 4, 28, 
-  48, 48, 68, 68, 68, 68, 86, 89, 90, 90, 91, 91, 91, 91, 24, 8, 51, 
-  51, 71, 71, 71, 71, 87, 90, 92, 92, 93, 93, 93, 93, 41, 44, 12, 31, 
-  73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 41, 44, 31, 12, 73, 
-  73, 73, 73, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 16, 34, 
-  53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 34, 16, 53, 
-  53, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 53, 53, 16, 34, 
-  88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 53, 53, 34, 16}, {4,
-   24, 41, 41, 59, 59, 59, 59, 76, 75, 77, 77, 78, 78, 78, 78, 28, 8, 
-  44, 44, 62, 62, 62, 62, 79, 76, 80, 80, 81, 81, 81, 81, 48, 51, 12, 
-  31, 64, 64, 64, 64, 80, 77, 82, 82, 83, 83, 83, 83, 48, 51, 31, 12, 
-  64, 64, 64, 64, 80, 77, 82, 82, 83, 83, 83, 83, 68, 71, 73, 73, 16, 
-  34, 53, 53, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 34, 16, 
-  53, 53, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 53, 53, 16, 
-  34, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 53, 53, 34, 16, 
-  81, 78, 83, 83, 84, 84, 84, 84, 86, 89, 90, 90, 91, 91, 91, 91, 8, 
-  24, 51, 51, 71, 71, 71, 71, 85, 86, 87, 87, 88, 88, 88, 88, 28, 4, 
-  48, 48, 68, 68, 68, 68, 87, 90, 92, 92, 93, 93, 93, 93, 44, 41, 12, 
-  31, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 44, 41, 31, 12, 
-  73, 73, 73, 73, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 64, 16, 
-  34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 64, 34, 16, 
-  53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 16, 
-  34, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 34, 
-  16}, {4, 24, 41, 41, 59, 59, 59, 59, 77, 77, 75, 76, 78, 78, 78, 78,
-   28, 8, 44, 44, 62, 62, 62, 62, 80, 80, 76, 79, 81, 81, 81, 81, 48, 
-  51, 12, 31, 64, 64, 64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 48, 51, 
-  31, 12, 64, 64, 64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 68, 71, 73, 
-  73, 16, 34, 53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 68, 71, 73, 73, 
-  34, 16, 53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 68, 71, 73, 73, 53, 
-  53, 16, 34, 83, 83, 78, 81, 84, 84, 84, 84, 68, 71, 73, 73, 53, 53, 
-  34, 16, 83, 83, 78, 81, 84, 84, 84, 84, 87, 90, 92, 92, 93, 93, 93, 
-  93, 12, 31, 41, 44, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 
-  31, 12, 41, 44, 73, 73, 73, 73, 85, 86, 87, 87, 88, 88, 88, 88, 48, 
-  48, 4, 28, 68, 68, 68, 68, 86, 89, 90, 90, 91, 91, 91, 91, 51, 51, 
-  24, 8, 71, 71, 71, 71, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 59, 
-  62, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 59, 62, 
-  34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 59, 62, 53, 
-  53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 
-  34, 16}, {4, 24, 41, 41, 59, 59, 59, 59, 77, 77, 76, 75, 78, 78, 78,
-   78, 28, 8, 44, 44, 62, 62, 62, 62, 80, 80, 79, 76, 81, 81, 81, 81, 
-  48, 51, 12, 31, 64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 83, 48, 
-  51, 31, 12, 64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 83, 68, 71, 
-  73, 73, 16, 34, 53, 53, 83, 83, 81, 78, 84, 84, 84, 84, 68, 71, 73, 
-  73, 34, 16, 53, 53, 83, 83, 81, 78, 84, 84, 84, 84, 68, 71, 73, 73, 
-  53, 53, 16, 34, 83, 83, 81, 78, 84, 84, 84, 84, 68, 71, 73, 73, 53, 
-  53, 34, 16, 83, 83, 81, 78, 84, 84, 84, 84, 87, 90, 92, 92, 93, 93, 
-  93, 93, 12, 31, 44, 41, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 
-  93, 31, 12, 44, 41, 73, 73, 73, 73, 86, 89, 90, 90, 91, 91, 91, 91, 
-  51, 51, 8, 24, 71, 71, 71, 71, 85, 86, 87, 87, 88, 88, 88, 88, 48, 
-  48, 28, 4, 68, 68, 68, 68, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 
-  62, 59, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 62, 
-  59, 34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 62, 59, 
-  53, 53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 62, 59, 53, 
-  53, 34, 16}, {4, 24, 41, 41, 59, 59, 59, 59, 78, 78, 78, 78, 75, 76,
-   77, 77, 28, 8, 44, 44, 62, 62, 62, 62, 81, 81, 81, 81, 76, 79, 80, 
-  80, 48, 51, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 
-  48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 68, 
-  71, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 68, 71, 
-  73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 68, 71, 73, 
-  73, 53, 53, 16, 34, 84, 84, 84, 84, 78, 81, 83, 83, 68, 71, 73, 73, 
-  53, 53, 34, 16, 84, 84, 84, 84, 78, 81, 83, 83, 88, 91, 93, 93, 94, 
-  94, 94, 94, 16, 34, 53, 53, 59, 62, 64, 64, 88, 91, 93, 93, 94, 94, 
-  94, 94, 34, 16, 53, 53, 59, 62, 64, 64, 88, 91, 93, 93, 94, 94, 94, 
-  94, 53, 53, 16, 34, 59, 62, 64, 64, 88, 91, 93, 93, 94, 94, 94, 94, 
-  53, 53, 34, 16, 59, 62, 64, 64, 85, 86, 87, 87, 88, 88, 88, 88, 68, 
-  68, 68, 68, 4, 28, 48, 48, 86, 89, 90, 90, 91, 91, 91, 91, 71, 71, 
-  71, 71, 24, 8, 51, 51, 87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 73, 
-  73, 41, 44, 12, 31, 87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 
-  41, 44, 31, 12}, {4, 24, 41, 41, 59, 59, 59, 59, 78, 78, 78, 78, 76,
-   75, 77, 77, 28, 8, 44, 44, 62, 62, 62, 62, 81, 81, 81, 81, 79, 76, 
-  80, 80, 48, 51, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 
-  82, 48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 82, 
-  68, 71, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 68, 
-  71, 73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 68, 71, 
-  73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 81, 78, 83, 83, 68, 71, 73, 
-  73, 53, 53, 34, 16, 84, 84, 84, 84, 81, 78, 83, 83, 88, 91, 93, 93, 
-  94, 94, 94, 94, 16, 34, 53, 53, 62, 59, 64, 64, 88, 91, 93, 93, 94, 
-  94, 94, 94, 34, 16, 53, 53, 62, 59, 64, 64, 88, 91, 93, 93, 94, 94, 
-  94, 94, 53, 53, 16, 34, 62, 59, 64, 64, 88, 91, 93, 93, 94, 94, 94, 
-  94, 53, 53, 34, 16, 62, 59, 64, 64, 86, 89, 90, 90, 91, 91, 91, 91, 
-  71, 71, 71, 71, 8, 24, 51, 51, 85, 86, 87, 87, 88, 88, 88, 88, 68, 
-  68, 68, 68, 28, 4, 48, 48, 87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 
-  73, 73, 44, 41, 12, 31, 87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 73, 
-  73, 44, 41, 31, 12}, {4, 24, 41, 41, 59, 59, 59, 59, 78, 78, 78, 78,
-   77, 77, 75, 76, 28, 8, 44, 44, 62, 62, 62, 62, 81, 81, 81, 81, 80, 
-  80, 76, 79, 48, 51, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 
-  77, 80, 48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 77, 
-  80, 68, 71, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 
-  68, 71, 73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 68, 
-  71, 73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 78, 81, 68, 71, 
-  73, 73, 53, 53, 34, 16, 84, 84, 84, 84, 83, 83, 78, 81, 88, 91, 93, 
-  93, 94, 94, 94, 94, 16, 34, 53, 53, 64, 64, 59, 62, 88, 91, 93, 93, 
-  94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 59, 62, 88, 91, 93, 93, 94, 
-  94, 94, 94, 53, 53, 16, 34, 64, 64, 59, 62, 88, 91, 93, 93, 94, 94, 
-  94, 94, 53, 53, 34, 16, 64, 64, 59, 62, 87, 90, 92, 92, 93, 93, 93, 
-  93, 73, 73, 73, 73, 12, 31, 41, 44, 87, 90, 92, 92, 93, 93, 93, 93, 
-  73, 73, 73, 73, 31, 12, 41, 44, 85, 86, 87, 87, 88, 88, 88, 88, 68, 
-  68, 68, 68, 48, 48, 4, 28, 86, 89, 90, 90, 91, 91, 91, 91, 71, 71, 
-  71, 71, 51, 51, 24, 8}, {4, 24, 41, 41, 59, 59, 59, 59, 78, 78, 78, 
-  78, 77, 77, 76, 75, 28, 8, 44, 44, 62, 62, 62, 62, 81, 81, 81, 81, 
-  80, 80, 79, 76, 48, 51, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 82, 
-  82, 80, 77, 48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 
-  80, 77, 68, 71, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 81, 
-  78, 68, 71, 73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 
-  68, 71, 73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 81, 78, 68, 
-  71, 73, 73, 53, 53, 34, 16, 84, 84, 84, 84, 83, 83, 81, 78, 88, 91, 
-  93, 93, 94, 94, 94, 94, 16, 34, 53, 53, 64, 64, 62, 59, 88, 91, 93, 
-  93, 94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 62, 59, 88, 91, 93, 93, 
-  94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 62, 59, 88, 91, 93, 93, 94, 
-  94, 94, 94, 53, 53, 34, 16, 64, 64, 62, 59, 87, 90, 92, 92, 93, 93, 
-  93, 93, 73, 73, 73, 73, 12, 31, 44, 41, 87, 90, 92, 92, 93, 93, 93, 
-  93, 73, 73, 73, 73, 31, 12, 44, 41, 86, 89, 90, 90, 91, 91, 91, 91, 
-  71, 71, 71, 71, 51, 51, 8, 24, 85, 86, 87, 87, 88, 88, 88, 88, 68, 
-  68, 68, 68, 48, 48, 28, 4}, {1, 25, 26, 26, 27, 27, 27, 27, 28, 28, 
-  28, 28, 28, 28, 28, 28, 21, 1, 22, 22, 23, 23, 23, 23, 24, 24, 24, 
-  24, 24, 24, 24, 24, 22, 26, 10, 29, 30, 30, 30, 30, 31, 31, 31, 31, 
-  31, 31, 31, 31, 22, 26, 29, 10, 30, 30, 30, 30, 31, 31, 31, 31, 31, 
-  31, 31, 31, 23, 27, 30, 30, 14, 32, 33, 33, 34, 34, 34, 34, 34, 34, 
-  34, 34, 23, 27, 30, 30, 32, 14, 33, 33, 34, 34, 34, 34, 34, 34, 34, 
-  34, 23, 27, 30, 30, 33, 33, 14, 32, 34, 34, 34, 34, 34, 34, 34, 34, 
-  23, 27, 30, 30, 33, 33, 32, 14, 34, 34, 34, 34, 34, 34, 34, 34, 24, 
-  28, 31, 31, 34, 34, 34, 34, 18, 35, 36, 36, 37, 37, 37, 37, 24, 28, 
-  31, 31, 34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 24, 28, 31, 
-  31, 34, 34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 24, 28, 31, 31, 
-  34, 34, 34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 24, 28, 31, 31, 34, 
-  34, 34, 34, 37, 37, 37, 37, 18, 35, 36, 36, 24, 28, 31, 31, 34, 34, 
-  34, 34, 37, 37, 37, 37, 35, 18, 36, 36, 24, 28, 31, 31, 34, 34, 34, 
-  34, 37, 37, 37, 37, 36, 36, 18, 35, 24, 28, 31, 31, 34, 34, 34, 34, 
-  37, 37, 37, 37, 36, 36, 35, 18}, {5, 1, 6, 6, 7, 7, 7, 7, 8, 8, 8, 
-  8, 8, 8, 8, 8, 1, 0, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 6, 2,
-   9, 10, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 6, 2, 10, 9,
-   11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 7, 3, 11, 11, 13, 
-  14, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 14, 13, 
-  15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 15, 15, 13, 
-  14, 16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 15, 15, 14, 13, 
-  16, 16, 16, 16, 16, 16, 16, 16, 8, 4, 12, 12, 16, 16, 16, 16, 17, 
-  18, 19, 19, 20, 20, 20, 20, 8, 4, 12, 12, 16, 16, 16, 16, 18, 17, 
-  19, 19, 20, 20, 20, 20, 8, 4, 12, 12, 16, 16, 16, 16, 19, 19, 17, 
-  18, 20, 20, 20, 20, 8, 4, 12, 12, 16, 16, 16, 16, 19, 19, 18, 17, 
-  20, 20, 20, 20, 8, 4, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 17, 
-  18, 19, 19, 8, 4, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 18, 17, 
-  19, 19, 8, 4, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 17, 
-  18, 8, 4, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 18, 
-  17}, {6, 26, 39, 42, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
-   22, 2, 38, 39, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 46, 
-  45, 2, 26, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 49, 46, 
-  22, 6, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 50, 47, 40, 
-  43, 15, 33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 
-  33, 15, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 52, 
-  52, 15, 33, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 52, 52, 
-  33, 15, 53, 53, 53, 53, 53, 53, 53, 53, 51, 48, 41, 44, 53, 53, 53, 
-  53, 19, 36, 54, 54, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 
-  36, 19, 54, 54, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 54, 
-  54, 19, 36, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 54, 54, 
-  36, 19, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 
-  55, 19, 36, 54, 54, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 
-  36, 19, 54, 54, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 
-  54, 19, 36, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 
-  36, 19}, {6, 26, 42, 39, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44,
-   44, 22, 2, 39, 38, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 
-  49, 46, 6, 22, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 46, 
-  45, 26, 2, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 50, 47, 
-  43, 40, 15, 33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 
-  40, 33, 15, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 40, 
-  52, 52, 15, 33, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 40, 52, 
-  52, 33, 15, 53, 53, 53, 53, 53, 53, 53, 53, 51, 48, 44, 41, 53, 53, 
-  53, 53, 19, 36, 54, 54, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 
-  53, 36, 19, 54, 54, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 
-  54, 54, 19, 36, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 54, 
-  54, 36, 19, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 
-  55, 55, 19, 36, 54, 54, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 
-  55, 36, 19, 54, 54, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 
-  54, 54, 19, 36, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 54, 
-  54, 36, 19}, {7, 27, 43, 43, 57, 60, 61, 61, 62, 62, 62, 62, 62, 62,
-   62, 62, 23, 3, 40, 40, 56, 57, 58, 58, 59, 59, 59, 59, 59, 59, 59, 
-  59, 50, 47, 11, 30, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 
-  50, 47, 30, 11, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 66, 
-  65, 67, 67, 3, 27, 47, 47, 68, 68, 68, 68, 68, 68, 68, 68, 69, 66, 
-  70, 70, 23, 7, 50, 50, 71, 71, 71, 71, 71, 71, 71, 71, 70, 67, 72, 
-  72, 40, 43, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 70, 67, 72, 72, 
-  40, 43, 30, 11, 73, 73, 73, 73, 73, 73, 73, 73, 71, 68, 73, 73, 59, 
-  62, 64, 64, 20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 
-  64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 64, 
-  64, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 64, 64, 
-  55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 64, 64, 74, 
-  74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 59, 62, 64, 64, 74, 74, 
-  74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 59, 62, 64, 64, 74, 74, 74, 
-  74, 55, 55, 20, 37, 71, 68, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 
-  55, 55, 37, 20}, {7, 27, 43, 43, 60, 57, 61, 61, 62, 62, 62, 62, 62,
-   62, 62, 62, 23, 3, 40, 40, 57, 56, 58, 58, 59, 59, 59, 59, 59, 59, 
-  59, 59, 50, 47, 11, 30, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 
-  64, 50, 47, 30, 11, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 
-  69, 66, 70, 70, 7, 23, 50, 50, 71, 71, 71, 71, 71, 71, 71, 71, 66, 
-  65, 67, 67, 27, 3, 47, 47, 68, 68, 68, 68, 68, 68, 68, 68, 70, 67, 
-  72, 72, 43, 40, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 70, 67, 72, 
-  72, 43, 40, 30, 11, 73, 73, 73, 73, 73, 73, 73, 73, 71, 68, 73, 73, 
-  62, 59, 64, 64, 20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 62, 
-  59, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 62, 59, 
-  64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 62, 59, 64, 
-  64, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 62, 59, 64, 64, 
-  74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 62, 59, 64, 64, 74, 
-  74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 62, 59, 64, 64, 74, 74, 
-  74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 62, 59, 64, 64, 74, 74, 74, 
-  74, 55, 55, 37, 20}, {7, 27, 43, 43, 61, 61, 57, 60, 62, 62, 62, 62,
-   62, 62, 62, 62, 23, 3, 40, 40, 58, 58, 56, 57, 59, 59, 59, 59, 59, 
-  59, 59, 59, 50, 47, 11, 30, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 
-  64, 64, 50, 47, 30, 11, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 64, 
-  64, 70, 67, 72, 72, 11, 30, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 
-  70, 67, 72, 72, 30, 11, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 66, 
-  65, 67, 67, 47, 47, 3, 27, 68, 68, 68, 68, 68, 68, 68, 68, 69, 66, 
-  70, 70, 50, 50, 23, 7, 71, 71, 71, 71, 71, 71, 71, 71, 71, 68, 73, 
-  73, 64, 64, 59, 62, 20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 
-  64, 64, 59, 62, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 64, 
-  64, 59, 62, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 64, 64, 
-  59, 62, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 64, 64, 59, 
-  62, 74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 64, 64, 59, 62, 
-  74, 74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 64, 64, 59, 62, 74, 
-  74, 74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 64, 64, 59, 62, 74, 74, 
-  74, 74, 55, 55, 37, 20}, {7, 27, 43, 43, 61, 61, 60, 57, 62, 62, 62,
-   62, 62, 62, 62, 62, 23, 3, 40, 40, 58, 58, 57, 56, 59, 59, 59, 59, 
-  59, 59, 59, 59, 50, 47, 11, 30, 63, 63, 61, 58, 64, 64, 64, 64, 64, 
-  64, 64, 64, 50, 47, 30, 11, 63, 63, 61, 58, 64, 64, 64, 64, 64, 64, 
-  64, 64, 70, 67, 72, 72, 11, 30, 43, 40, 73, 73, 73, 73, 73, 73, 73, 
-  73, 70, 67, 72, 72, 30, 11, 43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 
-  69, 66, 70, 70, 50, 50, 7, 23, 71, 71, 71, 71, 71, 71, 71, 71, 66, 
-  65, 67, 67, 47, 47, 27, 3, 68, 68, 68, 68, 68, 68, 68, 68, 71, 68, 
-  73, 73, 64, 64, 62, 59, 20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 
-  73, 64, 64, 62, 59, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 
-  64, 64, 62, 59, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 64, 
-  64, 62, 59, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 64, 64, 
-  62, 59, 74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 64, 64, 62, 
-  59, 74, 74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 64, 64, 62, 59, 
-  74, 74, 74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 64, 64, 62, 59, 74, 
-  74, 74, 74, 55, 55, 37, 20}, {8, 28, 44, 44, 62, 62, 62, 62, 76, 79,
-   80, 80, 81, 81, 81, 81, 24, 4, 41, 41, 59, 59, 59, 59, 75, 76, 77, 
-  77, 78, 78, 78, 78, 51, 48, 12, 31, 64, 64, 64, 64, 77, 80, 82, 82, 
-  83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 77, 80, 82, 82, 83, 
-  83, 83, 83, 71, 68, 73, 73, 16, 34, 53, 53, 78, 81, 83, 83, 84, 84, 
-  84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 78, 81, 83, 83, 84, 84, 84, 
-  84, 71, 68, 73, 73, 53, 53, 16, 34, 78, 81, 83, 83, 84, 84, 84, 84, 
-  71, 68, 73, 73, 53, 53, 34, 16, 78, 81, 83, 83, 84, 84, 84, 84, 86, 
-  85, 87, 87, 88, 88, 88, 88, 4, 28, 48, 48, 68, 68, 68, 68, 89, 86, 
-  90, 90, 91, 91, 91, 91, 24, 8, 51, 51, 71, 71, 71, 71, 90, 87, 92, 
-  92, 93, 93, 93, 93, 41, 44, 12, 31, 73, 73, 73, 73, 90, 87, 92, 92, 
-  93, 93, 93, 93, 41, 44, 31, 12, 73, 73, 73, 73, 91, 88, 93, 93, 94, 
-  94, 94, 94, 59, 62, 64, 64, 16, 34, 53, 53, 91, 88, 93, 93, 94, 94, 
-  94, 94, 59, 62, 64, 64, 34, 16, 53, 53, 91, 88, 93, 93, 94, 94, 94, 
-  94, 59, 62, 64, 64, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 94, 94, 
-  59, 62, 64, 64, 53, 53, 34, 16}, {8, 28, 44, 44, 62, 62, 62, 62, 79,
-   76, 80, 80, 81, 81, 81, 81, 24, 4, 41, 41, 59, 59, 59, 59, 76, 75, 
-  77, 77, 78, 78, 78, 78, 51, 48, 12, 31, 64, 64, 64, 64, 80, 77, 82, 
-  82, 83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 80, 77, 82, 82, 
-  83, 83, 83, 83, 71, 68, 73, 73, 16, 34, 53, 53, 81, 78, 83, 83, 84, 
-  84, 84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 81, 78, 83, 83, 84, 84, 
-  84, 84, 71, 68, 73, 73, 53, 53, 16, 34, 81, 78, 83, 83, 84, 84, 84, 
-  84, 71, 68, 73, 73, 53, 53, 34, 16, 81, 78, 83, 83, 84, 84, 84, 84, 
-  89, 86, 90, 90, 91, 91, 91, 91, 8, 24, 51, 51, 71, 71, 71, 71, 86, 
-  85, 87, 87, 88, 88, 88, 88, 28, 4, 48, 48, 68, 68, 68, 68, 90, 87, 
-  92, 92, 93, 93, 93, 93, 44, 41, 12, 31, 73, 73, 73, 73, 90, 87, 92, 
-  92, 93, 93, 93, 93, 44, 41, 31, 12, 73, 73, 73, 73, 91, 88, 93, 93, 
-  94, 94, 94, 94, 62, 59, 64, 64, 16, 34, 53, 53, 91, 88, 93, 93, 94, 
-  94, 94, 94, 62, 59, 64, 64, 34, 16, 53, 53, 91, 88, 93, 93, 94, 94, 
-  94, 94, 62, 59, 64, 64, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 94, 
-  94, 62, 59, 64, 64, 53, 53, 34, 16}, {8, 28, 44, 44, 62, 62, 62, 62,
-   80, 80, 76, 79, 81, 81, 81, 81, 24, 4, 41, 41, 59, 59, 59, 59, 77, 
-  77, 75, 76, 78, 78, 78, 78, 51, 48, 12, 31, 64, 64, 64, 64, 82, 82, 
-  77, 80, 83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 82, 82, 77, 
-  80, 83, 83, 83, 83, 71, 68, 73, 73, 16, 34, 53, 53, 83, 83, 78, 81, 
-  84, 84, 84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 83, 83, 78, 81, 84, 
-  84, 84, 84, 71, 68, 73, 73, 53, 53, 16, 34, 83, 83, 78, 81, 84, 84, 
-  84, 84, 71, 68, 73, 73, 53, 53, 34, 16, 83, 83, 78, 81, 84, 84, 84, 
-  84, 90, 87, 92, 92, 93, 93, 93, 93, 12, 31, 41, 44, 73, 73, 73, 73, 
-  90, 87, 92, 92, 93, 93, 93, 93, 31, 12, 41, 44, 73, 73, 73, 73, 86, 
-  85, 87, 87, 88, 88, 88, 88, 48, 48, 4, 28, 68, 68, 68, 68, 89, 86, 
-  90, 90, 91, 91, 91, 91, 51, 51, 24, 8, 71, 71, 71, 71, 91, 88, 93, 
-  93, 94, 94, 94, 94, 64, 64, 59, 62, 16, 34, 53, 53, 91, 88, 93, 93, 
-  94, 94, 94, 94, 64, 64, 59, 62, 34, 16, 53, 53, 91, 88, 93, 93, 94, 
-  94, 94, 94, 64, 64, 59, 62, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 
-  94, 94, 64, 64, 59, 62, 53, 53, 34, 16}, {8, 28, 44, 44, 62, 62, 62,
-   62, 80, 80, 79, 76, 81, 81, 81, 81, 24, 4, 41, 41, 59, 59, 59, 59, 
-  77, 77, 76, 75, 78, 78, 78, 78, 51, 48, 12, 31, 64, 64, 64, 64, 82, 
-  82, 80, 77, 83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 82, 82, 
-  80, 77, 83, 83, 83, 83, 71, 68, 73, 73, 16, 34, 53, 53, 83, 83, 81, 
-  78, 84, 84, 84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 83, 83, 81, 78, 
-  84, 84, 84, 84, 71, 68, 73, 73, 53, 53, 16, 34, 83, 83, 81, 78, 84, 
-  84, 84, 84, 71, 68, 73, 73, 53, 53, 34, 16, 83, 83, 81, 78, 84, 84, 
-  84, 84, 90, 87, 92, 92, 93, 93, 93, 93, 12, 31, 44, 41, 73, 73, 73, 
-  73, 90, 87, 92, 92, 93, 93, 93, 93, 31, 12, 44, 41, 73, 73, 73, 73, 
-  89, 86, 90, 90, 91, 91, 91, 91, 51, 51, 8, 24, 71, 71, 71, 71, 86, 
-  85, 87, 87, 88, 88, 88, 88, 48, 48, 28, 4, 68, 68, 68, 68, 91, 88, 
-  93, 93, 94, 94, 94, 94, 64, 64, 62, 59, 16, 34, 53, 53, 91, 88, 93, 
-  93, 94, 94, 94, 94, 64, 64, 62, 59, 34, 16, 53, 53, 91, 88, 93, 93, 
-  94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 16, 34, 91, 88, 93, 93, 94, 
-  94, 94, 94, 64, 64, 62, 59, 53, 53, 34, 16}, {8, 28, 44, 44, 62, 62,
-   62, 62, 81, 81, 81, 81, 76, 79, 80, 80, 24, 4, 41, 41, 59, 59, 59, 
-  59, 78, 78, 78, 78, 75, 76, 77, 77, 51, 48, 12, 31, 64, 64, 64, 64, 
-  83, 83, 83, 83, 77, 80, 82, 82, 51, 48, 31, 12, 64, 64, 64, 64, 83, 
-  83, 83, 83, 77, 80, 82, 82, 71, 68, 73, 73, 16, 34, 53, 53, 84, 84, 
-  84, 84, 78, 81, 83, 83, 71, 68, 73, 73, 34, 16, 53, 53, 84, 84, 84, 
-  84, 78, 81, 83, 83, 71, 68, 73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 
-  78, 81, 83, 83, 71, 68, 73, 73, 53, 53, 34, 16, 84, 84, 84, 84, 78, 
-  81, 83, 83, 91, 88, 93, 93, 94, 94, 94, 94, 16, 34, 53, 53, 59, 62, 
-  64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 59, 62, 64, 
-  64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 59, 62, 64, 64, 
-  91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 59, 62, 64, 64, 86, 
-  85, 87, 87, 88, 88, 88, 88, 68, 68, 68, 68, 4, 28, 48, 48, 89, 86, 
-  90, 90, 91, 91, 91, 91, 71, 71, 71, 71, 24, 8, 51, 51, 90, 87, 92, 
-  92, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 12, 31, 90, 87, 92, 92, 
-  93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 31, 12}, {8, 28, 44, 44, 62,
-   62, 62, 62, 81, 81, 81, 81, 79, 76, 80, 80, 24, 4, 41, 41, 59, 59, 
-  59, 59, 78, 78, 78, 78, 76, 75, 77, 77, 51, 48, 12, 31, 64, 64, 64, 
-  64, 83, 83, 83, 83, 80, 77, 82, 82, 51, 48, 31, 12, 64, 64, 64, 64, 
-  83, 83, 83, 83, 80, 77, 82, 82, 71, 68, 73, 73, 16, 34, 53, 53, 84, 
-  84, 84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 34, 16, 53, 53, 84, 84, 
-  84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 53, 53, 16, 34, 84, 84, 84, 
-  84, 81, 78, 83, 83, 71, 68, 73, 73, 53, 53, 34, 16, 84, 84, 84, 84, 
-  81, 78, 83, 83, 91, 88, 93, 93, 94, 94, 94, 94, 16, 34, 53, 53, 62, 
-  59, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 62, 59, 
-  64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 62, 59, 64, 
-  64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 62, 59, 64, 64, 
-  89, 86, 90, 90, 91, 91, 91, 91, 71, 71, 71, 71, 8, 24, 51, 51, 86, 
-  85, 87, 87, 88, 88, 88, 88, 68, 68, 68, 68, 28, 4, 48, 48, 90, 87, 
-  92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 12, 31, 90, 87, 92, 
-  92, 93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 31, 12}, {8, 28, 44, 44,
-   62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 76, 79, 24, 4, 41, 41, 59, 
-  59, 59, 59, 78, 78, 78, 78, 77, 77, 75, 76, 51, 48, 12, 31, 64, 64, 
-  64, 64, 83, 83, 83, 83, 82, 82, 77, 80, 51, 48, 31, 12, 64, 64, 64, 
-  64, 83, 83, 83, 83, 82, 82, 77, 80, 71, 68, 73, 73, 16, 34, 53, 53, 
-  84, 84, 84, 84, 83, 83, 78, 81, 71, 68, 73, 73, 34, 16, 53, 53, 84, 
-  84, 84, 84, 83, 83, 78, 81, 71, 68, 73, 73, 53, 53, 16, 34, 84, 84, 
-  84, 84, 83, 83, 78, 81, 71, 68, 73, 73, 53, 53, 34, 16, 84, 84, 84, 
-  84, 83, 83, 78, 81, 91, 88, 93, 93, 94, 94, 94, 94, 16, 34, 53, 53, 
-  64, 64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 64, 
-  64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 
-  59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 59, 
-  62, 90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 12, 31, 41, 44, 
-  90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 41, 44, 86, 
-  85, 87, 87, 88, 88, 88, 88, 68, 68, 68, 68, 48, 48, 4, 28, 89, 86, 
-  90, 90, 91, 91, 91, 91, 71, 71, 71, 71, 51, 51, 24, 8}, {8, 28, 44, 
-  44, 62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 79, 76, 24, 4, 41, 41, 
-  59, 59, 59, 59, 78, 78, 78, 78, 77, 77, 76, 75, 51, 48, 12, 31, 64, 
-  64, 64, 64, 83, 83, 83, 83, 82, 82, 80, 77, 51, 48, 31, 12, 64, 64, 
-  64, 64, 83, 83, 83, 83, 82, 82, 80, 77, 71, 68, 73, 73, 16, 34, 53, 
-  53, 84, 84, 84, 84, 83, 83, 81, 78, 71, 68, 73, 73, 34, 16, 53, 53, 
-  84, 84, 84, 84, 83, 83, 81, 78, 71, 68, 73, 73, 53, 53, 16, 34, 84, 
-  84, 84, 84, 83, 83, 81, 78, 71, 68, 73, 73, 53, 53, 34, 16, 84, 84, 
-  84, 84, 83, 83, 81, 78, 91, 88, 93, 93, 94, 94, 94, 94, 16, 34, 53, 
-  53, 64, 64, 62, 59, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 
-  64, 64, 62, 59, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 64, 
-  64, 62, 59, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 
-  62, 59, 90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 12, 31, 44, 
-  41, 90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 44, 41, 
-  89, 86, 90, 90, 91, 91, 91, 91, 71, 71, 71, 71, 51, 51, 8, 24, 86, 
-  85, 87, 87, 88, 88, 88, 88, 68, 68, 68, 68, 48, 48, 28, 4}, {2, 26, 
-  45, 46, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 22, 6, 46, 
-  49, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 38, 39, 2, 22, 
-  40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 39, 42, 26, 6, 43, 
-  43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 40, 43, 47, 50, 15, 33, 
-  52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 47, 50, 33, 15, 52, 
-  52, 53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 47, 50, 52, 52, 15, 33, 
-  53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 47, 50, 52, 52, 33, 15, 53, 
-  53, 53, 53, 53, 53, 53, 53, 41, 44, 48, 51, 53, 53, 53, 53, 19, 36, 
-  54, 54, 55, 55, 55, 55, 41, 44, 48, 51, 53, 53, 53, 53, 36, 19, 54, 
-  54, 55, 55, 55, 55, 41, 44, 48, 51, 53, 53, 53, 53, 54, 54, 19, 36, 
-  55, 55, 55, 55, 41, 44, 48, 51, 53, 53, 53, 53, 54, 54, 36, 19, 55, 
-  55, 55, 55, 41, 44, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 
-  54, 54, 41, 44, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 
-  54, 41, 44, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 
-  41, 44, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19}, {6,
-   22, 46, 49, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 26, 2, 
-  45, 46, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48, 39, 38, 2, 
-  22, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 42, 39, 26, 6, 
-  43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 43, 40, 47, 50, 15, 
-  33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 33, 15, 
-  52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 52, 52, 15, 
-  33, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 52, 52, 33, 15, 
-  53, 53, 53, 53, 53, 53, 53, 53, 44, 41, 48, 51, 53, 53, 53, 53, 19, 
-  36, 54, 54, 55, 55, 55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 36, 19, 
-  54, 54, 55, 55, 55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 54, 54, 19, 
-  36, 55, 55, 55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 54, 54, 36, 19, 
-  55, 55, 55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 19, 
-  36, 54, 54, 44, 41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 
-  54, 54, 44, 41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 
-  36, 44, 41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 
-  19}, {9, 10, 2, 6, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 
-  10, 9, 2, 6, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 2, 2, 
-  0, 1, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 1, 5, 7, 7, 7, 7, 8,
-   8, 8, 8, 8, 8, 8, 8, 11, 11, 3, 7, 13, 14, 15, 15, 16, 16, 16, 16, 
-  16, 16, 16, 16, 11, 11, 3, 7, 14, 13, 15, 15, 16, 16, 16, 16, 16, 
-  16, 16, 16, 11, 11, 3, 7, 15, 15, 13, 14, 16, 16, 16, 16, 16, 16, 
-  16, 16, 11, 11, 3, 7, 15, 15, 14, 13, 16, 16, 16, 16, 16, 16, 16, 
-  16, 12, 12, 4, 8, 16, 16, 16, 16, 17, 18, 19, 19, 20, 20, 20, 20, 
-  12, 12, 4, 8, 16, 16, 16, 16, 18, 17, 19, 19, 20, 20, 20, 20, 12, 
-  12, 4, 8, 16, 16, 16, 16, 19, 19, 17, 18, 20, 20, 20, 20, 12, 12, 4,
-   8, 16, 16, 16, 16, 19, 19, 18, 17, 20, 20, 20, 20, 12, 12, 4, 8, 
-  16, 16, 16, 16, 20, 20, 20, 20, 17, 18, 19, 19, 12, 12, 4, 8, 16, 
-  16, 16, 16, 20, 20, 20, 20, 18, 17, 19, 19, 12, 12, 4, 8, 16, 16, 
-  16, 16, 20, 20, 20, 20, 19, 19, 17, 18, 12, 12, 4, 8, 16, 16, 16, 
-  16, 20, 20, 20, 20, 19, 19, 18, 17}, {10, 29, 26, 22, 30, 30, 30, 
-  30, 31, 31, 31, 31, 31, 31, 31, 31, 29, 10, 26, 22, 30, 30, 30, 30, 
-  31, 31, 31, 31, 31, 31, 31, 31, 22, 22, 1, 21, 23, 23, 23, 23, 24, 
-  24, 24, 24, 24, 24, 24, 24, 26, 26, 25, 1, 27, 27, 27, 27, 28, 28, 
-  28, 28, 28, 28, 28, 28, 30, 30, 27, 23, 14, 32, 33, 33, 34, 34, 34, 
-  34, 34, 34, 34, 34, 30, 30, 27, 23, 32, 14, 33, 33, 34, 34, 34, 34, 
-  34, 34, 34, 34, 30, 30, 27, 23, 33, 33, 14, 32, 34, 34, 34, 34, 34, 
-  34, 34, 34, 30, 30, 27, 23, 33, 33, 32, 14, 34, 34, 34, 34, 34, 34, 
-  34, 34, 31, 31, 28, 24, 34, 34, 34, 34, 18, 35, 36, 36, 37, 37, 37, 
-  37, 31, 31, 28, 24, 34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 
-  31, 31, 28, 24, 34, 34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 31, 
-  31, 28, 24, 34, 34, 34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 31, 31, 
-  28, 24, 34, 34, 34, 34, 37, 37, 37, 37, 18, 35, 36, 36, 31, 31, 28, 
-  24, 34, 34, 34, 34, 37, 37, 37, 37, 35, 18, 36, 36, 31, 31, 28, 24, 
-  34, 34, 34, 34, 37, 37, 37, 37, 36, 36, 18, 35, 31, 31, 28, 24, 34, 
-  34, 34, 34, 37, 37, 37, 37, 36, 36, 35, 18}, {11, 30, 47, 50, 58, 
-  61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 58, 61, 
-  63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 40, 40, 3, 23, 56, 57, 58, 
-  58, 59, 59, 59, 59, 59, 59, 59, 59, 43, 43, 27, 7, 57, 60, 61, 61, 
-  62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 65, 66, 3, 27, 47, 47, 68, 
-  68, 68, 68, 68, 68, 68, 68, 70, 70, 66, 69, 23, 7, 50, 50, 71, 71, 
-  71, 71, 71, 71, 71, 71, 72, 72, 67, 70, 40, 43, 11, 30, 73, 73, 73, 
-  73, 73, 73, 73, 73, 72, 72, 67, 70, 40, 43, 30, 11, 73, 73, 73, 73, 
-  73, 73, 73, 73, 73, 73, 68, 71, 59, 62, 64, 64, 20, 37, 55, 55, 74, 
-  74, 74, 74, 73, 73, 68, 71, 59, 62, 64, 64, 37, 20, 55, 55, 74, 74, 
-  74, 74, 73, 73, 68, 71, 59, 62, 64, 64, 55, 55, 20, 37, 74, 74, 74, 
-  74, 73, 73, 68, 71, 59, 62, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 
-  73, 73, 68, 71, 59, 62, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 73, 
-  73, 68, 71, 59, 62, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 
-  68, 71, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 68, 
-  71, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 47, 
-  50, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 
-  61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 40, 40, 3, 23, 57, 
-  56, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 43, 43, 27, 7, 60, 57, 
-  61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 70, 70, 66, 69, 7, 23, 50, 
-  50, 71, 71, 71, 71, 71, 71, 71, 71, 67, 67, 65, 66, 27, 3, 47, 47, 
-  68, 68, 68, 68, 68, 68, 68, 68, 72, 72, 67, 70, 43, 40, 11, 30, 73, 
-  73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 43, 40, 30, 11, 73, 73, 
-  73, 73, 73, 73, 73, 73, 73, 73, 68, 71, 62, 59, 64, 64, 20, 37, 55, 
-  55, 74, 74, 74, 74, 73, 73, 68, 71, 62, 59, 64, 64, 37, 20, 55, 55, 
-  74, 74, 74, 74, 73, 73, 68, 71, 62, 59, 64, 64, 55, 55, 20, 37, 74, 
-  74, 74, 74, 73, 73, 68, 71, 62, 59, 64, 64, 55, 55, 37, 20, 74, 74, 
-  74, 74, 73, 73, 68, 71, 62, 59, 64, 64, 74, 74, 74, 74, 20, 37, 55, 
-  55, 73, 73, 68, 71, 62, 59, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 
-  73, 73, 68, 71, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 
-  73, 68, 71, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 
-  30, 47, 50, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 
-  47, 50, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 64, 64, 40, 40, 3, 
-  23, 58, 58, 56, 57, 59, 59, 59, 59, 59, 59, 59, 59, 43, 43, 27, 7, 
-  61, 61, 57, 60, 62, 62, 62, 62, 62, 62, 62, 62, 72, 72, 67, 70, 11, 
-  30, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 30, 11, 
-  40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 67, 67, 65, 66, 47, 47, 3, 
-  27, 68, 68, 68, 68, 68, 68, 68, 68, 70, 70, 66, 69, 50, 50, 23, 7, 
-  71, 71, 71, 71, 71, 71, 71, 71, 73, 73, 68, 71, 64, 64, 59, 62, 20, 
-  37, 55, 55, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 59, 62, 37, 20, 
-  55, 55, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 59, 62, 55, 55, 20, 
-  37, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 59, 62, 55, 55, 37, 20, 
-  74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 20, 
-  37, 55, 55, 73, 73, 68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 37, 20, 
-  55, 55, 73, 73, 68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 20, 
-  37, 73, 73, 68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 37, 
-  20}, {11, 30, 47, 50, 63, 63, 61, 58, 64, 64, 64, 64, 64, 64, 64, 
-  64, 30, 11, 47, 50, 63, 63, 61, 58, 64, 64, 64, 64, 64, 64, 64, 64, 
-  40, 40, 3, 23, 58, 58, 57, 56, 59, 59, 59, 59, 59, 59, 59, 59, 43, 
-  43, 27, 7, 61, 61, 60, 57, 62, 62, 62, 62, 62, 62, 62, 62, 72, 72, 
-  67, 70, 11, 30, 43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 
-  70, 30, 11, 43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 70, 70, 66, 69, 
-  50, 50, 7, 23, 71, 71, 71, 71, 71, 71, 71, 71, 67, 67, 65, 66, 47, 
-  47, 27, 3, 68, 68, 68, 68, 68, 68, 68, 68, 73, 73, 68, 71, 64, 64, 
-  62, 59, 20, 37, 55, 55, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 62, 
-  59, 37, 20, 55, 55, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 62, 59, 
-  55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 62, 59, 55, 
-  55, 37, 20, 74, 74, 74, 74, 73, 73, 68, 71, 64, 64, 62, 59, 74, 74, 
-  74, 74, 20, 37, 55, 55, 73, 73, 68, 71, 64, 64, 62, 59, 74, 74, 74, 
-  74, 37, 20, 55, 55, 73, 73, 68, 71, 64, 64, 62, 59, 74, 74, 74, 74, 
-  55, 55, 20, 37, 73, 73, 68, 71, 64, 64, 62, 59, 74, 74, 74, 74, 55, 
-  55, 37, 20}, {12, 31, 48, 51, 64, 64, 64, 64, 77, 80, 82, 82, 83, 
-  83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 64, 77, 80, 82, 82, 83, 83, 
-  83, 83, 41, 41, 4, 24, 59, 59, 59, 59, 75, 76, 77, 77, 78, 78, 78, 
-  78, 44, 44, 28, 8, 62, 62, 62, 62, 76, 79, 80, 80, 81, 81, 81, 81, 
-  73, 73, 68, 71, 16, 34, 53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 73, 
-  73, 68, 71, 34, 16, 53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 73, 73, 
-  68, 71, 53, 53, 16, 34, 78, 81, 83, 83, 84, 84, 84, 84, 73, 73, 68, 
-  71, 53, 53, 34, 16, 78, 81, 83, 83, 84, 84, 84, 84, 87, 87, 85, 86, 
-  88, 88, 88, 88, 4, 28, 48, 48, 68, 68, 68, 68, 90, 90, 86, 89, 91, 
-  91, 91, 91, 24, 8, 51, 51, 71, 71, 71, 71, 92, 92, 87, 90, 93, 93, 
-  93, 93, 41, 44, 12, 31, 73, 73, 73, 73, 92, 92, 87, 90, 93, 93, 93, 
-  93, 41, 44, 31, 12, 73, 73, 73, 73, 93, 93, 88, 91, 94, 94, 94, 94, 
-  59, 62, 64, 64, 16, 34, 53, 53, 93, 93, 88, 91, 94, 94, 94, 94, 59, 
-  62, 64, 64, 34, 16, 53, 53, 93, 93, 88, 91, 94, 94, 94, 94, 59, 62, 
-  64, 64, 53, 53, 16, 34, 93, 93, 88, 91, 94, 94, 94, 94, 59, 62, 64, 
-  64, 53, 53, 34, 16}, {12, 31, 48, 51, 64, 64, 64, 64, 80, 77, 82, 
-  82, 83, 83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 64, 80, 77, 82, 82, 
-  83, 83, 83, 83, 41, 41, 4, 24, 59, 59, 59, 59, 76, 75, 77, 77, 78, 
-  78, 78, 78, 44, 44, 28, 8, 62, 62, 62, 62, 79, 76, 80, 80, 81, 81, 
-  81, 81, 73, 73, 68, 71, 16, 34, 53, 53, 81, 78, 83, 83, 84, 84, 84, 
-  84, 73, 73, 68, 71, 34, 16, 53, 53, 81, 78, 83, 83, 84, 84, 84, 84, 
-  73, 73, 68, 71, 53, 53, 16, 34, 81, 78, 83, 83, 84, 84, 84, 84, 73, 
-  73, 68, 71, 53, 53, 34, 16, 81, 78, 83, 83, 84, 84, 84, 84, 90, 90, 
-  86, 89, 91, 91, 91, 91, 8, 24, 51, 51, 71, 71, 71, 71, 87, 87, 85, 
-  86, 88, 88, 88, 88, 28, 4, 48, 48, 68, 68, 68, 68, 92, 92, 87, 90, 
-  93, 93, 93, 93, 44, 41, 12, 31, 73, 73, 73, 73, 92, 92, 87, 90, 93, 
-  93, 93, 93, 44, 41, 31, 12, 73, 73, 73, 73, 93, 93, 88, 91, 94, 94, 
-  94, 94, 62, 59, 64, 64, 16, 34, 53, 53, 93, 93, 88, 91, 94, 94, 94, 
-  94, 62, 59, 64, 64, 34, 16, 53, 53, 93, 93, 88, 91, 94, 94, 94, 94, 
-  62, 59, 64, 64, 53, 53, 16, 34, 93, 93, 88, 91, 94, 94, 94, 94, 62, 
-  59, 64, 64, 53, 53, 34, 16}, {12, 31, 48, 51, 64, 64, 64, 64, 82, 
-  82, 77, 80, 83, 83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 64, 82, 82, 
-  77, 80, 83, 83, 83, 83, 41, 41, 4, 24, 59, 59, 59, 59, 77, 77, 75, 
-  76, 78, 78, 78, 78, 44, 44, 28, 8, 62, 62, 62, 62, 80, 80, 76, 79, 
-  81, 81, 81, 81, 73, 73, 68, 71, 16, 34, 53, 53, 83, 83, 78, 81, 84, 
-  84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 53, 83, 83, 78, 81, 84, 84, 
-  84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 83, 83, 78, 81, 84, 84, 84, 
-  84, 73, 73, 68, 71, 53, 53, 34, 16, 83, 83, 78, 81, 84, 84, 84, 84, 
-  92, 92, 87, 90, 93, 93, 93, 93, 12, 31, 41, 44, 73, 73, 73, 73, 92, 
-  92, 87, 90, 93, 93, 93, 93, 31, 12, 41, 44, 73, 73, 73, 73, 87, 87, 
-  85, 86, 88, 88, 88, 88, 48, 48, 4, 28, 68, 68, 68, 68, 90, 90, 86, 
-  89, 91, 91, 91, 91, 51, 51, 24, 8, 71, 71, 71, 71, 93, 93, 88, 91, 
-  94, 94, 94, 94, 64, 64, 59, 62, 16, 34, 53, 53, 93, 93, 88, 91, 94, 
-  94, 94, 94, 64, 64, 59, 62, 34, 16, 53, 53, 93, 93, 88, 91, 94, 94, 
-  94, 94, 64, 64, 59, 62, 53, 53, 16, 34, 93, 93, 88, 91, 94, 94, 94, 
-  94, 64, 64, 59, 62, 53, 53, 34, 16}, {12, 31, 48, 51, 64, 64, 64, 
-  64, 82, 82, 80, 77, 83, 83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 64, 
-  82, 82, 80, 77, 83, 83, 83, 83, 41, 41, 4, 24, 59, 59, 59, 59, 77, 
-  77, 76, 75, 78, 78, 78, 78, 44, 44, 28, 8, 62, 62, 62, 62, 80, 80, 
-  79, 76, 81, 81, 81, 81, 73, 73, 68, 71, 16, 34, 53, 53, 83, 83, 81, 
-  78, 84, 84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 53, 83, 83, 81, 78, 
-  84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 83, 83, 81, 78, 84, 
-  84, 84, 84, 73, 73, 68, 71, 53, 53, 34, 16, 83, 83, 81, 78, 84, 84, 
-  84, 84, 92, 92, 87, 90, 93, 93, 93, 93, 12, 31, 44, 41, 73, 73, 73, 
-  73, 92, 92, 87, 90, 93, 93, 93, 93, 31, 12, 44, 41, 73, 73, 73, 73, 
-  90, 90, 86, 89, 91, 91, 91, 91, 51, 51, 8, 24, 71, 71, 71, 71, 87, 
-  87, 85, 86, 88, 88, 88, 88, 48, 48, 28, 4, 68, 68, 68, 68, 93, 93, 
-  88, 91, 94, 94, 94, 94, 64, 64, 62, 59, 16, 34, 53, 53, 93, 93, 88, 
-  91, 94, 94, 94, 94, 64, 64, 62, 59, 34, 16, 53, 53, 93, 93, 88, 91, 
-  94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 16, 34, 93, 93, 88, 91, 94, 
-  94, 94, 94, 64, 64, 62, 59, 53, 53, 34, 16}, {12, 31, 48, 51, 64, 
-  64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 31, 12, 48, 51, 64, 64, 
-  64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 41, 41, 4, 24, 59, 59, 59, 
-  59, 78, 78, 78, 78, 75, 76, 77, 77, 44, 44, 28, 8, 62, 62, 62, 62, 
-  81, 81, 81, 81, 76, 79, 80, 80, 73, 73, 68, 71, 16, 34, 53, 53, 84, 
-  84, 84, 84, 78, 81, 83, 83, 73, 73, 68, 71, 34, 16, 53, 53, 84, 84, 
-  84, 84, 78, 81, 83, 83, 73, 73, 68, 71, 53, 53, 16, 34, 84, 84, 84, 
-  84, 78, 81, 83, 83, 73, 73, 68, 71, 53, 53, 34, 16, 84, 84, 84, 84, 
-  78, 81, 83, 83, 93, 93, 88, 91, 94, 94, 94, 94, 16, 34, 53, 53, 59, 
-  62, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 34, 16, 53, 53, 59, 62, 
-  64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 16, 34, 59, 62, 64, 
-  64, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 34, 16, 59, 62, 64, 64, 
-  87, 87, 85, 86, 88, 88, 88, 88, 68, 68, 68, 68, 4, 28, 48, 48, 90, 
-  90, 86, 89, 91, 91, 91, 91, 71, 71, 71, 71, 24, 8, 51, 51, 92, 92, 
-  87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 12, 31, 92, 92, 87, 
-  90, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 31, 12}, {12, 31, 48, 
-  51, 64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 82, 31, 12, 48, 51, 
-  64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 82, 41, 41, 4, 24, 59, 
-  59, 59, 59, 78, 78, 78, 78, 76, 75, 77, 77, 44, 44, 28, 8, 62, 62, 
-  62, 62, 81, 81, 81, 81, 79, 76, 80, 80, 73, 73, 68, 71, 16, 34, 53, 
-  53, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 68, 71, 34, 16, 53, 53, 
-  84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 68, 71, 53, 53, 16, 34, 84, 
-  84, 84, 84, 81, 78, 83, 83, 73, 73, 68, 71, 53, 53, 34, 16, 84, 84, 
-  84, 84, 81, 78, 83, 83, 93, 93, 88, 91, 94, 94, 94, 94, 16, 34, 53, 
-  53, 62, 59, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 34, 16, 53, 53, 
-  62, 59, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 16, 34, 62, 
-  59, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 34, 16, 62, 59, 
-  64, 64, 90, 90, 86, 89, 91, 91, 91, 91, 71, 71, 71, 71, 8, 24, 51, 
-  51, 87, 87, 85, 86, 88, 88, 88, 88, 68, 68, 68, 68, 28, 4, 48, 48, 
-  92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 12, 31, 92, 
-  92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 31, 12}, {12, 
-  31, 48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 77, 80, 31, 12, 
-  48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 77, 80, 41, 41, 4, 
-  24, 59, 59, 59, 59, 78, 78, 78, 78, 77, 77, 75, 76, 44, 44, 28, 8, 
-  62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 76, 79, 73, 73, 68, 71, 16, 
-  34, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 73, 73, 68, 71, 34, 16, 
-  53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 73, 73, 68, 71, 53, 53, 16, 
-  34, 84, 84, 84, 84, 83, 83, 78, 81, 73, 73, 68, 71, 53, 53, 34, 16, 
-  84, 84, 84, 84, 83, 83, 78, 81, 93, 93, 88, 91, 94, 94, 94, 94, 16, 
-  34, 53, 53, 64, 64, 59, 62, 93, 93, 88, 91, 94, 94, 94, 94, 34, 16, 
-  53, 53, 64, 64, 59, 62, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 16, 
-  34, 64, 64, 59, 62, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 34, 16, 
-  64, 64, 59, 62, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 12, 
-  31, 41, 44, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 
-  41, 44, 87, 87, 85, 86, 88, 88, 88, 88, 68, 68, 68, 68, 48, 48, 4, 
-  28, 90, 90, 86, 89, 91, 91, 91, 91, 71, 71, 71, 71, 51, 51, 24, 
-  8}, {12, 31, 48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 80, 77,
-   31, 12, 48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 80, 77, 41,
-   41, 4, 24, 59, 59, 59, 59, 78, 78, 78, 78, 77, 77, 76, 75, 44, 44, 
-  28, 8, 62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 79, 76, 73, 73, 68, 
-  71, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 73, 73, 68, 71, 
-  34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 73, 73, 68, 71, 53, 
-  53, 16, 34, 84, 84, 84, 84, 83, 83, 81, 78, 73, 73, 68, 71, 53, 53, 
-  34, 16, 84, 84, 84, 84, 83, 83, 81, 78, 93, 93, 88, 91, 94, 94, 94, 
-  94, 16, 34, 53, 53, 64, 64, 62, 59, 93, 93, 88, 91, 94, 94, 94, 94, 
-  34, 16, 53, 53, 64, 64, 62, 59, 93, 93, 88, 91, 94, 94, 94, 94, 53, 
-  53, 16, 34, 64, 64, 62, 59, 93, 93, 88, 91, 94, 94, 94, 94, 53, 53, 
-  34, 16, 64, 64, 62, 59, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 
-  73, 12, 31, 44, 41, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 
-  31, 12, 44, 41, 90, 90, 86, 89, 91, 91, 91, 91, 71, 71, 71, 71, 51, 
-  51, 8, 24, 87, 87, 85, 86, 88, 88, 88, 88, 68, 68, 68, 68, 48, 48, 
-  28, 4}, {2, 26, 46, 45, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 
-  48, 22, 6, 49, 46, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 
-  39, 42, 6, 26, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 38, 
-  39, 22, 2, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 40, 43, 
-  50, 47, 15, 33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 50, 
-  47, 33, 15, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 50, 47, 
-  52, 52, 15, 33, 53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 50, 47, 52, 
-  52, 33, 15, 53, 53, 53, 53, 53, 53, 53, 53, 41, 44, 51, 48, 53, 53, 
-  53, 53, 19, 36, 54, 54, 55, 55, 55, 55, 41, 44, 51, 48, 53, 53, 53, 
-  53, 36, 19, 54, 54, 55, 55, 55, 55, 41, 44, 51, 48, 53, 53, 53, 53, 
-  54, 54, 19, 36, 55, 55, 55, 55, 41, 44, 51, 48, 53, 53, 53, 53, 54, 
-  54, 36, 19, 55, 55, 55, 55, 41, 44, 51, 48, 53, 53, 53, 53, 55, 55, 
-  55, 55, 19, 36, 54, 54, 41, 44, 51, 48, 53, 53, 53, 53, 55, 55, 55, 
-  55, 36, 19, 54, 54, 41, 44, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 
-  54, 54, 19, 36, 41, 44, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 54, 
-  54, 36, 19}, {6, 22, 49, 46, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51,
-   51, 51, 26, 2, 46, 45, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 
-  48, 42, 39, 6, 26, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44, 
-  39, 38, 22, 2, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 43, 
-  40, 50, 47, 15, 33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 
-  50, 47, 33, 15, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 
-  47, 52, 52, 15, 33, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 47, 
-  52, 52, 33, 15, 53, 53, 53, 53, 53, 53, 53, 53, 44, 41, 51, 48, 53, 
-  53, 53, 53, 19, 36, 54, 54, 55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 
-  53, 53, 36, 19, 54, 54, 55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 
-  53, 54, 54, 19, 36, 55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 
-  54, 54, 36, 19, 55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 55, 
-  55, 55, 55, 19, 36, 54, 54, 44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 
-  55, 55, 36, 19, 54, 54, 44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 
-  55, 54, 54, 19, 36, 44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 
-  54, 54, 36, 19}, {10, 29, 22, 26, 30, 30, 30, 30, 31, 31, 31, 31, 
-  31, 31, 31, 31, 29, 10, 22, 26, 30, 30, 30, 30, 31, 31, 31, 31, 31, 
-  31, 31, 31, 26, 26, 1, 25, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 
-  28, 28, 22, 22, 21, 1, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 
-  24, 30, 30, 23, 27, 14, 32, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 
-  30, 30, 23, 27, 32, 14, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 30, 
-  30, 23, 27, 33, 33, 14, 32, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 
-  23, 27, 33, 33, 32, 14, 34, 34, 34, 34, 34, 34, 34, 34, 31, 31, 24, 
-  28, 34, 34, 34, 34, 18, 35, 36, 36, 37, 37, 37, 37, 31, 31, 24, 28, 
-  34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 31, 31, 24, 28, 34, 
-  34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 
-  34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 34, 
-  34, 37, 37, 37, 37, 18, 35, 36, 36, 31, 31, 24, 28, 34, 34, 34, 34, 
-  37, 37, 37, 37, 35, 18, 36, 36, 31, 31, 24, 28, 34, 34, 34, 34, 37, 
-  37, 37, 37, 36, 36, 18, 35, 31, 31, 24, 28, 34, 34, 34, 34, 37, 37, 
-  37, 37, 36, 36, 35, 18}, {9, 10, 6, 2, 11, 11, 11, 11, 12, 12, 12, 
-  12, 12, 12, 12, 12, 10, 9, 6, 2, 11, 11, 11, 11, 12, 12, 12, 12, 12,
-   12, 12, 12, 6, 6, 5, 1, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 2, 2, 
-  1, 0, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 11, 11, 7, 3, 13, 14, 15, 
-  15, 16, 16, 16, 16, 16, 16, 16, 16, 11, 11, 7, 3, 14, 13, 15, 15, 
-  16, 16, 16, 16, 16, 16, 16, 16, 11, 11, 7, 3, 15, 15, 13, 14, 16, 
-  16, 16, 16, 16, 16, 16, 16, 11, 11, 7, 3, 15, 15, 14, 13, 16, 16, 
-  16, 16, 16, 16, 16, 16, 12, 12, 8, 4, 16, 16, 16, 16, 17, 18, 19, 
-  19, 20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 18, 17, 19, 19, 
-  20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 19, 19, 17, 18, 20, 
-  20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 19, 19, 18, 17, 20, 20, 
-  20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 17, 18, 19, 
-  19, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 18, 17, 19, 19, 
-  12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 17, 18, 12, 
-  12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 18, 17}, {11, 30, 
-  50, 47, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 50, 
-  47, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 43, 43, 7, 27, 
-  57, 60, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 40, 40, 23, 3, 56, 
-  57, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 67, 67, 66, 65, 3, 27, 
-  47, 47, 68, 68, 68, 68, 68, 68, 68, 68, 70, 70, 69, 66, 23, 7, 50, 
-  50, 71, 71, 71, 71, 71, 71, 71, 71, 72, 72, 70, 67, 40, 43, 11, 30, 
-  73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 40, 43, 30, 11, 73, 
-  73, 73, 73, 73, 73, 73, 73, 73, 73, 71, 68, 59, 62, 64, 64, 20, 37, 
-  55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 59, 62, 64, 64, 37, 20, 55, 
-  55, 74, 74, 74, 74, 73, 73, 71, 68, 59, 62, 64, 64, 55, 55, 20, 37, 
-  74, 74, 74, 74, 73, 73, 71, 68, 59, 62, 64, 64, 55, 55, 37, 20, 74, 
-  74, 74, 74, 73, 73, 71, 68, 59, 62, 64, 64, 74, 74, 74, 74, 20, 37, 
-  55, 55, 73, 73, 71, 68, 59, 62, 64, 64, 74, 74, 74, 74, 37, 20, 55, 
-  55, 73, 73, 71, 68, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 
-  73, 73, 71, 68, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 37, 
-  20}, {11, 30, 50, 47, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 
-  64, 30, 11, 50, 47, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 
-  43, 43, 7, 27, 60, 57, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 40, 
-  40, 23, 3, 57, 56, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 70, 70, 
-  69, 66, 7, 23, 50, 50, 71, 71, 71, 71, 71, 71, 71, 71, 67, 67, 66, 
-  65, 27, 3, 47, 47, 68, 68, 68, 68, 68, 68, 68, 68, 72, 72, 70, 67, 
-  43, 40, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 43, 
-  40, 30, 11, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 71, 68, 62, 59, 
-  64, 64, 20, 37, 55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 62, 59, 64, 
-  64, 37, 20, 55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 62, 59, 64, 64, 
-  55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 71, 68, 62, 59, 64, 64, 55, 
-  55, 37, 20, 74, 74, 74, 74, 73, 73, 71, 68, 62, 59, 64, 64, 74, 74, 
-  74, 74, 20, 37, 55, 55, 73, 73, 71, 68, 62, 59, 64, 64, 74, 74, 74, 
-  74, 37, 20, 55, 55, 73, 73, 71, 68, 62, 59, 64, 64, 74, 74, 74, 74, 
-  55, 55, 20, 37, 73, 73, 71, 68, 62, 59, 64, 64, 74, 74, 74, 74, 55, 
-  55, 37, 20}, {11, 30, 50, 47, 63, 63, 58, 61, 64, 64, 64, 64, 64, 
-  64, 64, 64, 30, 11, 50, 47, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 
-  64, 64, 43, 43, 7, 27, 61, 61, 57, 60, 62, 62, 62, 62, 62, 62, 62, 
-  62, 40, 40, 23, 3, 58, 58, 56, 57, 59, 59, 59, 59, 59, 59, 59, 59, 
-  72, 72, 70, 67, 11, 30, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 72, 
-  72, 70, 67, 30, 11, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 67, 67, 
-  66, 65, 47, 47, 3, 27, 68, 68, 68, 68, 68, 68, 68, 68, 70, 70, 69, 
-  66, 50, 50, 23, 7, 71, 71, 71, 71, 71, 71, 71, 71, 73, 73, 71, 68, 
-  64, 64, 59, 62, 20, 37, 55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 64, 
-  64, 59, 62, 37, 20, 55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 
-  59, 62, 55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 59, 
-  62, 55, 55, 37, 20, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 59, 62, 
-  74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 71, 68, 64, 64, 59, 62, 74, 
-  74, 74, 74, 37, 20, 55, 55, 73, 73, 71, 68, 64, 64, 59, 62, 74, 74, 
-  74, 74, 55, 55, 20, 37, 73, 73, 71, 68, 64, 64, 59, 62, 74, 74, 74, 
-  74, 55, 55, 37, 20}, {11, 30, 50, 47, 63, 63, 61, 58, 64, 64, 64, 
-  64, 64, 64, 64, 64, 30, 11, 50, 47, 63, 63, 61, 58, 64, 64, 64, 64, 
-  64, 64, 64, 64, 43, 43, 7, 27, 61, 61, 60, 57, 62, 62, 62, 62, 62, 
-  62, 62, 62, 40, 40, 23, 3, 58, 58, 57, 56, 59, 59, 59, 59, 59, 59, 
-  59, 59, 72, 72, 70, 67, 11, 30, 43, 40, 73, 73, 73, 73, 73, 73, 73, 
-  73, 72, 72, 70, 67, 30, 11, 43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 
-  70, 70, 69, 66, 50, 50, 7, 23, 71, 71, 71, 71, 71, 71, 71, 71, 67, 
-  67, 66, 65, 47, 47, 27, 3, 68, 68, 68, 68, 68, 68, 68, 68, 73, 73, 
-  71, 68, 64, 64, 62, 59, 20, 37, 55, 55, 74, 74, 74, 74, 73, 73, 71, 
-  68, 64, 64, 62, 59, 37, 20, 55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 
-  64, 64, 62, 59, 55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 71, 68, 64, 
-  64, 62, 59, 55, 55, 37, 20, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 
-  62, 59, 74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 71, 68, 64, 64, 62, 
-  59, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 71, 68, 64, 64, 62, 59, 
-  74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 71, 68, 64, 64, 62, 59, 74, 
-  74, 74, 74, 55, 55, 37, 20}, {12, 31, 51, 48, 64, 64, 64, 64, 77, 
-  80, 82, 82, 83, 83, 83, 83, 31, 12, 51, 48, 64, 64, 64, 64, 77, 80, 
-  82, 82, 83, 83, 83, 83, 44, 44, 8, 28, 62, 62, 62, 62, 76, 79, 80, 
-  80, 81, 81, 81, 81, 41, 41, 24, 4, 59, 59, 59, 59, 75, 76, 77, 77, 
-  78, 78, 78, 78, 73, 73, 71, 68, 16, 34, 53, 53, 78, 81, 83, 83, 84, 
-  84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 78, 81, 83, 83, 84, 84, 
-  84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 78, 81, 83, 83, 84, 84, 84, 
-  84, 73, 73, 71, 68, 53, 53, 34, 16, 78, 81, 83, 83, 84, 84, 84, 84, 
-  87, 87, 86, 85, 88, 88, 88, 88, 4, 28, 48, 48, 68, 68, 68, 68, 90, 
-  90, 89, 86, 91, 91, 91, 91, 24, 8, 51, 51, 71, 71, 71, 71, 92, 92, 
-  90, 87, 93, 93, 93, 93, 41, 44, 12, 31, 73, 73, 73, 73, 92, 92, 90, 
-  87, 93, 93, 93, 93, 41, 44, 31, 12, 73, 73, 73, 73, 93, 93, 91, 88, 
-  94, 94, 94, 94, 59, 62, 64, 64, 16, 34, 53, 53, 93, 93, 91, 88, 94, 
-  94, 94, 94, 59, 62, 64, 64, 34, 16, 53, 53, 93, 93, 91, 88, 94, 94, 
-  94, 94, 59, 62, 64, 64, 53, 53, 16, 34, 93, 93, 91, 88, 94, 94, 94, 
-  94, 59, 62, 64, 64, 53, 53, 34, 16}, {12, 31, 51, 48, 64, 64, 64, 
-  64, 80, 77, 82, 82, 83, 83, 83, 83, 31, 12, 51, 48, 64, 64, 64, 64, 
-  80, 77, 82, 82, 83, 83, 83, 83, 44, 44, 8, 28, 62, 62, 62, 62, 79, 
-  76, 80, 80, 81, 81, 81, 81, 41, 41, 24, 4, 59, 59, 59, 59, 76, 75, 
-  77, 77, 78, 78, 78, 78, 73, 73, 71, 68, 16, 34, 53, 53, 81, 78, 83, 
-  83, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 81, 78, 83, 83, 
-  84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 81, 78, 83, 83, 84, 
-  84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 16, 81, 78, 83, 83, 84, 84, 
-  84, 84, 90, 90, 89, 86, 91, 91, 91, 91, 8, 24, 51, 51, 71, 71, 71, 
-  71, 87, 87, 86, 85, 88, 88, 88, 88, 28, 4, 48, 48, 68, 68, 68, 68, 
-  92, 92, 90, 87, 93, 93, 93, 93, 44, 41, 12, 31, 73, 73, 73, 73, 92, 
-  92, 90, 87, 93, 93, 93, 93, 44, 41, 31, 12, 73, 73, 73, 73, 93, 93, 
-  91, 88, 94, 94, 94, 94, 62, 59, 64, 64, 16, 34, 53, 53, 93, 93, 91, 
-  88, 94, 94, 94, 94, 62, 59, 64, 64, 34, 16, 53, 53, 93, 93, 91, 88, 
-  94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 16, 34, 93, 93, 91, 88, 94, 
-  94, 94, 94, 62, 59, 64, 64, 53, 53, 34, 16}, {12, 31, 51, 48, 64, 
-  64, 64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 31, 12, 51, 48, 64, 64, 
-  64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 44, 44, 8, 28, 62, 62, 62, 
-  62, 80, 80, 76, 79, 81, 81, 81, 81, 41, 41, 24, 4, 59, 59, 59, 59, 
-  77, 77, 75, 76, 78, 78, 78, 78, 73, 73, 71, 68, 16, 34, 53, 53, 83, 
-  83, 78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 83, 83, 
-  78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 83, 83, 78, 
-  81, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 16, 83, 83, 78, 81, 
-  84, 84, 84, 84, 92, 92, 90, 87, 93, 93, 93, 93, 12, 31, 41, 44, 73, 
-  73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 31, 12, 41, 44, 73, 73, 
-  73, 73, 87, 87, 86, 85, 88, 88, 88, 88, 48, 48, 4, 28, 68, 68, 68, 
-  68, 90, 90, 89, 86, 91, 91, 91, 91, 51, 51, 24, 8, 71, 71, 71, 71, 
-  93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 16, 34, 53, 53, 93, 
-  93, 91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 34, 16, 53, 53, 93, 93, 
-  91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 16, 34, 93, 93, 91, 
-  88, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 34, 16}, {12, 31, 51, 
-  48, 64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 83, 31, 12, 51, 48, 
-  64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 83, 44, 44, 8, 28, 62, 
-  62, 62, 62, 80, 80, 79, 76, 81, 81, 81, 81, 41, 41, 24, 4, 59, 59, 
-  59, 59, 77, 77, 76, 75, 78, 78, 78, 78, 73, 73, 71, 68, 16, 34, 53, 
-  53, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 
-  83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 83, 
-  83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 16, 83, 83, 
-  81, 78, 84, 84, 84, 84, 92, 92, 90, 87, 93, 93, 93, 93, 12, 31, 44, 
-  41, 73, 73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 31, 12, 44, 41, 
-  73, 73, 73, 73, 90, 90, 89, 86, 91, 91, 91, 91, 51, 51, 8, 24, 71, 
-  71, 71, 71, 87, 87, 86, 85, 88, 88, 88, 88, 48, 48, 28, 4, 68, 68, 
-  68, 68, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 16, 34, 53, 
-  53, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 34, 16, 53, 53, 
-  93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 16, 34, 93, 
-  93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 34, 16}, {12, 
-  31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 31, 12, 
-  51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 44, 44, 8, 
-  28, 62, 62, 62, 62, 81, 81, 81, 81, 76, 79, 80, 80, 41, 41, 24, 4, 
-  59, 59, 59, 59, 78, 78, 78, 78, 75, 76, 77, 77, 73, 73, 71, 68, 16, 
-  34, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 71, 68, 34, 16, 
-  53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 71, 68, 53, 53, 16, 
-  34, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 71, 68, 53, 53, 34, 16, 
-  84, 84, 84, 84, 78, 81, 83, 83, 93, 93, 91, 88, 94, 94, 94, 94, 16, 
-  34, 53, 53, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 34, 16, 
-  53, 53, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 53, 53, 16, 
-  34, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 53, 53, 34, 16, 
-  59, 62, 64, 64, 87, 87, 86, 85, 88, 88, 88, 88, 68, 68, 68, 68, 4, 
-  28, 48, 48, 90, 90, 89, 86, 91, 91, 91, 91, 71, 71, 71, 71, 24, 8, 
-  51, 51, 92, 92, 90, 87, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 12, 
-  31, 92, 92, 90, 87, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 31, 
-  12}, {12, 31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 
-  82, 31, 12, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 82, 
-  44, 44, 8, 28, 62, 62, 62, 62, 81, 81, 81, 81, 79, 76, 80, 80, 41, 
-  41, 24, 4, 59, 59, 59, 59, 78, 78, 78, 78, 76, 75, 77, 77, 73, 73, 
-  71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 71, 
-  68, 34, 16, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 71, 68, 
-  53, 53, 16, 34, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 71, 68, 53, 
-  53, 34, 16, 84, 84, 84, 84, 81, 78, 83, 83, 93, 93, 91, 88, 94, 94, 
-  94, 94, 16, 34, 53, 53, 62, 59, 64, 64, 93, 93, 91, 88, 94, 94, 94, 
-  94, 34, 16, 53, 53, 62, 59, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 
-  53, 53, 16, 34, 62, 59, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 53, 
-  53, 34, 16, 62, 59, 64, 64, 90, 90, 89, 86, 91, 91, 91, 91, 71, 71, 
-  71, 71, 8, 24, 51, 51, 87, 87, 86, 85, 88, 88, 88, 88, 68, 68, 68, 
-  68, 28, 4, 48, 48, 92, 92, 90, 87, 93, 93, 93, 93, 73, 73, 73, 73, 
-  44, 41, 12, 31, 92, 92, 90, 87, 93, 93, 93, 93, 73, 73, 73, 73, 44, 
-  41, 31, 12}, {12, 31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 82, 
-  82, 77, 80, 31, 12, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 
-  77, 80, 44, 44, 8, 28, 62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 76, 
-  79, 41, 41, 24, 4, 59, 59, 59, 59, 78, 78, 78, 78, 77, 77, 75, 76, 
-  73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 73, 
-  73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 73, 73, 
-  71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 78, 81, 73, 73, 71, 
-  68, 53, 53, 34, 16, 84, 84, 84, 84, 83, 83, 78, 81, 93, 93, 91, 88, 
-  94, 94, 94, 94, 16, 34, 53, 53, 64, 64, 59, 62, 93, 93, 91, 88, 94, 
-  94, 94, 94, 34, 16, 53, 53, 64, 64, 59, 62, 93, 93, 91, 88, 94, 94, 
-  94, 94, 53, 53, 16, 34, 64, 64, 59, 62, 93, 93, 91, 88, 94, 94, 94, 
-  94, 53, 53, 34, 16, 64, 64, 59, 62, 92, 92, 90, 87, 93, 93, 93, 93, 
-  73, 73, 73, 73, 12, 31, 41, 44, 92, 92, 90, 87, 93, 93, 93, 93, 73, 
-  73, 73, 73, 31, 12, 41, 44, 87, 87, 86, 85, 88, 88, 88, 88, 68, 68, 
-  68, 68, 48, 48, 4, 28, 90, 90, 89, 86, 91, 91, 91, 91, 71, 71, 71, 
-  71, 51, 51, 24, 8}, {12, 31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83,
-   82, 82, 80, 77, 31, 12, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 82,
-   82, 80, 77, 44, 44, 8, 28, 62, 62, 62, 62, 81, 81, 81, 81, 80, 80, 
-  79, 76, 41, 41, 24, 4, 59, 59, 59, 59, 78, 78, 78, 78, 77, 77, 76, 
-  75, 73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 
-  73, 73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 73, 
-  73, 71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 81, 78, 73, 73, 
-  71, 68, 53, 53, 34, 16, 84, 84, 84, 84, 83, 83, 81, 78, 93, 93, 91, 
-  88, 94, 94, 94, 94, 16, 34, 53, 53, 64, 64, 62, 59, 93, 93, 91, 88, 
-  94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 62, 59, 93, 93, 91, 88, 94, 
-  94, 94, 94, 53, 53, 16, 34, 64, 64, 62, 59, 93, 93, 91, 88, 94, 94, 
-  94, 94, 53, 53, 34, 16, 64, 64, 62, 59, 92, 92, 90, 87, 93, 93, 93, 
-  93, 73, 73, 73, 73, 12, 31, 44, 41, 92, 92, 90, 87, 93, 93, 93, 93, 
-  73, 73, 73, 73, 31, 12, 44, 41, 90, 90, 89, 86, 91, 91, 91, 91, 71, 
-  71, 71, 71, 51, 51, 8, 24, 87, 87, 86, 85, 88, 88, 88, 88, 68, 68, 
-  68, 68, 48, 48, 28, 4}, {3, 27, 47, 47, 65, 66, 67, 67, 68, 68, 68, 
-  68, 68, 68, 68, 68, 23, 7, 50, 50, 66, 69, 70, 70, 71, 71, 71, 71, 
-  71, 71, 71, 71, 40, 43, 11, 30, 67, 70, 72, 72, 73, 73, 73, 73, 73, 
-  73, 73, 73, 40, 43, 30, 11, 67, 70, 72, 72, 73, 73, 73, 73, 73, 73, 
-  73, 73, 56, 57, 58, 58, 3, 23, 40, 40, 59, 59, 59, 59, 59, 59, 59, 
-  59, 57, 60, 61, 61, 27, 7, 43, 43, 62, 62, 62, 62, 62, 62, 62, 62, 
-  58, 61, 63, 63, 47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 58, 
-  61, 63, 63, 47, 50, 30, 11, 64, 64, 64, 64, 64, 64, 64, 64, 59, 62, 
-  64, 64, 68, 71, 73, 73, 20, 37, 55, 55, 74, 74, 74, 74, 59, 62, 64, 
-  64, 68, 71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 
-  68, 71, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 59, 62, 64, 64, 68, 
-  71, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 59, 62, 64, 64, 68, 71, 
-  73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 59, 62, 64, 64, 68, 71, 73, 
-  73, 74, 74, 74, 74, 37, 20, 55, 55, 59, 62, 64, 64, 68, 71, 73, 73, 
-  74, 74, 74, 74, 55, 55, 20, 37, 59, 62, 64, 64, 68, 71, 73, 73, 74, 
-  74, 74, 74, 55, 55, 37, 20}, {7, 23, 50, 50, 66, 69, 70, 70, 71, 71,
-   71, 71, 71, 71, 71, 71, 27, 3, 47, 47, 65, 66, 67, 67, 68, 68, 68, 
-  68, 68, 68, 68, 68, 43, 40, 11, 30, 67, 70, 72, 72, 73, 73, 73, 73, 
-  73, 73, 73, 73, 43, 40, 30, 11, 67, 70, 72, 72, 73, 73, 73, 73, 73, 
-  73, 73, 73, 57, 56, 58, 58, 3, 23, 40, 40, 59, 59, 59, 59, 59, 59, 
-  59, 59, 60, 57, 61, 61, 27, 7, 43, 43, 62, 62, 62, 62, 62, 62, 62, 
-  62, 61, 58, 63, 63, 47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 
-  61, 58, 63, 63, 47, 50, 30, 11, 64, 64, 64, 64, 64, 64, 64, 64, 62, 
-  59, 64, 64, 68, 71, 73, 73, 20, 37, 55, 55, 74, 74, 74, 74, 62, 59, 
-  64, 64, 68, 71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 62, 59, 64, 
-  64, 68, 71, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 62, 59, 64, 64, 
-  68, 71, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 62, 59, 64, 64, 68, 
-  71, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 62, 59, 64, 64, 68, 71, 
-  73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 62, 59, 64, 64, 68, 71, 73, 
-  73, 74, 74, 74, 74, 55, 55, 20, 37, 62, 59, 64, 64, 68, 71, 73, 73, 
-  74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 40, 43, 67, 70, 72, 72, 
-  73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 40, 43, 67, 70, 72, 72, 73, 
-  73, 73, 73, 73, 73, 73, 73, 47, 47, 3, 27, 65, 66, 67, 67, 68, 68, 
-  68, 68, 68, 68, 68, 68, 50, 50, 23, 7, 66, 69, 70, 70, 71, 71, 71, 
-  71, 71, 71, 71, 71, 58, 58, 56, 57, 3, 23, 40, 40, 59, 59, 59, 59, 
-  59, 59, 59, 59, 61, 61, 57, 60, 27, 7, 43, 43, 62, 62, 62, 62, 62, 
-  62, 62, 62, 63, 63, 58, 61, 47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 
-  64, 64, 63, 63, 58, 61, 47, 50, 30, 11, 64, 64, 64, 64, 64, 64, 64, 
-  64, 64, 64, 59, 62, 68, 71, 73, 73, 20, 37, 55, 55, 74, 74, 74, 74, 
-  64, 64, 59, 62, 68, 71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 64, 
-  64, 59, 62, 68, 71, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 
-  59, 62, 68, 71, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 59, 
-  62, 68, 71, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 59, 62, 
-  68, 71, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 59, 62, 68, 
-  71, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 59, 62, 68, 71, 
-  73, 73, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 43, 40, 67, 70, 
-  72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 43, 40, 67, 70, 72, 
-  72, 73, 73, 73, 73, 73, 73, 73, 73, 50, 50, 7, 23, 66, 69, 70, 70, 
-  71, 71, 71, 71, 71, 71, 71, 71, 47, 47, 27, 3, 65, 66, 67, 67, 68, 
-  68, 68, 68, 68, 68, 68, 68, 58, 58, 57, 56, 3, 23, 40, 40, 59, 59, 
-  59, 59, 59, 59, 59, 59, 61, 61, 60, 57, 27, 7, 43, 43, 62, 62, 62, 
-  62, 62, 62, 62, 62, 63, 63, 61, 58, 47, 50, 11, 30, 64, 64, 64, 64, 
-  64, 64, 64, 64, 63, 63, 61, 58, 47, 50, 30, 11, 64, 64, 64, 64, 64, 
-  64, 64, 64, 64, 64, 62, 59, 68, 71, 73, 73, 20, 37, 55, 55, 74, 74, 
-  74, 74, 64, 64, 62, 59, 68, 71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 
-  74, 64, 64, 62, 59, 68, 71, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 
-  64, 64, 62, 59, 68, 71, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 
-  64, 62, 59, 68, 71, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 
-  62, 59, 68, 71, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 62, 
-  59, 68, 71, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 62, 59, 
-  68, 71, 73, 73, 74, 74, 74, 74, 55, 55, 37, 20}, {13, 14, 15, 15, 3,
-   7, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 3, 7, 
-  11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 13, 14, 3, 7, 11, 
-  11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 14, 13, 3, 7, 11, 11, 
-  16, 16, 16, 16, 16, 16, 16, 16, 3, 3, 3, 3, 0, 1, 2, 2, 4, 4, 4, 4, 
-  4, 4, 4, 4, 7, 7, 7, 7, 1, 5, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8, 11, 11, 
-  11, 11, 2, 6, 9, 10, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11,
-   2, 6, 10, 9, 12, 12, 12, 12, 12, 12, 12, 12, 16, 16, 16, 16, 4, 8, 
-  12, 12, 17, 18, 19, 19, 20, 20, 20, 20, 16, 16, 16, 16, 4, 8, 12, 
-  12, 18, 17, 19, 19, 20, 20, 20, 20, 16, 16, 16, 16, 4, 8, 12, 12, 
-  19, 19, 17, 18, 20, 20, 20, 20, 16, 16, 16, 16, 4, 8, 12, 12, 19, 
-  19, 18, 17, 20, 20, 20, 20, 16, 16, 16, 16, 4, 8, 12, 12, 20, 20, 
-  20, 20, 17, 18, 19, 19, 16, 16, 16, 16, 4, 8, 12, 12, 20, 20, 20, 
-  20, 18, 17, 19, 19, 16, 16, 16, 16, 4, 8, 12, 12, 20, 20, 20, 20, 
-  19, 19, 17, 18, 16, 16, 16, 16, 4, 8, 12, 12, 20, 20, 20, 20, 19, 
-  19, 18, 17}, {14, 32, 33, 33, 27, 23, 30, 30, 34, 34, 34, 34, 34, 
-  34, 34, 34, 32, 14, 33, 33, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 
-  34, 34, 33, 33, 14, 32, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 34, 
-  34, 33, 33, 32, 14, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 
-  23, 23, 23, 23, 1, 21, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24, 27, 
-  27, 27, 27, 25, 1, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 
-  30, 30, 26, 22, 10, 29, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 
-  30, 26, 22, 29, 10, 31, 31, 31, 31, 31, 31, 31, 31, 34, 34, 34, 34, 
-  28, 24, 31, 31, 18, 35, 36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 28, 
-  24, 31, 31, 35, 18, 36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 
-  31, 31, 36, 36, 18, 35, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 
-  31, 36, 36, 35, 18, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 31, 
-  37, 37, 37, 37, 18, 35, 36, 36, 34, 34, 34, 34, 28, 24, 31, 31, 37, 
-  37, 37, 37, 35, 18, 36, 36, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 
-  37, 37, 36, 36, 18, 35, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 37, 
-  37, 36, 36, 35, 18}, {15, 33, 52, 52, 47, 50, 40, 43, 53, 53, 53, 
-  53, 53, 53, 53, 53, 33, 15, 52, 52, 47, 50, 40, 43, 53, 53, 53, 53, 
-  53, 53, 53, 53, 52, 52, 15, 33, 47, 50, 40, 43, 53, 53, 53, 53, 53, 
-  53, 53, 53, 52, 52, 33, 15, 47, 50, 40, 43, 53, 53, 53, 53, 53, 53, 
-  53, 53, 40, 40, 40, 40, 2, 22, 38, 39, 41, 41, 41, 41, 41, 41, 41, 
-  41, 43, 43, 43, 43, 26, 6, 39, 42, 44, 44, 44, 44, 44, 44, 44, 44, 
-  47, 47, 47, 47, 45, 46, 2, 26, 48, 48, 48, 48, 48, 48, 48, 48, 50, 
-  50, 50, 50, 46, 49, 22, 6, 51, 51, 51, 51, 51, 51, 51, 51, 53, 53, 
-  53, 53, 48, 51, 41, 44, 19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 
-  53, 48, 51, 41, 44, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 
-  48, 51, 41, 44, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 48, 
-  51, 41, 44, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 
-  41, 44, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 48, 51, 41, 
-  44, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 48, 51, 41, 44, 
-  55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 48, 51, 41, 44, 55, 
-  55, 55, 55, 54, 54, 36, 19}, {15, 33, 52, 52, 47, 50, 43, 40, 53, 
-  53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 47, 50, 43, 40, 53, 53, 
-  53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 47, 50, 43, 40, 53, 53, 53, 
-  53, 53, 53, 53, 53, 52, 52, 33, 15, 47, 50, 43, 40, 53, 53, 53, 53, 
-  53, 53, 53, 53, 40, 40, 40, 40, 2, 22, 39, 38, 41, 41, 41, 41, 41, 
-  41, 41, 41, 43, 43, 43, 43, 26, 6, 42, 39, 44, 44, 44, 44, 44, 44, 
-  44, 44, 50, 50, 50, 50, 46, 49, 6, 22, 51, 51, 51, 51, 51, 51, 51, 
-  51, 47, 47, 47, 47, 45, 46, 26, 2, 48, 48, 48, 48, 48, 48, 48, 48, 
-  53, 53, 53, 53, 48, 51, 44, 41, 19, 36, 54, 54, 55, 55, 55, 55, 53, 
-  53, 53, 53, 48, 51, 44, 41, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 
-  53, 53, 48, 51, 44, 41, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 
-  53, 48, 51, 44, 41, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 
-  48, 51, 44, 41, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 48, 
-  51, 44, 41, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 48, 51, 
-  44, 41, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 48, 51, 44, 
-  41, 55, 55, 55, 55, 54, 54, 36, 19}, {16, 34, 53, 53, 68, 71, 73, 
-  73, 78, 81, 83, 83, 84, 84, 84, 84, 34, 16, 53, 53, 68, 71, 73, 73, 
-  78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 68, 71, 73, 73, 78, 
-  81, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 68, 71, 73, 73, 78, 81, 
-  83, 83, 84, 84, 84, 84, 59, 59, 59, 59, 4, 24, 41, 41, 75, 76, 77, 
-  77, 78, 78, 78, 78, 62, 62, 62, 62, 28, 8, 44, 44, 76, 79, 80, 80, 
-  81, 81, 81, 81, 64, 64, 64, 64, 48, 51, 12, 31, 77, 80, 82, 82, 83, 
-  83, 83, 83, 64, 64, 64, 64, 48, 51, 31, 12, 77, 80, 82, 82, 83, 83, 
-  83, 83, 88, 88, 88, 88, 85, 86, 87, 87, 4, 28, 48, 48, 68, 68, 68, 
-  68, 91, 91, 91, 91, 86, 89, 90, 90, 24, 8, 51, 51, 71, 71, 71, 71, 
-  93, 93, 93, 93, 87, 90, 92, 92, 41, 44, 12, 31, 73, 73, 73, 73, 93, 
-  93, 93, 93, 87, 90, 92, 92, 41, 44, 31, 12, 73, 73, 73, 73, 94, 94, 
-  94, 94, 88, 91, 93, 93, 59, 62, 64, 64, 16, 34, 53, 53, 94, 94, 94, 
-  94, 88, 91, 93, 93, 59, 62, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 
-  88, 91, 93, 93, 59, 62, 64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 88, 
-  91, 93, 93, 59, 62, 64, 64, 53, 53, 34, 16}, {16, 34, 53, 53, 68, 
-  71, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 34, 16, 53, 53, 68, 71, 
-  73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 68, 71, 73, 
-  73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 68, 71, 73, 73, 
-  81, 78, 83, 83, 84, 84, 84, 84, 59, 59, 59, 59, 4, 24, 41, 41, 76, 
-  75, 77, 77, 78, 78, 78, 78, 62, 62, 62, 62, 28, 8, 44, 44, 79, 76, 
-  80, 80, 81, 81, 81, 81, 64, 64, 64, 64, 48, 51, 12, 31, 80, 77, 82, 
-  82, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 31, 12, 80, 77, 82, 82, 
-  83, 83, 83, 83, 91, 91, 91, 91, 86, 89, 90, 90, 8, 24, 51, 51, 71, 
-  71, 71, 71, 88, 88, 88, 88, 85, 86, 87, 87, 28, 4, 48, 48, 68, 68, 
-  68, 68, 93, 93, 93, 93, 87, 90, 92, 92, 44, 41, 12, 31, 73, 73, 73, 
-  73, 93, 93, 93, 93, 87, 90, 92, 92, 44, 41, 31, 12, 73, 73, 73, 73, 
-  94, 94, 94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 16, 34, 53, 53, 94, 
-  94, 94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 34, 16, 53, 53, 94, 94, 
-  94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 53, 53, 16, 34, 94, 94, 94, 
-  94, 88, 91, 93, 93, 62, 59, 64, 64, 53, 53, 34, 16}, {16, 34, 53, 
-  53, 68, 71, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 34, 16, 53, 53, 
-  68, 71, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 53, 53, 16, 34, 68, 
-  71, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 53, 53, 34, 16, 68, 71, 
-  73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 59, 59, 59, 59, 4, 24, 41, 
-  41, 77, 77, 75, 76, 78, 78, 78, 78, 62, 62, 62, 62, 28, 8, 44, 44, 
-  80, 80, 76, 79, 81, 81, 81, 81, 64, 64, 64, 64, 48, 51, 12, 31, 82, 
-  82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 31, 12, 82, 82, 
-  77, 80, 83, 83, 83, 83, 93, 93, 93, 93, 87, 90, 92, 92, 12, 31, 41, 
-  44, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 31, 12, 41, 44, 
-  73, 73, 73, 73, 88, 88, 88, 88, 85, 86, 87, 87, 48, 48, 4, 28, 68, 
-  68, 68, 68, 91, 91, 91, 91, 86, 89, 90, 90, 51, 51, 24, 8, 71, 71, 
-  71, 71, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 62, 16, 34, 53, 
-  53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 62, 34, 16, 53, 53, 
-  94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 62, 53, 53, 16, 34, 94, 
-  94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 62, 53, 53, 34, 16}, {16, 
-  34, 53, 53, 68, 71, 73, 73, 83, 83, 81, 78, 84, 84, 84, 84, 34, 16, 
-  53, 53, 68, 71, 73, 73, 83, 83, 81, 78, 84, 84, 84, 84, 53, 53, 16, 
-  34, 68, 71, 73, 73, 83, 83, 81, 78, 84, 84, 84, 84, 53, 53, 34, 16, 
-  68, 71, 73, 73, 83, 83, 81, 78, 84, 84, 84, 84, 59, 59, 59, 59, 4, 
-  24, 41, 41, 77, 77, 76, 75, 78, 78, 78, 78, 62, 62, 62, 62, 28, 8, 
-  44, 44, 80, 80, 79, 76, 81, 81, 81, 81, 64, 64, 64, 64, 48, 51, 12, 
-  31, 82, 82, 80, 77, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 31, 12, 
-  82, 82, 80, 77, 83, 83, 83, 83, 93, 93, 93, 93, 87, 90, 92, 92, 12, 
-  31, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 31, 12, 
-  44, 41, 73, 73, 73, 73, 91, 91, 91, 91, 86, 89, 90, 90, 51, 51, 8, 
-  24, 71, 71, 71, 71, 88, 88, 88, 88, 85, 86, 87, 87, 48, 48, 28, 4, 
-  68, 68, 68, 68, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 62, 59, 16, 
-  34, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 62, 59, 34, 16, 
-  53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 62, 59, 53, 53, 16, 
-  34, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 62, 59, 53, 53, 34, 
-  16}, {16, 34, 53, 53, 68, 71, 73, 73, 84, 84, 84, 84, 78, 81, 83, 
-  83, 34, 16, 53, 53, 68, 71, 73, 73, 84, 84, 84, 84, 78, 81, 83, 83, 
-  53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 84, 84, 78, 81, 83, 83, 53, 
-  53, 34, 16, 68, 71, 73, 73, 84, 84, 84, 84, 78, 81, 83, 83, 59, 59, 
-  59, 59, 4, 24, 41, 41, 78, 78, 78, 78, 75, 76, 77, 77, 62, 62, 62, 
-  62, 28, 8, 44, 44, 81, 81, 81, 81, 76, 79, 80, 80, 64, 64, 64, 64, 
-  48, 51, 12, 31, 83, 83, 83, 83, 77, 80, 82, 82, 64, 64, 64, 64, 48, 
-  51, 31, 12, 83, 83, 83, 83, 77, 80, 82, 82, 94, 94, 94, 94, 88, 91, 
-  93, 93, 16, 34, 53, 53, 59, 62, 64, 64, 94, 94, 94, 94, 88, 91, 93, 
-  93, 34, 16, 53, 53, 59, 62, 64, 64, 94, 94, 94, 94, 88, 91, 93, 93, 
-  53, 53, 16, 34, 59, 62, 64, 64, 94, 94, 94, 94, 88, 91, 93, 93, 53, 
-  53, 34, 16, 59, 62, 64, 64, 88, 88, 88, 88, 85, 86, 87, 87, 68, 68, 
-  68, 68, 4, 28, 48, 48, 91, 91, 91, 91, 86, 89, 90, 90, 71, 71, 71, 
-  71, 24, 8, 51, 51, 93, 93, 93, 93, 87, 90, 92, 92, 73, 73, 73, 73, 
-  41, 44, 12, 31, 93, 93, 93, 93, 87, 90, 92, 92, 73, 73, 73, 73, 41, 
-  44, 31, 12}, {16, 34, 53, 53, 68, 71, 73, 73, 84, 84, 84, 84, 81, 
-  78, 83, 83, 34, 16, 53, 53, 68, 71, 73, 73, 84, 84, 84, 84, 81, 78, 
-  83, 83, 53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 84, 84, 81, 78, 83, 
-  83, 53, 53, 34, 16, 68, 71, 73, 73, 84, 84, 84, 84, 81, 78, 83, 83, 
-  59, 59, 59, 59, 4, 24, 41, 41, 78, 78, 78, 78, 76, 75, 77, 77, 62, 
-  62, 62, 62, 28, 8, 44, 44, 81, 81, 81, 81, 79, 76, 80, 80, 64, 64, 
-  64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 
-  64, 48, 51, 31, 12, 83, 83, 83, 83, 80, 77, 82, 82, 94, 94, 94, 94, 
-  88, 91, 93, 93, 16, 34, 53, 53, 62, 59, 64, 64, 94, 94, 94, 94, 88, 
-  91, 93, 93, 34, 16, 53, 53, 62, 59, 64, 64, 94, 94, 94, 94, 88, 91, 
-  93, 93, 53, 53, 16, 34, 62, 59, 64, 64, 94, 94, 94, 94, 88, 91, 93, 
-  93, 53, 53, 34, 16, 62, 59, 64, 64, 91, 91, 91, 91, 86, 89, 90, 90, 
-  71, 71, 71, 71, 8, 24, 51, 51, 88, 88, 88, 88, 85, 86, 87, 87, 68, 
-  68, 68, 68, 28, 4, 48, 48, 93, 93, 93, 93, 87, 90, 92, 92, 73, 73, 
-  73, 73, 44, 41, 12, 31, 93, 93, 93, 93, 87, 90, 92, 92, 73, 73, 73, 
-  73, 44, 41, 31, 12}, {16, 34, 53, 53, 68, 71, 73, 73, 84, 84, 84, 
-  84, 83, 83, 78, 81, 34, 16, 53, 53, 68, 71, 73, 73, 84, 84, 84, 84, 
-  83, 83, 78, 81, 53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 84, 84, 83, 
-  83, 78, 81, 53, 53, 34, 16, 68, 71, 73, 73, 84, 84, 84, 84, 83, 83, 
-  78, 81, 59, 59, 59, 59, 4, 24, 41, 41, 78, 78, 78, 78, 77, 77, 75, 
-  76, 62, 62, 62, 62, 28, 8, 44, 44, 81, 81, 81, 81, 80, 80, 76, 79, 
-  64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 82, 82, 77, 80, 64, 
-  64, 64, 64, 48, 51, 31, 12, 83, 83, 83, 83, 82, 82, 77, 80, 94, 94, 
-  94, 94, 88, 91, 93, 93, 16, 34, 53, 53, 64, 64, 59, 62, 94, 94, 94, 
-  94, 88, 91, 93, 93, 34, 16, 53, 53, 64, 64, 59, 62, 94, 94, 94, 94, 
-  88, 91, 93, 93, 53, 53, 16, 34, 64, 64, 59, 62, 94, 94, 94, 94, 88, 
-  91, 93, 93, 53, 53, 34, 16, 64, 64, 59, 62, 93, 93, 93, 93, 87, 90, 
-  92, 92, 73, 73, 73, 73, 12, 31, 41, 44, 93, 93, 93, 93, 87, 90, 92, 
-  92, 73, 73, 73, 73, 31, 12, 41, 44, 88, 88, 88, 88, 85, 86, 87, 87, 
-  68, 68, 68, 68, 48, 48, 4, 28, 91, 91, 91, 91, 86, 89, 90, 90, 71, 
-  71, 71, 71, 51, 51, 24, 8}, {16, 34, 53, 53, 68, 71, 73, 73, 84, 84,
-   84, 84, 83, 83, 81, 78, 34, 16, 53, 53, 68, 71, 73, 73, 84, 84, 84,
-   84, 83, 83, 81, 78, 53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 84, 84,
-   83, 83, 81, 78, 53, 53, 34, 16, 68, 71, 73, 73, 84, 84, 84, 84, 83,
-   83, 81, 78, 59, 59, 59, 59, 4, 24, 41, 41, 78, 78, 78, 78, 77, 77, 
-  76, 75, 62, 62, 62, 62, 28, 8, 44, 44, 81, 81, 81, 81, 80, 80, 79, 
-  76, 64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 82, 82, 80, 77, 
-  64, 64, 64, 64, 48, 51, 31, 12, 83, 83, 83, 83, 82, 82, 80, 77, 94, 
-  94, 94, 94, 88, 91, 93, 93, 16, 34, 53, 53, 64, 64, 62, 59, 94, 94, 
-  94, 94, 88, 91, 93, 93, 34, 16, 53, 53, 64, 64, 62, 59, 94, 94, 94, 
-  94, 88, 91, 93, 93, 53, 53, 16, 34, 64, 64, 62, 59, 94, 94, 94, 94, 
-  88, 91, 93, 93, 53, 53, 34, 16, 64, 64, 62, 59, 93, 93, 93, 93, 87, 
-  90, 92, 92, 73, 73, 73, 73, 12, 31, 44, 41, 93, 93, 93, 93, 87, 90, 
-  92, 92, 73, 73, 73, 73, 31, 12, 44, 41, 91, 91, 91, 91, 86, 89, 90, 
-  90, 71, 71, 71, 71, 51, 51, 8, 24, 88, 88, 88, 88, 85, 86, 87, 87, 
-  68, 68, 68, 68, 48, 48, 28, 4}, {3, 27, 47, 47, 66, 65, 67, 67, 68, 
-  68, 68, 68, 68, 68, 68, 68, 23, 7, 50, 50, 69, 66, 70, 70, 71, 71, 
-  71, 71, 71, 71, 71, 71, 40, 43, 11, 30, 70, 67, 72, 72, 73, 73, 73, 
-  73, 73, 73, 73, 73, 40, 43, 30, 11, 70, 67, 72, 72, 73, 73, 73, 73, 
-  73, 73, 73, 73, 57, 60, 61, 61, 7, 27, 43, 43, 62, 62, 62, 62, 62, 
-  62, 62, 62, 56, 57, 58, 58, 23, 3, 40, 40, 59, 59, 59, 59, 59, 59, 
-  59, 59, 58, 61, 63, 63, 50, 47, 11, 30, 64, 64, 64, 64, 64, 64, 64, 
-  64, 58, 61, 63, 63, 50, 47, 30, 11, 64, 64, 64, 64, 64, 64, 64, 64, 
-  59, 62, 64, 64, 71, 68, 73, 73, 20, 37, 55, 55, 74, 74, 74, 74, 59, 
-  62, 64, 64, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 59, 62, 
-  64, 64, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 59, 62, 64, 
-  64, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 59, 62, 64, 64, 
-  71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 59, 62, 64, 64, 71, 
-  68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 59, 62, 64, 64, 71, 68, 
-  73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 59, 62, 64, 64, 71, 68, 73, 
-  73, 74, 74, 74, 74, 55, 55, 37, 20}, {7, 23, 50, 50, 69, 66, 70, 70,
-   71, 71, 71, 71, 71, 71, 71, 71, 27, 3, 47, 47, 66, 65, 67, 67, 68, 
-  68, 68, 68, 68, 68, 68, 68, 43, 40, 11, 30, 70, 67, 72, 72, 73, 73, 
-  73, 73, 73, 73, 73, 73, 43, 40, 30, 11, 70, 67, 72, 72, 73, 73, 73, 
-  73, 73, 73, 73, 73, 60, 57, 61, 61, 7, 27, 43, 43, 62, 62, 62, 62, 
-  62, 62, 62, 62, 57, 56, 58, 58, 23, 3, 40, 40, 59, 59, 59, 59, 59, 
-  59, 59, 59, 61, 58, 63, 63, 50, 47, 11, 30, 64, 64, 64, 64, 64, 64, 
-  64, 64, 61, 58, 63, 63, 50, 47, 30, 11, 64, 64, 64, 64, 64, 64, 64, 
-  64, 62, 59, 64, 64, 71, 68, 73, 73, 20, 37, 55, 55, 74, 74, 74, 74, 
-  62, 59, 64, 64, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 62, 
-  59, 64, 64, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 62, 59, 
-  64, 64, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 62, 59, 64, 
-  64, 71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 62, 59, 64, 64, 
-  71, 68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 62, 59, 64, 64, 71, 
-  68, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 62, 59, 64, 64, 71, 68, 
-  73, 73, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 40, 43, 70, 67, 
-  72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 40, 43, 70, 67, 72, 
-  72, 73, 73, 73, 73, 73, 73, 73, 73, 47, 47, 3, 27, 66, 65, 67, 67, 
-  68, 68, 68, 68, 68, 68, 68, 68, 50, 50, 23, 7, 69, 66, 70, 70, 71, 
-  71, 71, 71, 71, 71, 71, 71, 61, 61, 57, 60, 7, 27, 43, 43, 62, 62, 
-  62, 62, 62, 62, 62, 62, 58, 58, 56, 57, 23, 3, 40, 40, 59, 59, 59, 
-  59, 59, 59, 59, 59, 63, 63, 58, 61, 50, 47, 11, 30, 64, 64, 64, 64, 
-  64, 64, 64, 64, 63, 63, 58, 61, 50, 47, 30, 11, 64, 64, 64, 64, 64, 
-  64, 64, 64, 64, 64, 59, 62, 71, 68, 73, 73, 20, 37, 55, 55, 74, 74, 
-  74, 74, 64, 64, 59, 62, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 
-  74, 64, 64, 59, 62, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 
-  64, 64, 59, 62, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 
-  64, 59, 62, 71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 
-  59, 62, 71, 68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 59, 
-  62, 71, 68, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 59, 62, 
-  71, 68, 73, 73, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 43, 40, 
-  70, 67, 72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 43, 40, 70, 
-  67, 72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 50, 50, 7, 23, 69, 66, 
-  70, 70, 71, 71, 71, 71, 71, 71, 71, 71, 47, 47, 27, 3, 66, 65, 67, 
-  67, 68, 68, 68, 68, 68, 68, 68, 68, 61, 61, 60, 57, 7, 27, 43, 43, 
-  62, 62, 62, 62, 62, 62, 62, 62, 58, 58, 57, 56, 23, 3, 40, 40, 59, 
-  59, 59, 59, 59, 59, 59, 59, 63, 63, 61, 58, 50, 47, 11, 30, 64, 64, 
-  64, 64, 64, 64, 64, 64, 63, 63, 61, 58, 50, 47, 30, 11, 64, 64, 64, 
-  64, 64, 64, 64, 64, 64, 64, 62, 59, 71, 68, 73, 73, 20, 37, 55, 55, 
-  74, 74, 74, 74, 64, 64, 62, 59, 71, 68, 73, 73, 37, 20, 55, 55, 74, 
-  74, 74, 74, 64, 64, 62, 59, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 
-  74, 74, 64, 64, 62, 59, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 
-  74, 64, 64, 62, 59, 71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 
-  64, 64, 62, 59, 71, 68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 
-  64, 62, 59, 71, 68, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 
-  62, 59, 71, 68, 73, 73, 74, 74, 74, 74, 55, 55, 37, 20}, {14, 32, 
-  33, 33, 23, 27, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 
-  33, 23, 27, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 
-  23, 27, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 23, 
-  27, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 27, 27, 27, 27, 1, 25, 
-  26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 23, 23, 23, 23, 21, 1, 22, 
-  22, 24, 24, 24, 24, 24, 24, 24, 24, 30, 30, 30, 30, 22, 26, 10, 29, 
-  31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 22, 26, 29, 10, 31, 
-  31, 31, 31, 31, 31, 31, 31, 34, 34, 34, 34, 24, 28, 31, 31, 18, 35, 
-  36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 35, 18, 36, 
-  36, 37, 37, 37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 36, 36, 18, 35, 
-  37, 37, 37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 36, 36, 35, 18, 37, 
-  37, 37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 18, 35, 
-  36, 36, 34, 34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 35, 18, 36, 
-  36, 34, 34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 36, 36, 18, 35, 
-  34, 34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 36, 36, 35, 
-  18}, {13, 14, 15, 15, 7, 3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 
-  14, 13, 15, 15, 7, 3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 
-  15, 13, 14, 7, 3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 
-  14, 13, 7, 3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 7, 7, 7, 7, 5,
-   1, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8, 3, 3, 3, 3, 1, 0, 2, 2, 4, 4, 4, 
-  4, 4, 4, 4, 4, 11, 11, 11, 11, 6, 2, 9, 10, 12, 12, 12, 12, 12, 12, 
-  12, 12, 11, 11, 11, 11, 6, 2, 10, 9, 12, 12, 12, 12, 12, 12, 12, 12,
-   16, 16, 16, 16, 8, 4, 12, 12, 17, 18, 19, 19, 20, 20, 20, 20, 16, 
-  16, 16, 16, 8, 4, 12, 12, 18, 17, 19, 19, 20, 20, 20, 20, 16, 16, 
-  16, 16, 8, 4, 12, 12, 19, 19, 17, 18, 20, 20, 20, 20, 16, 16, 16, 
-  16, 8, 4, 12, 12, 19, 19, 18, 17, 20, 20, 20, 20, 16, 16, 16, 16, 8,
-   4, 12, 12, 20, 20, 20, 20, 17, 18, 19, 19, 16, 16, 16, 16, 8, 4, 
-  12, 12, 20, 20, 20, 20, 18, 17, 19, 19, 16, 16, 16, 16, 8, 4, 12, 
-  12, 20, 20, 20, 20, 19, 19, 17, 18, 16, 16, 16, 16, 8, 4, 12, 12, 
-  20, 20, 20, 20, 19, 19, 18, 17}, {15, 33, 52, 52, 50, 47, 40, 43, 
-  53, 53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 50, 47, 40, 43, 53, 
-  53, 53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 50, 47, 40, 43, 53, 53, 
-  53, 53, 53, 53, 53, 53, 52, 52, 33, 15, 50, 47, 40, 43, 53, 53, 53, 
-  53, 53, 53, 53, 53, 43, 43, 43, 43, 6, 26, 39, 42, 44, 44, 44, 44, 
-  44, 44, 44, 44, 40, 40, 40, 40, 22, 2, 38, 39, 41, 41, 41, 41, 41, 
-  41, 41, 41, 47, 47, 47, 47, 46, 45, 2, 26, 48, 48, 48, 48, 48, 48, 
-  48, 48, 50, 50, 50, 50, 49, 46, 22, 6, 51, 51, 51, 51, 51, 51, 51, 
-  51, 53, 53, 53, 53, 51, 48, 41, 44, 19, 36, 54, 54, 55, 55, 55, 55, 
-  53, 53, 53, 53, 51, 48, 41, 44, 36, 19, 54, 54, 55, 55, 55, 55, 53, 
-  53, 53, 53, 51, 48, 41, 44, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 
-  53, 53, 51, 48, 41, 44, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 
-  53, 51, 48, 41, 44, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 
-  51, 48, 41, 44, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 51, 
-  48, 41, 44, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 51, 48, 
-  41, 44, 55, 55, 55, 55, 54, 54, 36, 19}, {15, 33, 52, 52, 50, 47, 
-  43, 40, 53, 53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 50, 47, 43, 
-  40, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 50, 47, 43, 40, 
-  53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 33, 15, 50, 47, 43, 40, 53, 
-  53, 53, 53, 53, 53, 53, 53, 43, 43, 43, 43, 6, 26, 42, 39, 44, 44, 
-  44, 44, 44, 44, 44, 44, 40, 40, 40, 40, 22, 2, 39, 38, 41, 41, 41, 
-  41, 41, 41, 41, 41, 50, 50, 50, 50, 49, 46, 6, 22, 51, 51, 51, 51, 
-  51, 51, 51, 51, 47, 47, 47, 47, 46, 45, 26, 2, 48, 48, 48, 48, 48, 
-  48, 48, 48, 53, 53, 53, 53, 51, 48, 44, 41, 19, 36, 54, 54, 55, 55, 
-  55, 55, 53, 53, 53, 53, 51, 48, 44, 41, 36, 19, 54, 54, 55, 55, 55, 
-  55, 53, 53, 53, 53, 51, 48, 44, 41, 54, 54, 19, 36, 55, 55, 55, 55, 
-  53, 53, 53, 53, 51, 48, 44, 41, 54, 54, 36, 19, 55, 55, 55, 55, 53, 
-  53, 53, 53, 51, 48, 44, 41, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 
-  53, 53, 51, 48, 44, 41, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 
-  53, 51, 48, 44, 41, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 
-  51, 48, 44, 41, 55, 55, 55, 55, 54, 54, 36, 19}, {16, 34, 53, 53, 
-  71, 68, 73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 34, 16, 53, 53, 71, 
-  68, 73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 71, 68, 
-  73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 71, 68, 73, 
-  73, 78, 81, 83, 83, 84, 84, 84, 84, 62, 62, 62, 62, 8, 28, 44, 44, 
-  76, 79, 80, 80, 81, 81, 81, 81, 59, 59, 59, 59, 24, 4, 41, 41, 75, 
-  76, 77, 77, 78, 78, 78, 78, 64, 64, 64, 64, 51, 48, 12, 31, 77, 80, 
-  82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 51, 48, 31, 12, 77, 80, 82, 
-  82, 83, 83, 83, 83, 88, 88, 88, 88, 86, 85, 87, 87, 4, 28, 48, 48, 
-  68, 68, 68, 68, 91, 91, 91, 91, 89, 86, 90, 90, 24, 8, 51, 51, 71, 
-  71, 71, 71, 93, 93, 93, 93, 90, 87, 92, 92, 41, 44, 12, 31, 73, 73, 
-  73, 73, 93, 93, 93, 93, 90, 87, 92, 92, 41, 44, 31, 12, 73, 73, 73, 
-  73, 94, 94, 94, 94, 91, 88, 93, 93, 59, 62, 64, 64, 16, 34, 53, 53, 
-  94, 94, 94, 94, 91, 88, 93, 93, 59, 62, 64, 64, 34, 16, 53, 53, 94, 
-  94, 94, 94, 91, 88, 93, 93, 59, 62, 64, 64, 53, 53, 16, 34, 94, 94, 
-  94, 94, 91, 88, 93, 93, 59, 62, 64, 64, 53, 53, 34, 16}, {16, 34, 
-  53, 53, 71, 68, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 34, 16, 53, 
-  53, 71, 68, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 
-  71, 68, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 71, 
-  68, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 62, 62, 62, 62, 8, 28, 
-  44, 44, 79, 76, 80, 80, 81, 81, 81, 81, 59, 59, 59, 59, 24, 4, 41, 
-  41, 76, 75, 77, 77, 78, 78, 78, 78, 64, 64, 64, 64, 51, 48, 12, 31, 
-  80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 51, 48, 31, 12, 80, 
-  77, 82, 82, 83, 83, 83, 83, 91, 91, 91, 91, 89, 86, 90, 90, 8, 24, 
-  51, 51, 71, 71, 71, 71, 88, 88, 88, 88, 86, 85, 87, 87, 28, 4, 48, 
-  48, 68, 68, 68, 68, 93, 93, 93, 93, 90, 87, 92, 92, 44, 41, 12, 31, 
-  73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 92, 92, 44, 41, 31, 12, 73, 
-  73, 73, 73, 94, 94, 94, 94, 91, 88, 93, 93, 62, 59, 64, 64, 16, 34, 
-  53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 62, 59, 64, 64, 34, 16, 53, 
-  53, 94, 94, 94, 94, 91, 88, 93, 93, 62, 59, 64, 64, 53, 53, 16, 34, 
-  94, 94, 94, 94, 91, 88, 93, 93, 62, 59, 64, 64, 53, 53, 34, 
-  16}, {16, 34, 53, 53, 71, 68, 73, 73, 83, 83, 78, 81, 84, 84, 84, 
-  84, 34, 16, 53, 53, 71, 68, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 
-  53, 53, 16, 34, 71, 68, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 53, 
-  53, 34, 16, 71, 68, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 62, 62, 
-  62, 62, 8, 28, 44, 44, 80, 80, 76, 79, 81, 81, 81, 81, 59, 59, 59, 
-  59, 24, 4, 41, 41, 77, 77, 75, 76, 78, 78, 78, 78, 64, 64, 64, 64, 
-  51, 48, 12, 31, 82, 82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 64, 51, 
-  48, 31, 12, 82, 82, 77, 80, 83, 83, 83, 83, 93, 93, 93, 93, 90, 87, 
-  92, 92, 12, 31, 41, 44, 73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 92, 
-  92, 31, 12, 41, 44, 73, 73, 73, 73, 88, 88, 88, 88, 86, 85, 87, 87, 
-  48, 48, 4, 28, 68, 68, 68, 68, 91, 91, 91, 91, 89, 86, 90, 90, 51, 
-  51, 24, 8, 71, 71, 71, 71, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 
-  59, 62, 16, 34, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 59, 
-  62, 34, 16, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 59, 62, 
-  53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 59, 62, 53, 
-  53, 34, 16}, {16, 34, 53, 53, 71, 68, 73, 73, 83, 83, 81, 78, 84, 
-  84, 84, 84, 34, 16, 53, 53, 71, 68, 73, 73, 83, 83, 81, 78, 84, 84, 
-  84, 84, 53, 53, 16, 34, 71, 68, 73, 73, 83, 83, 81, 78, 84, 84, 84, 
-  84, 53, 53, 34, 16, 71, 68, 73, 73, 83, 83, 81, 78, 84, 84, 84, 84, 
-  62, 62, 62, 62, 8, 28, 44, 44, 80, 80, 79, 76, 81, 81, 81, 81, 59, 
-  59, 59, 59, 24, 4, 41, 41, 77, 77, 76, 75, 78, 78, 78, 78, 64, 64, 
-  64, 64, 51, 48, 12, 31, 82, 82, 80, 77, 83, 83, 83, 83, 64, 64, 64, 
-  64, 51, 48, 31, 12, 82, 82, 80, 77, 83, 83, 83, 83, 93, 93, 93, 93, 
-  90, 87, 92, 92, 12, 31, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 90, 
-  87, 92, 92, 31, 12, 44, 41, 73, 73, 73, 73, 91, 91, 91, 91, 89, 86, 
-  90, 90, 51, 51, 8, 24, 71, 71, 71, 71, 88, 88, 88, 88, 86, 85, 87, 
-  87, 48, 48, 28, 4, 68, 68, 68, 68, 94, 94, 94, 94, 91, 88, 93, 93, 
-  64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 64, 
-  64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 
-  62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 93, 93, 64, 64, 62, 
-  59, 53, 53, 34, 16}, {16, 34, 53, 53, 71, 68, 73, 73, 84, 84, 84, 
-  84, 78, 81, 83, 83, 34, 16, 53, 53, 71, 68, 73, 73, 84, 84, 84, 84, 
-  78, 81, 83, 83, 53, 53, 16, 34, 71, 68, 73, 73, 84, 84, 84, 84, 78, 
-  81, 83, 83, 53, 53, 34, 16, 71, 68, 73, 73, 84, 84, 84, 84, 78, 81, 
-  83, 83, 62, 62, 62, 62, 8, 28, 44, 44, 81, 81, 81, 81, 76, 79, 80, 
-  80, 59, 59, 59, 59, 24, 4, 41, 41, 78, 78, 78, 78, 75, 76, 77, 77, 
-  64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 83, 83, 77, 80, 82, 82, 64, 
-  64, 64, 64, 51, 48, 31, 12, 83, 83, 83, 83, 77, 80, 82, 82, 94, 94, 
-  94, 94, 91, 88, 93, 93, 16, 34, 53, 53, 59, 62, 64, 64, 94, 94, 94, 
-  94, 91, 88, 93, 93, 34, 16, 53, 53, 59, 62, 64, 64, 94, 94, 94, 94, 
-  91, 88, 93, 93, 53, 53, 16, 34, 59, 62, 64, 64, 94, 94, 94, 94, 91, 
-  88, 93, 93, 53, 53, 34, 16, 59, 62, 64, 64, 88, 88, 88, 88, 86, 85, 
-  87, 87, 68, 68, 68, 68, 4, 28, 48, 48, 91, 91, 91, 91, 89, 86, 90, 
-  90, 71, 71, 71, 71, 24, 8, 51, 51, 93, 93, 93, 93, 90, 87, 92, 92, 
-  73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 93, 90, 87, 92, 92, 73, 
-  73, 73, 73, 41, 44, 31, 12}, {16, 34, 53, 53, 71, 68, 73, 73, 84, 
-  84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 71, 68, 73, 73, 84, 84, 
-  84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 71, 68, 73, 73, 84, 84, 84, 
-  84, 81, 78, 83, 83, 53, 53, 34, 16, 71, 68, 73, 73, 84, 84, 84, 84, 
-  81, 78, 83, 83, 62, 62, 62, 62, 8, 28, 44, 44, 81, 81, 81, 81, 79, 
-  76, 80, 80, 59, 59, 59, 59, 24, 4, 41, 41, 78, 78, 78, 78, 76, 75, 
-  77, 77, 64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 83, 83, 80, 77, 82, 
-  82, 64, 64, 64, 64, 51, 48, 31, 12, 83, 83, 83, 83, 80, 77, 82, 82, 
-  94, 94, 94, 94, 91, 88, 93, 93, 16, 34, 53, 53, 62, 59, 64, 64, 94, 
-  94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 53, 62, 59, 64, 64, 94, 94, 
-  94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 62, 59, 64, 64, 94, 94, 94, 
-  94, 91, 88, 93, 93, 53, 53, 34, 16, 62, 59, 64, 64, 91, 91, 91, 91, 
-  89, 86, 90, 90, 71, 71, 71, 71, 8, 24, 51, 51, 88, 88, 88, 88, 86, 
-  85, 87, 87, 68, 68, 68, 68, 28, 4, 48, 48, 93, 93, 93, 93, 90, 87, 
-  92, 92, 73, 73, 73, 73, 44, 41, 12, 31, 93, 93, 93, 93, 90, 87, 92, 
-  92, 73, 73, 73, 73, 44, 41, 31, 12}, {16, 34, 53, 53, 71, 68, 73, 
-  73, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 53, 53, 71, 68, 73, 73, 
-  84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 34, 71, 68, 73, 73, 84, 
-  84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 71, 68, 73, 73, 84, 84, 
-  84, 84, 83, 83, 78, 81, 62, 62, 62, 62, 8, 28, 44, 44, 81, 81, 81, 
-  81, 80, 80, 76, 79, 59, 59, 59, 59, 24, 4, 41, 41, 78, 78, 78, 78, 
-  77, 77, 75, 76, 64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 83, 83, 82, 
-  82, 77, 80, 64, 64, 64, 64, 51, 48, 31, 12, 83, 83, 83, 83, 82, 82, 
-  77, 80, 94, 94, 94, 94, 91, 88, 93, 93, 16, 34, 53, 53, 64, 64, 59, 
-  62, 94, 94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 53, 64, 64, 59, 62, 
-  94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 64, 64, 59, 62, 94, 
-  94, 94, 94, 91, 88, 93, 93, 53, 53, 34, 16, 64, 64, 59, 62, 93, 93, 
-  93, 93, 90, 87, 92, 92, 73, 73, 73, 73, 12, 31, 41, 44, 93, 93, 93, 
-  93, 90, 87, 92, 92, 73, 73, 73, 73, 31, 12, 41, 44, 88, 88, 88, 88, 
-  86, 85, 87, 87, 68, 68, 68, 68, 48, 48, 4, 28, 91, 91, 91, 91, 89, 
-  86, 90, 90, 71, 71, 71, 71, 51, 51, 24, 8}, {16, 34, 53, 53, 71, 68,
-   73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 34, 16, 53, 53, 71, 68, 73,
-   73, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 16, 34, 71, 68, 73, 73,
-   84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 34, 16, 71, 68, 73, 73, 84,
-   84, 84, 84, 83, 83, 81, 78, 62, 62, 62, 62, 8, 28, 44, 44, 81, 81, 
-  81, 81, 80, 80, 79, 76, 59, 59, 59, 59, 24, 4, 41, 41, 78, 78, 78, 
-  78, 77, 77, 76, 75, 64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 83, 83, 
-  82, 82, 80, 77, 64, 64, 64, 64, 51, 48, 31, 12, 83, 83, 83, 83, 82, 
-  82, 80, 77, 94, 94, 94, 94, 91, 88, 93, 93, 16, 34, 53, 53, 64, 64, 
-  62, 59, 94, 94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 53, 64, 64, 62, 
-  59, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 64, 64, 62, 59, 
-  94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 34, 16, 64, 64, 62, 59, 93, 
-  93, 93, 93, 90, 87, 92, 92, 73, 73, 73, 73, 12, 31, 44, 41, 93, 93, 
-  93, 93, 90, 87, 92, 92, 73, 73, 73, 73, 31, 12, 44, 41, 91, 91, 91, 
-  91, 89, 86, 90, 90, 71, 71, 71, 71, 51, 51, 8, 24, 88, 88, 88, 88, 
-  86, 85, 87, 87, 68, 68, 68, 68, 48, 48, 28, 4}, {3, 27, 47, 47, 67, 
-  67, 65, 66, 68, 68, 68, 68, 68, 68, 68, 68, 23, 7, 50, 50, 70, 70, 
-  66, 69, 71, 71, 71, 71, 71, 71, 71, 71, 40, 43, 11, 30, 72, 72, 67, 
-  70, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 30, 11, 72, 72, 67, 70, 
-  73, 73, 73, 73, 73, 73, 73, 73, 58, 61, 63, 63, 11, 30, 47, 50, 64, 
-  64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 30, 11, 47, 50, 64, 64, 
-  64, 64, 64, 64, 64, 64, 56, 57, 58, 58, 40, 40, 3, 23, 59, 59, 59, 
-  59, 59, 59, 59, 59, 57, 60, 61, 61, 43, 43, 27, 7, 62, 62, 62, 62, 
-  62, 62, 62, 62, 59, 62, 64, 64, 73, 73, 68, 71, 20, 37, 55, 55, 74, 
-  74, 74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 37, 20, 55, 55, 74, 74, 
-  74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 55, 55, 20, 37, 74, 74, 74, 
-  74, 59, 62, 64, 64, 73, 73, 68, 71, 55, 55, 37, 20, 74, 74, 74, 74, 
-  59, 62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 20, 37, 55, 55, 59, 
-  62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 37, 20, 55, 55, 59, 62, 
-  64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 20, 37, 59, 62, 64, 
-  64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 37, 20}, {7, 23, 50, 50,
-   70, 70, 66, 69, 71, 71, 71, 71, 71, 71, 71, 71, 27, 3, 47, 47, 67, 
-  67, 65, 66, 68, 68, 68, 68, 68, 68, 68, 68, 43, 40, 11, 30, 72, 72, 
-  67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 43, 40, 30, 11, 72, 72, 67, 
-  70, 73, 73, 73, 73, 73, 73, 73, 73, 61, 58, 63, 63, 11, 30, 47, 50, 
-  64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 63, 30, 11, 47, 50, 64, 
-  64, 64, 64, 64, 64, 64, 64, 57, 56, 58, 58, 40, 40, 3, 23, 59, 59, 
-  59, 59, 59, 59, 59, 59, 60, 57, 61, 61, 43, 43, 27, 7, 62, 62, 62, 
-  62, 62, 62, 62, 62, 62, 59, 64, 64, 73, 73, 68, 71, 20, 37, 55, 55, 
-  74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 37, 20, 55, 55, 74, 
-  74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 55, 55, 20, 37, 74, 74, 
-  74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 55, 55, 37, 20, 74, 74, 74, 
-  74, 62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 20, 37, 55, 55, 
-  62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 37, 20, 55, 55, 62, 
-  59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 20, 37, 62, 59, 
-  64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 37, 20}, {11, 30, 
-  40, 43, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 40, 
-  43, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 47, 47, 3, 27, 
-  67, 67, 65, 66, 68, 68, 68, 68, 68, 68, 68, 68, 50, 50, 23, 7, 70, 
-  70, 66, 69, 71, 71, 71, 71, 71, 71, 71, 71, 63, 63, 58, 61, 11, 30, 
-  47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 58, 61, 30, 11, 47, 
-  50, 64, 64, 64, 64, 64, 64, 64, 64, 58, 58, 56, 57, 40, 40, 3, 23, 
-  59, 59, 59, 59, 59, 59, 59, 59, 61, 61, 57, 60, 43, 43, 27, 7, 62, 
-  62, 62, 62, 62, 62, 62, 62, 64, 64, 59, 62, 73, 73, 68, 71, 20, 37, 
-  55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 37, 20, 55, 
-  55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 55, 55, 20, 37, 
-  74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 55, 55, 37, 20, 74, 
-  74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74, 20, 37, 
-  55, 55, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74, 37, 20, 55, 
-  55, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 20, 37, 
-  64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 37, 
-  20}, {11, 30, 43, 40, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 
-  73, 30, 11, 43, 40, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 
-  50, 50, 7, 23, 70, 70, 66, 69, 71, 71, 71, 71, 71, 71, 71, 71, 47, 
-  47, 27, 3, 67, 67, 65, 66, 68, 68, 68, 68, 68, 68, 68, 68, 63, 63, 
-  61, 58, 11, 30, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 61, 
-  58, 30, 11, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 58, 58, 57, 56, 
-  40, 40, 3, 23, 59, 59, 59, 59, 59, 59, 59, 59, 61, 61, 60, 57, 43, 
-  43, 27, 7, 62, 62, 62, 62, 62, 62, 62, 62, 64, 64, 62, 59, 73, 73, 
-  68, 71, 20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 
-  71, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 71, 
-  55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 71, 55, 
-  55, 37, 20, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 
-  74, 74, 20, 37, 55, 55, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 74, 
-  74, 37, 20, 55, 55, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 74, 74, 
-  55, 55, 20, 37, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 74, 74, 55, 
-  55, 37, 20}, {15, 33, 52, 52, 40, 43, 47, 50, 53, 53, 53, 53, 53, 
-  53, 53, 53, 33, 15, 52, 52, 40, 43, 47, 50, 53, 53, 53, 53, 53, 53, 
-  53, 53, 52, 52, 15, 33, 40, 43, 47, 50, 53, 53, 53, 53, 53, 53, 53, 
-  53, 52, 52, 33, 15, 40, 43, 47, 50, 53, 53, 53, 53, 53, 53, 53, 53, 
-  47, 47, 47, 47, 2, 26, 45, 46, 48, 48, 48, 48, 48, 48, 48, 48, 50, 
-  50, 50, 50, 22, 6, 46, 49, 51, 51, 51, 51, 51, 51, 51, 51, 40, 40, 
-  40, 40, 38, 39, 2, 22, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 
-  43, 39, 42, 26, 6, 44, 44, 44, 44, 44, 44, 44, 44, 53, 53, 53, 53, 
-  41, 44, 48, 51, 19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 41, 
-  44, 48, 51, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44, 
-  48, 51, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44, 48, 
-  51, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44, 48, 51, 
-  55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 41, 44, 48, 51, 55, 
-  55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 41, 44, 48, 51, 55, 55, 
-  55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 41, 44, 48, 51, 55, 55, 55, 
-  55, 54, 54, 36, 19}, {15, 33, 52, 52, 43, 40, 47, 50, 53, 53, 53, 
-  53, 53, 53, 53, 53, 33, 15, 52, 52, 43, 40, 47, 50, 53, 53, 53, 53, 
-  53, 53, 53, 53, 52, 52, 15, 33, 43, 40, 47, 50, 53, 53, 53, 53, 53, 
-  53, 53, 53, 52, 52, 33, 15, 43, 40, 47, 50, 53, 53, 53, 53, 53, 53, 
-  53, 53, 50, 50, 50, 50, 6, 22, 46, 49, 51, 51, 51, 51, 51, 51, 51, 
-  51, 47, 47, 47, 47, 26, 2, 45, 46, 48, 48, 48, 48, 48, 48, 48, 48, 
-  40, 40, 40, 40, 39, 38, 2, 22, 41, 41, 41, 41, 41, 41, 41, 41, 43, 
-  43, 43, 43, 42, 39, 26, 6, 44, 44, 44, 44, 44, 44, 44, 44, 53, 53, 
-  53, 53, 44, 41, 48, 51, 19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 
-  53, 44, 41, 48, 51, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 
-  44, 41, 48, 51, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 44, 
-  41, 48, 51, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 44, 41, 
-  48, 51, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 44, 41, 48, 
-  51, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 44, 41, 48, 51, 
-  55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 44, 41, 48, 51, 55, 
-  55, 55, 55, 54, 54, 36, 19}, {13, 14, 15, 15, 11, 11, 3, 7, 16, 16, 
-  16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 11, 11, 3, 7, 16, 16, 16, 
-  16, 16, 16, 16, 16, 15, 15, 13, 14, 11, 11, 3, 7, 16, 16, 16, 16, 
-  16, 16, 16, 16, 15, 15, 14, 13, 11, 11, 3, 7, 16, 16, 16, 16, 16, 
-  16, 16, 16, 11, 11, 11, 11, 9, 10, 2, 6, 12, 12, 12, 12, 12, 12, 12,
-   12, 11, 11, 11, 11, 10, 9, 2, 6, 12, 12, 12, 12, 12, 12, 12, 12, 3,
-   3, 3, 3, 2, 2, 0, 1, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 6, 6, 1, 
-  5, 8, 8, 8, 8, 8, 8, 8, 8, 16, 16, 16, 16, 12, 12, 4, 8, 17, 18, 19,
-   19, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 4, 8, 18, 17, 19, 19, 
-  20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 4, 8, 19, 19, 17, 18, 20, 
-  20, 20, 20, 16, 16, 16, 16, 12, 12, 4, 8, 19, 19, 18, 17, 20, 20, 
-  20, 20, 16, 16, 16, 16, 12, 12, 4, 8, 20, 20, 20, 20, 17, 18, 19, 
-  19, 16, 16, 16, 16, 12, 12, 4, 8, 20, 20, 20, 20, 18, 17, 19, 19, 
-  16, 16, 16, 16, 12, 12, 4, 8, 20, 20, 20, 20, 19, 19, 17, 18, 16, 
-  16, 16, 16, 12, 12, 4, 8, 20, 20, 20, 20, 19, 19, 18, 17}, {14, 32, 
-  33, 33, 30, 30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 
-  33, 30, 30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 
-  30, 30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 30, 
-  30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 30, 30, 10, 29, 
-  26, 22, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 29, 10, 26, 
-  22, 31, 31, 31, 31, 31, 31, 31, 31, 23, 23, 23, 23, 22, 22, 1, 21, 
-  24, 24, 24, 24, 24, 24, 24, 24, 27, 27, 27, 27, 26, 26, 25, 1, 28, 
-  28, 28, 28, 28, 28, 28, 28, 34, 34, 34, 34, 31, 31, 28, 24, 18, 35, 
-  36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 35, 18, 36, 
-  36, 37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 36, 36, 18, 35, 
-  37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 36, 36, 35, 18, 37, 
-  37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 18, 35, 
-  36, 36, 34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 35, 18, 36, 
-  36, 34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 36, 36, 18, 35, 
-  34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 36, 36, 35, 
-  18}, {16, 34, 53, 53, 73, 73, 68, 71, 78, 81, 83, 83, 84, 84, 84, 
-  84, 34, 16, 53, 53, 73, 73, 68, 71, 78, 81, 83, 83, 84, 84, 84, 84, 
-  53, 53, 16, 34, 73, 73, 68, 71, 78, 81, 83, 83, 84, 84, 84, 84, 53, 
-  53, 34, 16, 73, 73, 68, 71, 78, 81, 83, 83, 84, 84, 84, 84, 64, 64, 
-  64, 64, 12, 31, 48, 51, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 
-  64, 31, 12, 48, 51, 77, 80, 82, 82, 83, 83, 83, 83, 59, 59, 59, 59, 
-  41, 41, 4, 24, 75, 76, 77, 77, 78, 78, 78, 78, 62, 62, 62, 62, 44, 
-  44, 28, 8, 76, 79, 80, 80, 81, 81, 81, 81, 88, 88, 88, 88, 87, 87, 
-  85, 86, 4, 28, 48, 48, 68, 68, 68, 68, 91, 91, 91, 91, 90, 90, 86, 
-  89, 24, 8, 51, 51, 71, 71, 71, 71, 93, 93, 93, 93, 92, 92, 87, 90, 
-  41, 44, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 87, 90, 41, 
-  44, 31, 12, 73, 73, 73, 73, 94, 94, 94, 94, 93, 93, 88, 91, 59, 62, 
-  64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 88, 91, 59, 62, 64, 
-  64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 88, 91, 59, 62, 64, 64, 
-  53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 88, 91, 59, 62, 64, 64, 53, 
-  53, 34, 16}, {16, 34, 53, 53, 73, 73, 68, 71, 81, 78, 83, 83, 84, 
-  84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 81, 78, 83, 83, 84, 84, 
-  84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 81, 78, 83, 83, 84, 84, 84, 
-  84, 53, 53, 34, 16, 73, 73, 68, 71, 81, 78, 83, 83, 84, 84, 84, 84, 
-  64, 64, 64, 64, 12, 31, 48, 51, 80, 77, 82, 82, 83, 83, 83, 83, 64, 
-  64, 64, 64, 31, 12, 48, 51, 80, 77, 82, 82, 83, 83, 83, 83, 59, 59, 
-  59, 59, 41, 41, 4, 24, 76, 75, 77, 77, 78, 78, 78, 78, 62, 62, 62, 
-  62, 44, 44, 28, 8, 79, 76, 80, 80, 81, 81, 81, 81, 91, 91, 91, 91, 
-  90, 90, 86, 89, 8, 24, 51, 51, 71, 71, 71, 71, 88, 88, 88, 88, 87, 
-  87, 85, 86, 28, 4, 48, 48, 68, 68, 68, 68, 93, 93, 93, 93, 92, 92, 
-  87, 90, 44, 41, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 87, 
-  90, 44, 41, 31, 12, 73, 73, 73, 73, 94, 94, 94, 94, 93, 93, 88, 91, 
-  62, 59, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 88, 91, 62, 
-  59, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 88, 91, 62, 59, 
-  64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 88, 91, 62, 59, 64, 
-  64, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 68, 71, 83, 83, 78, 
-  81, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 83, 83, 78, 81, 
-  84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 83, 83, 78, 81, 84, 
-  84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 83, 83, 78, 81, 84, 84, 
-  84, 84, 64, 64, 64, 64, 12, 31, 48, 51, 82, 82, 77, 80, 83, 83, 83, 
-  83, 64, 64, 64, 64, 31, 12, 48, 51, 82, 82, 77, 80, 83, 83, 83, 83, 
-  59, 59, 59, 59, 41, 41, 4, 24, 77, 77, 75, 76, 78, 78, 78, 78, 62, 
-  62, 62, 62, 44, 44, 28, 8, 80, 80, 76, 79, 81, 81, 81, 81, 93, 93, 
-  93, 93, 92, 92, 87, 90, 12, 31, 41, 44, 73, 73, 73, 73, 93, 93, 93, 
-  93, 92, 92, 87, 90, 31, 12, 41, 44, 73, 73, 73, 73, 88, 88, 88, 88, 
-  87, 87, 85, 86, 48, 48, 4, 28, 68, 68, 68, 68, 91, 91, 91, 91, 90, 
-  90, 86, 89, 51, 51, 24, 8, 71, 71, 71, 71, 94, 94, 94, 94, 93, 93, 
-  88, 91, 64, 64, 59, 62, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 88, 
-  91, 64, 64, 59, 62, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 88, 91, 
-  64, 64, 59, 62, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 88, 91, 64, 
-  64, 59, 62, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 68, 71, 83, 
-  83, 81, 78, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 83, 83, 
-  81, 78, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 83, 83, 81, 
-  78, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 83, 83, 81, 78, 
-  84, 84, 84, 84, 64, 64, 64, 64, 12, 31, 48, 51, 82, 82, 80, 77, 83, 
-  83, 83, 83, 64, 64, 64, 64, 31, 12, 48, 51, 82, 82, 80, 77, 83, 83, 
-  83, 83, 59, 59, 59, 59, 41, 41, 4, 24, 77, 77, 76, 75, 78, 78, 78, 
-  78, 62, 62, 62, 62, 44, 44, 28, 8, 80, 80, 79, 76, 81, 81, 81, 81, 
-  93, 93, 93, 93, 92, 92, 87, 90, 12, 31, 44, 41, 73, 73, 73, 73, 93, 
-  93, 93, 93, 92, 92, 87, 90, 31, 12, 44, 41, 73, 73, 73, 73, 91, 91, 
-  91, 91, 90, 90, 86, 89, 51, 51, 8, 24, 71, 71, 71, 71, 88, 88, 88, 
-  88, 87, 87, 85, 86, 48, 48, 28, 4, 68, 68, 68, 68, 94, 94, 94, 94, 
-  93, 93, 88, 91, 64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 94, 94, 93, 
-  93, 88, 91, 64, 64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 
-  88, 91, 64, 64, 62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 88, 
-  91, 64, 64, 62, 59, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 68, 
-  71, 84, 84, 84, 84, 78, 81, 83, 83, 34, 16, 53, 53, 73, 73, 68, 71, 
-  84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 16, 34, 73, 73, 68, 71, 84, 
-  84, 84, 84, 78, 81, 83, 83, 53, 53, 34, 16, 73, 73, 68, 71, 84, 84, 
-  84, 84, 78, 81, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 83, 83, 83, 
-  83, 77, 80, 82, 82, 64, 64, 64, 64, 31, 12, 48, 51, 83, 83, 83, 83, 
-  77, 80, 82, 82, 59, 59, 59, 59, 41, 41, 4, 24, 78, 78, 78, 78, 75, 
-  76, 77, 77, 62, 62, 62, 62, 44, 44, 28, 8, 81, 81, 81, 81, 76, 79, 
-  80, 80, 94, 94, 94, 94, 93, 93, 88, 91, 16, 34, 53, 53, 59, 62, 64, 
-  64, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53, 59, 62, 64, 64, 
-  94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 59, 62, 64, 64, 94, 
-  94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 59, 62, 64, 64, 88, 88, 
-  88, 88, 87, 87, 85, 86, 68, 68, 68, 68, 4, 28, 48, 48, 91, 91, 91, 
-  91, 90, 90, 86, 89, 71, 71, 71, 71, 24, 8, 51, 51, 93, 93, 93, 93, 
-  92, 92, 87, 90, 73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 93, 92, 
-  92, 87, 90, 73, 73, 73, 73, 41, 44, 31, 12}, {16, 34, 53, 53, 73, 
-  73, 68, 71, 84, 84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 73, 73, 
-  68, 71, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 73, 73, 68, 
-  71, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 34, 16, 73, 73, 68, 71, 
-  84, 84, 84, 84, 81, 78, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 83, 
-  83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 31, 12, 48, 51, 83, 83, 
-  83, 83, 80, 77, 82, 82, 59, 59, 59, 59, 41, 41, 4, 24, 78, 78, 78, 
-  78, 76, 75, 77, 77, 62, 62, 62, 62, 44, 44, 28, 8, 81, 81, 81, 81, 
-  79, 76, 80, 80, 94, 94, 94, 94, 93, 93, 88, 91, 16, 34, 53, 53, 62, 
-  59, 64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53, 62, 59, 
-  64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 62, 59, 64, 
-  64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 62, 59, 64, 64, 
-  91, 91, 91, 91, 90, 90, 86, 89, 71, 71, 71, 71, 8, 24, 51, 51, 88, 
-  88, 88, 88, 87, 87, 85, 86, 68, 68, 68, 68, 28, 4, 48, 48, 93, 93, 
-  93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 44, 41, 12, 31, 93, 93, 93, 
-  93, 92, 92, 87, 90, 73, 73, 73, 73, 44, 41, 31, 12}, {16, 34, 53, 
-  53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 53, 53, 
-  73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 34, 73, 
-  73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 73, 73, 
-  68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 64, 64, 64, 64, 12, 31, 48, 
-  51, 83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 31, 12, 48, 51, 
-  83, 83, 83, 83, 82, 82, 77, 80, 59, 59, 59, 59, 41, 41, 4, 24, 78, 
-  78, 78, 78, 77, 77, 75, 76, 62, 62, 62, 62, 44, 44, 28, 8, 81, 81, 
-  81, 81, 80, 80, 76, 79, 94, 94, 94, 94, 93, 93, 88, 91, 16, 34, 53, 
-  53, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53, 
-  64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 64, 
-  64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 64, 64, 
-  59, 62, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 12, 31, 41, 
-  44, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 31, 12, 41, 44, 
-  88, 88, 88, 88, 87, 87, 85, 86, 68, 68, 68, 68, 48, 48, 4, 28, 91, 
-  91, 91, 91, 90, 90, 86, 89, 71, 71, 71, 71, 51, 51, 24, 8}, {16, 34,
-   53, 53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 34, 16, 53,
-   53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 16, 34,
-   73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 34, 16, 73,
-   73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 64, 64, 64, 64, 12, 31,
-   48, 51, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 31, 12, 48,
-   51, 83, 83, 83, 83, 82, 82, 80, 77, 59, 59, 59, 59, 41, 41, 4, 24, 
-  78, 78, 78, 78, 77, 77, 76, 75, 62, 62, 62, 62, 44, 44, 28, 8, 81, 
-  81, 81, 81, 80, 80, 79, 76, 94, 94, 94, 94, 93, 93, 88, 91, 16, 34, 
-  53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 
-  53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 
-  64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 64, 
-  64, 62, 59, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 12, 31, 
-  44, 41, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 31, 12, 44, 
-  41, 91, 91, 91, 91, 90, 90, 86, 89, 71, 71, 71, 71, 51, 51, 8, 24, 
-  88, 88, 88, 88, 87, 87, 85, 86, 68, 68, 68, 68, 48, 48, 28, 4}, {3, 
-  27, 47, 47, 67, 67, 66, 65, 68, 68, 68, 68, 68, 68, 68, 68, 23, 7, 
-  50, 50, 70, 70, 69, 66, 71, 71, 71, 71, 71, 71, 71, 71, 40, 43, 11, 
-  30, 72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 30, 11, 
-  72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 73, 73, 58, 61, 63, 63, 11, 
-  30, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 30, 11, 
-  50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 57, 60, 61, 61, 43, 43, 7, 
-  27, 62, 62, 62, 62, 62, 62, 62, 62, 56, 57, 58, 58, 40, 40, 23, 3, 
-  59, 59, 59, 59, 59, 59, 59, 59, 59, 62, 64, 64, 73, 73, 71, 68, 20, 
-  37, 55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 71, 68, 37, 20, 
-  55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 71, 68, 55, 55, 20, 
-  37, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 71, 68, 55, 55, 37, 20, 
-  74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 20, 
-  37, 55, 55, 59, 62, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 37, 20, 
-  55, 55, 59, 62, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 55, 55, 20, 
-  37, 59, 62, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 55, 55, 37, 
-  20}, {7, 23, 50, 50, 70, 70, 69, 66, 71, 71, 71, 71, 71, 71, 71, 71,
-   27, 3, 47, 47, 67, 67, 66, 65, 68, 68, 68, 68, 68, 68, 68, 68, 43, 
-  40, 11, 30, 72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 73, 73, 43, 40, 
-  30, 11, 72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 73, 73, 61, 58, 63, 
-  63, 11, 30, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 63, 
-  30, 11, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 60, 57, 61, 61, 43, 
-  43, 7, 27, 62, 62, 62, 62, 62, 62, 62, 62, 57, 56, 58, 58, 40, 40, 
-  23, 3, 59, 59, 59, 59, 59, 59, 59, 59, 62, 59, 64, 64, 73, 73, 71, 
-  68, 20, 37, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 71, 68, 
-  37, 20, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 71, 68, 55, 
-  55, 20, 37, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 71, 68, 55, 55, 
-  37, 20, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 71, 68, 74, 74, 74, 
-  74, 20, 37, 55, 55, 62, 59, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 
-  37, 20, 55, 55, 62, 59, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 55, 
-  55, 20, 37, 62, 59, 64, 64, 73, 73, 71, 68, 74, 74, 74, 74, 55, 55, 
-  37, 20}, {11, 30, 40, 43, 72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 
-  73, 73, 30, 11, 40, 43, 72, 72, 70, 67, 73, 73, 73, 73, 73, 73, 73, 
-  73, 47, 47, 3, 27, 67, 67, 66, 65, 68, 68, 68, 68, 68, 68, 68, 68, 
-  50, 50, 23, 7, 70, 70, 69, 66, 71, 71, 71, 71, 71, 71, 71, 71, 63, 
-  63, 58, 61, 11, 30, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 
-  58, 61, 30, 11, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 61, 61, 57, 
-  60, 43, 43, 7, 27, 62, 62, 62, 62, 62, 62, 62, 62, 58, 58, 56, 57, 
-  40, 40, 23, 3, 59, 59, 59, 59, 59, 59, 59, 59, 64, 64, 59, 62, 73, 
-  73, 71, 68, 20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 
-  71, 68, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 71, 
-  68, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 71, 68, 
-  55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 71, 68, 74, 
-  74, 74, 74, 20, 37, 55, 55, 64, 64, 59, 62, 73, 73, 71, 68, 74, 74, 
-  74, 74, 37, 20, 55, 55, 64, 64, 59, 62, 73, 73, 71, 68, 74, 74, 74, 
-  74, 55, 55, 20, 37, 64, 64, 59, 62, 73, 73, 71, 68, 74, 74, 74, 74, 
-  55, 55, 37, 20}, {11, 30, 43, 40, 72, 72, 70, 67, 73, 73, 73, 73, 
-  73, 73, 73, 73, 30, 11, 43, 40, 72, 72, 70, 67, 73, 73, 73, 73, 73, 
-  73, 73, 73, 50, 50, 7, 23, 70, 70, 69, 66, 71, 71, 71, 71, 71, 71, 
-  71, 71, 47, 47, 27, 3, 67, 67, 66, 65, 68, 68, 68, 68, 68, 68, 68, 
-  68, 63, 63, 61, 58, 11, 30, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 
-  63, 63, 61, 58, 30, 11, 50, 47, 64, 64, 64, 64, 64, 64, 64, 64, 61, 
-  61, 60, 57, 43, 43, 7, 27, 62, 62, 62, 62, 62, 62, 62, 62, 58, 58, 
-  57, 56, 40, 40, 23, 3, 59, 59, 59, 59, 59, 59, 59, 59, 64, 64, 62, 
-  59, 73, 73, 71, 68, 20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 
-  73, 73, 71, 68, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 73, 
-  73, 71, 68, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 
-  71, 68, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 71, 
-  68, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 62, 59, 73, 73, 71, 68, 
-  74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 62, 59, 73, 73, 71, 68, 74, 
-  74, 74, 74, 55, 55, 20, 37, 64, 64, 62, 59, 73, 73, 71, 68, 74, 74, 
-  74, 74, 55, 55, 37, 20}, {15, 33, 52, 52, 40, 43, 50, 47, 53, 53, 
-  53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 40, 43, 50, 47, 53, 53, 53, 
-  53, 53, 53, 53, 53, 52, 52, 15, 33, 40, 43, 50, 47, 53, 53, 53, 53, 
-  53, 53, 53, 53, 52, 52, 33, 15, 40, 43, 50, 47, 53, 53, 53, 53, 53, 
-  53, 53, 53, 47, 47, 47, 47, 2, 26, 46, 45, 48, 48, 48, 48, 48, 48, 
-  48, 48, 50, 50, 50, 50, 22, 6, 49, 46, 51, 51, 51, 51, 51, 51, 51, 
-  51, 43, 43, 43, 43, 39, 42, 6, 26, 44, 44, 44, 44, 44, 44, 44, 44, 
-  40, 40, 40, 40, 38, 39, 22, 2, 41, 41, 41, 41, 41, 41, 41, 41, 53, 
-  53, 53, 53, 41, 44, 51, 48, 19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 
-  53, 53, 41, 44, 51, 48, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 
-  53, 41, 44, 51, 48, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 
-  41, 44, 51, 48, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 41, 
-  44, 51, 48, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 41, 44, 
-  51, 48, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 41, 44, 51, 
-  48, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 41, 44, 51, 48, 
-  55, 55, 55, 55, 54, 54, 36, 19}, {15, 33, 52, 52, 43, 40, 50, 47, 
-  53, 53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 43, 40, 50, 47, 53, 
-  53, 53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 43, 40, 50, 47, 53, 53, 
-  53, 53, 53, 53, 53, 53, 52, 52, 33, 15, 43, 40, 50, 47, 53, 53, 53, 
-  53, 53, 53, 53, 53, 50, 50, 50, 50, 6, 22, 49, 46, 51, 51, 51, 51, 
-  51, 51, 51, 51, 47, 47, 47, 47, 26, 2, 46, 45, 48, 48, 48, 48, 48, 
-  48, 48, 48, 43, 43, 43, 43, 42, 39, 6, 26, 44, 44, 44, 44, 44, 44, 
-  44, 44, 40, 40, 40, 40, 39, 38, 22, 2, 41, 41, 41, 41, 41, 41, 41, 
-  41, 53, 53, 53, 53, 44, 41, 51, 48, 19, 36, 54, 54, 55, 55, 55, 55, 
-  53, 53, 53, 53, 44, 41, 51, 48, 36, 19, 54, 54, 55, 55, 55, 55, 53, 
-  53, 53, 53, 44, 41, 51, 48, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 
-  53, 53, 44, 41, 51, 48, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 
-  53, 44, 41, 51, 48, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 
-  44, 41, 51, 48, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 44, 
-  41, 51, 48, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 44, 41, 
-  51, 48, 55, 55, 55, 55, 54, 54, 36, 19}, {14, 32, 33, 33, 30, 30, 
-  23, 27, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 33, 30, 30, 23, 
-  27, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 30, 30, 23, 27, 
-  34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 30, 30, 23, 27, 34, 
-  34, 34, 34, 34, 34, 34, 34, 30, 30, 30, 30, 10, 29, 22, 26, 31, 31, 
-  31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 29, 10, 22, 26, 31, 31, 31, 
-  31, 31, 31, 31, 31, 27, 27, 27, 27, 26, 26, 1, 25, 28, 28, 28, 28, 
-  28, 28, 28, 28, 23, 23, 23, 23, 22, 22, 21, 1, 24, 24, 24, 24, 24, 
-  24, 24, 24, 34, 34, 34, 34, 31, 31, 24, 28, 18, 35, 36, 36, 37, 37, 
-  37, 37, 34, 34, 34, 34, 31, 31, 24, 28, 35, 18, 36, 36, 37, 37, 37, 
-  37, 34, 34, 34, 34, 31, 31, 24, 28, 36, 36, 18, 35, 37, 37, 37, 37, 
-  34, 34, 34, 34, 31, 31, 24, 28, 36, 36, 35, 18, 37, 37, 37, 37, 34, 
-  34, 34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 18, 35, 36, 36, 34, 34, 
-  34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 35, 18, 36, 36, 34, 34, 34, 
-  34, 31, 31, 24, 28, 37, 37, 37, 37, 36, 36, 18, 35, 34, 34, 34, 34, 
-  31, 31, 24, 28, 37, 37, 37, 37, 36, 36, 35, 18}, {13, 14, 15, 15, 
-  11, 11, 7, 3, 16, 16, 16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 11, 
-  11, 7, 3, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 13, 14, 11, 11, 7,
-   3, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 14, 13, 11, 11, 7, 3, 
-  16, 16, 16, 16, 16, 16, 16, 16, 11, 11, 11, 11, 9, 10, 6, 2, 12, 12,
-   12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 10, 9, 6, 2, 12, 12, 12, 
-  12, 12, 12, 12, 12, 7, 7, 7, 7, 6, 6, 5, 1, 8, 8, 8, 8, 8, 8, 8, 8, 
-  3, 3, 3, 3, 2, 2, 1, 0, 4, 4, 4, 4, 4, 4, 4, 4, 16, 16, 16, 16, 12, 
-  12, 8, 4, 17, 18, 19, 19, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8,
-   4, 18, 17, 19, 19, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 
-  19, 19, 17, 18, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 19, 
-  19, 18, 17, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 
-  20, 20, 17, 18, 19, 19, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 
-  20, 18, 17, 19, 19, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 
-  19, 19, 17, 18, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 19, 
-  19, 18, 17}, {16, 34, 53, 53, 73, 73, 71, 68, 78, 81, 83, 83, 84, 
-  84, 84, 84, 34, 16, 53, 53, 73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 
-  84, 84, 53, 53, 16, 34, 73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 84, 
-  84, 53, 53, 34, 16, 73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 84, 84, 
-  64, 64, 64, 64, 12, 31, 51, 48, 77, 80, 82, 82, 83, 83, 83, 83, 64, 
-  64, 64, 64, 31, 12, 51, 48, 77, 80, 82, 82, 83, 83, 83, 83, 62, 62, 
-  62, 62, 44, 44, 8, 28, 76, 79, 80, 80, 81, 81, 81, 81, 59, 59, 59, 
-  59, 41, 41, 24, 4, 75, 76, 77, 77, 78, 78, 78, 78, 88, 88, 88, 88, 
-  87, 87, 86, 85, 4, 28, 48, 48, 68, 68, 68, 68, 91, 91, 91, 91, 90, 
-  90, 89, 86, 24, 8, 51, 51, 71, 71, 71, 71, 93, 93, 93, 93, 92, 92, 
-  90, 87, 41, 44, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 
-  87, 41, 44, 31, 12, 73, 73, 73, 73, 94, 94, 94, 94, 93, 93, 91, 88, 
-  59, 62, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 59, 
-  62, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 59, 62, 
-  64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 91, 88, 59, 62, 64, 
-  64, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 71, 68, 81, 78, 83, 
-  83, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 71, 68, 81, 78, 83, 83, 
-  84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 71, 68, 81, 78, 83, 83, 84, 
-  84, 84, 84, 53, 53, 34, 16, 73, 73, 71, 68, 81, 78, 83, 83, 84, 84, 
-  84, 84, 64, 64, 64, 64, 12, 31, 51, 48, 80, 77, 82, 82, 83, 83, 83, 
-  83, 64, 64, 64, 64, 31, 12, 51, 48, 80, 77, 82, 82, 83, 83, 83, 83, 
-  62, 62, 62, 62, 44, 44, 8, 28, 79, 76, 80, 80, 81, 81, 81, 81, 59, 
-  59, 59, 59, 41, 41, 24, 4, 76, 75, 77, 77, 78, 78, 78, 78, 91, 91, 
-  91, 91, 90, 90, 89, 86, 8, 24, 51, 51, 71, 71, 71, 71, 88, 88, 88, 
-  88, 87, 87, 86, 85, 28, 4, 48, 48, 68, 68, 68, 68, 93, 93, 93, 93, 
-  92, 92, 90, 87, 44, 41, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 92, 
-  92, 90, 87, 44, 41, 31, 12, 73, 73, 73, 73, 94, 94, 94, 94, 93, 93, 
-  91, 88, 62, 59, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 91, 
-  88, 62, 59, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 
-  62, 59, 64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 91, 88, 62, 
-  59, 64, 64, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 71, 68, 83, 
-  83, 78, 81, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 71, 68, 83, 83, 
-  78, 81, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 71, 68, 83, 83, 78, 
-  81, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 78, 81, 
-  84, 84, 84, 84, 64, 64, 64, 64, 12, 31, 51, 48, 82, 82, 77, 80, 83, 
-  83, 83, 83, 64, 64, 64, 64, 31, 12, 51, 48, 82, 82, 77, 80, 83, 83, 
-  83, 83, 62, 62, 62, 62, 44, 44, 8, 28, 80, 80, 76, 79, 81, 81, 81, 
-  81, 59, 59, 59, 59, 41, 41, 24, 4, 77, 77, 75, 76, 78, 78, 78, 78, 
-  93, 93, 93, 93, 92, 92, 90, 87, 12, 31, 41, 44, 73, 73, 73, 73, 93, 
-  93, 93, 93, 92, 92, 90, 87, 31, 12, 41, 44, 73, 73, 73, 73, 88, 88, 
-  88, 88, 87, 87, 86, 85, 48, 48, 4, 28, 68, 68, 68, 68, 91, 91, 91, 
-  91, 90, 90, 89, 86, 51, 51, 24, 8, 71, 71, 71, 71, 94, 94, 94, 94, 
-  93, 93, 91, 88, 64, 64, 59, 62, 16, 34, 53, 53, 94, 94, 94, 94, 93, 
-  93, 91, 88, 64, 64, 59, 62, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 
-  91, 88, 64, 64, 59, 62, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 91, 
-  88, 64, 64, 59, 62, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 73, 71, 
-  68, 83, 83, 81, 78, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 71, 68, 
-  83, 83, 81, 78, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 71, 68, 83, 
-  83, 81, 78, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 
-  81, 78, 84, 84, 84, 84, 64, 64, 64, 64, 12, 31, 51, 48, 82, 82, 80, 
-  77, 83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 51, 48, 82, 82, 80, 77, 
-  83, 83, 83, 83, 62, 62, 62, 62, 44, 44, 8, 28, 80, 80, 79, 76, 81, 
-  81, 81, 81, 59, 59, 59, 59, 41, 41, 24, 4, 77, 77, 76, 75, 78, 78, 
-  78, 78, 93, 93, 93, 93, 92, 92, 90, 87, 12, 31, 44, 41, 73, 73, 73, 
-  73, 93, 93, 93, 93, 92, 92, 90, 87, 31, 12, 44, 41, 73, 73, 73, 73, 
-  91, 91, 91, 91, 90, 90, 89, 86, 51, 51, 8, 24, 71, 71, 71, 71, 88, 
-  88, 88, 88, 87, 87, 86, 85, 48, 48, 28, 4, 68, 68, 68, 68, 94, 94, 
-  94, 94, 93, 93, 91, 88, 64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 94, 
-  94, 93, 93, 91, 88, 64, 64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 94, 
-  93, 93, 91, 88, 64, 64, 62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 93, 
-  93, 91, 88, 64, 64, 62, 59, 53, 53, 34, 16}, {16, 34, 53, 53, 73, 
-  73, 71, 68, 84, 84, 84, 84, 78, 81, 83, 83, 34, 16, 53, 53, 73, 73, 
-  71, 68, 84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 16, 34, 73, 73, 71, 
-  68, 84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 34, 16, 73, 73, 71, 68, 
-  84, 84, 84, 84, 78, 81, 83, 83, 64, 64, 64, 64, 12, 31, 51, 48, 83, 
-  83, 83, 83, 77, 80, 82, 82, 64, 64, 64, 64, 31, 12, 51, 48, 83, 83, 
-  83, 83, 77, 80, 82, 82, 62, 62, 62, 62, 44, 44, 8, 28, 81, 81, 81, 
-  81, 76, 79, 80, 80, 59, 59, 59, 59, 41, 41, 24, 4, 78, 78, 78, 78, 
-  75, 76, 77, 77, 94, 94, 94, 94, 93, 93, 91, 88, 16, 34, 53, 53, 59, 
-  62, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 34, 16, 53, 53, 59, 62, 
-  64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 16, 34, 59, 62, 64, 
-  64, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 34, 16, 59, 62, 64, 64, 
-  88, 88, 88, 88, 87, 87, 86, 85, 68, 68, 68, 68, 4, 28, 48, 48, 91, 
-  91, 91, 91, 90, 90, 89, 86, 71, 71, 71, 71, 24, 8, 51, 51, 93, 93, 
-  93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 
-  93, 92, 92, 90, 87, 73, 73, 73, 73, 41, 44, 31, 12}, {16, 34, 53, 
-  53, 73, 73, 71, 68, 84, 84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 
-  73, 73, 71, 68, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 73, 
-  73, 71, 68, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 34, 16, 73, 73, 
-  71, 68, 84, 84, 84, 84, 81, 78, 83, 83, 64, 64, 64, 64, 12, 31, 51, 
-  48, 83, 83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 31, 12, 51, 48, 
-  83, 83, 83, 83, 80, 77, 82, 82, 62, 62, 62, 62, 44, 44, 8, 28, 81, 
-  81, 81, 81, 79, 76, 80, 80, 59, 59, 59, 59, 41, 41, 24, 4, 78, 78, 
-  78, 78, 76, 75, 77, 77, 94, 94, 94, 94, 93, 93, 91, 88, 16, 34, 53, 
-  53, 62, 59, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 34, 16, 53, 53, 
-  62, 59, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 16, 34, 62, 
-  59, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 34, 16, 62, 59, 
-  64, 64, 91, 91, 91, 91, 90, 90, 89, 86, 71, 71, 71, 71, 8, 24, 51, 
-  51, 88, 88, 88, 88, 87, 87, 86, 85, 68, 68, 68, 68, 28, 4, 48, 48, 
-  93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 44, 41, 12, 31, 93, 
-  93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 44, 41, 31, 12}, {16, 
-  34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 
-  53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 
-  34, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 
-  73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 78, 81, 64, 64, 64, 64, 12, 
-  31, 51, 48, 83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 31, 12, 
-  51, 48, 83, 83, 83, 83, 82, 82, 77, 80, 62, 62, 62, 62, 44, 44, 8, 
-  28, 81, 81, 81, 81, 80, 80, 76, 79, 59, 59, 59, 59, 41, 41, 24, 4, 
-  78, 78, 78, 78, 77, 77, 75, 76, 94, 94, 94, 94, 93, 93, 91, 88, 16, 
-  34, 53, 53, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 91, 88, 34, 16, 
-  53, 53, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 16, 
-  34, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 34, 16, 
-  64, 64, 59, 62, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 12, 
-  31, 41, 44, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 31, 12, 
-  41, 44, 88, 88, 88, 88, 87, 87, 86, 85, 68, 68, 68, 68, 48, 48, 4, 
-  28, 91, 91, 91, 91, 90, 90, 89, 86, 71, 71, 71, 71, 51, 51, 24, 
-  8}, {16, 34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 81, 78,
-   34, 16, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 81, 78, 53,
-   53, 16, 34, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53,
-   34, 16, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 81, 78, 64, 64, 64,
-   64, 12, 31, 51, 48, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64,
-   31, 12, 51, 48, 83, 83, 83, 83, 82, 82, 80, 77, 62, 62, 62, 62, 44,
-   44, 8, 28, 81, 81, 81, 81, 80, 80, 79, 76, 59, 59, 59, 59, 41, 41, 
-  24, 4, 78, 78, 78, 78, 77, 77, 76, 75, 94, 94, 94, 94, 93, 93, 91, 
-  88, 16, 34, 53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 91, 88, 
-  34, 16, 53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 91, 88, 53, 
-  53, 16, 34, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 91, 88, 53, 53, 
-  34, 16, 64, 64, 62, 59, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 
-  73, 12, 31, 44, 41, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 
-  31, 12, 44, 41, 91, 91, 91, 91, 90, 90, 89, 86, 71, 71, 71, 71, 51, 
-  51, 8, 24, 88, 88, 88, 88, 87, 87, 86, 85, 68, 68, 68, 68, 48, 48, 
-  28, 4}, {4, 28, 48, 48, 68, 68, 68, 68, 85, 86, 87, 87, 88, 88, 88, 
-  88, 24, 8, 51, 51, 71, 71, 71, 71, 86, 89, 90, 90, 91, 91, 91, 91, 
-  41, 44, 12, 31, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 41, 
-  44, 31, 12, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 59, 62, 
-  64, 64, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 
-  64, 34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 
-  53, 53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 59, 62, 64, 64, 53, 
-  53, 34, 16, 88, 91, 93, 93, 94, 94, 94, 94, 75, 76, 77, 77, 78, 78, 
-  78, 78, 4, 24, 41, 41, 59, 59, 59, 59, 76, 79, 80, 80, 81, 81, 81, 
-  81, 28, 8, 44, 44, 62, 62, 62, 62, 77, 80, 82, 82, 83, 83, 83, 83, 
-  48, 51, 12, 31, 64, 64, 64, 64, 77, 80, 82, 82, 83, 83, 83, 83, 48, 
-  51, 31, 12, 64, 64, 64, 64, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 
-  73, 73, 16, 34, 53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 
-  73, 34, 16, 53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 
-  53, 53, 16, 34, 78, 81, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 53, 
-  53, 34, 16}, {8, 24, 51, 51, 71, 71, 71, 71, 86, 89, 90, 90, 91, 91,
-   91, 91, 28, 4, 48, 48, 68, 68, 68, 68, 85, 86, 87, 87, 88, 88, 88, 
-  88, 44, 41, 12, 31, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 
-  44, 41, 31, 12, 73, 73, 73, 73, 87, 90, 92, 92, 93, 93, 93, 93, 62, 
-  59, 64, 64, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 
-  64, 64, 34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 
-  64, 53, 53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 62, 59, 64, 64, 
-  53, 53, 34, 16, 88, 91, 93, 93, 94, 94, 94, 94, 76, 75, 77, 77, 78, 
-  78, 78, 78, 4, 24, 41, 41, 59, 59, 59, 59, 79, 76, 80, 80, 81, 81, 
-  81, 81, 28, 8, 44, 44, 62, 62, 62, 62, 80, 77, 82, 82, 83, 83, 83, 
-  83, 48, 51, 12, 31, 64, 64, 64, 64, 80, 77, 82, 82, 83, 83, 83, 83, 
-  48, 51, 31, 12, 64, 64, 64, 64, 81, 78, 83, 83, 84, 84, 84, 84, 68, 
-  71, 73, 73, 16, 34, 53, 53, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 
-  73, 73, 34, 16, 53, 53, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 73, 
-  73, 53, 53, 16, 34, 81, 78, 83, 83, 84, 84, 84, 84, 68, 71, 73, 73, 
-  53, 53, 34, 16}, {12, 31, 41, 44, 73, 73, 73, 73, 87, 90, 92, 92, 
-  93, 93, 93, 93, 31, 12, 41, 44, 73, 73, 73, 73, 87, 90, 92, 92, 93, 
-  93, 93, 93, 48, 48, 4, 28, 68, 68, 68, 68, 85, 86, 87, 87, 88, 88, 
-  88, 88, 51, 51, 24, 8, 71, 71, 71, 71, 86, 89, 90, 90, 91, 91, 91, 
-  91, 64, 64, 59, 62, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 
-  64, 64, 59, 62, 34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 94, 64, 
-  64, 59, 62, 53, 53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 64, 64, 
-  59, 62, 53, 53, 34, 16, 88, 91, 93, 93, 94, 94, 94, 94, 77, 77, 75, 
-  76, 78, 78, 78, 78, 4, 24, 41, 41, 59, 59, 59, 59, 80, 80, 76, 79, 
-  81, 81, 81, 81, 28, 8, 44, 44, 62, 62, 62, 62, 82, 82, 77, 80, 83, 
-  83, 83, 83, 48, 51, 12, 31, 64, 64, 64, 64, 82, 82, 77, 80, 83, 83, 
-  83, 83, 48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 78, 81, 84, 84, 84, 
-  84, 68, 71, 73, 73, 16, 34, 53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 
-  68, 71, 73, 73, 34, 16, 53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 68, 
-  71, 73, 73, 53, 53, 16, 34, 83, 83, 78, 81, 84, 84, 84, 84, 68, 71, 
-  73, 73, 53, 53, 34, 16}, {12, 31, 44, 41, 73, 73, 73, 73, 87, 90, 
-  92, 92, 93, 93, 93, 93, 31, 12, 44, 41, 73, 73, 73, 73, 87, 90, 92, 
-  92, 93, 93, 93, 93, 51, 51, 8, 24, 71, 71, 71, 71, 86, 89, 90, 90, 
-  91, 91, 91, 91, 48, 48, 28, 4, 68, 68, 68, 68, 85, 86, 87, 87, 88, 
-  88, 88, 88, 64, 64, 62, 59, 16, 34, 53, 53, 88, 91, 93, 93, 94, 94, 
-  94, 94, 64, 64, 62, 59, 34, 16, 53, 53, 88, 91, 93, 93, 94, 94, 94, 
-  94, 64, 64, 62, 59, 53, 53, 16, 34, 88, 91, 93, 93, 94, 94, 94, 94, 
-  64, 64, 62, 59, 53, 53, 34, 16, 88, 91, 93, 93, 94, 94, 94, 94, 77, 
-  77, 76, 75, 78, 78, 78, 78, 4, 24, 41, 41, 59, 59, 59, 59, 80, 80, 
-  79, 76, 81, 81, 81, 81, 28, 8, 44, 44, 62, 62, 62, 62, 82, 82, 80, 
-  77, 83, 83, 83, 83, 48, 51, 12, 31, 64, 64, 64, 64, 82, 82, 80, 77, 
-  83, 83, 83, 83, 48, 51, 31, 12, 64, 64, 64, 64, 83, 83, 81, 78, 84, 
-  84, 84, 84, 68, 71, 73, 73, 16, 34, 53, 53, 83, 83, 81, 78, 84, 84, 
-  84, 84, 68, 71, 73, 73, 34, 16, 53, 53, 83, 83, 81, 78, 84, 84, 84, 
-  84, 68, 71, 73, 73, 53, 53, 16, 34, 83, 83, 81, 78, 84, 84, 84, 84, 
-  68, 71, 73, 73, 53, 53, 34, 16}, {16, 34, 53, 53, 59, 62, 64, 64, 
-  88, 91, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 59, 62, 64, 64, 88, 
-  91, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 59, 62, 64, 64, 88, 91, 
-  93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 59, 62, 64, 64, 88, 91, 93, 
-  93, 94, 94, 94, 94, 68, 68, 68, 68, 4, 28, 48, 48, 85, 86, 87, 87, 
-  88, 88, 88, 88, 71, 71, 71, 71, 24, 8, 51, 51, 86, 89, 90, 90, 91, 
-  91, 91, 91, 73, 73, 73, 73, 41, 44, 12, 31, 87, 90, 92, 92, 93, 93, 
-  93, 93, 73, 73, 73, 73, 41, 44, 31, 12, 87, 90, 92, 92, 93, 93, 93, 
-  93, 78, 78, 78, 78, 75, 76, 77, 77, 4, 24, 41, 41, 59, 59, 59, 59, 
-  81, 81, 81, 81, 76, 79, 80, 80, 28, 8, 44, 44, 62, 62, 62, 62, 83, 
-  83, 83, 83, 77, 80, 82, 82, 48, 51, 12, 31, 64, 64, 64, 64, 83, 83, 
-  83, 83, 77, 80, 82, 82, 48, 51, 31, 12, 64, 64, 64, 64, 84, 84, 84, 
-  84, 78, 81, 83, 83, 68, 71, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 
-  78, 81, 83, 83, 68, 71, 73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 78, 
-  81, 83, 83, 68, 71, 73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 78, 81, 
-  83, 83, 68, 71, 73, 73, 53, 53, 34, 16}, {16, 34, 53, 53, 62, 59, 
-  64, 64, 88, 91, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 62, 59, 64, 
-  64, 88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 62, 59, 64, 64, 
-  88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 62, 59, 64, 64, 88, 
-  91, 93, 93, 94, 94, 94, 94, 71, 71, 71, 71, 8, 24, 51, 51, 86, 89, 
-  90, 90, 91, 91, 91, 91, 68, 68, 68, 68, 28, 4, 48, 48, 85, 86, 87, 
-  87, 88, 88, 88, 88, 73, 73, 73, 73, 44, 41, 12, 31, 87, 90, 92, 92, 
-  93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 31, 12, 87, 90, 92, 92, 93, 
-  93, 93, 93, 78, 78, 78, 78, 76, 75, 77, 77, 4, 24, 41, 41, 59, 59, 
-  59, 59, 81, 81, 81, 81, 79, 76, 80, 80, 28, 8, 44, 44, 62, 62, 62, 
-  62, 83, 83, 83, 83, 80, 77, 82, 82, 48, 51, 12, 31, 64, 64, 64, 64, 
-  83, 83, 83, 83, 80, 77, 82, 82, 48, 51, 31, 12, 64, 64, 64, 64, 84, 
-  84, 84, 84, 81, 78, 83, 83, 68, 71, 73, 73, 16, 34, 53, 53, 84, 84, 
-  84, 84, 81, 78, 83, 83, 68, 71, 73, 73, 34, 16, 53, 53, 84, 84, 84, 
-  84, 81, 78, 83, 83, 68, 71, 73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 
-  81, 78, 83, 83, 68, 71, 73, 73, 53, 53, 34, 16}, {16, 34, 53, 53, 
-  64, 64, 59, 62, 88, 91, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 64, 
-  64, 59, 62, 88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 
-  59, 62, 88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 59, 
-  62, 88, 91, 93, 93, 94, 94, 94, 94, 73, 73, 73, 73, 12, 31, 41, 44, 
-  87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 41, 44, 87, 
-  90, 92, 92, 93, 93, 93, 93, 68, 68, 68, 68, 48, 48, 4, 28, 85, 86, 
-  87, 87, 88, 88, 88, 88, 71, 71, 71, 71, 51, 51, 24, 8, 86, 89, 90, 
-  90, 91, 91, 91, 91, 78, 78, 78, 78, 77, 77, 75, 76, 4, 24, 41, 41, 
-  59, 59, 59, 59, 81, 81, 81, 81, 80, 80, 76, 79, 28, 8, 44, 44, 62, 
-  62, 62, 62, 83, 83, 83, 83, 82, 82, 77, 80, 48, 51, 12, 31, 64, 64, 
-  64, 64, 83, 83, 83, 83, 82, 82, 77, 80, 48, 51, 31, 12, 64, 64, 64, 
-  64, 84, 84, 84, 84, 83, 83, 78, 81, 68, 71, 73, 73, 16, 34, 53, 53, 
-  84, 84, 84, 84, 83, 83, 78, 81, 68, 71, 73, 73, 34, 16, 53, 53, 84, 
-  84, 84, 84, 83, 83, 78, 81, 68, 71, 73, 73, 53, 53, 16, 34, 84, 84, 
-  84, 84, 83, 83, 78, 81, 68, 71, 73, 73, 53, 53, 34, 16}, {16, 34, 
-  53, 53, 64, 64, 62, 59, 88, 91, 93, 93, 94, 94, 94, 94, 34, 16, 53, 
-  53, 64, 64, 62, 59, 88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 
-  64, 64, 62, 59, 88, 91, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 64, 
-  64, 62, 59, 88, 91, 93, 93, 94, 94, 94, 94, 73, 73, 73, 73, 12, 31, 
-  44, 41, 87, 90, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 44, 
-  41, 87, 90, 92, 92, 93, 93, 93, 93, 71, 71, 71, 71, 51, 51, 8, 24, 
-  86, 89, 90, 90, 91, 91, 91, 91, 68, 68, 68, 68, 48, 48, 28, 4, 85, 
-  86, 87, 87, 88, 88, 88, 88, 78, 78, 78, 78, 77, 77, 76, 75, 4, 24, 
-  41, 41, 59, 59, 59, 59, 81, 81, 81, 81, 80, 80, 79, 76, 28, 8, 44, 
-  44, 62, 62, 62, 62, 83, 83, 83, 83, 82, 82, 80, 77, 48, 51, 12, 31, 
-  64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 80, 77, 48, 51, 31, 12, 64, 
-  64, 64, 64, 84, 84, 84, 84, 83, 83, 81, 78, 68, 71, 73, 73, 16, 34, 
-  53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 68, 71, 73, 73, 34, 16, 53, 
-  53, 84, 84, 84, 84, 83, 83, 81, 78, 68, 71, 73, 73, 53, 53, 16, 34, 
-  84, 84, 84, 84, 83, 83, 81, 78, 68, 71, 73, 73, 53, 53, 34, 
-  16}, {17, 18, 19, 19, 20, 20, 20, 20, 4, 8, 12, 12, 16, 16, 16, 16, 
-  18, 17, 19, 19, 20, 20, 20, 20, 4, 8, 12, 12, 16, 16, 16, 16, 19, 
-  19, 17, 18, 20, 20, 20, 20, 4, 8, 12, 12, 16, 16, 16, 16, 19, 19, 
-  18, 17, 20, 20, 20, 20, 4, 8, 12, 12, 16, 16, 16, 16, 20, 20, 20, 
-  20, 17, 18, 19, 19, 4, 8, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 
-  18, 17, 19, 19, 4, 8, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 19, 
-  19, 17, 18, 4, 8, 12, 12, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 
-  18, 17, 4, 8, 12, 12, 16, 16, 16, 16, 4, 4, 4, 4, 4, 4, 4, 4, 0, 1, 
-  2, 2, 3, 3, 3, 3, 8, 8, 8, 8, 8, 8, 8, 8, 1, 5, 6, 6, 7, 7, 7, 7, 
-  12, 12, 12, 12, 12, 12, 12, 12, 2, 6, 9, 10, 11, 11, 11, 11, 12, 12,
-   12, 12, 12, 12, 12, 12, 2, 6, 10, 9, 11, 11, 11, 11, 16, 16, 16, 
-  16, 16, 16, 16, 16, 3, 7, 11, 11, 13, 14, 15, 15, 16, 16, 16, 16, 
-  16, 16, 16, 16, 3, 7, 11, 11, 14, 13, 15, 15, 16, 16, 16, 16, 16, 
-  16, 16, 16, 3, 7, 11, 11, 15, 15, 13, 14, 16, 16, 16, 16, 16, 16, 
-  16, 16, 3, 7, 11, 11, 15, 15, 14, 13}, {18, 35, 36, 36, 37, 37, 37, 
-  37, 28, 24, 31, 31, 34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 
-  28, 24, 31, 31, 34, 34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 28, 
-  24, 31, 31, 34, 34, 34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 28, 24, 
-  31, 31, 34, 34, 34, 34, 37, 37, 37, 37, 18, 35, 36, 36, 28, 24, 31, 
-  31, 34, 34, 34, 34, 37, 37, 37, 37, 35, 18, 36, 36, 28, 24, 31, 31, 
-  34, 34, 34, 34, 37, 37, 37, 37, 36, 36, 18, 35, 28, 24, 31, 31, 34, 
-  34, 34, 34, 37, 37, 37, 37, 36, 36, 35, 18, 28, 24, 31, 31, 34, 34, 
-  34, 34, 24, 24, 24, 24, 24, 24, 24, 24, 1, 21, 22, 22, 23, 23, 23, 
-  23, 28, 28, 28, 28, 28, 28, 28, 28, 25, 1, 26, 26, 27, 27, 27, 27, 
-  31, 31, 31, 31, 31, 31, 31, 31, 26, 22, 10, 29, 30, 30, 30, 30, 31, 
-  31, 31, 31, 31, 31, 31, 31, 26, 22, 29, 10, 30, 30, 30, 30, 34, 34, 
-  34, 34, 34, 34, 34, 34, 27, 23, 30, 30, 14, 32, 33, 33, 34, 34, 34, 
-  34, 34, 34, 34, 34, 27, 23, 30, 30, 32, 14, 33, 33, 34, 34, 34, 34, 
-  34, 34, 34, 34, 27, 23, 30, 30, 33, 33, 14, 32, 34, 34, 34, 34, 34, 
-  34, 34, 34, 27, 23, 30, 30, 33, 33, 32, 14}, {19, 36, 54, 54, 55, 
-  55, 55, 55, 48, 51, 41, 44, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 
-  55, 55, 48, 51, 41, 44, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 
-  55, 48, 51, 41, 44, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 
-  48, 51, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 48, 
-  51, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 48, 51, 
-  41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 48, 51, 41, 
-  44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 48, 51, 41, 44, 
-  53, 53, 53, 53, 41, 41, 41, 41, 41, 41, 41, 41, 2, 22, 38, 39, 40, 
-  40, 40, 40, 44, 44, 44, 44, 44, 44, 44, 44, 26, 6, 39, 42, 43, 43, 
-  43, 43, 48, 48, 48, 48, 48, 48, 48, 48, 45, 46, 2, 26, 47, 47, 47, 
-  47, 51, 51, 51, 51, 51, 51, 51, 51, 46, 49, 22, 6, 50, 50, 50, 50, 
-  53, 53, 53, 53, 53, 53, 53, 53, 47, 50, 40, 43, 15, 33, 52, 52, 53, 
-  53, 53, 53, 53, 53, 53, 53, 47, 50, 40, 43, 33, 15, 52, 52, 53, 53, 
-  53, 53, 53, 53, 53, 53, 47, 50, 40, 43, 52, 52, 15, 33, 53, 53, 53, 
-  53, 53, 53, 53, 53, 47, 50, 40, 43, 52, 52, 33, 15}, {19, 36, 54, 
-  54, 55, 55, 55, 55, 48, 51, 44, 41, 53, 53, 53, 53, 36, 19, 54, 54, 
-  55, 55, 55, 55, 48, 51, 44, 41, 53, 53, 53, 53, 54, 54, 19, 36, 55, 
-  55, 55, 55, 48, 51, 44, 41, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 
-  55, 55, 48, 51, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 
-  54, 48, 51, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 
-  48, 51, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 48, 
-  51, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 48, 51, 
-  44, 41, 53, 53, 53, 53, 41, 41, 41, 41, 41, 41, 41, 41, 2, 22, 39, 
-  38, 40, 40, 40, 40, 44, 44, 44, 44, 44, 44, 44, 44, 26, 6, 42, 39, 
-  43, 43, 43, 43, 51, 51, 51, 51, 51, 51, 51, 51, 46, 49, 6, 22, 50, 
-  50, 50, 50, 48, 48, 48, 48, 48, 48, 48, 48, 45, 46, 26, 2, 47, 47, 
-  47, 47, 53, 53, 53, 53, 53, 53, 53, 53, 47, 50, 43, 40, 15, 33, 52, 
-  52, 53, 53, 53, 53, 53, 53, 53, 53, 47, 50, 43, 40, 33, 15, 52, 52, 
-  53, 53, 53, 53, 53, 53, 53, 53, 47, 50, 43, 40, 52, 52, 15, 33, 53, 
-  53, 53, 53, 53, 53, 53, 53, 47, 50, 43, 40, 52, 52, 33, 15}, {20, 
-  37, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 59, 62, 64, 64, 37, 20, 
-  55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 59, 62, 64, 64, 55, 55, 20, 
-  37, 74, 74, 74, 74, 68, 71, 73, 73, 59, 62, 64, 64, 55, 55, 37, 20, 
-  74, 74, 74, 74, 68, 71, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 20, 
-  37, 55, 55, 68, 71, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 37, 20, 
-  55, 55, 68, 71, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 20, 
-  37, 68, 71, 73, 73, 59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20, 
-  68, 71, 73, 73, 59, 62, 64, 64, 59, 59, 59, 59, 59, 59, 59, 59, 3, 
-  23, 40, 40, 56, 57, 58, 58, 62, 62, 62, 62, 62, 62, 62, 62, 27, 7, 
-  43, 43, 57, 60, 61, 61, 64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 11, 
-  30, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 47, 50, 30, 11, 
-  58, 61, 63, 63, 68, 68, 68, 68, 68, 68, 68, 68, 65, 66, 67, 67, 3, 
-  27, 47, 47, 71, 71, 71, 71, 71, 71, 71, 71, 66, 69, 70, 70, 23, 7, 
-  50, 50, 73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 40, 43, 11, 
-  30, 73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 40, 43, 30, 
-  11}, {20, 37, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 62, 59, 64, 
-  64, 37, 20, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 62, 59, 64, 64, 
-  55, 55, 20, 37, 74, 74, 74, 74, 68, 71, 73, 73, 62, 59, 64, 64, 55, 
-  55, 37, 20, 74, 74, 74, 74, 68, 71, 73, 73, 62, 59, 64, 64, 74, 74, 
-  74, 74, 20, 37, 55, 55, 68, 71, 73, 73, 62, 59, 64, 64, 74, 74, 74, 
-  74, 37, 20, 55, 55, 68, 71, 73, 73, 62, 59, 64, 64, 74, 74, 74, 74, 
-  55, 55, 20, 37, 68, 71, 73, 73, 62, 59, 64, 64, 74, 74, 74, 74, 55, 
-  55, 37, 20, 68, 71, 73, 73, 62, 59, 64, 64, 59, 59, 59, 59, 59, 59, 
-  59, 59, 3, 23, 40, 40, 57, 56, 58, 58, 62, 62, 62, 62, 62, 62, 62, 
-  62, 27, 7, 43, 43, 60, 57, 61, 61, 64, 64, 64, 64, 64, 64, 64, 64, 
-  47, 50, 11, 30, 61, 58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 47, 
-  50, 30, 11, 61, 58, 63, 63, 71, 71, 71, 71, 71, 71, 71, 71, 66, 69, 
-  70, 70, 7, 23, 50, 50, 68, 68, 68, 68, 68, 68, 68, 68, 65, 66, 67, 
-  67, 27, 3, 47, 47, 73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 
-  43, 40, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 67, 70, 72, 72, 43, 
-  40, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 64, 
-  64, 59, 62, 37, 20, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 
-  59, 62, 55, 55, 20, 37, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 59, 
-  62, 55, 55, 37, 20, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 59, 62, 
-  74, 74, 74, 74, 20, 37, 55, 55, 68, 71, 73, 73, 64, 64, 59, 62, 74, 
-  74, 74, 74, 37, 20, 55, 55, 68, 71, 73, 73, 64, 64, 59, 62, 74, 74, 
-  74, 74, 55, 55, 20, 37, 68, 71, 73, 73, 64, 64, 59, 62, 74, 74, 74, 
-  74, 55, 55, 37, 20, 68, 71, 73, 73, 64, 64, 59, 62, 59, 59, 59, 59, 
-  59, 59, 59, 59, 3, 23, 40, 40, 58, 58, 56, 57, 62, 62, 62, 62, 62, 
-  62, 62, 62, 27, 7, 43, 43, 61, 61, 57, 60, 64, 64, 64, 64, 64, 64, 
-  64, 64, 47, 50, 11, 30, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 64, 
-  64, 47, 50, 30, 11, 63, 63, 58, 61, 73, 73, 73, 73, 73, 73, 73, 73, 
-  67, 70, 72, 72, 11, 30, 40, 43, 73, 73, 73, 73, 73, 73, 73, 73, 67, 
-  70, 72, 72, 30, 11, 40, 43, 68, 68, 68, 68, 68, 68, 68, 68, 65, 66, 
-  67, 67, 47, 47, 3, 27, 71, 71, 71, 71, 71, 71, 71, 71, 66, 69, 70, 
-  70, 50, 50, 23, 7}, {20, 37, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73,
-   64, 64, 62, 59, 37, 20, 55, 55, 74, 74, 74, 74, 68, 71, 73, 73, 64,
-   64, 62, 59, 55, 55, 20, 37, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64,
-   62, 59, 55, 55, 37, 20, 74, 74, 74, 74, 68, 71, 73, 73, 64, 64, 62,
-   59, 74, 74, 74, 74, 20, 37, 55, 55, 68, 71, 73, 73, 64, 64, 62, 59,
-   74, 74, 74, 74, 37, 20, 55, 55, 68, 71, 73, 73, 64, 64, 62, 59, 74,
-   74, 74, 74, 55, 55, 20, 37, 68, 71, 73, 73, 64, 64, 62, 59, 74, 74,
-   74, 74, 55, 55, 37, 20, 68, 71, 73, 73, 64, 64, 62, 59, 59, 59, 59,
-   59, 59, 59, 59, 59, 3, 23, 40, 40, 58, 58, 57, 56, 62, 62, 62, 62, 
-  62, 62, 62, 62, 27, 7, 43, 43, 61, 61, 60, 57, 64, 64, 64, 64, 64, 
-  64, 64, 64, 47, 50, 11, 30, 63, 63, 61, 58, 64, 64, 64, 64, 64, 64, 
-  64, 64, 47, 50, 30, 11, 63, 63, 61, 58, 73, 73, 73, 73, 73, 73, 73, 
-  73, 67, 70, 72, 72, 11, 30, 43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 
-  67, 70, 72, 72, 30, 11, 43, 40, 71, 71, 71, 71, 71, 71, 71, 71, 66, 
-  69, 70, 70, 50, 50, 7, 23, 68, 68, 68, 68, 68, 68, 68, 68, 65, 66, 
-  67, 67, 47, 47, 27, 3}, {4, 28, 48, 48, 68, 68, 68, 68, 86, 85, 87, 
-  87, 88, 88, 88, 88, 24, 8, 51, 51, 71, 71, 71, 71, 89, 86, 90, 90, 
-  91, 91, 91, 91, 41, 44, 12, 31, 73, 73, 73, 73, 90, 87, 92, 92, 93, 
-  93, 93, 93, 41, 44, 31, 12, 73, 73, 73, 73, 90, 87, 92, 92, 93, 93, 
-  93, 93, 59, 62, 64, 64, 16, 34, 53, 53, 91, 88, 93, 93, 94, 94, 94, 
-  94, 59, 62, 64, 64, 34, 16, 53, 53, 91, 88, 93, 93, 94, 94, 94, 94, 
-  59, 62, 64, 64, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 94, 94, 59, 
-  62, 64, 64, 53, 53, 34, 16, 91, 88, 93, 93, 94, 94, 94, 94, 76, 79, 
-  80, 80, 81, 81, 81, 81, 8, 28, 44, 44, 62, 62, 62, 62, 75, 76, 77, 
-  77, 78, 78, 78, 78, 24, 4, 41, 41, 59, 59, 59, 59, 77, 80, 82, 82, 
-  83, 83, 83, 83, 51, 48, 12, 31, 64, 64, 64, 64, 77, 80, 82, 82, 83, 
-  83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 78, 81, 83, 83, 84, 84, 
-  84, 84, 71, 68, 73, 73, 16, 34, 53, 53, 78, 81, 83, 83, 84, 84, 84, 
-  84, 71, 68, 73, 73, 34, 16, 53, 53, 78, 81, 83, 83, 84, 84, 84, 84, 
-  71, 68, 73, 73, 53, 53, 16, 34, 78, 81, 83, 83, 84, 84, 84, 84, 71, 
-  68, 73, 73, 53, 53, 34, 16}, {8, 24, 51, 51, 71, 71, 71, 71, 89, 86,
-   90, 90, 91, 91, 91, 91, 28, 4, 48, 48, 68, 68, 68, 68, 86, 85, 87, 
-  87, 88, 88, 88, 88, 44, 41, 12, 31, 73, 73, 73, 73, 90, 87, 92, 92, 
-  93, 93, 93, 93, 44, 41, 31, 12, 73, 73, 73, 73, 90, 87, 92, 92, 93, 
-  93, 93, 93, 62, 59, 64, 64, 16, 34, 53, 53, 91, 88, 93, 93, 94, 94, 
-  94, 94, 62, 59, 64, 64, 34, 16, 53, 53, 91, 88, 93, 93, 94, 94, 94, 
-  94, 62, 59, 64, 64, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 94, 94, 
-  62, 59, 64, 64, 53, 53, 34, 16, 91, 88, 93, 93, 94, 94, 94, 94, 79, 
-  76, 80, 80, 81, 81, 81, 81, 8, 28, 44, 44, 62, 62, 62, 62, 76, 75, 
-  77, 77, 78, 78, 78, 78, 24, 4, 41, 41, 59, 59, 59, 59, 80, 77, 82, 
-  82, 83, 83, 83, 83, 51, 48, 12, 31, 64, 64, 64, 64, 80, 77, 82, 82, 
-  83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 81, 78, 83, 83, 84, 
-  84, 84, 84, 71, 68, 73, 73, 16, 34, 53, 53, 81, 78, 83, 83, 84, 84, 
-  84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 81, 78, 83, 83, 84, 84, 84, 
-  84, 71, 68, 73, 73, 53, 53, 16, 34, 81, 78, 83, 83, 84, 84, 84, 84, 
-  71, 68, 73, 73, 53, 53, 34, 16}, {12, 31, 41, 44, 73, 73, 73, 73, 
-  90, 87, 92, 92, 93, 93, 93, 93, 31, 12, 41, 44, 73, 73, 73, 73, 90, 
-  87, 92, 92, 93, 93, 93, 93, 48, 48, 4, 28, 68, 68, 68, 68, 86, 85, 
-  87, 87, 88, 88, 88, 88, 51, 51, 24, 8, 71, 71, 71, 71, 89, 86, 90, 
-  90, 91, 91, 91, 91, 64, 64, 59, 62, 16, 34, 53, 53, 91, 88, 93, 93, 
-  94, 94, 94, 94, 64, 64, 59, 62, 34, 16, 53, 53, 91, 88, 93, 93, 94, 
-  94, 94, 94, 64, 64, 59, 62, 53, 53, 16, 34, 91, 88, 93, 93, 94, 94, 
-  94, 94, 64, 64, 59, 62, 53, 53, 34, 16, 91, 88, 93, 93, 94, 94, 94, 
-  94, 80, 80, 76, 79, 81, 81, 81, 81, 8, 28, 44, 44, 62, 62, 62, 62, 
-  77, 77, 75, 76, 78, 78, 78, 78, 24, 4, 41, 41, 59, 59, 59, 59, 82, 
-  82, 77, 80, 83, 83, 83, 83, 51, 48, 12, 31, 64, 64, 64, 64, 82, 82, 
-  77, 80, 83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 83, 83, 78, 
-  81, 84, 84, 84, 84, 71, 68, 73, 73, 16, 34, 53, 53, 83, 83, 78, 81, 
-  84, 84, 84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 83, 83, 78, 81, 84, 
-  84, 84, 84, 71, 68, 73, 73, 53, 53, 16, 34, 83, 83, 78, 81, 84, 84, 
-  84, 84, 71, 68, 73, 73, 53, 53, 34, 16}, {12, 31, 44, 41, 73, 73, 
-  73, 73, 90, 87, 92, 92, 93, 93, 93, 93, 31, 12, 44, 41, 73, 73, 73, 
-  73, 90, 87, 92, 92, 93, 93, 93, 93, 51, 51, 8, 24, 71, 71, 71, 71, 
-  89, 86, 90, 90, 91, 91, 91, 91, 48, 48, 28, 4, 68, 68, 68, 68, 86, 
-  85, 87, 87, 88, 88, 88, 88, 64, 64, 62, 59, 16, 34, 53, 53, 91, 88, 
-  93, 93, 94, 94, 94, 94, 64, 64, 62, 59, 34, 16, 53, 53, 91, 88, 93, 
-  93, 94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 16, 34, 91, 88, 93, 93, 
-  94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 34, 16, 91, 88, 93, 93, 94, 
-  94, 94, 94, 80, 80, 79, 76, 81, 81, 81, 81, 8, 28, 44, 44, 62, 62, 
-  62, 62, 77, 77, 76, 75, 78, 78, 78, 78, 24, 4, 41, 41, 59, 59, 59, 
-  59, 82, 82, 80, 77, 83, 83, 83, 83, 51, 48, 12, 31, 64, 64, 64, 64, 
-  82, 82, 80, 77, 83, 83, 83, 83, 51, 48, 31, 12, 64, 64, 64, 64, 83, 
-  83, 81, 78, 84, 84, 84, 84, 71, 68, 73, 73, 16, 34, 53, 53, 83, 83, 
-  81, 78, 84, 84, 84, 84, 71, 68, 73, 73, 34, 16, 53, 53, 83, 83, 81, 
-  78, 84, 84, 84, 84, 71, 68, 73, 73, 53, 53, 16, 34, 83, 83, 81, 78, 
-  84, 84, 84, 84, 71, 68, 73, 73, 53, 53, 34, 16}, {16, 34, 53, 53, 
-  59, 62, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 53, 59, 
-  62, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 59, 62, 
-  64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 59, 62, 64, 
-  64, 91, 88, 93, 93, 94, 94, 94, 94, 68, 68, 68, 68, 4, 28, 48, 48, 
-  86, 85, 87, 87, 88, 88, 88, 88, 71, 71, 71, 71, 24, 8, 51, 51, 89, 
-  86, 90, 90, 91, 91, 91, 91, 73, 73, 73, 73, 41, 44, 12, 31, 90, 87, 
-  92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 41, 44, 31, 12, 90, 87, 92, 
-  92, 93, 93, 93, 93, 81, 81, 81, 81, 76, 79, 80, 80, 8, 28, 44, 44, 
-  62, 62, 62, 62, 78, 78, 78, 78, 75, 76, 77, 77, 24, 4, 41, 41, 59, 
-  59, 59, 59, 83, 83, 83, 83, 77, 80, 82, 82, 51, 48, 12, 31, 64, 64, 
-  64, 64, 83, 83, 83, 83, 77, 80, 82, 82, 51, 48, 31, 12, 64, 64, 64, 
-  64, 84, 84, 84, 84, 78, 81, 83, 83, 71, 68, 73, 73, 16, 34, 53, 53, 
-  84, 84, 84, 84, 78, 81, 83, 83, 71, 68, 73, 73, 34, 16, 53, 53, 84, 
-  84, 84, 84, 78, 81, 83, 83, 71, 68, 73, 73, 53, 53, 16, 34, 84, 84, 
-  84, 84, 78, 81, 83, 83, 71, 68, 73, 73, 53, 53, 34, 16}, {16, 34, 
-  53, 53, 62, 59, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 34, 16, 53, 
-  53, 62, 59, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 16, 34, 
-  62, 59, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 53, 53, 34, 16, 62, 
-  59, 64, 64, 91, 88, 93, 93, 94, 94, 94, 94, 71, 71, 71, 71, 8, 24, 
-  51, 51, 89, 86, 90, 90, 91, 91, 91, 91, 68, 68, 68, 68, 28, 4, 48, 
-  48, 86, 85, 87, 87, 88, 88, 88, 88, 73, 73, 73, 73, 44, 41, 12, 31, 
-  90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 73, 44, 41, 31, 12, 90, 
-  87, 92, 92, 93, 93, 93, 93, 81, 81, 81, 81, 79, 76, 80, 80, 8, 28, 
-  44, 44, 62, 62, 62, 62, 78, 78, 78, 78, 76, 75, 77, 77, 24, 4, 41, 
-  41, 59, 59, 59, 59, 83, 83, 83, 83, 80, 77, 82, 82, 51, 48, 12, 31, 
-  64, 64, 64, 64, 83, 83, 83, 83, 80, 77, 82, 82, 51, 48, 31, 12, 64, 
-  64, 64, 64, 84, 84, 84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 16, 34, 
-  53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 34, 16, 53, 
-  53, 84, 84, 84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 53, 53, 16, 34, 
-  84, 84, 84, 84, 81, 78, 83, 83, 71, 68, 73, 73, 53, 53, 34, 
-  16}, {16, 34, 53, 53, 64, 64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 
-  94, 34, 16, 53, 53, 64, 64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 
-  53, 53, 16, 34, 64, 64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 53, 
-  53, 34, 16, 64, 64, 59, 62, 91, 88, 93, 93, 94, 94, 94, 94, 73, 73, 
-  73, 73, 12, 31, 41, 44, 90, 87, 92, 92, 93, 93, 93, 93, 73, 73, 73, 
-  73, 31, 12, 41, 44, 90, 87, 92, 92, 93, 93, 93, 93, 68, 68, 68, 68, 
-  48, 48, 4, 28, 86, 85, 87, 87, 88, 88, 88, 88, 71, 71, 71, 71, 51, 
-  51, 24, 8, 89, 86, 90, 90, 91, 91, 91, 91, 81, 81, 81, 81, 80, 80, 
-  76, 79, 8, 28, 44, 44, 62, 62, 62, 62, 78, 78, 78, 78, 77, 77, 75, 
-  76, 24, 4, 41, 41, 59, 59, 59, 59, 83, 83, 83, 83, 82, 82, 77, 80, 
-  51, 48, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 77, 80, 51, 
-  48, 31, 12, 64, 64, 64, 64, 84, 84, 84, 84, 83, 83, 78, 81, 71, 68, 
-  73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 71, 68, 73, 
-  73, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 71, 68, 73, 73, 
-  53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 78, 81, 71, 68, 73, 73, 53, 
-  53, 34, 16}, {16, 34, 53, 53, 64, 64, 62, 59, 91, 88, 93, 93, 94, 
-  94, 94, 94, 34, 16, 53, 53, 64, 64, 62, 59, 91, 88, 93, 93, 94, 94, 
-  94, 94, 53, 53, 16, 34, 64, 64, 62, 59, 91, 88, 93, 93, 94, 94, 94, 
-  94, 53, 53, 34, 16, 64, 64, 62, 59, 91, 88, 93, 93, 94, 94, 94, 94, 
-  73, 73, 73, 73, 12, 31, 44, 41, 90, 87, 92, 92, 93, 93, 93, 93, 73, 
-  73, 73, 73, 31, 12, 44, 41, 90, 87, 92, 92, 93, 93, 93, 93, 71, 71, 
-  71, 71, 51, 51, 8, 24, 89, 86, 90, 90, 91, 91, 91, 91, 68, 68, 68, 
-  68, 48, 48, 28, 4, 86, 85, 87, 87, 88, 88, 88, 88, 81, 81, 81, 81, 
-  80, 80, 79, 76, 8, 28, 44, 44, 62, 62, 62, 62, 78, 78, 78, 78, 77, 
-  77, 76, 75, 24, 4, 41, 41, 59, 59, 59, 59, 83, 83, 83, 83, 82, 82, 
-  80, 77, 51, 48, 12, 31, 64, 64, 64, 64, 83, 83, 83, 83, 82, 82, 80, 
-  77, 51, 48, 31, 12, 64, 64, 64, 64, 84, 84, 84, 84, 83, 83, 81, 78, 
-  71, 68, 73, 73, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 71, 
-  68, 73, 73, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 81, 78, 71, 68, 
-  73, 73, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 81, 78, 71, 68, 73, 
-  73, 53, 53, 34, 16}, {18, 35, 36, 36, 37, 37, 37, 37, 24, 28, 31, 
-  31, 34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 24, 28, 31, 31, 
-  34, 34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 24, 28, 31, 31, 34, 
-  34, 34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 24, 28, 31, 31, 34, 34, 
-  34, 34, 37, 37, 37, 37, 18, 35, 36, 36, 24, 28, 31, 31, 34, 34, 34, 
-  34, 37, 37, 37, 37, 35, 18, 36, 36, 24, 28, 31, 31, 34, 34, 34, 34, 
-  37, 37, 37, 37, 36, 36, 18, 35, 24, 28, 31, 31, 34, 34, 34, 34, 37, 
-  37, 37, 37, 36, 36, 35, 18, 24, 28, 31, 31, 34, 34, 34, 34, 28, 28, 
-  28, 28, 28, 28, 28, 28, 1, 25, 26, 26, 27, 27, 27, 27, 24, 24, 24, 
-  24, 24, 24, 24, 24, 21, 1, 22, 22, 23, 23, 23, 23, 31, 31, 31, 31, 
-  31, 31, 31, 31, 22, 26, 10, 29, 30, 30, 30, 30, 31, 31, 31, 31, 31, 
-  31, 31, 31, 22, 26, 29, 10, 30, 30, 30, 30, 34, 34, 34, 34, 34, 34, 
-  34, 34, 23, 27, 30, 30, 14, 32, 33, 33, 34, 34, 34, 34, 34, 34, 34, 
-  34, 23, 27, 30, 30, 32, 14, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 
-  23, 27, 30, 30, 33, 33, 14, 32, 34, 34, 34, 34, 34, 34, 34, 34, 23, 
-  27, 30, 30, 33, 33, 32, 14}, {17, 18, 19, 19, 20, 20, 20, 20, 8, 4, 
-  12, 12, 16, 16, 16, 16, 18, 17, 19, 19, 20, 20, 20, 20, 8, 4, 12, 
-  12, 16, 16, 16, 16, 19, 19, 17, 18, 20, 20, 20, 20, 8, 4, 12, 12, 
-  16, 16, 16, 16, 19, 19, 18, 17, 20, 20, 20, 20, 8, 4, 12, 12, 16, 
-  16, 16, 16, 20, 20, 20, 20, 17, 18, 19, 19, 8, 4, 12, 12, 16, 16, 
-  16, 16, 20, 20, 20, 20, 18, 17, 19, 19, 8, 4, 12, 12, 16, 16, 16, 
-  16, 20, 20, 20, 20, 19, 19, 17, 18, 8, 4, 12, 12, 16, 16, 16, 16, 
-  20, 20, 20, 20, 19, 19, 18, 17, 8, 4, 12, 12, 16, 16, 16, 16, 8, 8, 
-  8, 8, 8, 8, 8, 8, 5, 1, 6, 6, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4, 4, 4, 1,
-   0, 2, 2, 3, 3, 3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 6, 2, 9, 10, 
-  11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 6, 2, 10, 9, 11, 11,
-   11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 13, 14, 15, 
-  15, 16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 14, 13, 15, 15, 
-  16, 16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 15, 15, 13, 14, 16, 
-  16, 16, 16, 16, 16, 16, 16, 7, 3, 11, 11, 15, 15, 14, 13}, {19, 36, 
-  54, 54, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 36, 19, 54, 
-  54, 55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 54, 54, 19, 36, 
-  55, 55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 54, 54, 36, 19, 55, 
-  55, 55, 55, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 
-  54, 54, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 
-  54, 51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 
-  51, 48, 41, 44, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 51, 
-  48, 41, 44, 53, 53, 53, 53, 44, 44, 44, 44, 44, 44, 44, 44, 6, 26, 
-  39, 42, 43, 43, 43, 43, 41, 41, 41, 41, 41, 41, 41, 41, 22, 2, 38, 
-  39, 40, 40, 40, 40, 48, 48, 48, 48, 48, 48, 48, 48, 46, 45, 2, 26, 
-  47, 47, 47, 47, 51, 51, 51, 51, 51, 51, 51, 51, 49, 46, 22, 6, 50, 
-  50, 50, 50, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 15, 33, 
-  52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 33, 15, 52, 
-  52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 52, 52, 15, 33, 
-  53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 40, 43, 52, 52, 33, 
-  15}, {19, 36, 54, 54, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 
-  53, 36, 19, 54, 54, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 
-  54, 54, 19, 36, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 54, 
-  54, 36, 19, 55, 55, 55, 55, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 
-  55, 55, 19, 36, 54, 54, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 
-  55, 36, 19, 54, 54, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 
-  54, 54, 19, 36, 51, 48, 44, 41, 53, 53, 53, 53, 55, 55, 55, 55, 54, 
-  54, 36, 19, 51, 48, 44, 41, 53, 53, 53, 53, 44, 44, 44, 44, 44, 44, 
-  44, 44, 6, 26, 42, 39, 43, 43, 43, 43, 41, 41, 41, 41, 41, 41, 41, 
-  41, 22, 2, 39, 38, 40, 40, 40, 40, 51, 51, 51, 51, 51, 51, 51, 51, 
-  49, 46, 6, 22, 50, 50, 50, 50, 48, 48, 48, 48, 48, 48, 48, 48, 46, 
-  45, 26, 2, 47, 47, 47, 47, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 
-  43, 40, 15, 33, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 
-  40, 33, 15, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 40, 
-  52, 52, 15, 33, 53, 53, 53, 53, 53, 53, 53, 53, 50, 47, 43, 40, 52, 
-  52, 33, 15}, {20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 59, 
-  62, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 
-  64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 64, 
-  64, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 59, 62, 64, 64, 
-  74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 59, 62, 64, 64, 74, 
-  74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 59, 62, 64, 64, 74, 74, 
-  74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 59, 62, 64, 64, 74, 74, 74, 
-  74, 55, 55, 37, 20, 71, 68, 73, 73, 59, 62, 64, 64, 62, 62, 62, 62, 
-  62, 62, 62, 62, 7, 27, 43, 43, 57, 60, 61, 61, 59, 59, 59, 59, 59, 
-  59, 59, 59, 23, 3, 40, 40, 56, 57, 58, 58, 64, 64, 64, 64, 64, 64, 
-  64, 64, 50, 47, 11, 30, 58, 61, 63, 63, 64, 64, 64, 64, 64, 64, 64, 
-  64, 50, 47, 30, 11, 58, 61, 63, 63, 68, 68, 68, 68, 68, 68, 68, 68, 
-  66, 65, 67, 67, 3, 27, 47, 47, 71, 71, 71, 71, 71, 71, 71, 71, 69, 
-  66, 70, 70, 23, 7, 50, 50, 73, 73, 73, 73, 73, 73, 73, 73, 70, 67, 
-  72, 72, 40, 43, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 70, 67, 72, 
-  72, 40, 43, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 71, 68, 73, 
-  73, 62, 59, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 73, 73, 
-  62, 59, 64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 73, 62, 
-  59, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 62, 59, 
-  64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 62, 59, 64, 
-  64, 74, 74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 62, 59, 64, 64, 
-  74, 74, 74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 62, 59, 64, 64, 74, 
-  74, 74, 74, 55, 55, 37, 20, 71, 68, 73, 73, 62, 59, 64, 64, 62, 62, 
-  62, 62, 62, 62, 62, 62, 7, 27, 43, 43, 60, 57, 61, 61, 59, 59, 59, 
-  59, 59, 59, 59, 59, 23, 3, 40, 40, 57, 56, 58, 58, 64, 64, 64, 64, 
-  64, 64, 64, 64, 50, 47, 11, 30, 61, 58, 63, 63, 64, 64, 64, 64, 64, 
-  64, 64, 64, 50, 47, 30, 11, 61, 58, 63, 63, 71, 71, 71, 71, 71, 71, 
-  71, 71, 69, 66, 70, 70, 7, 23, 50, 50, 68, 68, 68, 68, 68, 68, 68, 
-  68, 66, 65, 67, 67, 27, 3, 47, 47, 73, 73, 73, 73, 73, 73, 73, 73, 
-  70, 67, 72, 72, 43, 40, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 70, 
-  67, 72, 72, 43, 40, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 71, 
-  68, 73, 73, 64, 64, 59, 62, 37, 20, 55, 55, 74, 74, 74, 74, 71, 68, 
-  73, 73, 64, 64, 59, 62, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68, 73, 
-  73, 64, 64, 59, 62, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73, 73, 
-  64, 64, 59, 62, 74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73, 64, 
-  64, 59, 62, 74, 74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 64, 64, 
-  59, 62, 74, 74, 74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 64, 64, 59, 
-  62, 74, 74, 74, 74, 55, 55, 37, 20, 71, 68, 73, 73, 64, 64, 59, 62, 
-  62, 62, 62, 62, 62, 62, 62, 62, 7, 27, 43, 43, 61, 61, 57, 60, 59, 
-  59, 59, 59, 59, 59, 59, 59, 23, 3, 40, 40, 58, 58, 56, 57, 64, 64, 
-  64, 64, 64, 64, 64, 64, 50, 47, 11, 30, 63, 63, 58, 61, 64, 64, 64, 
-  64, 64, 64, 64, 64, 50, 47, 30, 11, 63, 63, 58, 61, 73, 73, 73, 73, 
-  73, 73, 73, 73, 70, 67, 72, 72, 11, 30, 40, 43, 73, 73, 73, 73, 73, 
-  73, 73, 73, 70, 67, 72, 72, 30, 11, 40, 43, 68, 68, 68, 68, 68, 68, 
-  68, 68, 66, 65, 67, 67, 47, 47, 3, 27, 71, 71, 71, 71, 71, 71, 71, 
-  71, 69, 66, 70, 70, 50, 50, 23, 7}, {20, 37, 55, 55, 74, 74, 74, 74,
-   71, 68, 73, 73, 64, 64, 62, 59, 37, 20, 55, 55, 74, 74, 74, 74, 71,
-   68, 73, 73, 64, 64, 62, 59, 55, 55, 20, 37, 74, 74, 74, 74, 71, 68,
-   73, 73, 64, 64, 62, 59, 55, 55, 37, 20, 74, 74, 74, 74, 71, 68, 73,
-   73, 64, 64, 62, 59, 74, 74, 74, 74, 20, 37, 55, 55, 71, 68, 73, 73,
-   64, 64, 62, 59, 74, 74, 74, 74, 37, 20, 55, 55, 71, 68, 73, 73, 64,
-   64, 62, 59, 74, 74, 74, 74, 55, 55, 20, 37, 71, 68, 73, 73, 64, 64,
-   62, 59, 74, 74, 74, 74, 55, 55, 37, 20, 71, 68, 73, 73, 64, 64, 62,
-   59, 62, 62, 62, 62, 62, 62, 62, 62, 7, 27, 43, 43, 61, 61, 60, 57, 
-  59, 59, 59, 59, 59, 59, 59, 59, 23, 3, 40, 40, 58, 58, 57, 56, 64, 
-  64, 64, 64, 64, 64, 64, 64, 50, 47, 11, 30, 63, 63, 61, 58, 64, 64, 
-  64, 64, 64, 64, 64, 64, 50, 47, 30, 11, 63, 63, 61, 58, 73, 73, 73, 
-  73, 73, 73, 73, 73, 70, 67, 72, 72, 11, 30, 43, 40, 73, 73, 73, 73, 
-  73, 73, 73, 73, 70, 67, 72, 72, 30, 11, 43, 40, 71, 71, 71, 71, 71, 
-  71, 71, 71, 69, 66, 70, 70, 50, 50, 7, 23, 68, 68, 68, 68, 68, 68, 
-  68, 68, 66, 65, 67, 67, 47, 47, 27, 3}, {4, 28, 48, 48, 68, 68, 68, 
-  68, 87, 87, 85, 86, 88, 88, 88, 88, 24, 8, 51, 51, 71, 71, 71, 71, 
-  90, 90, 86, 89, 91, 91, 91, 91, 41, 44, 12, 31, 73, 73, 73, 73, 92, 
-  92, 87, 90, 93, 93, 93, 93, 41, 44, 31, 12, 73, 73, 73, 73, 92, 92, 
-  87, 90, 93, 93, 93, 93, 59, 62, 64, 64, 16, 34, 53, 53, 93, 93, 88, 
-  91, 94, 94, 94, 94, 59, 62, 64, 64, 34, 16, 53, 53, 93, 93, 88, 91, 
-  94, 94, 94, 94, 59, 62, 64, 64, 53, 53, 16, 34, 93, 93, 88, 91, 94, 
-  94, 94, 94, 59, 62, 64, 64, 53, 53, 34, 16, 93, 93, 88, 91, 94, 94, 
-  94, 94, 77, 80, 82, 82, 83, 83, 83, 83, 12, 31, 48, 51, 64, 64, 64, 
-  64, 77, 80, 82, 82, 83, 83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 64, 
-  75, 76, 77, 77, 78, 78, 78, 78, 41, 41, 4, 24, 59, 59, 59, 59, 76, 
-  79, 80, 80, 81, 81, 81, 81, 44, 44, 28, 8, 62, 62, 62, 62, 78, 81, 
-  83, 83, 84, 84, 84, 84, 73, 73, 68, 71, 16, 34, 53, 53, 78, 81, 83, 
-  83, 84, 84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 53, 78, 81, 83, 83, 
-  84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 78, 81, 83, 83, 84, 
-  84, 84, 84, 73, 73, 68, 71, 53, 53, 34, 16}, {8, 24, 51, 51, 71, 71,
-   71, 71, 90, 90, 86, 89, 91, 91, 91, 91, 28, 4, 48, 48, 68, 68, 68, 
-  68, 87, 87, 85, 86, 88, 88, 88, 88, 44, 41, 12, 31, 73, 73, 73, 73, 
-  92, 92, 87, 90, 93, 93, 93, 93, 44, 41, 31, 12, 73, 73, 73, 73, 92, 
-  92, 87, 90, 93, 93, 93, 93, 62, 59, 64, 64, 16, 34, 53, 53, 93, 93, 
-  88, 91, 94, 94, 94, 94, 62, 59, 64, 64, 34, 16, 53, 53, 93, 93, 88, 
-  91, 94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 16, 34, 93, 93, 88, 91, 
-  94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 34, 16, 93, 93, 88, 91, 94, 
-  94, 94, 94, 80, 77, 82, 82, 83, 83, 83, 83, 12, 31, 48, 51, 64, 64, 
-  64, 64, 80, 77, 82, 82, 83, 83, 83, 83, 31, 12, 48, 51, 64, 64, 64, 
-  64, 76, 75, 77, 77, 78, 78, 78, 78, 41, 41, 4, 24, 59, 59, 59, 59, 
-  79, 76, 80, 80, 81, 81, 81, 81, 44, 44, 28, 8, 62, 62, 62, 62, 81, 
-  78, 83, 83, 84, 84, 84, 84, 73, 73, 68, 71, 16, 34, 53, 53, 81, 78, 
-  83, 83, 84, 84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 53, 81, 78, 83, 
-  83, 84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 81, 78, 83, 83, 
-  84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 34, 16}, {12, 31, 41, 44, 
-  73, 73, 73, 73, 92, 92, 87, 90, 93, 93, 93, 93, 31, 12, 41, 44, 73, 
-  73, 73, 73, 92, 92, 87, 90, 93, 93, 93, 93, 48, 48, 4, 28, 68, 68, 
-  68, 68, 87, 87, 85, 86, 88, 88, 88, 88, 51, 51, 24, 8, 71, 71, 71, 
-  71, 90, 90, 86, 89, 91, 91, 91, 91, 64, 64, 59, 62, 16, 34, 53, 53, 
-  93, 93, 88, 91, 94, 94, 94, 94, 64, 64, 59, 62, 34, 16, 53, 53, 93, 
-  93, 88, 91, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 16, 34, 93, 93, 
-  88, 91, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 34, 16, 93, 93, 88, 
-  91, 94, 94, 94, 94, 82, 82, 77, 80, 83, 83, 83, 83, 12, 31, 48, 51, 
-  64, 64, 64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 31, 12, 48, 51, 64, 
-  64, 64, 64, 77, 77, 75, 76, 78, 78, 78, 78, 41, 41, 4, 24, 59, 59, 
-  59, 59, 80, 80, 76, 79, 81, 81, 81, 81, 44, 44, 28, 8, 62, 62, 62, 
-  62, 83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 68, 71, 16, 34, 53, 53, 
-  83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 53, 83, 
-  83, 78, 81, 84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 83, 83, 
-  78, 81, 84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 34, 16}, {12, 31, 
-  44, 41, 73, 73, 73, 73, 92, 92, 87, 90, 93, 93, 93, 93, 31, 12, 44, 
-  41, 73, 73, 73, 73, 92, 92, 87, 90, 93, 93, 93, 93, 51, 51, 8, 24, 
-  71, 71, 71, 71, 90, 90, 86, 89, 91, 91, 91, 91, 48, 48, 28, 4, 68, 
-  68, 68, 68, 87, 87, 85, 86, 88, 88, 88, 88, 64, 64, 62, 59, 16, 34, 
-  53, 53, 93, 93, 88, 91, 94, 94, 94, 94, 64, 64, 62, 59, 34, 16, 53, 
-  53, 93, 93, 88, 91, 94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 16, 34, 
-  93, 93, 88, 91, 94, 94, 94, 94, 64, 64, 62, 59, 53, 53, 34, 16, 93, 
-  93, 88, 91, 94, 94, 94, 94, 82, 82, 80, 77, 83, 83, 83, 83, 12, 31, 
-  48, 51, 64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 83, 31, 12, 48, 
-  51, 64, 64, 64, 64, 77, 77, 76, 75, 78, 78, 78, 78, 41, 41, 4, 24, 
-  59, 59, 59, 59, 80, 80, 79, 76, 81, 81, 81, 81, 44, 44, 28, 8, 62, 
-  62, 62, 62, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 68, 71, 16, 34, 
-  53, 53, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 68, 71, 34, 16, 53, 
-  53, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 16, 34, 
-  83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 68, 71, 53, 53, 34, 
-  16}, {16, 34, 53, 53, 59, 62, 64, 64, 93, 93, 88, 91, 94, 94, 94, 
-  94, 34, 16, 53, 53, 59, 62, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 
-  53, 53, 16, 34, 59, 62, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 53, 
-  53, 34, 16, 59, 62, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 68, 68, 
-  68, 68, 4, 28, 48, 48, 87, 87, 85, 86, 88, 88, 88, 88, 71, 71, 71, 
-  71, 24, 8, 51, 51, 90, 90, 86, 89, 91, 91, 91, 91, 73, 73, 73, 73, 
-  41, 44, 12, 31, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 73, 41, 
-  44, 31, 12, 92, 92, 87, 90, 93, 93, 93, 93, 83, 83, 83, 83, 77, 80, 
-  82, 82, 12, 31, 48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 77, 80, 82, 
-  82, 31, 12, 48, 51, 64, 64, 64, 64, 78, 78, 78, 78, 75, 76, 77, 77, 
-  41, 41, 4, 24, 59, 59, 59, 59, 81, 81, 81, 81, 76, 79, 80, 80, 44, 
-  44, 28, 8, 62, 62, 62, 62, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 
-  68, 71, 16, 34, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 68, 
-  71, 34, 16, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 68, 71, 
-  53, 53, 16, 34, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 68, 71, 53, 
-  53, 34, 16}, {16, 34, 53, 53, 62, 59, 64, 64, 93, 93, 88, 91, 94, 
-  94, 94, 94, 34, 16, 53, 53, 62, 59, 64, 64, 93, 93, 88, 91, 94, 94, 
-  94, 94, 53, 53, 16, 34, 62, 59, 64, 64, 93, 93, 88, 91, 94, 94, 94, 
-  94, 53, 53, 34, 16, 62, 59, 64, 64, 93, 93, 88, 91, 94, 94, 94, 94, 
-  71, 71, 71, 71, 8, 24, 51, 51, 90, 90, 86, 89, 91, 91, 91, 91, 68, 
-  68, 68, 68, 28, 4, 48, 48, 87, 87, 85, 86, 88, 88, 88, 88, 73, 73, 
-  73, 73, 44, 41, 12, 31, 92, 92, 87, 90, 93, 93, 93, 93, 73, 73, 73, 
-  73, 44, 41, 31, 12, 92, 92, 87, 90, 93, 93, 93, 93, 83, 83, 83, 83, 
-  80, 77, 82, 82, 12, 31, 48, 51, 64, 64, 64, 64, 83, 83, 83, 83, 80, 
-  77, 82, 82, 31, 12, 48, 51, 64, 64, 64, 64, 78, 78, 78, 78, 76, 75, 
-  77, 77, 41, 41, 4, 24, 59, 59, 59, 59, 81, 81, 81, 81, 79, 76, 80, 
-  80, 44, 44, 28, 8, 62, 62, 62, 62, 84, 84, 84, 84, 81, 78, 83, 83, 
-  73, 73, 68, 71, 16, 34, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 73, 
-  73, 68, 71, 34, 16, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 
-  68, 71, 53, 53, 16, 34, 84, 84, 84, 84, 81, 78, 83, 83, 73, 73, 68, 
-  71, 53, 53, 34, 16}, {16, 34, 53, 53, 64, 64, 59, 62, 93, 93, 88, 
-  91, 94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 59, 62, 93, 93, 88, 91, 
-  94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 59, 62, 93, 93, 88, 91, 94, 
-  94, 94, 94, 53, 53, 34, 16, 64, 64, 59, 62, 93, 93, 88, 91, 94, 94, 
-  94, 94, 73, 73, 73, 73, 12, 31, 41, 44, 92, 92, 87, 90, 93, 93, 93, 
-  93, 73, 73, 73, 73, 31, 12, 41, 44, 92, 92, 87, 90, 93, 93, 93, 93, 
-  68, 68, 68, 68, 48, 48, 4, 28, 87, 87, 85, 86, 88, 88, 88, 88, 71, 
-  71, 71, 71, 51, 51, 24, 8, 90, 90, 86, 89, 91, 91, 91, 91, 83, 83, 
-  83, 83, 82, 82, 77, 80, 12, 31, 48, 51, 64, 64, 64, 64, 83, 83, 83, 
-  83, 82, 82, 77, 80, 31, 12, 48, 51, 64, 64, 64, 64, 78, 78, 78, 78, 
-  77, 77, 75, 76, 41, 41, 4, 24, 59, 59, 59, 59, 81, 81, 81, 81, 80, 
-  80, 76, 79, 44, 44, 28, 8, 62, 62, 62, 62, 84, 84, 84, 84, 83, 83, 
-  78, 81, 73, 73, 68, 71, 16, 34, 53, 53, 84, 84, 84, 84, 83, 83, 78, 
-  81, 73, 73, 68, 71, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 78, 81, 
-  73, 73, 68, 71, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 78, 81, 73, 
-  73, 68, 71, 53, 53, 34, 16}, {16, 34, 53, 53, 64, 64, 62, 59, 93, 
-  93, 88, 91, 94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 62, 59, 93, 93, 
-  88, 91, 94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 62, 59, 93, 93, 88, 
-  91, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 62, 59, 93, 93, 88, 91, 
-  94, 94, 94, 94, 73, 73, 73, 73, 12, 31, 44, 41, 92, 92, 87, 90, 93, 
-  93, 93, 93, 73, 73, 73, 73, 31, 12, 44, 41, 92, 92, 87, 90, 93, 93, 
-  93, 93, 71, 71, 71, 71, 51, 51, 8, 24, 90, 90, 86, 89, 91, 91, 91, 
-  91, 68, 68, 68, 68, 48, 48, 28, 4, 87, 87, 85, 86, 88, 88, 88, 88, 
-  83, 83, 83, 83, 82, 82, 80, 77, 12, 31, 48, 51, 64, 64, 64, 64, 83, 
-  83, 83, 83, 82, 82, 80, 77, 31, 12, 48, 51, 64, 64, 64, 64, 78, 78, 
-  78, 78, 77, 77, 76, 75, 41, 41, 4, 24, 59, 59, 59, 59, 81, 81, 81, 
-  81, 80, 80, 79, 76, 44, 44, 28, 8, 62, 62, 62, 62, 84, 84, 84, 84, 
-  83, 83, 81, 78, 73, 73, 68, 71, 16, 34, 53, 53, 84, 84, 84, 84, 83, 
-  83, 81, 78, 73, 73, 68, 71, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 
-  81, 78, 73, 73, 68, 71, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 81, 
-  78, 73, 73, 68, 71, 53, 53, 34, 16}, {19, 36, 54, 54, 55, 55, 55, 
-  55, 41, 44, 48, 51, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 55, 55, 
-  41, 44, 48, 51, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 55, 41, 
-  44, 48, 51, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 41, 44, 
-  48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 41, 44, 48, 
-  51, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 41, 44, 48, 51, 
-  53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 41, 44, 48, 51, 53, 
-  53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 41, 44, 48, 51, 53, 53, 
-  53, 53, 48, 48, 48, 48, 48, 48, 48, 48, 2, 26, 45, 46, 47, 47, 47, 
-  47, 51, 51, 51, 51, 51, 51, 51, 51, 22, 6, 46, 49, 50, 50, 50, 50, 
-  41, 41, 41, 41, 41, 41, 41, 41, 38, 39, 2, 22, 40, 40, 40, 40, 44, 
-  44, 44, 44, 44, 44, 44, 44, 39, 42, 26, 6, 43, 43, 43, 43, 53, 53, 
-  53, 53, 53, 53, 53, 53, 40, 43, 47, 50, 15, 33, 52, 52, 53, 53, 53, 
-  53, 53, 53, 53, 53, 40, 43, 47, 50, 33, 15, 52, 52, 53, 53, 53, 53, 
-  53, 53, 53, 53, 40, 43, 47, 50, 52, 52, 15, 33, 53, 53, 53, 53, 53, 
-  53, 53, 53, 40, 43, 47, 50, 52, 52, 33, 15}, {19, 36, 54, 54, 55, 
-  55, 55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 
-  55, 55, 44, 41, 48, 51, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 
-  55, 44, 41, 48, 51, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 
-  44, 41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 44, 
-  41, 48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 44, 41, 
-  48, 51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 44, 41, 48, 
-  51, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 44, 41, 48, 51, 
-  53, 53, 53, 53, 51, 51, 51, 51, 51, 51, 51, 51, 6, 22, 46, 49, 50, 
-  50, 50, 50, 48, 48, 48, 48, 48, 48, 48, 48, 26, 2, 45, 46, 47, 47, 
-  47, 47, 41, 41, 41, 41, 41, 41, 41, 41, 39, 38, 2, 22, 40, 40, 40, 
-  40, 44, 44, 44, 44, 44, 44, 44, 44, 42, 39, 26, 6, 43, 43, 43, 43, 
-  53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 15, 33, 52, 52, 53, 
-  53, 53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 33, 15, 52, 52, 53, 53, 
-  53, 53, 53, 53, 53, 53, 43, 40, 47, 50, 52, 52, 15, 33, 53, 53, 53, 
-  53, 53, 53, 53, 53, 43, 40, 47, 50, 52, 52, 33, 15}, {17, 18, 19, 
-  19, 20, 20, 20, 20, 12, 12, 4, 8, 16, 16, 16, 16, 18, 17, 19, 19, 
-  20, 20, 20, 20, 12, 12, 4, 8, 16, 16, 16, 16, 19, 19, 17, 18, 20, 
-  20, 20, 20, 12, 12, 4, 8, 16, 16, 16, 16, 19, 19, 18, 17, 20, 20, 
-  20, 20, 12, 12, 4, 8, 16, 16, 16, 16, 20, 20, 20, 20, 17, 18, 19, 
-  19, 12, 12, 4, 8, 16, 16, 16, 16, 20, 20, 20, 20, 18, 17, 19, 19, 
-  12, 12, 4, 8, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 17, 18, 12, 
-  12, 4, 8, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 18, 17, 12, 12, 4,
-   8, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12, 9, 10, 2, 6, 11,
-   11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 10, 9, 2, 6, 11, 11, 
-  11, 11, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 0, 1, 3, 3, 3, 3, 8, 8, 8, 8, 
-  8, 8, 8, 8, 6, 6, 1, 5, 7, 7, 7, 7, 16, 16, 16, 16, 16, 16, 16, 16, 
-  11, 11, 3, 7, 13, 14, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 11, 
-  11, 3, 7, 14, 13, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 11, 11, 3,
-   7, 15, 15, 13, 14, 16, 16, 16, 16, 16, 16, 16, 16, 11, 11, 3, 7, 
-  15, 15, 14, 13}, {18, 35, 36, 36, 37, 37, 37, 37, 31, 31, 28, 24, 
-  34, 34, 34, 34, 35, 18, 36, 36, 37, 37, 37, 37, 31, 31, 28, 24, 34, 
-  34, 34, 34, 36, 36, 18, 35, 37, 37, 37, 37, 31, 31, 28, 24, 34, 34, 
-  34, 34, 36, 36, 35, 18, 37, 37, 37, 37, 31, 31, 28, 24, 34, 34, 34, 
-  34, 37, 37, 37, 37, 18, 35, 36, 36, 31, 31, 28, 24, 34, 34, 34, 34, 
-  37, 37, 37, 37, 35, 18, 36, 36, 31, 31, 28, 24, 34, 34, 34, 34, 37, 
-  37, 37, 37, 36, 36, 18, 35, 31, 31, 28, 24, 34, 34, 34, 34, 37, 37, 
-  37, 37, 36, 36, 35, 18, 31, 31, 28, 24, 34, 34, 34, 34, 31, 31, 31, 
-  31, 31, 31, 31, 31, 10, 29, 26, 22, 30, 30, 30, 30, 31, 31, 31, 31, 
-  31, 31, 31, 31, 29, 10, 26, 22, 30, 30, 30, 30, 24, 24, 24, 24, 24, 
-  24, 24, 24, 22, 22, 1, 21, 23, 23, 23, 23, 28, 28, 28, 28, 28, 28, 
-  28, 28, 26, 26, 25, 1, 27, 27, 27, 27, 34, 34, 34, 34, 34, 34, 34, 
-  34, 30, 30, 27, 23, 14, 32, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 
-  30, 30, 27, 23, 32, 14, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 30, 
-  30, 27, 23, 33, 33, 14, 32, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 
-  27, 23, 33, 33, 32, 14}, {20, 37, 55, 55, 74, 74, 74, 74, 73, 73, 
-  68, 71, 59, 62, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 73, 73, 68, 
-  71, 59, 62, 64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 68, 71, 
-  59, 62, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 73, 73, 68, 71, 59, 
-  62, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 68, 71, 59, 62, 
-  64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 68, 71, 59, 62, 64, 
-  64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 68, 71, 59, 62, 64, 64, 
-  74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 68, 71, 59, 62, 64, 64, 64, 
-  64, 64, 64, 64, 64, 64, 64, 11, 30, 47, 50, 58, 61, 63, 63, 64, 64, 
-  64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 58, 61, 63, 63, 59, 59, 59, 
-  59, 59, 59, 59, 59, 40, 40, 3, 23, 56, 57, 58, 58, 62, 62, 62, 62, 
-  62, 62, 62, 62, 43, 43, 27, 7, 57, 60, 61, 61, 68, 68, 68, 68, 68, 
-  68, 68, 68, 67, 67, 65, 66, 3, 27, 47, 47, 71, 71, 71, 71, 71, 71, 
-  71, 71, 70, 70, 66, 69, 23, 7, 50, 50, 73, 73, 73, 73, 73, 73, 73, 
-  73, 72, 72, 67, 70, 40, 43, 11, 30, 73, 73, 73, 73, 73, 73, 73, 73, 
-  72, 72, 67, 70, 40, 43, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 
-  73, 73, 68, 71, 62, 59, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 73, 
-  73, 68, 71, 62, 59, 64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 73, 73, 
-  68, 71, 62, 59, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 73, 73, 68, 
-  71, 62, 59, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 68, 71, 
-  62, 59, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 68, 71, 62, 
-  59, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 68, 71, 62, 59, 
-  64, 64, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 68, 71, 62, 59, 64, 
-  64, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 47, 50, 61, 58, 63, 63, 
-  64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 61, 58, 63, 63, 59, 
-  59, 59, 59, 59, 59, 59, 59, 40, 40, 3, 23, 57, 56, 58, 58, 62, 62, 
-  62, 62, 62, 62, 62, 62, 43, 43, 27, 7, 60, 57, 61, 61, 71, 71, 71, 
-  71, 71, 71, 71, 71, 70, 70, 66, 69, 7, 23, 50, 50, 68, 68, 68, 68, 
-  68, 68, 68, 68, 67, 67, 65, 66, 27, 3, 47, 47, 73, 73, 73, 73, 73, 
-  73, 73, 73, 72, 72, 67, 70, 43, 40, 11, 30, 73, 73, 73, 73, 73, 73, 
-  73, 73, 72, 72, 67, 70, 43, 40, 30, 11}, {20, 37, 55, 55, 74, 74, 
-  74, 74, 73, 73, 68, 71, 64, 64, 59, 62, 37, 20, 55, 55, 74, 74, 74, 
-  74, 73, 73, 68, 71, 64, 64, 59, 62, 55, 55, 20, 37, 74, 74, 74, 74, 
-  73, 73, 68, 71, 64, 64, 59, 62, 55, 55, 37, 20, 74, 74, 74, 74, 73, 
-  73, 68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 
-  68, 71, 64, 64, 59, 62, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 68, 
-  71, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 68, 71, 
-  64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 68, 71, 64, 
-  64, 59, 62, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 47, 50, 63, 63, 
-  58, 61, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 63, 63, 58, 
-  61, 59, 59, 59, 59, 59, 59, 59, 59, 40, 40, 3, 23, 58, 58, 56, 57, 
-  62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 27, 7, 61, 61, 57, 60, 73, 
-  73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 11, 30, 40, 43, 73, 73, 
-  73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 30, 11, 40, 43, 68, 68, 68, 
-  68, 68, 68, 68, 68, 67, 67, 65, 66, 47, 47, 3, 27, 71, 71, 71, 71, 
-  71, 71, 71, 71, 70, 70, 66, 69, 50, 50, 23, 7}, {20, 37, 55, 55, 74,
-   74, 74, 74, 73, 73, 68, 71, 64, 64, 62, 59, 37, 20, 55, 55, 74, 74,
-   74, 74, 73, 73, 68, 71, 64, 64, 62, 59, 55, 55, 20, 37, 74, 74, 74,
-   74, 73, 73, 68, 71, 64, 64, 62, 59, 55, 55, 37, 20, 74, 74, 74, 74,
-   73, 73, 68, 71, 64, 64, 62, 59, 74, 74, 74, 74, 20, 37, 55, 55, 73,
-   73, 68, 71, 64, 64, 62, 59, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73,
-   68, 71, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 68,
-   71, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 68, 71,
-   64, 64, 62, 59, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 47, 50, 63,
-   63, 61, 58, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 47, 50, 63, 63,
-   61, 58, 59, 59, 59, 59, 59, 59, 59, 59, 40, 40, 3, 23, 58, 58, 57, 
-  56, 62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 27, 7, 61, 61, 60, 57, 
-  73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 11, 30, 43, 40, 73, 
-  73, 73, 73, 73, 73, 73, 73, 72, 72, 67, 70, 30, 11, 43, 40, 71, 71, 
-  71, 71, 71, 71, 71, 71, 70, 70, 66, 69, 50, 50, 7, 23, 68, 68, 68, 
-  68, 68, 68, 68, 68, 67, 67, 65, 66, 47, 47, 27, 3}, {4, 28, 48, 48, 
-  68, 68, 68, 68, 87, 87, 86, 85, 88, 88, 88, 88, 24, 8, 51, 51, 71, 
-  71, 71, 71, 90, 90, 89, 86, 91, 91, 91, 91, 41, 44, 12, 31, 73, 73, 
-  73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 41, 44, 31, 12, 73, 73, 73, 
-  73, 92, 92, 90, 87, 93, 93, 93, 93, 59, 62, 64, 64, 16, 34, 53, 53, 
-  93, 93, 91, 88, 94, 94, 94, 94, 59, 62, 64, 64, 34, 16, 53, 53, 93, 
-  93, 91, 88, 94, 94, 94, 94, 59, 62, 64, 64, 53, 53, 16, 34, 93, 93, 
-  91, 88, 94, 94, 94, 94, 59, 62, 64, 64, 53, 53, 34, 16, 93, 93, 91, 
-  88, 94, 94, 94, 94, 77, 80, 82, 82, 83, 83, 83, 83, 12, 31, 51, 48, 
-  64, 64, 64, 64, 77, 80, 82, 82, 83, 83, 83, 83, 31, 12, 51, 48, 64, 
-  64, 64, 64, 76, 79, 80, 80, 81, 81, 81, 81, 44, 44, 8, 28, 62, 62, 
-  62, 62, 75, 76, 77, 77, 78, 78, 78, 78, 41, 41, 24, 4, 59, 59, 59, 
-  59, 78, 81, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 16, 34, 53, 53, 
-  78, 81, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 78, 
-  81, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 78, 81, 
-  83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 16}, {8, 24, 51,
-   51, 71, 71, 71, 71, 90, 90, 89, 86, 91, 91, 91, 91, 28, 4, 48, 48, 
-  68, 68, 68, 68, 87, 87, 86, 85, 88, 88, 88, 88, 44, 41, 12, 31, 73, 
-  73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 44, 41, 31, 12, 73, 73, 
-  73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 62, 59, 64, 64, 16, 34, 53, 
-  53, 93, 93, 91, 88, 94, 94, 94, 94, 62, 59, 64, 64, 34, 16, 53, 53, 
-  93, 93, 91, 88, 94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 16, 34, 93, 
-  93, 91, 88, 94, 94, 94, 94, 62, 59, 64, 64, 53, 53, 34, 16, 93, 93, 
-  91, 88, 94, 94, 94, 94, 80, 77, 82, 82, 83, 83, 83, 83, 12, 31, 51, 
-  48, 64, 64, 64, 64, 80, 77, 82, 82, 83, 83, 83, 83, 31, 12, 51, 48, 
-  64, 64, 64, 64, 79, 76, 80, 80, 81, 81, 81, 81, 44, 44, 8, 28, 62, 
-  62, 62, 62, 76, 75, 77, 77, 78, 78, 78, 78, 41, 41, 24, 4, 59, 59, 
-  59, 59, 81, 78, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 16, 34, 53, 
-  53, 81, 78, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 53, 53, 
-  81, 78, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 34, 81, 
-  78, 83, 83, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 16}, {12, 
-  31, 41, 44, 73, 73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 31, 12, 
-  41, 44, 73, 73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 48, 48, 4, 
-  28, 68, 68, 68, 68, 87, 87, 86, 85, 88, 88, 88, 88, 51, 51, 24, 8, 
-  71, 71, 71, 71, 90, 90, 89, 86, 91, 91, 91, 91, 64, 64, 59, 62, 16, 
-  34, 53, 53, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 34, 16, 
-  53, 53, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 16, 
-  34, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 59, 62, 53, 53, 34, 16, 
-  93, 93, 91, 88, 94, 94, 94, 94, 82, 82, 77, 80, 83, 83, 83, 83, 12, 
-  31, 51, 48, 64, 64, 64, 64, 82, 82, 77, 80, 83, 83, 83, 83, 31, 12, 
-  51, 48, 64, 64, 64, 64, 80, 80, 76, 79, 81, 81, 81, 81, 44, 44, 8, 
-  28, 62, 62, 62, 62, 77, 77, 75, 76, 78, 78, 78, 78, 41, 41, 24, 4, 
-  59, 59, 59, 59, 83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 16, 
-  34, 53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 34, 16, 
-  53, 53, 83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 16, 
-  34, 83, 83, 78, 81, 84, 84, 84, 84, 73, 73, 71, 68, 53, 53, 34, 
-  16}, {12, 31, 44, 41, 73, 73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 
-  93, 31, 12, 44, 41, 73, 73, 73, 73, 92, 92, 90, 87, 93, 93, 93, 93, 
-  51, 51, 8, 24, 71, 71, 71, 71, 90, 90, 89, 86, 91, 91, 91, 91, 48, 
-  48, 28, 4, 68, 68, 68, 68, 87, 87, 86, 85, 88, 88, 88, 88, 64, 64, 
-  62, 59, 16, 34, 53, 53, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 
-  59, 34, 16, 53, 53, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 
-  53, 53, 16, 34, 93, 93, 91, 88, 94, 94, 94, 94, 64, 64, 62, 59, 53, 
-  53, 34, 16, 93, 93, 91, 88, 94, 94, 94, 94, 82, 82, 80, 77, 83, 83, 
-  83, 83, 12, 31, 51, 48, 64, 64, 64, 64, 82, 82, 80, 77, 83, 83, 83, 
-  83, 31, 12, 51, 48, 64, 64, 64, 64, 80, 80, 79, 76, 81, 81, 81, 81, 
-  44, 44, 8, 28, 62, 62, 62, 62, 77, 77, 76, 75, 78, 78, 78, 78, 41, 
-  41, 24, 4, 59, 59, 59, 59, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 
-  71, 68, 16, 34, 53, 53, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 
-  68, 34, 16, 53, 53, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 68, 
-  53, 53, 16, 34, 83, 83, 81, 78, 84, 84, 84, 84, 73, 73, 71, 68, 53, 
-  53, 34, 16}, {16, 34, 53, 53, 59, 62, 64, 64, 93, 93, 91, 88, 94, 
-  94, 94, 94, 34, 16, 53, 53, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 
-  94, 94, 53, 53, 16, 34, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 94, 
-  94, 53, 53, 34, 16, 59, 62, 64, 64, 93, 93, 91, 88, 94, 94, 94, 94, 
-  68, 68, 68, 68, 4, 28, 48, 48, 87, 87, 86, 85, 88, 88, 88, 88, 71, 
-  71, 71, 71, 24, 8, 51, 51, 90, 90, 89, 86, 91, 91, 91, 91, 73, 73, 
-  73, 73, 41, 44, 12, 31, 92, 92, 90, 87, 93, 93, 93, 93, 73, 73, 73, 
-  73, 41, 44, 31, 12, 92, 92, 90, 87, 93, 93, 93, 93, 83, 83, 83, 83, 
-  77, 80, 82, 82, 12, 31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 83, 77, 
-  80, 82, 82, 31, 12, 51, 48, 64, 64, 64, 64, 81, 81, 81, 81, 76, 79, 
-  80, 80, 44, 44, 8, 28, 62, 62, 62, 62, 78, 78, 78, 78, 75, 76, 77, 
-  77, 41, 41, 24, 4, 59, 59, 59, 59, 84, 84, 84, 84, 78, 81, 83, 83, 
-  73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 
-  73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 
-  71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 78, 81, 83, 83, 73, 73, 71, 
-  68, 53, 53, 34, 16}, {16, 34, 53, 53, 62, 59, 64, 64, 93, 93, 91, 
-  88, 94, 94, 94, 94, 34, 16, 53, 53, 62, 59, 64, 64, 93, 93, 91, 88, 
-  94, 94, 94, 94, 53, 53, 16, 34, 62, 59, 64, 64, 93, 93, 91, 88, 94, 
-  94, 94, 94, 53, 53, 34, 16, 62, 59, 64, 64, 93, 93, 91, 88, 94, 94, 
-  94, 94, 71, 71, 71, 71, 8, 24, 51, 51, 90, 90, 89, 86, 91, 91, 91, 
-  91, 68, 68, 68, 68, 28, 4, 48, 48, 87, 87, 86, 85, 88, 88, 88, 88, 
-  73, 73, 73, 73, 44, 41, 12, 31, 92, 92, 90, 87, 93, 93, 93, 93, 73, 
-  73, 73, 73, 44, 41, 31, 12, 92, 92, 90, 87, 93, 93, 93, 93, 83, 83, 
-  83, 83, 80, 77, 82, 82, 12, 31, 51, 48, 64, 64, 64, 64, 83, 83, 83, 
-  83, 80, 77, 82, 82, 31, 12, 51, 48, 64, 64, 64, 64, 81, 81, 81, 81, 
-  79, 76, 80, 80, 44, 44, 8, 28, 62, 62, 62, 62, 78, 78, 78, 78, 76, 
-  75, 77, 77, 41, 41, 24, 4, 59, 59, 59, 59, 84, 84, 84, 84, 81, 78, 
-  83, 83, 73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 81, 78, 83, 
-  83, 73, 73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 81, 78, 83, 83, 
-  73, 73, 71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 81, 78, 83, 83, 73, 
-  73, 71, 68, 53, 53, 34, 16}, {16, 34, 53, 53, 64, 64, 59, 62, 93, 
-  93, 91, 88, 94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 59, 62, 93, 93, 
-  91, 88, 94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 59, 62, 93, 93, 91, 
-  88, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 59, 62, 93, 93, 91, 88, 
-  94, 94, 94, 94, 73, 73, 73, 73, 12, 31, 41, 44, 92, 92, 90, 87, 93, 
-  93, 93, 93, 73, 73, 73, 73, 31, 12, 41, 44, 92, 92, 90, 87, 93, 93, 
-  93, 93, 68, 68, 68, 68, 48, 48, 4, 28, 87, 87, 86, 85, 88, 88, 88, 
-  88, 71, 71, 71, 71, 51, 51, 24, 8, 90, 90, 89, 86, 91, 91, 91, 91, 
-  83, 83, 83, 83, 82, 82, 77, 80, 12, 31, 51, 48, 64, 64, 64, 64, 83, 
-  83, 83, 83, 82, 82, 77, 80, 31, 12, 51, 48, 64, 64, 64, 64, 81, 81, 
-  81, 81, 80, 80, 76, 79, 44, 44, 8, 28, 62, 62, 62, 62, 78, 78, 78, 
-  78, 77, 77, 75, 76, 41, 41, 24, 4, 59, 59, 59, 59, 84, 84, 84, 84, 
-  83, 83, 78, 81, 73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 84, 83, 
-  83, 78, 81, 73, 73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 83, 83, 
-  78, 81, 73, 73, 71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 83, 83, 78, 
-  81, 73, 73, 71, 68, 53, 53, 34, 16}, {16, 34, 53, 53, 64, 64, 62, 
-  59, 93, 93, 91, 88, 94, 94, 94, 94, 34, 16, 53, 53, 64, 64, 62, 59, 
-  93, 93, 91, 88, 94, 94, 94, 94, 53, 53, 16, 34, 64, 64, 62, 59, 93, 
-  93, 91, 88, 94, 94, 94, 94, 53, 53, 34, 16, 64, 64, 62, 59, 93, 93, 
-  91, 88, 94, 94, 94, 94, 73, 73, 73, 73, 12, 31, 44, 41, 92, 92, 90, 
-  87, 93, 93, 93, 93, 73, 73, 73, 73, 31, 12, 44, 41, 92, 92, 90, 87, 
-  93, 93, 93, 93, 71, 71, 71, 71, 51, 51, 8, 24, 90, 90, 89, 86, 91, 
-  91, 91, 91, 68, 68, 68, 68, 48, 48, 28, 4, 87, 87, 86, 85, 88, 88, 
-  88, 88, 83, 83, 83, 83, 82, 82, 80, 77, 12, 31, 51, 48, 64, 64, 64, 
-  64, 83, 83, 83, 83, 82, 82, 80, 77, 31, 12, 51, 48, 64, 64, 64, 64, 
-  81, 81, 81, 81, 80, 80, 79, 76, 44, 44, 8, 28, 62, 62, 62, 62, 78, 
-  78, 78, 78, 77, 77, 76, 75, 41, 41, 24, 4, 59, 59, 59, 59, 84, 84, 
-  84, 84, 83, 83, 81, 78, 73, 73, 71, 68, 16, 34, 53, 53, 84, 84, 84, 
-  84, 83, 83, 81, 78, 73, 73, 71, 68, 34, 16, 53, 53, 84, 84, 84, 84, 
-  83, 83, 81, 78, 73, 73, 71, 68, 53, 53, 16, 34, 84, 84, 84, 84, 83, 
-  83, 81, 78, 73, 73, 71, 68, 53, 53, 34, 16}, {19, 36, 54, 54, 55, 
-  55, 55, 55, 41, 44, 51, 48, 53, 53, 53, 53, 36, 19, 54, 54, 55, 55, 
-  55, 55, 41, 44, 51, 48, 53, 53, 53, 53, 54, 54, 19, 36, 55, 55, 55, 
-  55, 41, 44, 51, 48, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 55, 55, 
-  41, 44, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 54, 41, 
-  44, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 41, 44, 
-  51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 41, 44, 51, 
-  48, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 41, 44, 51, 48, 
-  53, 53, 53, 53, 48, 48, 48, 48, 48, 48, 48, 48, 2, 26, 46, 45, 47, 
-  47, 47, 47, 51, 51, 51, 51, 51, 51, 51, 51, 22, 6, 49, 46, 50, 50, 
-  50, 50, 44, 44, 44, 44, 44, 44, 44, 44, 39, 42, 6, 26, 43, 43, 43, 
-  43, 41, 41, 41, 41, 41, 41, 41, 41, 38, 39, 22, 2, 40, 40, 40, 40, 
-  53, 53, 53, 53, 53, 53, 53, 53, 40, 43, 50, 47, 15, 33, 52, 52, 53, 
-  53, 53, 53, 53, 53, 53, 53, 40, 43, 50, 47, 33, 15, 52, 52, 53, 53, 
-  53, 53, 53, 53, 53, 53, 40, 43, 50, 47, 52, 52, 15, 33, 53, 53, 53, 
-  53, 53, 53, 53, 53, 40, 43, 50, 47, 52, 52, 33, 15}, {19, 36, 54, 
-  54, 55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 36, 19, 54, 54, 
-  55, 55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 54, 54, 19, 36, 55, 
-  55, 55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 54, 54, 36, 19, 55, 55, 
-  55, 55, 44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 19, 36, 54, 
-  54, 44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 36, 19, 54, 54, 
-  44, 41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 19, 36, 44, 
-  41, 51, 48, 53, 53, 53, 53, 55, 55, 55, 55, 54, 54, 36, 19, 44, 41, 
-  51, 48, 53, 53, 53, 53, 51, 51, 51, 51, 51, 51, 51, 51, 6, 22, 49, 
-  46, 50, 50, 50, 50, 48, 48, 48, 48, 48, 48, 48, 48, 26, 2, 46, 45, 
-  47, 47, 47, 47, 44, 44, 44, 44, 44, 44, 44, 44, 42, 39, 6, 26, 43, 
-  43, 43, 43, 41, 41, 41, 41, 41, 41, 41, 41, 39, 38, 22, 2, 40, 40, 
-  40, 40, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 47, 15, 33, 52, 
-  52, 53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 47, 33, 15, 52, 52, 
-  53, 53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 47, 52, 52, 15, 33, 53, 
-  53, 53, 53, 53, 53, 53, 53, 43, 40, 50, 47, 52, 52, 33, 15}, {18, 
-  35, 36, 36, 37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 34, 34, 35, 18, 
-  36, 36, 37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 34, 34, 36, 36, 18, 
-  35, 37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 34, 34, 36, 36, 35, 18, 
-  37, 37, 37, 37, 31, 31, 24, 28, 34, 34, 34, 34, 37, 37, 37, 37, 18, 
-  35, 36, 36, 31, 31, 24, 28, 34, 34, 34, 34, 37, 37, 37, 37, 35, 18, 
-  36, 36, 31, 31, 24, 28, 34, 34, 34, 34, 37, 37, 37, 37, 36, 36, 18, 
-  35, 31, 31, 24, 28, 34, 34, 34, 34, 37, 37, 37, 37, 36, 36, 35, 18, 
-  31, 31, 24, 28, 34, 34, 34, 34, 31, 31, 31, 31, 31, 31, 31, 31, 10, 
-  29, 22, 26, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 29, 10, 
-  22, 26, 30, 30, 30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 26, 26, 1, 
-  25, 27, 27, 27, 27, 24, 24, 24, 24, 24, 24, 24, 24, 22, 22, 21, 1, 
-  23, 23, 23, 23, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 23, 27, 14, 
-  32, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 23, 27, 32, 14, 
-  33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 23, 27, 33, 33, 14, 
-  32, 34, 34, 34, 34, 34, 34, 34, 34, 30, 30, 23, 27, 33, 33, 32, 
-  14}, {17, 18, 19, 19, 20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 
-  18, 17, 19, 19, 20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 19, 
-  19, 17, 18, 20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 19, 19, 
-  18, 17, 20, 20, 20, 20, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 
-  20, 17, 18, 19, 19, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 
-  18, 17, 19, 19, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 19, 
-  19, 17, 18, 12, 12, 8, 4, 16, 16, 16, 16, 20, 20, 20, 20, 19, 19, 
-  18, 17, 12, 12, 8, 4, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 
-  12, 9, 10, 6, 2, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-   9, 6, 2, 11, 11, 11, 11, 8, 8, 8, 8, 8, 8, 8, 8, 6, 6, 5, 1, 7, 7, 
-  7, 7, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 1, 0, 3, 3, 3, 3, 16, 16, 16, 
-  16, 16, 16, 16, 16, 11, 11, 7, 3, 13, 14, 15, 15, 16, 16, 16, 16, 
-  16, 16, 16, 16, 11, 11, 7, 3, 14, 13, 15, 15, 16, 16, 16, 16, 16, 
-  16, 16, 16, 11, 11, 7, 3, 15, 15, 13, 14, 16, 16, 16, 16, 16, 16, 
-  16, 16, 11, 11, 7, 3, 15, 15, 14, 13}, {20, 37, 55, 55, 74, 74, 74, 
-  74, 73, 73, 71, 68, 59, 62, 64, 64, 37, 20, 55, 55, 74, 74, 74, 74, 
-  73, 73, 71, 68, 59, 62, 64, 64, 55, 55, 20, 37, 74, 74, 74, 74, 73, 
-  73, 71, 68, 59, 62, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 73, 73, 
-  71, 68, 59, 62, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 73, 73, 71, 
-  68, 59, 62, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 71, 68, 
-  59, 62, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 71, 68, 59, 
-  62, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 71, 68, 59, 62, 
-  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 50, 47, 58, 61, 63, 
-  63, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 50, 47, 58, 61, 63, 63, 
-  62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 7, 27, 57, 60, 61, 61, 59, 
-  59, 59, 59, 59, 59, 59, 59, 40, 40, 23, 3, 56, 57, 58, 58, 68, 68, 
-  68, 68, 68, 68, 68, 68, 67, 67, 66, 65, 3, 27, 47, 47, 71, 71, 71, 
-  71, 71, 71, 71, 71, 70, 70, 69, 66, 23, 7, 50, 50, 73, 73, 73, 73, 
-  73, 73, 73, 73, 72, 72, 70, 67, 40, 43, 11, 30, 73, 73, 73, 73, 73, 
-  73, 73, 73, 72, 72, 70, 67, 40, 43, 30, 11}, {20, 37, 55, 55, 74, 
-  74, 74, 74, 73, 73, 71, 68, 62, 59, 64, 64, 37, 20, 55, 55, 74, 74, 
-  74, 74, 73, 73, 71, 68, 62, 59, 64, 64, 55, 55, 20, 37, 74, 74, 74, 
-  74, 73, 73, 71, 68, 62, 59, 64, 64, 55, 55, 37, 20, 74, 74, 74, 74, 
-  73, 73, 71, 68, 62, 59, 64, 64, 74, 74, 74, 74, 20, 37, 55, 55, 73, 
-  73, 71, 68, 62, 59, 64, 64, 74, 74, 74, 74, 37, 20, 55, 55, 73, 73, 
-  71, 68, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 20, 37, 73, 73, 71, 
-  68, 62, 59, 64, 64, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 71, 68, 
-  62, 59, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 50, 47, 61, 
-  58, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 50, 47, 61, 58, 
-  63, 63, 62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 7, 27, 60, 57, 61, 
-  61, 59, 59, 59, 59, 59, 59, 59, 59, 40, 40, 23, 3, 57, 56, 58, 58, 
-  71, 71, 71, 71, 71, 71, 71, 71, 70, 70, 69, 66, 7, 23, 50, 50, 68, 
-  68, 68, 68, 68, 68, 68, 68, 67, 67, 66, 65, 27, 3, 47, 47, 73, 73, 
-  73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 43, 40, 11, 30, 73, 73, 73, 
-  73, 73, 73, 73, 73, 72, 72, 70, 67, 43, 40, 30, 11}, {20, 37, 55, 
-  55, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 59, 62, 37, 20, 55, 55, 
-  74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 59, 62, 55, 55, 20, 37, 74, 
-  74, 74, 74, 73, 73, 71, 68, 64, 64, 59, 62, 55, 55, 37, 20, 74, 74, 
-  74, 74, 73, 73, 71, 68, 64, 64, 59, 62, 74, 74, 74, 74, 20, 37, 55, 
-  55, 73, 73, 71, 68, 64, 64, 59, 62, 74, 74, 74, 74, 37, 20, 55, 55, 
-  73, 73, 71, 68, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 20, 37, 73, 
-  73, 71, 68, 64, 64, 59, 62, 74, 74, 74, 74, 55, 55, 37, 20, 73, 73, 
-  71, 68, 64, 64, 59, 62, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30, 50, 
-  47, 63, 63, 58, 61, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 50, 47, 
-  63, 63, 58, 61, 62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 7, 27, 61, 
-  61, 57, 60, 59, 59, 59, 59, 59, 59, 59, 59, 40, 40, 23, 3, 58, 58, 
-  56, 57, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 11, 30, 40, 
-  43, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 30, 11, 40, 43, 
-  68, 68, 68, 68, 68, 68, 68, 68, 67, 67, 66, 65, 47, 47, 3, 27, 71, 
-  71, 71, 71, 71, 71, 71, 71, 70, 70, 69, 66, 50, 50, 23, 7}, {20, 37,
-   55, 55, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 62, 59, 37, 20, 55,
-   55, 74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 62, 59, 55, 55, 20, 37,
-   74, 74, 74, 74, 73, 73, 71, 68, 64, 64, 62, 59, 55, 55, 37, 20, 74,
-   74, 74, 74, 73, 73, 71, 68, 64, 64, 62, 59, 74, 74, 74, 74, 20, 37,
-   55, 55, 73, 73, 71, 68, 64, 64, 62, 59, 74, 74, 74, 74, 37, 20, 55,
-   55, 73, 73, 71, 68, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 20, 37,
-   73, 73, 71, 68, 64, 64, 62, 59, 74, 74, 74, 74, 55, 55, 37, 20, 73,
-   73, 71, 68, 64, 64, 62, 59, 64, 64, 64, 64, 64, 64, 64, 64, 11, 30,
-   50, 47, 63, 63, 61, 58, 64, 64, 64, 64, 64, 64, 64, 64, 30, 11, 50,
-   47, 63, 63, 61, 58, 62, 62, 62, 62, 62, 62, 62, 62, 43, 43, 7, 27, 
-  61, 61, 60, 57, 59, 59, 59, 59, 59, 59, 59, 59, 40, 40, 23, 3, 58, 
-  58, 57, 56, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 11, 30, 
-  43, 40, 73, 73, 73, 73, 73, 73, 73, 73, 72, 72, 70, 67, 30, 11, 43, 
-  40, 71, 71, 71, 71, 71, 71, 71, 71, 70, 70, 69, 66, 50, 50, 7, 23, 
-  68, 68, 68, 68, 68, 68, 68, 68, 67, 67, 66, 65, 47, 47, 27, 3}, {4, 
-  28, 48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 85, 86, 87, 87, 24, 8, 
-  51, 51, 71, 71, 71, 71, 91, 91, 91, 91, 86, 89, 90, 90, 41, 44, 12, 
-  31, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 41, 44, 31, 12, 
-  73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 59, 62, 64, 64, 16, 
-  34, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 59, 62, 64, 64, 34, 16, 
-  53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 59, 62, 64, 64, 53, 53, 16, 
-  34, 94, 94, 94, 94, 88, 91, 93, 93, 59, 62, 64, 64, 53, 53, 34, 16, 
-  94, 94, 94, 94, 88, 91, 93, 93, 78, 81, 83, 83, 84, 84, 84, 84, 16, 
-  34, 53, 53, 68, 71, 73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 34, 16, 
-  53, 53, 68, 71, 73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 16, 
-  34, 68, 71, 73, 73, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 
-  68, 71, 73, 73, 75, 76, 77, 77, 78, 78, 78, 78, 59, 59, 59, 59, 4, 
-  24, 41, 41, 76, 79, 80, 80, 81, 81, 81, 81, 62, 62, 62, 62, 28, 8, 
-  44, 44, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 12, 
-  31, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 31, 
-  12}, {8, 24, 51, 51, 71, 71, 71, 71, 91, 91, 91, 91, 86, 89, 90, 90,
-   28, 4, 48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 85, 86, 87, 87, 44, 
-  41, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 44, 41, 
-  31, 12, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 92, 62, 59, 64, 
-  64, 16, 34, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 
-  34, 16, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 53, 
-  53, 16, 34, 94, 94, 94, 94, 88, 91, 93, 93, 62, 59, 64, 64, 53, 53, 
-  34, 16, 94, 94, 94, 94, 88, 91, 93, 93, 81, 78, 83, 83, 84, 84, 84, 
-  84, 16, 34, 53, 53, 68, 71, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 
-  34, 16, 53, 53, 68, 71, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 
-  53, 16, 34, 68, 71, 73, 73, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 
-  34, 16, 68, 71, 73, 73, 76, 75, 77, 77, 78, 78, 78, 78, 59, 59, 59, 
-  59, 4, 24, 41, 41, 79, 76, 80, 80, 81, 81, 81, 81, 62, 62, 62, 62, 
-  28, 8, 44, 44, 80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 48, 
-  51, 12, 31, 80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 48, 51, 
-  31, 12}, {12, 31, 41, 44, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 
-  92, 92, 31, 12, 41, 44, 73, 73, 73, 73, 93, 93, 93, 93, 87, 90, 92, 
-  92, 48, 48, 4, 28, 68, 68, 68, 68, 88, 88, 88, 88, 85, 86, 87, 87, 
-  51, 51, 24, 8, 71, 71, 71, 71, 91, 91, 91, 91, 86, 89, 90, 90, 64, 
-  64, 59, 62, 16, 34, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 
-  59, 62, 34, 16, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 
-  62, 53, 53, 16, 34, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 59, 62, 
-  53, 53, 34, 16, 94, 94, 94, 94, 88, 91, 93, 93, 83, 83, 78, 81, 84, 
-  84, 84, 84, 16, 34, 53, 53, 68, 71, 73, 73, 83, 83, 78, 81, 84, 84, 
-  84, 84, 34, 16, 53, 53, 68, 71, 73, 73, 83, 83, 78, 81, 84, 84, 84, 
-  84, 53, 53, 16, 34, 68, 71, 73, 73, 83, 83, 78, 81, 84, 84, 84, 84, 
-  53, 53, 34, 16, 68, 71, 73, 73, 77, 77, 75, 76, 78, 78, 78, 78, 59, 
-  59, 59, 59, 4, 24, 41, 41, 80, 80, 76, 79, 81, 81, 81, 81, 62, 62, 
-  62, 62, 28, 8, 44, 44, 82, 82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 
-  64, 48, 51, 12, 31, 82, 82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 64, 
-  48, 51, 31, 12}, {12, 31, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 
-  87, 90, 92, 92, 31, 12, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 87, 
-  90, 92, 92, 51, 51, 8, 24, 71, 71, 71, 71, 91, 91, 91, 91, 86, 89, 
-  90, 90, 48, 48, 28, 4, 68, 68, 68, 68, 88, 88, 88, 88, 85, 86, 87, 
-  87, 64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 
-  64, 64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 94, 88, 91, 93, 93, 64, 
-  64, 62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 88, 91, 93, 93, 64, 64, 
-  62, 59, 53, 53, 34, 16, 94, 94, 94, 94, 88, 91, 93, 93, 83, 83, 81, 
-  78, 84, 84, 84, 84, 16, 34, 53, 53, 68, 71, 73, 73, 83, 83, 81, 78, 
-  84, 84, 84, 84, 34, 16, 53, 53, 68, 71, 73, 73, 83, 83, 81, 78, 84, 
-  84, 84, 84, 53, 53, 16, 34, 68, 71, 73, 73, 83, 83, 81, 78, 84, 84, 
-  84, 84, 53, 53, 34, 16, 68, 71, 73, 73, 77, 77, 76, 75, 78, 78, 78, 
-  78, 59, 59, 59, 59, 4, 24, 41, 41, 80, 80, 79, 76, 81, 81, 81, 81, 
-  62, 62, 62, 62, 28, 8, 44, 44, 82, 82, 80, 77, 83, 83, 83, 83, 64, 
-  64, 64, 64, 48, 51, 12, 31, 82, 82, 80, 77, 83, 83, 83, 83, 64, 64, 
-  64, 64, 48, 51, 31, 12}, {16, 34, 53, 53, 59, 62, 64, 64, 94, 94, 
-  94, 94, 88, 91, 93, 93, 34, 16, 53, 53, 59, 62, 64, 64, 94, 94, 94, 
-  94, 88, 91, 93, 93, 53, 53, 16, 34, 59, 62, 64, 64, 94, 94, 94, 94, 
-  88, 91, 93, 93, 53, 53, 34, 16, 59, 62, 64, 64, 94, 94, 94, 94, 88, 
-  91, 93, 93, 68, 68, 68, 68, 4, 28, 48, 48, 88, 88, 88, 88, 85, 86, 
-  87, 87, 71, 71, 71, 71, 24, 8, 51, 51, 91, 91, 91, 91, 86, 89, 90, 
-  90, 73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 93, 87, 90, 92, 92, 
-  73, 73, 73, 73, 41, 44, 31, 12, 93, 93, 93, 93, 87, 90, 92, 92, 84, 
-  84, 84, 84, 78, 81, 83, 83, 16, 34, 53, 53, 68, 71, 73, 73, 84, 84, 
-  84, 84, 78, 81, 83, 83, 34, 16, 53, 53, 68, 71, 73, 73, 84, 84, 84, 
-  84, 78, 81, 83, 83, 53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 84, 84, 
-  78, 81, 83, 83, 53, 53, 34, 16, 68, 71, 73, 73, 78, 78, 78, 78, 75, 
-  76, 77, 77, 59, 59, 59, 59, 4, 24, 41, 41, 81, 81, 81, 81, 76, 79, 
-  80, 80, 62, 62, 62, 62, 28, 8, 44, 44, 83, 83, 83, 83, 77, 80, 82, 
-  82, 64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 77, 80, 82, 82, 
-  64, 64, 64, 64, 48, 51, 31, 12}, {16, 34, 53, 53, 62, 59, 64, 64, 
-  94, 94, 94, 94, 88, 91, 93, 93, 34, 16, 53, 53, 62, 59, 64, 64, 94, 
-  94, 94, 94, 88, 91, 93, 93, 53, 53, 16, 34, 62, 59, 64, 64, 94, 94, 
-  94, 94, 88, 91, 93, 93, 53, 53, 34, 16, 62, 59, 64, 64, 94, 94, 94, 
-  94, 88, 91, 93, 93, 71, 71, 71, 71, 8, 24, 51, 51, 91, 91, 91, 91, 
-  86, 89, 90, 90, 68, 68, 68, 68, 28, 4, 48, 48, 88, 88, 88, 88, 85, 
-  86, 87, 87, 73, 73, 73, 73, 44, 41, 12, 31, 93, 93, 93, 93, 87, 90, 
-  92, 92, 73, 73, 73, 73, 44, 41, 31, 12, 93, 93, 93, 93, 87, 90, 92, 
-  92, 84, 84, 84, 84, 81, 78, 83, 83, 16, 34, 53, 53, 68, 71, 73, 73, 
-  84, 84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 68, 71, 73, 73, 84, 
-  84, 84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 68, 71, 73, 73, 84, 84, 
-  84, 84, 81, 78, 83, 83, 53, 53, 34, 16, 68, 71, 73, 73, 78, 78, 78, 
-  78, 76, 75, 77, 77, 59, 59, 59, 59, 4, 24, 41, 41, 81, 81, 81, 81, 
-  79, 76, 80, 80, 62, 62, 62, 62, 28, 8, 44, 44, 83, 83, 83, 83, 80, 
-  77, 82, 82, 64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 80, 77, 
-  82, 82, 64, 64, 64, 64, 48, 51, 31, 12}, {16, 34, 53, 53, 64, 64, 
-  59, 62, 94, 94, 94, 94, 88, 91, 93, 93, 34, 16, 53, 53, 64, 64, 59, 
-  62, 94, 94, 94, 94, 88, 91, 93, 93, 53, 53, 16, 34, 64, 64, 59, 62, 
-  94, 94, 94, 94, 88, 91, 93, 93, 53, 53, 34, 16, 64, 64, 59, 62, 94, 
-  94, 94, 94, 88, 91, 93, 93, 73, 73, 73, 73, 12, 31, 41, 44, 93, 93, 
-  93, 93, 87, 90, 92, 92, 73, 73, 73, 73, 31, 12, 41, 44, 93, 93, 93, 
-  93, 87, 90, 92, 92, 68, 68, 68, 68, 48, 48, 4, 28, 88, 88, 88, 88, 
-  85, 86, 87, 87, 71, 71, 71, 71, 51, 51, 24, 8, 91, 91, 91, 91, 86, 
-  89, 90, 90, 84, 84, 84, 84, 83, 83, 78, 81, 16, 34, 53, 53, 68, 71, 
-  73, 73, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 53, 53, 68, 71, 73, 
-  73, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 34, 68, 71, 73, 73, 
-  84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 68, 71, 73, 73, 78, 
-  78, 78, 78, 77, 77, 75, 76, 59, 59, 59, 59, 4, 24, 41, 41, 81, 81, 
-  81, 81, 80, 80, 76, 79, 62, 62, 62, 62, 28, 8, 44, 44, 83, 83, 83, 
-  83, 82, 82, 77, 80, 64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 83, 83, 
-  82, 82, 77, 80, 64, 64, 64, 64, 48, 51, 31, 12}, {16, 34, 53, 53, 
-  64, 64, 62, 59, 94, 94, 94, 94, 88, 91, 93, 93, 34, 16, 53, 53, 64, 
-  64, 62, 59, 94, 94, 94, 94, 88, 91, 93, 93, 53, 53, 16, 34, 64, 64, 
-  62, 59, 94, 94, 94, 94, 88, 91, 93, 93, 53, 53, 34, 16, 64, 64, 62, 
-  59, 94, 94, 94, 94, 88, 91, 93, 93, 73, 73, 73, 73, 12, 31, 44, 41, 
-  93, 93, 93, 93, 87, 90, 92, 92, 73, 73, 73, 73, 31, 12, 44, 41, 93, 
-  93, 93, 93, 87, 90, 92, 92, 71, 71, 71, 71, 51, 51, 8, 24, 91, 91, 
-  91, 91, 86, 89, 90, 90, 68, 68, 68, 68, 48, 48, 28, 4, 88, 88, 88, 
-  88, 85, 86, 87, 87, 84, 84, 84, 84, 83, 83, 81, 78, 16, 34, 53, 53, 
-  68, 71, 73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 34, 16, 53, 53, 68, 
-  71, 73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 16, 34, 68, 71, 
-  73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 34, 16, 68, 71, 73, 
-  73, 78, 78, 78, 78, 77, 77, 76, 75, 59, 59, 59, 59, 4, 24, 41, 41, 
-  81, 81, 81, 81, 80, 80, 79, 76, 62, 62, 62, 62, 28, 8, 44, 44, 83, 
-  83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 48, 51, 12, 31, 83, 83, 
-  83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 48, 51, 31, 12}, {20, 37, 
-  55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 68, 71, 73, 73, 37, 20, 55, 
-  55, 74, 74, 74, 74, 59, 62, 64, 64, 68, 71, 73, 73, 55, 55, 20, 37, 
-  74, 74, 74, 74, 59, 62, 64, 64, 68, 71, 73, 73, 55, 55, 37, 20, 74, 
-  74, 74, 74, 59, 62, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 20, 37, 
-  55, 55, 59, 62, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 37, 20, 55, 
-  55, 59, 62, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 
-  59, 62, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 55, 55, 37, 20, 59, 
-  62, 64, 64, 68, 71, 73, 73, 68, 68, 68, 68, 68, 68, 68, 68, 3, 27, 
-  47, 47, 65, 66, 67, 67, 71, 71, 71, 71, 71, 71, 71, 71, 23, 7, 50, 
-  50, 66, 69, 70, 70, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 11, 30, 
-  67, 70, 72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 30, 11, 67, 
-  70, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 56, 57, 58, 58, 3, 23, 
-  40, 40, 62, 62, 62, 62, 62, 62, 62, 62, 57, 60, 61, 61, 27, 7, 43, 
-  43, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 47, 50, 11, 30, 
-  64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 47, 50, 30, 
-  11}, {20, 37, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 68, 71, 73, 
-  73, 37, 20, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 68, 71, 73, 73, 
-  55, 55, 20, 37, 74, 74, 74, 74, 62, 59, 64, 64, 68, 71, 73, 73, 55, 
-  55, 37, 20, 74, 74, 74, 74, 62, 59, 64, 64, 68, 71, 73, 73, 74, 74, 
-  74, 74, 20, 37, 55, 55, 62, 59, 64, 64, 68, 71, 73, 73, 74, 74, 74, 
-  74, 37, 20, 55, 55, 62, 59, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 
-  55, 55, 20, 37, 62, 59, 64, 64, 68, 71, 73, 73, 74, 74, 74, 74, 55, 
-  55, 37, 20, 62, 59, 64, 64, 68, 71, 73, 73, 71, 71, 71, 71, 71, 71, 
-  71, 71, 7, 23, 50, 50, 66, 69, 70, 70, 68, 68, 68, 68, 68, 68, 68, 
-  68, 27, 3, 47, 47, 65, 66, 67, 67, 73, 73, 73, 73, 73, 73, 73, 73, 
-  43, 40, 11, 30, 67, 70, 72, 72, 73, 73, 73, 73, 73, 73, 73, 73, 43, 
-  40, 30, 11, 67, 70, 72, 72, 59, 59, 59, 59, 59, 59, 59, 59, 57, 56, 
-  58, 58, 3, 23, 40, 40, 62, 62, 62, 62, 62, 62, 62, 62, 60, 57, 61, 
-  61, 27, 7, 43, 43, 64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 63, 
-  47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 63, 47, 
-  50, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 68, 
-  71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 68, 71, 
-  73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 59, 62, 68, 71, 73, 
-  73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 59, 62, 68, 71, 73, 73, 
-  74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 59, 62, 68, 71, 73, 73, 74, 
-  74, 74, 74, 37, 20, 55, 55, 64, 64, 59, 62, 68, 71, 73, 73, 74, 74, 
-  74, 74, 55, 55, 20, 37, 64, 64, 59, 62, 68, 71, 73, 73, 74, 74, 74, 
-  74, 55, 55, 37, 20, 64, 64, 59, 62, 68, 71, 73, 73, 73, 73, 73, 73, 
-  73, 73, 73, 73, 11, 30, 40, 43, 67, 70, 72, 72, 73, 73, 73, 73, 73, 
-  73, 73, 73, 30, 11, 40, 43, 67, 70, 72, 72, 68, 68, 68, 68, 68, 68, 
-  68, 68, 47, 47, 3, 27, 65, 66, 67, 67, 71, 71, 71, 71, 71, 71, 71, 
-  71, 50, 50, 23, 7, 66, 69, 70, 70, 59, 59, 59, 59, 59, 59, 59, 59, 
-  58, 58, 56, 57, 3, 23, 40, 40, 62, 62, 62, 62, 62, 62, 62, 62, 61, 
-  61, 57, 60, 27, 7, 43, 43, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 
-  58, 61, 47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 58, 
-  61, 47, 50, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 62, 
-  59, 68, 71, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 
-  68, 71, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 62, 59, 68, 
-  71, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 62, 59, 68, 71, 
-  73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 62, 59, 68, 71, 73, 
-  73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 62, 59, 68, 71, 73, 73, 
-  74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 62, 59, 68, 71, 73, 73, 74, 
-  74, 74, 74, 55, 55, 37, 20, 64, 64, 62, 59, 68, 71, 73, 73, 73, 73, 
-  73, 73, 73, 73, 73, 73, 11, 30, 43, 40, 67, 70, 72, 72, 73, 73, 73, 
-  73, 73, 73, 73, 73, 30, 11, 43, 40, 67, 70, 72, 72, 71, 71, 71, 71, 
-  71, 71, 71, 71, 50, 50, 7, 23, 66, 69, 70, 70, 68, 68, 68, 68, 68, 
-  68, 68, 68, 47, 47, 27, 3, 65, 66, 67, 67, 59, 59, 59, 59, 59, 59, 
-  59, 59, 58, 58, 57, 56, 3, 23, 40, 40, 62, 62, 62, 62, 62, 62, 62, 
-  62, 61, 61, 60, 57, 27, 7, 43, 43, 64, 64, 64, 64, 64, 64, 64, 64, 
-  63, 63, 61, 58, 47, 50, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 63, 
-  63, 61, 58, 47, 50, 30, 11}, {17, 18, 19, 19, 20, 20, 20, 20, 16, 
-  16, 16, 16, 4, 8, 12, 12, 18, 17, 19, 19, 20, 20, 20, 20, 16, 16, 
-  16, 16, 4, 8, 12, 12, 19, 19, 17, 18, 20, 20, 20, 20, 16, 16, 16, 
-  16, 4, 8, 12, 12, 19, 19, 18, 17, 20, 20, 20, 20, 16, 16, 16, 16, 4,
-   8, 12, 12, 20, 20, 20, 20, 17, 18, 19, 19, 16, 16, 16, 16, 4, 8, 
-  12, 12, 20, 20, 20, 20, 18, 17, 19, 19, 16, 16, 16, 16, 4, 8, 12, 
-  12, 20, 20, 20, 20, 19, 19, 17, 18, 16, 16, 16, 16, 4, 8, 12, 12, 
-  20, 20, 20, 20, 19, 19, 18, 17, 16, 16, 16, 16, 4, 8, 12, 12, 16, 
-  16, 16, 16, 16, 16, 16, 16, 13, 14, 15, 15, 3, 7, 11, 11, 16, 16, 
-  16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 3, 7, 11, 11, 16, 16, 16, 
-  16, 16, 16, 16, 16, 15, 15, 13, 14, 3, 7, 11, 11, 16, 16, 16, 16, 
-  16, 16, 16, 16, 15, 15, 14, 13, 3, 7, 11, 11, 4, 4, 4, 4, 4, 4, 4, 
-  4, 3, 3, 3, 3, 0, 1, 2, 2, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 1, 5,
-   6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 2, 6, 9, 10, 
-  12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 2, 6, 10, 9}, {18, 
-  35, 36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 31, 35, 18, 
-  36, 36, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 31, 36, 36, 18, 
-  35, 37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 31, 36, 36, 35, 18, 
-  37, 37, 37, 37, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 37, 37, 18, 
-  35, 36, 36, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 37, 37, 35, 18, 
-  36, 36, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 37, 37, 36, 36, 18, 
-  35, 34, 34, 34, 34, 28, 24, 31, 31, 37, 37, 37, 37, 36, 36, 35, 18, 
-  34, 34, 34, 34, 28, 24, 31, 31, 34, 34, 34, 34, 34, 34, 34, 34, 14, 
-  32, 33, 33, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 
-  33, 33, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 
-  32, 27, 23, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 
-  27, 23, 30, 30, 24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 1, 
-  21, 22, 22, 28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 25, 1, 
-  26, 26, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 26, 22, 10, 
-  29, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 26, 22, 29, 
-  10}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 41, 
-  44, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 41, 44, 
-  54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 41, 44, 54, 
-  54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 41, 44, 55, 55, 
-  55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 48, 51, 41, 44, 55, 55, 55, 
-  55, 36, 19, 54, 54, 53, 53, 53, 53, 48, 51, 41, 44, 55, 55, 55, 55, 
-  54, 54, 19, 36, 53, 53, 53, 53, 48, 51, 41, 44, 55, 55, 55, 55, 54, 
-  54, 36, 19, 53, 53, 53, 53, 48, 51, 41, 44, 53, 53, 53, 53, 53, 53, 
-  53, 53, 15, 33, 52, 52, 47, 50, 40, 43, 53, 53, 53, 53, 53, 53, 53, 
-  53, 33, 15, 52, 52, 47, 50, 40, 43, 53, 53, 53, 53, 53, 53, 53, 53, 
-  52, 52, 15, 33, 47, 50, 40, 43, 53, 53, 53, 53, 53, 53, 53, 53, 52, 
-  52, 33, 15, 47, 50, 40, 43, 41, 41, 41, 41, 41, 41, 41, 41, 40, 40, 
-  40, 40, 2, 22, 38, 39, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 
-  43, 26, 6, 39, 42, 48, 48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 
-  45, 46, 2, 26, 51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 46, 
-  49, 22, 6}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51,
-   44, 41, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 44,
-   41, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 44, 41,
-   54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 48, 51, 44, 41, 55,
-   55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 48, 51, 44, 41, 55, 55,
-   55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 48, 51, 44, 41, 55, 55, 55,
-   55, 54, 54, 19, 36, 53, 53, 53, 53, 48, 51, 44, 41, 55, 55, 55, 55,
-   54, 54, 36, 19, 53, 53, 53, 53, 48, 51, 44, 41, 53, 53, 53, 53, 53,
-   53, 53, 53, 15, 33, 52, 52, 47, 50, 43, 40, 53, 53, 53, 53, 53, 53,
-   53, 53, 33, 15, 52, 52, 47, 50, 43, 40, 53, 53, 53, 53, 53, 53, 53,
-   53, 52, 52, 15, 33, 47, 50, 43, 40, 53, 53, 53, 53, 53, 53, 53, 53,
-   52, 52, 33, 15, 47, 50, 43, 40, 41, 41, 41, 41, 41, 41, 41, 41, 40,
-   40, 40, 40, 2, 22, 39, 38, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 
-  43, 43, 26, 6, 42, 39, 51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 
-  50, 46, 49, 6, 22, 48, 48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 
-  45, 46, 26, 2}, {4, 28, 48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 86, 
-  85, 87, 87, 24, 8, 51, 51, 71, 71, 71, 71, 91, 91, 91, 91, 89, 86, 
-  90, 90, 41, 44, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 92, 
-  92, 41, 44, 31, 12, 73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 92, 92, 
-  59, 62, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 59, 
-  62, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 59, 62, 
-  64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 93, 93, 59, 62, 64, 
-  64, 53, 53, 34, 16, 94, 94, 94, 94, 91, 88, 93, 93, 78, 81, 83, 83, 
-  84, 84, 84, 84, 16, 34, 53, 53, 71, 68, 73, 73, 78, 81, 83, 83, 84, 
-  84, 84, 84, 34, 16, 53, 53, 71, 68, 73, 73, 78, 81, 83, 83, 84, 84, 
-  84, 84, 53, 53, 16, 34, 71, 68, 73, 73, 78, 81, 83, 83, 84, 84, 84, 
-  84, 53, 53, 34, 16, 71, 68, 73, 73, 76, 79, 80, 80, 81, 81, 81, 81, 
-  62, 62, 62, 62, 8, 28, 44, 44, 75, 76, 77, 77, 78, 78, 78, 78, 59, 
-  59, 59, 59, 24, 4, 41, 41, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 
-  64, 64, 51, 48, 12, 31, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 
-  64, 51, 48, 31, 12}, {8, 24, 51, 51, 71, 71, 71, 71, 91, 91, 91, 91,
-   89, 86, 90, 90, 28, 4, 48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 86, 
-  85, 87, 87, 44, 41, 12, 31, 73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 
-  92, 92, 44, 41, 31, 12, 73, 73, 73, 73, 93, 93, 93, 93, 90, 87, 92, 
-  92, 62, 59, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 
-  62, 59, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 91, 88, 93, 93, 62, 
-  59, 64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 93, 93, 62, 59, 
-  64, 64, 53, 53, 34, 16, 94, 94, 94, 94, 91, 88, 93, 93, 81, 78, 83, 
-  83, 84, 84, 84, 84, 16, 34, 53, 53, 71, 68, 73, 73, 81, 78, 83, 83, 
-  84, 84, 84, 84, 34, 16, 53, 53, 71, 68, 73, 73, 81, 78, 83, 83, 84, 
-  84, 84, 84, 53, 53, 16, 34, 71, 68, 73, 73, 81, 78, 83, 83, 84, 84, 
-  84, 84, 53, 53, 34, 16, 71, 68, 73, 73, 79, 76, 80, 80, 81, 81, 81, 
-  81, 62, 62, 62, 62, 8, 28, 44, 44, 76, 75, 77, 77, 78, 78, 78, 78, 
-  59, 59, 59, 59, 24, 4, 41, 41, 80, 77, 82, 82, 83, 83, 83, 83, 64, 
-  64, 64, 64, 51, 48, 12, 31, 80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 
-  64, 64, 51, 48, 31, 12}, {12, 31, 41, 44, 73, 73, 73, 73, 93, 93, 
-  93, 93, 90, 87, 92, 92, 31, 12, 41, 44, 73, 73, 73, 73, 93, 93, 93, 
-  93, 90, 87, 92, 92, 48, 48, 4, 28, 68, 68, 68, 68, 88, 88, 88, 88, 
-  86, 85, 87, 87, 51, 51, 24, 8, 71, 71, 71, 71, 91, 91, 91, 91, 89, 
-  86, 90, 90, 64, 64, 59, 62, 16, 34, 53, 53, 94, 94, 94, 94, 91, 88, 
-  93, 93, 64, 64, 59, 62, 34, 16, 53, 53, 94, 94, 94, 94, 91, 88, 93, 
-  93, 64, 64, 59, 62, 53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 93, 93, 
-  64, 64, 59, 62, 53, 53, 34, 16, 94, 94, 94, 94, 91, 88, 93, 93, 83, 
-  83, 78, 81, 84, 84, 84, 84, 16, 34, 53, 53, 71, 68, 73, 73, 83, 83, 
-  78, 81, 84, 84, 84, 84, 34, 16, 53, 53, 71, 68, 73, 73, 83, 83, 78, 
-  81, 84, 84, 84, 84, 53, 53, 16, 34, 71, 68, 73, 73, 83, 83, 78, 81, 
-  84, 84, 84, 84, 53, 53, 34, 16, 71, 68, 73, 73, 80, 80, 76, 79, 81, 
-  81, 81, 81, 62, 62, 62, 62, 8, 28, 44, 44, 77, 77, 75, 76, 78, 78, 
-  78, 78, 59, 59, 59, 59, 24, 4, 41, 41, 82, 82, 77, 80, 83, 83, 83, 
-  83, 64, 64, 64, 64, 51, 48, 12, 31, 82, 82, 77, 80, 83, 83, 83, 83, 
-  64, 64, 64, 64, 51, 48, 31, 12}, {12, 31, 44, 41, 73, 73, 73, 73, 
-  93, 93, 93, 93, 90, 87, 92, 92, 31, 12, 44, 41, 73, 73, 73, 73, 93, 
-  93, 93, 93, 90, 87, 92, 92, 51, 51, 8, 24, 71, 71, 71, 71, 91, 91, 
-  91, 91, 89, 86, 90, 90, 48, 48, 28, 4, 68, 68, 68, 68, 88, 88, 88, 
-  88, 86, 85, 87, 87, 64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 94, 94, 
-  91, 88, 93, 93, 64, 64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 94, 91, 
-  88, 93, 93, 64, 64, 62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 91, 88, 
-  93, 93, 64, 64, 62, 59, 53, 53, 34, 16, 94, 94, 94, 94, 91, 88, 93, 
-  93, 83, 83, 81, 78, 84, 84, 84, 84, 16, 34, 53, 53, 71, 68, 73, 73, 
-  83, 83, 81, 78, 84, 84, 84, 84, 34, 16, 53, 53, 71, 68, 73, 73, 83, 
-  83, 81, 78, 84, 84, 84, 84, 53, 53, 16, 34, 71, 68, 73, 73, 83, 83, 
-  81, 78, 84, 84, 84, 84, 53, 53, 34, 16, 71, 68, 73, 73, 80, 80, 79, 
-  76, 81, 81, 81, 81, 62, 62, 62, 62, 8, 28, 44, 44, 77, 77, 76, 75, 
-  78, 78, 78, 78, 59, 59, 59, 59, 24, 4, 41, 41, 82, 82, 80, 77, 83, 
-  83, 83, 83, 64, 64, 64, 64, 51, 48, 12, 31, 82, 82, 80, 77, 83, 83, 
-  83, 83, 64, 64, 64, 64, 51, 48, 31, 12}, {16, 34, 53, 53, 59, 62, 
-  64, 64, 94, 94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 53, 59, 62, 64, 
-  64, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 59, 62, 64, 64, 
-  94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 34, 16, 59, 62, 64, 64, 94, 
-  94, 94, 94, 91, 88, 93, 93, 68, 68, 68, 68, 4, 28, 48, 48, 88, 88, 
-  88, 88, 86, 85, 87, 87, 71, 71, 71, 71, 24, 8, 51, 51, 91, 91, 91, 
-  91, 89, 86, 90, 90, 73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 93, 
-  90, 87, 92, 92, 73, 73, 73, 73, 41, 44, 31, 12, 93, 93, 93, 93, 90, 
-  87, 92, 92, 84, 84, 84, 84, 78, 81, 83, 83, 16, 34, 53, 53, 71, 68, 
-  73, 73, 84, 84, 84, 84, 78, 81, 83, 83, 34, 16, 53, 53, 71, 68, 73, 
-  73, 84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 16, 34, 71, 68, 73, 73, 
-  84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 34, 16, 71, 68, 73, 73, 81, 
-  81, 81, 81, 76, 79, 80, 80, 62, 62, 62, 62, 8, 28, 44, 44, 78, 78, 
-  78, 78, 75, 76, 77, 77, 59, 59, 59, 59, 24, 4, 41, 41, 83, 83, 83, 
-  83, 77, 80, 82, 82, 64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 83, 83, 
-  77, 80, 82, 82, 64, 64, 64, 64, 51, 48, 31, 12}, {16, 34, 53, 53, 
-  62, 59, 64, 64, 94, 94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 53, 62, 
-  59, 64, 64, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 62, 59, 
-  64, 64, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 34, 16, 62, 59, 64, 
-  64, 94, 94, 94, 94, 91, 88, 93, 93, 71, 71, 71, 71, 8, 24, 51, 51, 
-  91, 91, 91, 91, 89, 86, 90, 90, 68, 68, 68, 68, 28, 4, 48, 48, 88, 
-  88, 88, 88, 86, 85, 87, 87, 73, 73, 73, 73, 44, 41, 12, 31, 93, 93, 
-  93, 93, 90, 87, 92, 92, 73, 73, 73, 73, 44, 41, 31, 12, 93, 93, 93, 
-  93, 90, 87, 92, 92, 84, 84, 84, 84, 81, 78, 83, 83, 16, 34, 53, 53, 
-  71, 68, 73, 73, 84, 84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 71, 
-  68, 73, 73, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 71, 68, 
-  73, 73, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 34, 16, 71, 68, 73, 
-  73, 81, 81, 81, 81, 79, 76, 80, 80, 62, 62, 62, 62, 8, 28, 44, 44, 
-  78, 78, 78, 78, 76, 75, 77, 77, 59, 59, 59, 59, 24, 4, 41, 41, 83, 
-  83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 51, 48, 12, 31, 83, 83, 
-  83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 51, 48, 31, 12}, {16, 34, 
-  53, 53, 64, 64, 59, 62, 94, 94, 94, 94, 91, 88, 93, 93, 34, 16, 53, 
-  53, 64, 64, 59, 62, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 16, 34, 
-  64, 64, 59, 62, 94, 94, 94, 94, 91, 88, 93, 93, 53, 53, 34, 16, 64, 
-  64, 59, 62, 94, 94, 94, 94, 91, 88, 93, 93, 73, 73, 73, 73, 12, 31, 
-  41, 44, 93, 93, 93, 93, 90, 87, 92, 92, 73, 73, 73, 73, 31, 12, 41, 
-  44, 93, 93, 93, 93, 90, 87, 92, 92, 68, 68, 68, 68, 48, 48, 4, 28, 
-  88, 88, 88, 88, 86, 85, 87, 87, 71, 71, 71, 71, 51, 51, 24, 8, 91, 
-  91, 91, 91, 89, 86, 90, 90, 84, 84, 84, 84, 83, 83, 78, 81, 16, 34, 
-  53, 53, 71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 53, 
-  53, 71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 34, 
-  71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 71, 
-  68, 73, 73, 81, 81, 81, 81, 80, 80, 76, 79, 62, 62, 62, 62, 8, 28, 
-  44, 44, 78, 78, 78, 78, 77, 77, 75, 76, 59, 59, 59, 59, 24, 4, 41, 
-  41, 83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 51, 48, 12, 31, 
-  83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 51, 48, 31, 
-  12}, {16, 34, 53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 91, 88, 93, 
-  93, 34, 16, 53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 91, 88, 93, 93, 
-  53, 53, 16, 34, 64, 64, 62, 59, 94, 94, 94, 94, 91, 88, 93, 93, 53, 
-  53, 34, 16, 64, 64, 62, 59, 94, 94, 94, 94, 91, 88, 93, 93, 73, 73, 
-  73, 73, 12, 31, 44, 41, 93, 93, 93, 93, 90, 87, 92, 92, 73, 73, 73, 
-  73, 31, 12, 44, 41, 93, 93, 93, 93, 90, 87, 92, 92, 71, 71, 71, 71, 
-  51, 51, 8, 24, 91, 91, 91, 91, 89, 86, 90, 90, 68, 68, 68, 68, 48, 
-  48, 28, 4, 88, 88, 88, 88, 86, 85, 87, 87, 84, 84, 84, 84, 83, 83, 
-  81, 78, 16, 34, 53, 53, 71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 81, 
-  78, 34, 16, 53, 53, 71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 
-  53, 53, 16, 34, 71, 68, 73, 73, 84, 84, 84, 84, 83, 83, 81, 78, 53, 
-  53, 34, 16, 71, 68, 73, 73, 81, 81, 81, 81, 80, 80, 79, 76, 62, 62, 
-  62, 62, 8, 28, 44, 44, 78, 78, 78, 78, 77, 77, 76, 75, 59, 59, 59, 
-  59, 24, 4, 41, 41, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 
-  51, 48, 12, 31, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 51, 
-  48, 31, 12}, {20, 37, 55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 71, 
-  68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 71, 68, 
-  73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 59, 62, 64, 64, 71, 68, 73, 
-  73, 55, 55, 37, 20, 74, 74, 74, 74, 59, 62, 64, 64, 71, 68, 73, 73, 
-  74, 74, 74, 74, 20, 37, 55, 55, 59, 62, 64, 64, 71, 68, 73, 73, 74, 
-  74, 74, 74, 37, 20, 55, 55, 59, 62, 64, 64, 71, 68, 73, 73, 74, 74, 
-  74, 74, 55, 55, 20, 37, 59, 62, 64, 64, 71, 68, 73, 73, 74, 74, 74, 
-  74, 55, 55, 37, 20, 59, 62, 64, 64, 71, 68, 73, 73, 68, 68, 68, 68, 
-  68, 68, 68, 68, 3, 27, 47, 47, 66, 65, 67, 67, 71, 71, 71, 71, 71, 
-  71, 71, 71, 23, 7, 50, 50, 69, 66, 70, 70, 73, 73, 73, 73, 73, 73, 
-  73, 73, 40, 43, 11, 30, 70, 67, 72, 72, 73, 73, 73, 73, 73, 73, 73, 
-  73, 40, 43, 30, 11, 70, 67, 72, 72, 62, 62, 62, 62, 62, 62, 62, 62, 
-  57, 60, 61, 61, 7, 27, 43, 43, 59, 59, 59, 59, 59, 59, 59, 59, 56, 
-  57, 58, 58, 23, 3, 40, 40, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 
-  63, 63, 50, 47, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 
-  63, 50, 47, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 62, 59, 64, 
-  64, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 
-  71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 62, 59, 64, 64, 71, 
-  68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 62, 59, 64, 64, 71, 68, 
-  73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 62, 59, 64, 64, 71, 68, 73, 
-  73, 74, 74, 74, 74, 37, 20, 55, 55, 62, 59, 64, 64, 71, 68, 73, 73, 
-  74, 74, 74, 74, 55, 55, 20, 37, 62, 59, 64, 64, 71, 68, 73, 73, 74, 
-  74, 74, 74, 55, 55, 37, 20, 62, 59, 64, 64, 71, 68, 73, 73, 71, 71, 
-  71, 71, 71, 71, 71, 71, 7, 23, 50, 50, 69, 66, 70, 70, 68, 68, 68, 
-  68, 68, 68, 68, 68, 27, 3, 47, 47, 66, 65, 67, 67, 73, 73, 73, 73, 
-  73, 73, 73, 73, 43, 40, 11, 30, 70, 67, 72, 72, 73, 73, 73, 73, 73, 
-  73, 73, 73, 43, 40, 30, 11, 70, 67, 72, 72, 62, 62, 62, 62, 62, 62, 
-  62, 62, 60, 57, 61, 61, 7, 27, 43, 43, 59, 59, 59, 59, 59, 59, 59, 
-  59, 57, 56, 58, 58, 23, 3, 40, 40, 64, 64, 64, 64, 64, 64, 64, 64, 
-  61, 58, 63, 63, 50, 47, 11, 30, 64, 64, 64, 64, 64, 64, 64, 64, 61, 
-  58, 63, 63, 50, 47, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 74, 64, 
-  64, 59, 62, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 
-  59, 62, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 59, 
-  62, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 59, 62, 
-  71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 59, 62, 71, 
-  68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 59, 62, 71, 68, 
-  73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 59, 62, 71, 68, 73, 
-  73, 74, 74, 74, 74, 55, 55, 37, 20, 64, 64, 59, 62, 71, 68, 73, 73, 
-  73, 73, 73, 73, 73, 73, 73, 73, 11, 30, 40, 43, 70, 67, 72, 72, 73, 
-  73, 73, 73, 73, 73, 73, 73, 30, 11, 40, 43, 70, 67, 72, 72, 68, 68, 
-  68, 68, 68, 68, 68, 68, 47, 47, 3, 27, 66, 65, 67, 67, 71, 71, 71, 
-  71, 71, 71, 71, 71, 50, 50, 23, 7, 69, 66, 70, 70, 62, 62, 62, 62, 
-  62, 62, 62, 62, 61, 61, 57, 60, 7, 27, 43, 43, 59, 59, 59, 59, 59, 
-  59, 59, 59, 58, 58, 56, 57, 23, 3, 40, 40, 64, 64, 64, 64, 64, 64, 
-  64, 64, 63, 63, 58, 61, 50, 47, 11, 30, 64, 64, 64, 64, 64, 64, 64, 
-  64, 63, 63, 58, 61, 50, 47, 30, 11}, {20, 37, 55, 55, 74, 74, 74, 
-  74, 64, 64, 62, 59, 71, 68, 73, 73, 37, 20, 55, 55, 74, 74, 74, 74, 
-  64, 64, 62, 59, 71, 68, 73, 73, 55, 55, 20, 37, 74, 74, 74, 74, 64, 
-  64, 62, 59, 71, 68, 73, 73, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 
-  62, 59, 71, 68, 73, 73, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 62, 
-  59, 71, 68, 73, 73, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 62, 59, 
-  71, 68, 73, 73, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 62, 59, 71, 
-  68, 73, 73, 74, 74, 74, 74, 55, 55, 37, 20, 64, 64, 62, 59, 71, 68, 
-  73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 11, 30, 43, 40, 70, 67, 72, 
-  72, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 43, 40, 70, 67, 72, 72, 
-  71, 71, 71, 71, 71, 71, 71, 71, 50, 50, 7, 23, 69, 66, 70, 70, 68, 
-  68, 68, 68, 68, 68, 68, 68, 47, 47, 27, 3, 66, 65, 67, 67, 62, 62, 
-  62, 62, 62, 62, 62, 62, 61, 61, 60, 57, 7, 27, 43, 43, 59, 59, 59, 
-  59, 59, 59, 59, 59, 58, 58, 57, 56, 23, 3, 40, 40, 64, 64, 64, 64, 
-  64, 64, 64, 64, 63, 63, 61, 58, 50, 47, 11, 30, 64, 64, 64, 64, 64, 
-  64, 64, 64, 63, 63, 61, 58, 50, 47, 30, 11}, {18, 35, 36, 36, 37, 
-  37, 37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 35, 18, 36, 36, 37, 37, 
-  37, 37, 34, 34, 34, 34, 24, 28, 31, 31, 36, 36, 18, 35, 37, 37, 37, 
-  37, 34, 34, 34, 34, 24, 28, 31, 31, 36, 36, 35, 18, 37, 37, 37, 37, 
-  34, 34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 18, 35, 36, 36, 34, 
-  34, 34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 35, 18, 36, 36, 34, 34, 
-  34, 34, 24, 28, 31, 31, 37, 37, 37, 37, 36, 36, 18, 35, 34, 34, 34, 
-  34, 24, 28, 31, 31, 37, 37, 37, 37, 36, 36, 35, 18, 34, 34, 34, 34, 
-  24, 28, 31, 31, 34, 34, 34, 34, 34, 34, 34, 34, 14, 32, 33, 33, 23, 
-  27, 30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 33, 23, 27, 
-  30, 30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 23, 27, 30, 
-  30, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 23, 27, 30, 30, 
-  28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 1, 25, 26, 26, 24, 
-  24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 21, 1, 22, 22, 31, 31, 
-  31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 22, 26, 10, 29, 31, 31, 31, 
-  31, 31, 31, 31, 31, 30, 30, 30, 30, 22, 26, 29, 10}, {17, 18, 19, 
-  19, 20, 20, 20, 20, 16, 16, 16, 16, 8, 4, 12, 12, 18, 17, 19, 19, 
-  20, 20, 20, 20, 16, 16, 16, 16, 8, 4, 12, 12, 19, 19, 17, 18, 20, 
-  20, 20, 20, 16, 16, 16, 16, 8, 4, 12, 12, 19, 19, 18, 17, 20, 20, 
-  20, 20, 16, 16, 16, 16, 8, 4, 12, 12, 20, 20, 20, 20, 17, 18, 19, 
-  19, 16, 16, 16, 16, 8, 4, 12, 12, 20, 20, 20, 20, 18, 17, 19, 19, 
-  16, 16, 16, 16, 8, 4, 12, 12, 20, 20, 20, 20, 19, 19, 17, 18, 16, 
-  16, 16, 16, 8, 4, 12, 12, 20, 20, 20, 20, 19, 19, 18, 17, 16, 16, 
-  16, 16, 8, 4, 12, 12, 16, 16, 16, 16, 16, 16, 16, 16, 13, 14, 15, 
-  15, 7, 3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 7,
-   3, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 13, 14, 7, 3, 
-  11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 14, 13, 7, 3, 11, 
-  11, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 5, 1, 6, 6, 4, 4, 4, 4, 4, 
-  4, 4, 4, 3, 3, 3, 3, 1, 0, 2, 2, 12, 12, 12, 12, 12, 12, 12, 12, 11,
-   11, 11, 11, 6, 2, 9, 10, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 
-  11, 11, 6, 2, 10, 9}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 
-  53, 51, 48, 41, 44, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 
-  51, 48, 41, 44, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 51, 
-  48, 41, 44, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 51, 48, 
-  41, 44, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 51, 48, 41, 
-  44, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 51, 48, 41, 44, 
-  55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 51, 48, 41, 44, 55, 
-  55, 55, 55, 54, 54, 36, 19, 53, 53, 53, 53, 51, 48, 41, 44, 53, 53, 
-  53, 53, 53, 53, 53, 53, 15, 33, 52, 52, 50, 47, 40, 43, 53, 53, 53, 
-  53, 53, 53, 53, 53, 33, 15, 52, 52, 50, 47, 40, 43, 53, 53, 53, 53, 
-  53, 53, 53, 53, 52, 52, 15, 33, 50, 47, 40, 43, 53, 53, 53, 53, 53, 
-  53, 53, 53, 52, 52, 33, 15, 50, 47, 40, 43, 44, 44, 44, 44, 44, 44, 
-  44, 44, 43, 43, 43, 43, 6, 26, 39, 42, 41, 41, 41, 41, 41, 41, 41, 
-  41, 40, 40, 40, 40, 22, 2, 38, 39, 48, 48, 48, 48, 48, 48, 48, 48, 
-  47, 47, 47, 47, 46, 45, 2, 26, 51, 51, 51, 51, 51, 51, 51, 51, 50, 
-  50, 50, 50, 49, 46, 22, 6}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53,
-   53, 53, 51, 48, 44, 41, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53,
-   53, 51, 48, 44, 41, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53,
-   51, 48, 44, 41, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 51,
-   48, 44, 41, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 51, 48,
-   44, 41, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 51, 48, 44,
-   41, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 51, 48, 44, 41,
-   55, 55, 55, 55, 54, 54, 36, 19, 53, 53, 53, 53, 51, 48, 44, 41, 53,
-   53, 53, 53, 53, 53, 53, 53, 15, 33, 52, 52, 50, 47, 43, 40, 53, 53,
-   53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 50, 47, 43, 40, 53, 53, 53,
-   53, 53, 53, 53, 53, 52, 52, 15, 33, 50, 47, 43, 40, 53, 53, 53, 53,
-   53, 53, 53, 53, 52, 52, 33, 15, 50, 47, 43, 40, 44, 44, 44, 44, 44,
-   44, 44, 44, 43, 43, 43, 43, 6, 26, 42, 39, 41, 41, 41, 41, 41, 41, 
-  41, 41, 40, 40, 40, 40, 22, 2, 39, 38, 51, 51, 51, 51, 51, 51, 51, 
-  51, 50, 50, 50, 50, 49, 46, 6, 22, 48, 48, 48, 48, 48, 48, 48, 48, 
-  47, 47, 47, 47, 46, 45, 26, 2}, {4, 28, 48, 48, 68, 68, 68, 68, 88, 
-  88, 88, 88, 87, 87, 85, 86, 24, 8, 51, 51, 71, 71, 71, 71, 91, 91, 
-  91, 91, 90, 90, 86, 89, 41, 44, 12, 31, 73, 73, 73, 73, 93, 93, 93, 
-  93, 92, 92, 87, 90, 41, 44, 31, 12, 73, 73, 73, 73, 93, 93, 93, 93, 
-  92, 92, 87, 90, 59, 62, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 93, 
-  93, 88, 91, 59, 62, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 
-  88, 91, 59, 62, 64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 88, 
-  91, 59, 62, 64, 64, 53, 53, 34, 16, 94, 94, 94, 94, 93, 93, 88, 91, 
-  78, 81, 83, 83, 84, 84, 84, 84, 16, 34, 53, 53, 73, 73, 68, 71, 78, 
-  81, 83, 83, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 78, 81, 
-  83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 78, 81, 83, 
-  83, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 77, 80, 82, 82, 
-  83, 83, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 77, 80, 82, 82, 83, 
-  83, 83, 83, 64, 64, 64, 64, 31, 12, 48, 51, 75, 76, 77, 77, 78, 78, 
-  78, 78, 59, 59, 59, 59, 41, 41, 4, 24, 76, 79, 80, 80, 81, 81, 81, 
-  81, 62, 62, 62, 62, 44, 44, 28, 8}, {8, 24, 51, 51, 71, 71, 71, 71, 
-  91, 91, 91, 91, 90, 90, 86, 89, 28, 4, 48, 48, 68, 68, 68, 68, 88, 
-  88, 88, 88, 87, 87, 85, 86, 44, 41, 12, 31, 73, 73, 73, 73, 93, 93, 
-  93, 93, 92, 92, 87, 90, 44, 41, 31, 12, 73, 73, 73, 73, 93, 93, 93, 
-  93, 92, 92, 87, 90, 62, 59, 64, 64, 16, 34, 53, 53, 94, 94, 94, 94, 
-  93, 93, 88, 91, 62, 59, 64, 64, 34, 16, 53, 53, 94, 94, 94, 94, 93, 
-  93, 88, 91, 62, 59, 64, 64, 53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 
-  88, 91, 62, 59, 64, 64, 53, 53, 34, 16, 94, 94, 94, 94, 93, 93, 88, 
-  91, 81, 78, 83, 83, 84, 84, 84, 84, 16, 34, 53, 53, 73, 73, 68, 71, 
-  81, 78, 83, 83, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 81, 
-  78, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 81, 78, 
-  83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 80, 77, 82, 
-  82, 83, 83, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 80, 77, 82, 82, 
-  83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 48, 51, 76, 75, 77, 77, 78, 
-  78, 78, 78, 59, 59, 59, 59, 41, 41, 4, 24, 79, 76, 80, 80, 81, 81, 
-  81, 81, 62, 62, 62, 62, 44, 44, 28, 8}, {12, 31, 41, 44, 73, 73, 73,
-   73, 93, 93, 93, 93, 92, 92, 87, 90, 31, 12, 41, 44, 73, 73, 73, 73,
-   93, 93, 93, 93, 92, 92, 87, 90, 48, 48, 4, 28, 68, 68, 68, 68, 88, 
-  88, 88, 88, 87, 87, 85, 86, 51, 51, 24, 8, 71, 71, 71, 71, 91, 91, 
-  91, 91, 90, 90, 86, 89, 64, 64, 59, 62, 16, 34, 53, 53, 94, 94, 94, 
-  94, 93, 93, 88, 91, 64, 64, 59, 62, 34, 16, 53, 53, 94, 94, 94, 94, 
-  93, 93, 88, 91, 64, 64, 59, 62, 53, 53, 16, 34, 94, 94, 94, 94, 93, 
-  93, 88, 91, 64, 64, 59, 62, 53, 53, 34, 16, 94, 94, 94, 94, 93, 93, 
-  88, 91, 83, 83, 78, 81, 84, 84, 84, 84, 16, 34, 53, 53, 73, 73, 68, 
-  71, 83, 83, 78, 81, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 71, 
-  83, 83, 78, 81, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 83, 
-  83, 78, 81, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 82, 82, 
-  77, 80, 83, 83, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 82, 82, 77, 
-  80, 83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 48, 51, 77, 77, 75, 76, 
-  78, 78, 78, 78, 59, 59, 59, 59, 41, 41, 4, 24, 80, 80, 76, 79, 81, 
-  81, 81, 81, 62, 62, 62, 62, 44, 44, 28, 8}, {12, 31, 44, 41, 73, 73,
-   73, 73, 93, 93, 93, 93, 92, 92, 87, 90, 31, 12, 44, 41, 73, 73, 73,
-   73, 93, 93, 93, 93, 92, 92, 87, 90, 51, 51, 8, 24, 71, 71, 71, 71, 
-  91, 91, 91, 91, 90, 90, 86, 89, 48, 48, 28, 4, 68, 68, 68, 68, 88, 
-  88, 88, 88, 87, 87, 85, 86, 64, 64, 62, 59, 16, 34, 53, 53, 94, 94, 
-  94, 94, 93, 93, 88, 91, 64, 64, 62, 59, 34, 16, 53, 53, 94, 94, 94, 
-  94, 93, 93, 88, 91, 64, 64, 62, 59, 53, 53, 16, 34, 94, 94, 94, 94, 
-  93, 93, 88, 91, 64, 64, 62, 59, 53, 53, 34, 16, 94, 94, 94, 94, 93, 
-  93, 88, 91, 83, 83, 81, 78, 84, 84, 84, 84, 16, 34, 53, 53, 73, 73, 
-  68, 71, 83, 83, 81, 78, 84, 84, 84, 84, 34, 16, 53, 53, 73, 73, 68, 
-  71, 83, 83, 81, 78, 84, 84, 84, 84, 53, 53, 16, 34, 73, 73, 68, 71, 
-  83, 83, 81, 78, 84, 84, 84, 84, 53, 53, 34, 16, 73, 73, 68, 71, 82, 
-  82, 80, 77, 83, 83, 83, 83, 64, 64, 64, 64, 12, 31, 48, 51, 82, 82, 
-  80, 77, 83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 48, 51, 77, 77, 76, 
-  75, 78, 78, 78, 78, 59, 59, 59, 59, 41, 41, 4, 24, 80, 80, 79, 76, 
-  81, 81, 81, 81, 62, 62, 62, 62, 44, 44, 28, 8}, {16, 34, 53, 53, 59,
-   62, 64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53, 59, 62,
-   64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 59, 62, 64,
-   64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 59, 62, 64, 64,
-   94, 94, 94, 94, 93, 93, 88, 91, 68, 68, 68, 68, 4, 28, 48, 48, 88, 
-  88, 88, 88, 87, 87, 85, 86, 71, 71, 71, 71, 24, 8, 51, 51, 91, 91, 
-  91, 91, 90, 90, 86, 89, 73, 73, 73, 73, 41, 44, 12, 31, 93, 93, 93, 
-  93, 92, 92, 87, 90, 73, 73, 73, 73, 41, 44, 31, 12, 93, 93, 93, 93, 
-  92, 92, 87, 90, 84, 84, 84, 84, 78, 81, 83, 83, 16, 34, 53, 53, 73, 
-  73, 68, 71, 84, 84, 84, 84, 78, 81, 83, 83, 34, 16, 53, 53, 73, 73, 
-  68, 71, 84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 16, 34, 73, 73, 68, 
-  71, 84, 84, 84, 84, 78, 81, 83, 83, 53, 53, 34, 16, 73, 73, 68, 71, 
-  83, 83, 83, 83, 77, 80, 82, 82, 64, 64, 64, 64, 12, 31, 48, 51, 83, 
-  83, 83, 83, 77, 80, 82, 82, 64, 64, 64, 64, 31, 12, 48, 51, 78, 78, 
-  78, 78, 75, 76, 77, 77, 59, 59, 59, 59, 41, 41, 4, 24, 81, 81, 81, 
-  81, 76, 79, 80, 80, 62, 62, 62, 62, 44, 44, 28, 8}, {16, 34, 53, 53,
-   62, 59, 64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53, 62,
-   59, 64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 62, 59,
-   64, 64, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 62, 59, 64,
-   64, 94, 94, 94, 94, 93, 93, 88, 91, 71, 71, 71, 71, 8, 24, 51, 51, 
-  91, 91, 91, 91, 90, 90, 86, 89, 68, 68, 68, 68, 28, 4, 48, 48, 88, 
-  88, 88, 88, 87, 87, 85, 86, 73, 73, 73, 73, 44, 41, 12, 31, 93, 93, 
-  93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 44, 41, 31, 12, 93, 93, 93, 
-  93, 92, 92, 87, 90, 84, 84, 84, 84, 81, 78, 83, 83, 16, 34, 53, 53, 
-  73, 73, 68, 71, 84, 84, 84, 84, 81, 78, 83, 83, 34, 16, 53, 53, 73, 
-  73, 68, 71, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 16, 34, 73, 73, 
-  68, 71, 84, 84, 84, 84, 81, 78, 83, 83, 53, 53, 34, 16, 73, 73, 68, 
-  71, 83, 83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 12, 31, 48, 51, 
-  83, 83, 83, 83, 80, 77, 82, 82, 64, 64, 64, 64, 31, 12, 48, 51, 78, 
-  78, 78, 78, 76, 75, 77, 77, 59, 59, 59, 59, 41, 41, 4, 24, 81, 81, 
-  81, 81, 79, 76, 80, 80, 62, 62, 62, 62, 44, 44, 28, 8}, {16, 34, 53,
-   53, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53, 53,
-   64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34, 64,
-   64, 59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 64, 64,
-   59, 62, 94, 94, 94, 94, 93, 93, 88, 91, 73, 73, 73, 73, 12, 31, 41,
-   44, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 31, 12, 41, 44,
-   93, 93, 93, 93, 92, 92, 87, 90, 68, 68, 68, 68, 48, 48, 4, 28, 88, 
-  88, 88, 88, 87, 87, 85, 86, 71, 71, 71, 71, 51, 51, 24, 8, 91, 91, 
-  91, 91, 90, 90, 86, 89, 84, 84, 84, 84, 83, 83, 78, 81, 16, 34, 53, 
-  53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 34, 16, 53, 53, 
-  73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 16, 34, 73, 
-  73, 68, 71, 84, 84, 84, 84, 83, 83, 78, 81, 53, 53, 34, 16, 73, 73, 
-  68, 71, 83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 12, 31, 48, 
-  51, 83, 83, 83, 83, 82, 82, 77, 80, 64, 64, 64, 64, 31, 12, 48, 51, 
-  78, 78, 78, 78, 77, 77, 75, 76, 59, 59, 59, 59, 41, 41, 4, 24, 81, 
-  81, 81, 81, 80, 80, 76, 79, 62, 62, 62, 62, 44, 44, 28, 8}, {16, 34,
-   53, 53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 34, 16, 53,
-   53, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 16, 34,
-   64, 64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 53, 53, 34, 16, 64,
-   64, 62, 59, 94, 94, 94, 94, 93, 93, 88, 91, 73, 73, 73, 73, 12, 31,
-   44, 41, 93, 93, 93, 93, 92, 92, 87, 90, 73, 73, 73, 73, 31, 12, 44,
-   41, 93, 93, 93, 93, 92, 92, 87, 90, 71, 71, 71, 71, 51, 51, 8, 24, 
-  91, 91, 91, 91, 90, 90, 86, 89, 68, 68, 68, 68, 48, 48, 28, 4, 88, 
-  88, 88, 88, 87, 87, 85, 86, 84, 84, 84, 84, 83, 83, 81, 78, 16, 34, 
-  53, 53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 34, 16, 53, 
-  53, 73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 16, 34, 
-  73, 73, 68, 71, 84, 84, 84, 84, 83, 83, 81, 78, 53, 53, 34, 16, 73, 
-  73, 68, 71, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 12, 31, 
-  48, 51, 83, 83, 83, 83, 82, 82, 80, 77, 64, 64, 64, 64, 31, 12, 48, 
-  51, 78, 78, 78, 78, 77, 77, 76, 75, 59, 59, 59, 59, 41, 41, 4, 24, 
-  81, 81, 81, 81, 80, 80, 79, 76, 62, 62, 62, 62, 44, 44, 28, 8}, {20,
-   37, 55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 37, 20,
-   55, 55, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 55, 55, 20,
-   37, 74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 55, 55, 37, 20,
-   74, 74, 74, 74, 59, 62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 20,
-   37, 55, 55, 59, 62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 37, 20,
-   55, 55, 59, 62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 20,
-   37, 59, 62, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55, 37, 20,
-   59, 62, 64, 64, 73, 73, 68, 71, 68, 68, 68, 68, 68, 68, 68, 68, 3, 
-  27, 47, 47, 67, 67, 65, 66, 71, 71, 71, 71, 71, 71, 71, 71, 23, 7, 
-  50, 50, 70, 70, 66, 69, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 11, 
-  30, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 40, 43, 30, 11, 
-  72, 72, 67, 70, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 11, 
-  30, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 58, 61, 63, 63, 30, 11, 
-  47, 50, 59, 59, 59, 59, 59, 59, 59, 59, 56, 57, 58, 58, 40, 40, 3, 
-  23, 62, 62, 62, 62, 62, 62, 62, 62, 57, 60, 61, 61, 43, 43, 27, 
-  7}, {20, 37, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71,
-   37, 20, 55, 55, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 55,
-   55, 20, 37, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 55, 55,
-   37, 20, 74, 74, 74, 74, 62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74,
-   74, 20, 37, 55, 55, 62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74,
-   37, 20, 55, 55, 62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55,
-   55, 20, 37, 62, 59, 64, 64, 73, 73, 68, 71, 74, 74, 74, 74, 55, 55,
-   37, 20, 62, 59, 64, 64, 73, 73, 68, 71, 71, 71, 71, 71, 71, 71, 71,
-   71, 7, 23, 50, 50, 70, 70, 66, 69, 68, 68, 68, 68, 68, 68, 68, 68, 
-  27, 3, 47, 47, 67, 67, 65, 66, 73, 73, 73, 73, 73, 73, 73, 73, 43, 
-  40, 11, 30, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73, 73, 43, 40, 
-  30, 11, 72, 72, 67, 70, 64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 
-  63, 11, 30, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 61, 58, 63, 63, 
-  30, 11, 47, 50, 59, 59, 59, 59, 59, 59, 59, 59, 57, 56, 58, 58, 40, 
-  40, 3, 23, 62, 62, 62, 62, 62, 62, 62, 62, 60, 57, 61, 61, 43, 43, 
-  27, 7}, {20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68,
-   71, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71,
-   55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 55,
-   55, 37, 20, 74, 74, 74, 74, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74,
-   74, 74, 20, 37, 55, 55, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74,
-   74, 37, 20, 55, 55, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74,
-   55, 55, 20, 37, 64, 64, 59, 62, 73, 73, 68, 71, 74, 74, 74, 74, 55,
-   55, 37, 20, 64, 64, 59, 62, 73, 73, 68, 71, 73, 73, 73, 73, 73, 73,
-   73, 73, 11, 30, 40, 43, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73, 73,
-   73, 30, 11, 40, 43, 72, 72, 67, 70, 68, 68, 68, 68, 68, 68, 68, 68,
-   47, 47, 3, 27, 67, 67, 65, 66, 71, 71, 71, 71, 71, 71, 71, 71, 50, 
-  50, 23, 7, 70, 70, 66, 69, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 
-  58, 61, 11, 30, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 58, 
-  61, 30, 11, 47, 50, 59, 59, 59, 59, 59, 59, 59, 59, 58, 58, 56, 57, 
-  40, 40, 3, 23, 62, 62, 62, 62, 62, 62, 62, 62, 61, 61, 57, 60, 43, 
-  43, 27, 7}, {20, 37, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73,
-   68, 71, 37, 20, 55, 55, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68,
-   71, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 71,
-   55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 62, 59, 73, 73, 68, 71, 74,
-   74, 74, 74, 20, 37, 55, 55, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74,
-   74, 74, 37, 20, 55, 55, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 74,
-   74, 55, 55, 20, 37, 64, 64, 62, 59, 73, 73, 68, 71, 74, 74, 74, 74,
-   55, 55, 37, 20, 64, 64, 62, 59, 73, 73, 68, 71, 73, 73, 73, 73, 73,
-   73, 73, 73, 11, 30, 43, 40, 72, 72, 67, 70, 73, 73, 73, 73, 73, 73,
-   73, 73, 30, 11, 43, 40, 72, 72, 67, 70, 71, 71, 71, 71, 71, 71, 71,
-   71, 50, 50, 7, 23, 70, 70, 66, 69, 68, 68, 68, 68, 68, 68, 68, 68, 
-  47, 47, 27, 3, 67, 67, 65, 66, 64, 64, 64, 64, 64, 64, 64, 64, 63, 
-  63, 61, 58, 11, 30, 47, 50, 64, 64, 64, 64, 64, 64, 64, 64, 63, 63, 
-  61, 58, 30, 11, 47, 50, 59, 59, 59, 59, 59, 59, 59, 59, 58, 58, 57, 
-  56, 40, 40, 3, 23, 62, 62, 62, 62, 62, 62, 62, 62, 61, 61, 60, 57, 
-  43, 43, 27, 7}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 41,
-   44, 48, 51, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44,
-   48, 51, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44, 48,
-   51, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 41, 44, 48, 51,
-   55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 41, 44, 48, 51, 55,
-   55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 41, 44, 48, 51, 55, 55,
-   55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 41, 44, 48, 51, 55, 55, 55,
-   55, 54, 54, 36, 19, 53, 53, 53, 53, 41, 44, 48, 51, 53, 53, 53, 53,
-   53, 53, 53, 53, 15, 33, 52, 52, 40, 43, 47, 50, 53, 53, 53, 53, 53,
-   53, 53, 53, 33, 15, 52, 52, 40, 43, 47, 50, 53, 53, 53, 53, 53, 53,
-   53, 53, 52, 52, 15, 33, 40, 43, 47, 50, 53, 53, 53, 53, 53, 53, 53,
-   53, 52, 52, 33, 15, 40, 43, 47, 50, 48, 48, 48, 48, 48, 48, 48, 48,
-   47, 47, 47, 47, 2, 26, 45, 46, 51, 51, 51, 51, 51, 51, 51, 51, 50, 
-  50, 50, 50, 22, 6, 46, 49, 41, 41, 41, 41, 41, 41, 41, 41, 40, 40, 
-  40, 40, 38, 39, 2, 22, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 
-  43, 39, 42, 26, 6}, {19, 36, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53,
-   44, 41, 48, 51, 36, 19, 54, 54, 55, 55, 55, 55, 53, 53, 53, 53, 44,
-   41, 48, 51, 54, 54, 19, 36, 55, 55, 55, 55, 53, 53, 53, 53, 44, 41,
-   48, 51, 54, 54, 36, 19, 55, 55, 55, 55, 53, 53, 53, 53, 44, 41, 48,
-   51, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53, 53, 53, 44, 41, 48, 51,
-   55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53, 53, 44, 41, 48, 51, 55,
-   55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53, 44, 41, 48, 51, 55, 55,
-   55, 55, 54, 54, 36, 19, 53, 53, 53, 53, 44, 41, 48, 51, 53, 53, 53,
-   53, 53, 53, 53, 53, 15, 33, 52, 52, 43, 40, 47, 50, 53, 53, 53, 53,
-   53, 53, 53, 53, 33, 15, 52, 52, 43, 40, 47, 50, 53, 53, 53, 53, 53,
-   53, 53, 53, 52, 52, 15, 33, 43, 40, 47, 50, 53, 53, 53, 53, 53, 53,
-   53, 53, 52, 52, 33, 15, 43, 40, 47, 50, 51, 51, 51, 51, 51, 51, 51,
-   51, 50, 50, 50, 50, 6, 22, 46, 49, 48, 48, 48, 48, 48, 48, 48, 48, 
-  47, 47, 47, 47, 26, 2, 45, 46, 41, 41, 41, 41, 41, 41, 41, 41, 40, 
-  40, 40, 40, 39, 38, 2, 22, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 
-  43, 43, 42, 39, 26, 6}, {17, 18, 19, 19, 20, 20, 20, 20, 16, 16, 16,
-   16, 12, 12, 4, 8, 18, 17, 19, 19, 20, 20, 20, 20, 16, 16, 16, 16, 
-  12, 12, 4, 8, 19, 19, 17, 18, 20, 20, 20, 20, 16, 16, 16, 16, 12, 
-  12, 4, 8, 19, 19, 18, 17, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 4,
-   8, 20, 20, 20, 20, 17, 18, 19, 19, 16, 16, 16, 16, 12, 12, 4, 8, 
-  20, 20, 20, 20, 18, 17, 19, 19, 16, 16, 16, 16, 12, 12, 4, 8, 20, 
-  20, 20, 20, 19, 19, 17, 18, 16, 16, 16, 16, 12, 12, 4, 8, 20, 20, 
-  20, 20, 19, 19, 18, 17, 16, 16, 16, 16, 12, 12, 4, 8, 16, 16, 16, 
-  16, 16, 16, 16, 16, 13, 14, 15, 15, 11, 11, 3, 7, 16, 16, 16, 16, 
-  16, 16, 16, 16, 14, 13, 15, 15, 11, 11, 3, 7, 16, 16, 16, 16, 16, 
-  16, 16, 16, 15, 15, 13, 14, 11, 11, 3, 7, 16, 16, 16, 16, 16, 16, 
-  16, 16, 15, 15, 14, 13, 11, 11, 3, 7, 12, 12, 12, 12, 12, 12, 12, 
-  12, 11, 11, 11, 11, 9, 10, 2, 6, 12, 12, 12, 12, 12, 12, 12, 12, 11,
-   11, 11, 11, 10, 9, 2, 6, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 
-  0, 1, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 1, 5}, {18, 35, 36, 
-  36, 37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 35, 18, 36, 36, 
-  37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 36, 36, 18, 35, 37, 
-  37, 37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 36, 36, 35, 18, 37, 37, 
-  37, 37, 34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 18, 35, 36, 
-  36, 34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 35, 18, 36, 36, 
-  34, 34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 36, 36, 18, 35, 34, 
-  34, 34, 34, 31, 31, 28, 24, 37, 37, 37, 37, 36, 36, 35, 18, 34, 34, 
-  34, 34, 31, 31, 28, 24, 34, 34, 34, 34, 34, 34, 34, 34, 14, 32, 33, 
-  33, 30, 30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 33, 
-  30, 30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 30, 
-  30, 27, 23, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 30, 30, 
-  27, 23, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 10, 29, 26, 
-  22, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 29, 10, 26, 22, 
-  24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 22, 22, 1, 21, 28, 
-  28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 26, 26, 25, 1}, {4, 28, 
-  48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 87, 87, 86, 85, 24, 8, 51, 
-  51, 71, 71, 71, 71, 91, 91, 91, 91, 90, 90, 89, 86, 41, 44, 12, 31, 
-  73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87, 41, 44, 31, 12, 73, 
-  73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87, 59, 62, 64, 64, 16, 34, 
-  53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 59, 62, 64, 64, 34, 16, 53, 
-  53, 94, 94, 94, 94, 93, 93, 91, 88, 59, 62, 64, 64, 53, 53, 16, 34, 
-  94, 94, 94, 94, 93, 93, 91, 88, 59, 62, 64, 64, 53, 53, 34, 16, 94, 
-  94, 94, 94, 93, 93, 91, 88, 78, 81, 83, 83, 84, 84, 84, 84, 16, 34, 
-  53, 53, 73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 84, 84, 34, 16, 53, 
-  53, 73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 16, 34, 
-  73, 73, 71, 68, 78, 81, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 73, 
-  73, 71, 68, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 12, 31, 
-  51, 48, 77, 80, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 51, 
-  48, 76, 79, 80, 80, 81, 81, 81, 81, 62, 62, 62, 62, 44, 44, 8, 28, 
-  75, 76, 77, 77, 78, 78, 78, 78, 59, 59, 59, 59, 41, 41, 24, 4}, {8, 
-  24, 51, 51, 71, 71, 71, 71, 91, 91, 91, 91, 90, 90, 89, 86, 28, 4, 
-  48, 48, 68, 68, 68, 68, 88, 88, 88, 88, 87, 87, 86, 85, 44, 41, 12, 
-  31, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87, 44, 41, 31, 12, 
-  73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87, 62, 59, 64, 64, 16, 
-  34, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 62, 59, 64, 64, 34, 16, 
-  53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 62, 59, 64, 64, 53, 53, 16, 
-  34, 94, 94, 94, 94, 93, 93, 91, 88, 62, 59, 64, 64, 53, 53, 34, 16, 
-  94, 94, 94, 94, 93, 93, 91, 88, 81, 78, 83, 83, 84, 84, 84, 84, 16, 
-  34, 53, 53, 73, 73, 71, 68, 81, 78, 83, 83, 84, 84, 84, 84, 34, 16, 
-  53, 53, 73, 73, 71, 68, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 16, 
-  34, 73, 73, 71, 68, 81, 78, 83, 83, 84, 84, 84, 84, 53, 53, 34, 16, 
-  73, 73, 71, 68, 80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 12, 
-  31, 51, 48, 80, 77, 82, 82, 83, 83, 83, 83, 64, 64, 64, 64, 31, 12, 
-  51, 48, 79, 76, 80, 80, 81, 81, 81, 81, 62, 62, 62, 62, 44, 44, 8, 
-  28, 76, 75, 77, 77, 78, 78, 78, 78, 59, 59, 59, 59, 41, 41, 24, 
-  4}, {12, 31, 41, 44, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87,
-   31, 12, 41, 44, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87, 48,
-   48, 4, 28, 68, 68, 68, 68, 88, 88, 88, 88, 87, 87, 86, 85, 51, 51, 
-  24, 8, 71, 71, 71, 71, 91, 91, 91, 91, 90, 90, 89, 86, 64, 64, 59, 
-  62, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 59, 62, 
-  34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 59, 62, 53, 
-  53, 16, 34, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 59, 62, 53, 53, 
-  34, 16, 94, 94, 94, 94, 93, 93, 91, 88, 83, 83, 78, 81, 84, 84, 84, 
-  84, 16, 34, 53, 53, 73, 73, 71, 68, 83, 83, 78, 81, 84, 84, 84, 84, 
-  34, 16, 53, 53, 73, 73, 71, 68, 83, 83, 78, 81, 84, 84, 84, 84, 53, 
-  53, 16, 34, 73, 73, 71, 68, 83, 83, 78, 81, 84, 84, 84, 84, 53, 53, 
-  34, 16, 73, 73, 71, 68, 82, 82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 
-  64, 12, 31, 51, 48, 82, 82, 77, 80, 83, 83, 83, 83, 64, 64, 64, 64, 
-  31, 12, 51, 48, 80, 80, 76, 79, 81, 81, 81, 81, 62, 62, 62, 62, 44, 
-  44, 8, 28, 77, 77, 75, 76, 78, 78, 78, 78, 59, 59, 59, 59, 41, 41, 
-  24, 4}, {12, 31, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90,
-   87, 31, 12, 44, 41, 73, 73, 73, 73, 93, 93, 93, 93, 92, 92, 90, 87,
-   51, 51, 8, 24, 71, 71, 71, 71, 91, 91, 91, 91, 90, 90, 89, 86, 48, 
-  48, 28, 4, 68, 68, 68, 68, 88, 88, 88, 88, 87, 87, 86, 85, 64, 64, 
-  62, 59, 16, 34, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 62, 
-  59, 34, 16, 53, 53, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 62, 59, 
-  53, 53, 16, 34, 94, 94, 94, 94, 93, 93, 91, 88, 64, 64, 62, 59, 53, 
-  53, 34, 16, 94, 94, 94, 94, 93, 93, 91, 88, 83, 83, 81, 78, 84, 84, 
-  84, 84, 16, 34, 53, 53, 73, 73, 71, 68, 83, 83, 81, 78, 84, 84, 84, 
-  84, 34, 16, 53, 53, 73, 73, 71, 68, 83, 83, 81, 78, 84, 84, 84, 84, 
-  53, 53, 16, 34, 73, 73, 71, 68, 83, 83, 81, 78, 84, 84, 84, 84, 53, 
-  53, 34, 16, 73, 73, 71, 68, 82, 82, 80, 77, 83, 83, 83, 83, 64, 64, 
-  64, 64, 12, 31, 51, 48, 82, 82, 80, 77, 83, 83, 83, 83, 64, 64, 64, 
-  64, 31, 12, 51, 48, 80, 80, 79, 76, 81, 81, 81, 81, 62, 62, 62, 62, 
-  44, 44, 8, 28, 77, 77, 76, 75, 78, 78, 78, 78, 59, 59, 59, 59, 41, 
-  41, 24, 4}, {16, 34, 53, 53, 59, 62, 64, 64, 94, 94, 94, 94, 93, 93,
-   91, 88, 34, 16, 53, 53, 59, 62, 64, 64, 94, 94, 94, 94, 93, 93, 91,
-   88, 53, 53, 16, 34, 59, 62, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88,
-   53, 53, 34, 16, 59, 62, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88, 68,
-   68, 68, 68, 4, 28, 48, 48, 88, 88, 88, 88, 87, 87, 86, 85, 71, 71, 
-  71, 71, 24, 8, 51, 51, 91, 91, 91, 91, 90, 90, 89, 86, 73, 73, 73, 
-  73, 41, 44, 12, 31, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 73, 
-  41, 44, 31, 12, 93, 93, 93, 93, 92, 92, 90, 87, 84, 84, 84, 84, 78, 
-  81, 83, 83, 16, 34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 78, 81, 
-  83, 83, 34, 16, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 78, 81, 83, 
-  83, 53, 53, 16, 34, 73, 73, 71, 68, 84, 84, 84, 84, 78, 81, 83, 83, 
-  53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 83, 83, 77, 80, 82, 82, 64, 
-  64, 64, 64, 12, 31, 51, 48, 83, 83, 83, 83, 77, 80, 82, 82, 64, 64, 
-  64, 64, 31, 12, 51, 48, 81, 81, 81, 81, 76, 79, 80, 80, 62, 62, 62, 
-  62, 44, 44, 8, 28, 78, 78, 78, 78, 75, 76, 77, 77, 59, 59, 59, 59, 
-  41, 41, 24, 4}, {16, 34, 53, 53, 62, 59, 64, 64, 94, 94, 94, 94, 93,
-   93, 91, 88, 34, 16, 53, 53, 62, 59, 64, 64, 94, 94, 94, 94, 93, 93,
-   91, 88, 53, 53, 16, 34, 62, 59, 64, 64, 94, 94, 94, 94, 93, 93, 91,
-   88, 53, 53, 34, 16, 62, 59, 64, 64, 94, 94, 94, 94, 93, 93, 91, 88,
-   71, 71, 71, 71, 8, 24, 51, 51, 91, 91, 91, 91, 90, 90, 89, 86, 68, 
-  68, 68, 68, 28, 4, 48, 48, 88, 88, 88, 88, 87, 87, 86, 85, 73, 73, 
-  73, 73, 44, 41, 12, 31, 93, 93, 93, 93, 92, 92, 90, 87, 73, 73, 73, 
-  73, 44, 41, 31, 12, 93, 93, 93, 93, 92, 92, 90, 87, 84, 84, 84, 84, 
-  81, 78, 83, 83, 16, 34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 81, 
-  78, 83, 83, 34, 16, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 81, 78, 
-  83, 83, 53, 53, 16, 34, 73, 73, 71, 68, 84, 84, 84, 84, 81, 78, 83, 
-  83, 53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 83, 83, 80, 77, 82, 82, 
-  64, 64, 64, 64, 12, 31, 51, 48, 83, 83, 83, 83, 80, 77, 82, 82, 64, 
-  64, 64, 64, 31, 12, 51, 48, 81, 81, 81, 81, 79, 76, 80, 80, 62, 62, 
-  62, 62, 44, 44, 8, 28, 78, 78, 78, 78, 76, 75, 77, 77, 59, 59, 59, 
-  59, 41, 41, 24, 4}, {16, 34, 53, 53, 64, 64, 59, 62, 94, 94, 94, 94,
-   93, 93, 91, 88, 34, 16, 53, 53, 64, 64, 59, 62, 94, 94, 94, 94, 93,
-   93, 91, 88, 53, 53, 16, 34, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93,
-   91, 88, 53, 53, 34, 16, 64, 64, 59, 62, 94, 94, 94, 94, 93, 93, 91,
-   88, 73, 73, 73, 73, 12, 31, 41, 44, 93, 93, 93, 93, 92, 92, 90, 87,
-   73, 73, 73, 73, 31, 12, 41, 44, 93, 93, 93, 93, 92, 92, 90, 87, 68,
-   68, 68, 68, 48, 48, 4, 28, 88, 88, 88, 88, 87, 87, 86, 85, 71, 71, 
-  71, 71, 51, 51, 24, 8, 91, 91, 91, 91, 90, 90, 89, 86, 84, 84, 84, 
-  84, 83, 83, 78, 81, 16, 34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 
-  83, 83, 78, 81, 34, 16, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 83, 
-  83, 78, 81, 53, 53, 16, 34, 73, 73, 71, 68, 84, 84, 84, 84, 83, 83, 
-  78, 81, 53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 83, 83, 82, 82, 77, 
-  80, 64, 64, 64, 64, 12, 31, 51, 48, 83, 83, 83, 83, 82, 82, 77, 80, 
-  64, 64, 64, 64, 31, 12, 51, 48, 81, 81, 81, 81, 80, 80, 76, 79, 62, 
-  62, 62, 62, 44, 44, 8, 28, 78, 78, 78, 78, 77, 77, 75, 76, 59, 59, 
-  59, 59, 41, 41, 24, 4}, {16, 34, 53, 53, 64, 64, 62, 59, 94, 94, 94,
-   94, 93, 93, 91, 88, 34, 16, 53, 53, 64, 64, 62, 59, 94, 94, 94, 94,
-   93, 93, 91, 88, 53, 53, 16, 34, 64, 64, 62, 59, 94, 94, 94, 94, 93,
-   93, 91, 88, 53, 53, 34, 16, 64, 64, 62, 59, 94, 94, 94, 94, 93, 93,
-   91, 88, 73, 73, 73, 73, 12, 31, 44, 41, 93, 93, 93, 93, 92, 92, 90,
-   87, 73, 73, 73, 73, 31, 12, 44, 41, 93, 93, 93, 93, 92, 92, 90, 87,
-   71, 71, 71, 71, 51, 51, 8, 24, 91, 91, 91, 91, 90, 90, 89, 86, 68, 
-  68, 68, 68, 48, 48, 28, 4, 88, 88, 88, 88, 87, 87, 86, 85, 84, 84, 
-  84, 84, 83, 83, 81, 78, 16, 34, 53, 53, 73, 73, 71, 68, 84, 84, 84, 
-  84, 83, 83, 81, 78, 34, 16, 53, 53, 73, 73, 71, 68, 84, 84, 84, 84, 
-  83, 83, 81, 78, 53, 53, 16, 34, 73, 73, 71, 68, 84, 84, 84, 84, 83, 
-  83, 81, 78, 53, 53, 34, 16, 73, 73, 71, 68, 83, 83, 83, 83, 82, 82, 
-  80, 77, 64, 64, 64, 64, 12, 31, 51, 48, 83, 83, 83, 83, 82, 82, 80, 
-  77, 64, 64, 64, 64, 31, 12, 51, 48, 81, 81, 81, 81, 80, 80, 79, 76, 
-  62, 62, 62, 62, 44, 44, 8, 28, 78, 78, 78, 78, 77, 77, 76, 75, 59, 
-  59, 59, 59, 41, 41, 24, 4}, {20, 37, 55, 55, 74, 74, 74, 74, 59, 62,
-   64, 64, 73, 73, 71, 68, 37, 20, 55, 55, 74, 74, 74, 74, 59, 62, 64,
-   64, 73, 73, 71, 68, 55, 55, 20, 37, 74, 74, 74, 74, 59, 62, 64, 64,
-   73, 73, 71, 68, 55, 55, 37, 20, 74, 74, 74, 74, 59, 62, 64, 64, 73,
-   73, 71, 68, 74, 74, 74, 74, 20, 37, 55, 55, 59, 62, 64, 64, 73, 73,
-   71, 68, 74, 74, 74, 74, 37, 20, 55, 55, 59, 62, 64, 64, 73, 73, 71,
-   68, 74, 74, 74, 74, 55, 55, 20, 37, 59, 62, 64, 64, 73, 73, 71, 68,
-   74, 74, 74, 74, 55, 55, 37, 20, 59, 62, 64, 64, 73, 73, 71, 68, 68,
-   68, 68, 68, 68, 68, 68, 68, 3, 27, 47, 47, 67, 67, 66, 65, 71, 71, 
-  71, 71, 71, 71, 71, 71, 23, 7, 50, 50, 70, 70, 69, 66, 73, 73, 73, 
-  73, 73, 73, 73, 73, 40, 43, 11, 30, 72, 72, 70, 67, 73, 73, 73, 73, 
-  73, 73, 73, 73, 40, 43, 30, 11, 72, 72, 70, 67, 64, 64, 64, 64, 64, 
-  64, 64, 64, 58, 61, 63, 63, 11, 30, 50, 47, 64, 64, 64, 64, 64, 64, 
-  64, 64, 58, 61, 63, 63, 30, 11, 50, 47, 62, 62, 62, 62, 62, 62, 62, 
-  62, 57, 60, 61, 61, 43, 43, 7, 27, 59, 59, 59, 59, 59, 59, 59, 59, 
-  56, 57, 58, 58, 40, 40, 23, 3}, {20, 37, 55, 55, 74, 74, 74, 74, 62,
-   59, 64, 64, 73, 73, 71, 68, 37, 20, 55, 55, 74, 74, 74, 74, 62, 59,
-   64, 64, 73, 73, 71, 68, 55, 55, 20, 37, 74, 74, 74, 74, 62, 59, 64,
-   64, 73, 73, 71, 68, 55, 55, 37, 20, 74, 74, 74, 74, 62, 59, 64, 64,
-   73, 73, 71, 68, 74, 74, 74, 74, 20, 37, 55, 55, 62, 59, 64, 64, 73,
-   73, 71, 68, 74, 74, 74, 74, 37, 20, 55, 55, 62, 59, 64, 64, 73, 73,
-   71, 68, 74, 74, 74, 74, 55, 55, 20, 37, 62, 59, 64, 64, 73, 73, 71,
-   68, 74, 74, 74, 74, 55, 55, 37, 20, 62, 59, 64, 64, 73, 73, 71, 68,
-   71, 71, 71, 71, 71, 71, 71, 71, 7, 23, 50, 50, 70, 70, 69, 66, 68, 
-  68, 68, 68, 68, 68, 68, 68, 27, 3, 47, 47, 67, 67, 66, 65, 73, 73, 
-  73, 73, 73, 73, 73, 73, 43, 40, 11, 30, 72, 72, 70, 67, 73, 73, 73, 
-  73, 73, 73, 73, 73, 43, 40, 30, 11, 72, 72, 70, 67, 64, 64, 64, 64, 
-  64, 64, 64, 64, 61, 58, 63, 63, 11, 30, 50, 47, 64, 64, 64, 64, 64, 
-  64, 64, 64, 61, 58, 63, 63, 30, 11, 50, 47, 62, 62, 62, 62, 62, 62, 
-  62, 62, 60, 57, 61, 61, 43, 43, 7, 27, 59, 59, 59, 59, 59, 59, 59, 
-  59, 57, 56, 58, 58, 40, 40, 23, 3}, {20, 37, 55, 55, 74, 74, 74, 74,
-   64, 64, 59, 62, 73, 73, 71, 68, 37, 20, 55, 55, 74, 74, 74, 74, 64,
-   64, 59, 62, 73, 73, 71, 68, 55, 55, 20, 37, 74, 74, 74, 74, 64, 64,
-   59, 62, 73, 73, 71, 68, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64, 59,
-   62, 73, 73, 71, 68, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 59, 62,
-   73, 73, 71, 68, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 59, 62, 73,
-   73, 71, 68, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 59, 62, 73, 73,
-   71, 68, 74, 74, 74, 74, 55, 55, 37, 20, 64, 64, 59, 62, 73, 73, 71,
-   68, 73, 73, 73, 73, 73, 73, 73, 73, 11, 30, 40, 43, 72, 72, 70, 67,
-   73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 40, 43, 72, 72, 70, 67, 68,
-   68, 68, 68, 68, 68, 68, 68, 47, 47, 3, 27, 67, 67, 66, 65, 71, 71, 
-  71, 71, 71, 71, 71, 71, 50, 50, 23, 7, 70, 70, 69, 66, 64, 64, 64, 
-  64, 64, 64, 64, 64, 63, 63, 58, 61, 11, 30, 50, 47, 64, 64, 64, 64, 
-  64, 64, 64, 64, 63, 63, 58, 61, 30, 11, 50, 47, 62, 62, 62, 62, 62, 
-  62, 62, 62, 61, 61, 57, 60, 43, 43, 7, 27, 59, 59, 59, 59, 59, 59, 
-  59, 59, 58, 58, 56, 57, 40, 40, 23, 3}, {20, 37, 55, 55, 74, 74, 74,
-   74, 64, 64, 62, 59, 73, 73, 71, 68, 37, 20, 55, 55, 74, 74, 74, 74,
-   64, 64, 62, 59, 73, 73, 71, 68, 55, 55, 20, 37, 74, 74, 74, 74, 64,
-   64, 62, 59, 73, 73, 71, 68, 55, 55, 37, 20, 74, 74, 74, 74, 64, 64,
-   62, 59, 73, 73, 71, 68, 74, 74, 74, 74, 20, 37, 55, 55, 64, 64, 62,
-   59, 73, 73, 71, 68, 74, 74, 74, 74, 37, 20, 55, 55, 64, 64, 62, 59,
-   73, 73, 71, 68, 74, 74, 74, 74, 55, 55, 20, 37, 64, 64, 62, 59, 73,
-   73, 71, 68, 74, 74, 74, 74, 55, 55, 37, 20, 64, 64, 62, 59, 73, 73,
-   71, 68, 73, 73, 73, 73, 73, 73, 73, 73, 11, 30, 43, 40, 72, 72, 70,
-   67, 73, 73, 73, 73, 73, 73, 73, 73, 30, 11, 43, 40, 72, 72, 70, 67,
-   71, 71, 71, 71, 71, 71, 71, 71, 50, 50, 7, 23, 70, 70, 69, 66, 68, 
-  68, 68, 68, 68, 68, 68, 68, 47, 47, 27, 3, 67, 67, 66, 65, 64, 64, 
-  64, 64, 64, 64, 64, 64, 63, 63, 61, 58, 11, 30, 50, 47, 64, 64, 64, 
-  64, 64, 64, 64, 64, 63, 63, 61, 58, 30, 11, 50, 47, 62, 62, 62, 62, 
-  62, 62, 62, 62, 61, 61, 60, 57, 43, 43, 7, 27, 59, 59, 59, 59, 59, 
-  59, 59, 59, 58, 58, 57, 56, 40, 40, 23, 3}, {19, 36, 54, 54, 55, 55,
-   55, 55, 53, 53, 53, 53, 41, 44, 51, 48, 36, 19, 54, 54, 55, 55, 55,
-   55, 53, 53, 53, 53, 41, 44, 51, 48, 54, 54, 19, 36, 55, 55, 55, 55,
-   53, 53, 53, 53, 41, 44, 51, 48, 54, 54, 36, 19, 55, 55, 55, 55, 53,
-   53, 53, 53, 41, 44, 51, 48, 55, 55, 55, 55, 19, 36, 54, 54, 53, 53,
-   53, 53, 41, 44, 51, 48, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53, 53,
-   53, 41, 44, 51, 48, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53, 53,
-   41, 44, 51, 48, 55, 55, 55, 55, 54, 54, 36, 19, 53, 53, 53, 53, 41,
-   44, 51, 48, 53, 53, 53, 53, 53, 53, 53, 53, 15, 33, 52, 52, 40, 43,
-   50, 47, 53, 53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 40, 43, 50,
-   47, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 40, 43, 50, 47,
-   53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 33, 15, 40, 43, 50, 47, 48,
-   48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 2, 26, 46, 45, 51, 51, 
-  51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 22, 6, 49, 46, 44, 44, 44, 
-  44, 44, 44, 44, 44, 43, 43, 43, 43, 39, 42, 6, 26, 41, 41, 41, 41, 
-  41, 41, 41, 41, 40, 40, 40, 40, 38, 39, 22, 2}, {19, 36, 54, 54, 55,
-   55, 55, 55, 53, 53, 53, 53, 44, 41, 51, 48, 36, 19, 54, 54, 55, 55,
-   55, 55, 53, 53, 53, 53, 44, 41, 51, 48, 54, 54, 19, 36, 55, 55, 55,
-   55, 53, 53, 53, 53, 44, 41, 51, 48, 54, 54, 36, 19, 55, 55, 55, 55,
-   53, 53, 53, 53, 44, 41, 51, 48, 55, 55, 55, 55, 19, 36, 54, 54, 53,
-   53, 53, 53, 44, 41, 51, 48, 55, 55, 55, 55, 36, 19, 54, 54, 53, 53,
-   53, 53, 44, 41, 51, 48, 55, 55, 55, 55, 54, 54, 19, 36, 53, 53, 53,
-   53, 44, 41, 51, 48, 55, 55, 55, 55, 54, 54, 36, 19, 53, 53, 53, 53,
-   44, 41, 51, 48, 53, 53, 53, 53, 53, 53, 53, 53, 15, 33, 52, 52, 43,
-   40, 50, 47, 53, 53, 53, 53, 53, 53, 53, 53, 33, 15, 52, 52, 43, 40,
-   50, 47, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 15, 33, 43, 40, 50,
-   47, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 33, 15, 43, 40, 50, 47,
-   51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 6, 22, 49, 46, 48, 
-  48, 48, 48, 48, 48, 48, 48, 47, 47, 47, 47, 26, 2, 46, 45, 44, 44, 
-  44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 42, 39, 6, 26, 41, 41, 41, 
-  41, 41, 41, 41, 41, 40, 40, 40, 40, 39, 38, 22, 2}, {18, 35, 36, 36,
-   37, 37, 37, 37, 34, 34, 34, 34, 31, 31, 24, 28, 35, 18, 36, 36, 37,
-   37, 37, 37, 34, 34, 34, 34, 31, 31, 24, 28, 36, 36, 18, 35, 37, 37,
-   37, 37, 34, 34, 34, 34, 31, 31, 24, 28, 36, 36, 35, 18, 37, 37, 37,
-   37, 34, 34, 34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 18, 35, 36, 36,
-   34, 34, 34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 35, 18, 36, 36, 34,
-   34, 34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 36, 36, 18, 35, 34, 34,
-   34, 34, 31, 31, 24, 28, 37, 37, 37, 37, 36, 36, 35, 18, 34, 34, 34,
-   34, 31, 31, 24, 28, 34, 34, 34, 34, 34, 34, 34, 34, 14, 32, 33, 33,
-   30, 30, 23, 27, 34, 34, 34, 34, 34, 34, 34, 34, 32, 14, 33, 33, 30,
-   30, 23, 27, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 14, 32, 30, 30,
-   23, 27, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 32, 14, 30, 30, 23,
-   27, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 10, 29, 22, 26,
-   31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 29, 10, 22, 26, 28,
-   28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 26, 26, 1, 25, 24, 24, 
-  24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 22, 22, 21, 1}, {17, 18, 19,
-   19, 20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 18, 17, 19, 19, 
-  20, 20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 19, 19, 17, 18, 20, 
-  20, 20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 19, 19, 18, 17, 20, 20, 
-  20, 20, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 17, 18, 19, 
-  19, 16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 18, 17, 19, 19, 
-  16, 16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 19, 19, 17, 18, 16, 
-  16, 16, 16, 12, 12, 8, 4, 20, 20, 20, 20, 19, 19, 18, 17, 16, 16, 
-  16, 16, 12, 12, 8, 4, 16, 16, 16, 16, 16, 16, 16, 16, 13, 14, 15, 
-  15, 11, 11, 7, 3, 16, 16, 16, 16, 16, 16, 16, 16, 14, 13, 15, 15, 
-  11, 11, 7, 3, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 13, 14, 11, 
-  11, 7, 3, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 14, 13, 11, 11, 7,
-   3, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 9, 10, 6, 2, 12,
-   12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 10, 9, 6, 2, 8, 8, 8, 
-  8, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 5, 1, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3,
-   3, 3, 2, 2, 1, 0}}
\ No newline at end of file
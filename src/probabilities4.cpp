@@ -1,21 +1,8 @@
 #include "probabilities4.h"
+#include "intermediateProbabilitiesMask.hpp"
 #include <cmath>
 #include <stdexcept>
-const int probabilityData<4>::intermediateProbabilitiesMask[][16] =
-{ { 0, 1, 2, 2, 1, 3, 4, 4, 2, 4, 5, 6, 2, 4, 6, 5 }, { 1, 7, 8, 8, 9, 1,
-10, 10, 10, 8, 6, 11, 10, 8, 11, 6 }, { 2, 8, 12, 13, 10, 4, 13, 14,
-15, 16, 2, 10, 16, 17, 8, 4 }, { 2, 8, 13, 12, 10, 4, 14, 13, 16, 17,
-4, 8, 15, 16, 10, 2 }, { 1, 9, 10, 10, 7, 1, 8, 8, 8, 10, 6, 11, 8,
-10, 11, 6 }, { 3, 1, 4, 4, 1, 0, 2, 2, 4, 2, 5, 6, 4, 2, 6, 5 }, { 4,
-10, 13, 14, 8, 2, 12, 13, 16, 15, 2, 10, 17, 16, 8, 4 }, { 4, 10, 14,
-13, 8, 2, 13, 12, 17, 16, 4, 8, 16, 15, 10, 2 }, { 2, 10, 15, 16, 8,
-4, 16, 17, 12, 13, 2, 8, 13, 14, 10, 4 }, { 4, 8, 16, 17, 10, 2, 15,
-16, 13, 12, 2, 8, 14, 13, 10, 4 }, { 5, 6, 2, 4, 6, 5, 2, 4, 2, 2, 0,
-1, 4, 4, 1, 3 }, { 6, 11, 10, 8, 11, 6, 10, 8, 8, 8, 1, 7, 10, 10, 9,
-1 }, { 2, 10, 16, 15, 8, 4, 17, 16, 13, 14, 4, 10, 12, 13, 8, 2 }, { 4,
-8, 17, 16, 10, 2, 16, 15, 14, 13, 4, 10, 13, 12, 8, 2 }, { 6, 11, 8,
-10, 11, 6, 8, 10, 10, 10, 1, 9, 8, 8, 7, 1 }, { 5, 6, 4, 2, 6, 5, 4,
-2, 4, 4, 3, 1, 2, 2, 1, 0 } };
+const int (&probabilityData<4>::intermediateProbabilitiesMask)[16][16] = intermediateProbabilitiesMaskGenerator<4>::get();
 const int probabilityData<4>::intermediateAllelesMask[][4] = 
 		{
 			{0,  1,  2,  3},
@@ -10,7 +10,8 @@ public:
 	In terms of values, see Table one of the paper. Zero = first equation of table, one = second equation, etc. Note that
 	we combine equations 4 and 5 into a single state. 
 	*/
-	static const int intermediateProbabilitiesMask[64][64];
+	//Generated from the symmetries of the funnel, see intermediateProbabilitiesMask.hpp
+	static const int (&intermediateProbabilitiesMask)[64][64];
 	/*This mask takes in the two alleles at a *single* location and returns a value encoding that genotype. */
 	static const int intermediateAllelesMask[8][8];
 	static const int infiniteMask[8][8];
@@ -1,5 +1,6 @@
 #include "rawSymmetricMatrix.h"
 #include "matrixChunks.h"
+#include "packedTriangleFile.h"
 SEXP rawSymmetricMatrixSubsetByMatrix(SEXP object_, SEXP index_)
 {
 BEGIN_RCPP
@@ -13,15 +14,8 @@ BEGIN_RCPP
 		throw std::runtime_error("Input object must be an S4 object");
 	}
 
-	Rcpp::RawVector data;
-	try
-	{
-		data = Rcpp::as<Rcpp::RawVector>(object.slot("data"));
-	}
-	catch(...)
-	{
-		throw std::runtime_error("Slot object@data must be a raw vector");
-	}
+	rawSymmetricMatrixData view(object, false);
+	const Rbyte* data = view.getData();
 
 	Rcpp::NumericVector levels;
 	try
@@ -61,7 +55,8 @@ BEGIN_RCPP
 	Rcpp::S4 object = object_;
 	Rcpp::CharacterVector markers = object.slot("markers");
 	Rcpp::NumericVector levels = object.slot("levels");
-	Rcpp::RawVector data = object.slot("data");
+	rawSymmetricMatrixData view(object, false);
+	const Rbyte* data = view.getData();
 	Rcpp::IntegerVector i = i_;
 	Rcpp::IntegerVector j = j_;
 	bool drop = Rcpp::as<bool>(drop_);
@@ -139,7 +134,8 @@ SEXP rawSymmetricMatrixSubsetObject(SEXP object_, SEXP indices_)
 {
 BEGIN_RCPP
 	Rcpp::S4 object = object_;
-	Rcpp::RawVector oldData = object.slot("data");
+	rawSymmetricMatrixData view(object, false);
+	const Rbyte* oldData = view.getData();
 	Rcpp::IntegerVector indices = indices_;
 	R_xlen_t newNMarkers = indices.size();
 	Rcpp::RawVector newData((indices.size() * (indices.size() + (R_xlen_t)1))/(R_xlen_t)2);
@@ -164,13 +160,14 @@ SEXP assignRawSymmetricMatrixFromEstimateRF(SEXP destination_, SEXP rowIndices_,
 BEGIN_RCPP
 	Rcpp::S4 destination = destination_;
 	Rcpp::RawVector source = source_;
-	Rcpp::RawVector destinationData = destination.slot("data");
+	rawSymmetricMatrixData view(destination, true);
+	Rbyte* destinationData = view.getData();
 	Rcpp::IntegerVector rowIndices = rowIndices_;
 	Rcpp::IntegerVector columnIndices = columnIndices_;
 
-	if(&(source(0)) == &(destinationData(0)))
+	if(&(source(0)) == destinationData)
 	{
-		throw std::runtime_error("Source and destination cannot be the same in assignRawSymmetricMatrixDiagonal");
+		throw std::runtime_error("Source and destination cannot be the same in assignRawSymmetricMatrixFromEstimateRF");
 	}
 
 	std::vector<int> markerRows, markerColumns;
@@ -187,7 +184,7 @@ BEGIN_RCPP
 	{
 		std::pair<int, int> markerPair = iterator.get();
 		R_xlen_t markerRow = markerPair.first, markerColumn = markerPair.second;
-		destinationData((markerColumn*(markerColumn-(R_xlen_t)1))/(R_xlen_t)2 + (markerRow - (R_xlen_t)1)) = source(counter);
+		destinationData[(markerColumn*(markerColumn-(R_xlen_t)1))/(R_xlen_t)2 + (markerRow - (R_xlen_t)1)] = source(counter);
 		counter++;
 	}
 	return R_NilValue;
@@ -197,16 +194,18 @@ SEXP assignRawSymmetricMatrixDiagonal(SEXP destination_, SEXP indices_, SEXP sou
 {
 BEGIN_RCPP
 	Rcpp::S4 destination = destination_;
-	Rcpp::RawVector source = source_;
+	//The source may be held in a file, so it's read through a view
+	rawSymmetricMatrixData sourceView(Rcpp::S4(source_), false);
+	const Rbyte* source = sourceView.getData();
 	Rcpp::RawVector destinationData = destination.slot("data");
 	Rcpp::IntegerVector indices = indices_;
 
-	if(&(source(0)) == &(destinationData(0)))
+	if(sourceView.getNValues() > 0 && source == &(destinationData(0)))
 	{
 		throw std::runtime_error("Source and destination cannot be the same in assignRawSymmetricMatrixDiagonal");
 	}
 
-	if((indices.size()*(indices.size()+(R_xlen_t)1))/(R_xlen_t)2 != source.size())
+	if((indices.size()*(indices.size()+(R_xlen_t)1))/(R_xlen_t)2 != sourceView.getNValues())
 	{
 		throw std::runtime_error("Mismatch between index length and source object size");
 	}
@@ -220,7 +219,7 @@ BEGIN_RCPP
 			{
 				std::swap(rowIndex, columnIndex);
 			}
-			destinationData((columnIndex*(columnIndex-(R_xlen_t)1))/(R_xlen_t)2+rowIndex-(R_xlen_t)1) = source((column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row);
+			destinationData((columnIndex*(columnIndex-(R_xlen_t)1))/(R_xlen_t)2+rowIndex-(R_xlen_t)1) = source[(column*(column+(R_xlen_t)1))/(R_xlen_t)2 + row];
 		}
 	}
 END_RCPP
@@ -246,7 +245,8 @@ BEGIN_RCPP
 	Rcpp::S4 rawSymmetric = object;
 	Rcpp::NumericVector levels = Rcpp::as<Rcpp::NumericVector>(rawSymmetric.slot("levels"));
 	Rcpp::CharacterVector markers = Rcpp::as<Rcpp::CharacterVector>(rawSymmetric.slot("markers"));
-	Rcpp::RawVector data = Rcpp::as<Rcpp::RawVector>(rawSymmetric.slot("data"));
+	rawSymmetricMatrixData view(rawSymmetric, false);
+	const Rbyte* data = view.getData();
 	R_xlen_t size = markers.size(), levelsSize = levels.size();
 
 	Rcpp::NumericVector result(size*(size - 1)/2, 0);
@@ -255,7 +255,7 @@ BEGIN_RCPP
 	{
 		for(R_xlen_t column = row+1; column < size; column++)
 		{
-			int byte = data(column * (column + (R_xlen_t)1)/(R_xlen_t)2 + row);
+			int byte = data[column * (column + (R_xlen_t)1)/(R_xlen_t)2 + row];
 			if(byte == 255) result(counter) = std::numeric_limits<double>::quiet_NaN();
 			else result(counter) = levels(byte);
 			counter++;
@@ -317,12 +317,12 @@ BEGIN_RCPP
 	Rcpp::S4 rawSymmetric = object;
 	Rcpp::NumericVector levels = Rcpp::as<Rcpp::NumericVector>(rawSymmetric.slot("levels"));
 	Rcpp::CharacterVector markers = Rcpp::as<Rcpp::CharacterVector>(rawSymmetric.slot("markers"));
-	Rcpp::RawVector data = Rcpp::as<Rcpp::RawVector>(rawSymmetric.slot("data"));
+	rawSymmetricMatrixData view(rawSymmetric, false);
 	int nMarkers = markers.size();
 	std::vector<double> levelsCopied = Rcpp::as<std::vector<double> >(levels);
 	
 	std::vector<int> permutation(nMarkers);
 	for(int i = 0; i < nMarkers; i++) permutation[i] = i;
-	return constructDissimilarityMatrixInternal(&(data(0)), levelsCopied, nMarkers, clusters_, 0, permutation);
+	return constructDissimilarityMatrixInternal(view.getData(), levelsCopied, nMarkers, clusters_, 0, permutation);
 END_RCPP
 }
@@ -1,10 +1,12 @@
 #include "recodeFoundersFinalsHets.h"
+#include <sstream>
 /*
 	Re-code the founder and final marker genotypes so that they always start at 0 and go up to n-1 where n is the number of distinct marker alleles at that particular marker. The maximum number of alleles across all the markers is recorded and output. 
 */
 void recodeFoundersFinalsHets(recodeDataStruct& inputs)
 {
 	inputs.maxAlleles = 0;
+	inputs.maxAllelesMarker = 0;
 	long nMarkers = inputs.finals.ncol();
 	long nFounders = inputs.founders.nrow(), nFinals = inputs.finals.nrow();
 	
@@ -55,7 +57,11 @@ void recodeFoundersFinalsHets(recodeDataStruct& inputs)
 		//The homozygotes get translated as-is, the heterozygotes are given sequential labels afterwards. 
 		std::sort(hetValues.begin(), hetValues.end());
 		hetValues.erase(std::unique(hetValues.begin(), hetValues.end()), hetValues.end());
-		inputs.maxAlleles = std::max(inputs.maxAlleles, (unsigned int)(nFounderAlleles + hetValues.size()));
+		if(nFounderAlleles + hetValues.size() > inputs.maxAlleles)
+		{
+			inputs.maxAlleles = (unsigned int)(nFounderAlleles + hetValues.size());
+			inputs.maxAllelesMarker = markerCounter;
+		}
 		for(std::size_t allowedValueCounter = 0; allowedValueCounter < hetValues.size(); allowedValueCounter++)
 		{
 			finalTranslations.insert(std::make_pair(hetValues[allowedValueCounter], (int)allowedValueCounter+nFounderAlleles));
@@ -77,3 +83,14 @@ void recodeFoundersFinalsHets(recodeDataStruct& inputs)
 		inputs.recodedHetData(markerCounter) = recodedCurrentMarkerHetData;
 	}
 }
+std::string checkMaxAlleles(const recodeDataStruct& recoded)
+{
+	if(recoded.maxAlleles <= 64) return "";
+	std::stringstream ss;
+	Rcpp::RObject markerNames = Rcpp::as<Rcpp::List>(recoded.hetData).attr("names");
+	ss << "Marker ";
+	if(markerNames.isNULL()) ss << recoded.maxAllelesMarker + 1;
+	else ss << Rcpp::as<std::string>(Rcpp::as<Rcpp::CharacterVector>(markerNames)(recoded.maxAllelesMarker));
+	ss << " has " << recoded.maxAlleles << " different values, including the heterozygotes, but at most 64 are allowed. Try removing the heterozygotes with removeHets()";
+	return ss.str();
+}
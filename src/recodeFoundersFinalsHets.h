@@ -1,6 +1,7 @@
 #ifndef RECODE_FOUNDERS_AND_FINALS_AND_HET_DATA_HEADER_GUARD
 #define RECODE_FOUNDERS_AND_FINALS_AND_HET_DATA_HEADER_GUARD
 #include <Rcpp.h>
+#include <string>
 struct recodeDataStruct
 {
 	Rcpp::IntegerMatrix recodedFounders;
@@ -10,6 +11,10 @@ struct recodeDataStruct
 	Rcpp::IntegerMatrix finals;
 	Rcpp::S4 hetData;
 	unsigned int maxAlleles;
+	//The first marker with maxAlleles values
+	long maxAllelesMarker;
 };
 void recodeFoundersFinalsHets(recodeDataStruct& inputs);
+//The lookup tables of estimateRF and imputeFounders allow at most 64 values per marker, including the heterozygotes. Returns an error message naming the marker with the most values if there are more, or an empty string.
+std::string checkMaxAlleles(const recodeDataStruct& recoded);
 #endif
\ No newline at end of file
@@ -28,6 +28,8 @@
 #include "checkImputedBounds.h"
 #include "generateDesignMatrix.h"
 #include "compressedProbabilities_RInterface.h"
+#include "genericFunnelProbabilities.h"
+#include "packedTriangleFile.h"
 #include "testDistortion.h"
 #include "removeHets.h"
 #ifdef HAS_BOOST
@@ -42,7 +44,8 @@ extern "C"
 		{"generateGenotypes", (DL_FUNC)&generateGenotypes, 3},
 		{"alleleDataErrors", (DL_FUNC)&alleleDataErrors, 2},
 		{"listCodingErrors", (DL_FUNC)&listCodingErrors, 3},
-		{"estimateRF", (DL_FUNC)&estimateRF, 9},
+		{"estimateRF", (DL_FUNC)&estimateRF, 12},
+		{"estimateRFAssign", (DL_FUNC)&estimateRFAssign, 13},
 		{"fourParentPedigreeRandomFunnels", (DL_FUNC)&fourParentPedigreeRandomFunnels, 4},
 		{"fourParentPedigreeSingleFunnel", (DL_FUNC)&fourParentPedigreeSingleFunnel, 4},
 		{"eightParentPedigreeRandomFunnels", (DL_FUNC)&eightParentPedigreeRandomFunnels, 4},
@@ -57,6 +60,9 @@ extern "C"
 		{"assignRawSymmetricMatrixFromEstimateRF", (DL_FUNC)&assignRawSymmetricMatrixFromEstimateRF, 4},
 		{"assignRawSymmetricMatrixDiagonal", (DL_FUNC)&assignRawSymmetricMatrixDiagonal, 3},
 		{"assignDspMatrixFromEstimateRF", (DL_FUNC)&assignDspMatrixFromEstimateRF, 4},
+		{"dspMatrixSubsetObject", (DL_FUNC)&dspMatrixSubsetObject, 2},
+		{"compactLodMatrixSubsetObject", (DL_FUNC)&compactLodMatrixSubsetObject, 2},
+		{"encodeLodValues", (DL_FUNC)&encodeLodValues, 2},
 		{"preClusterStep", (DL_FUNC)&preClusterStep, 1},
 		{"hclustThetaMatrix", (DL_FUNC)&hclustThetaMatrix, 2},
 		{"hclustCombinedMatrix", (DL_FUNC)&hclustCombinedMatrix, 2},
@@ -66,7 +72,7 @@ extern "C"
 		{"checkRawSymmetricMatrix", (DL_FUNC)&checkRawSymmetricMatrix, 1},
 		{"arsa", (DL_FUNC)&arsaExportedR, 8},
 		{"imputeWholeObject", (DL_FUNC)&imputeWholeObject, 2},
-		{"imputeGroup", (DL_FUNC)&imputeGroup, 3},
+		{"imputeGroup", (DL_FUNC)&imputeGroup, 4},
 		{"multiparentSNPRemoveHets", (DL_FUNC)&multiparentSNPRemoveHets, 1},
 		{"multiparentSNPKeepHets", (DL_FUNC)&multiparentSNPKeepHets, 1},
 		{"rawSymmetricMatrixSubsetByMatrix", (DL_FUNC)&rawSymmetricMatrixSubsetByMatrix, 2},
@@ -74,12 +80,19 @@ extern "C"
 		{"checkImputedBounds", (DL_FUNC)&checkImputedBounds, 1},
 		{"generateDesignMatrix", (DL_FUNC)&generateDesignMatrix, 2},
 		{"compressedProbabilities", (DL_FUNC)&compressedProbabilities_RInterface, 6},
+		{"genericFunnelProbabilities", (DL_FUNC)&genericFunnelProbabilities_RInterface, 4},
+		{"expandedProbabilities", (DL_FUNC)&expandedProbabilities_RInterface, 4},
 		{"eightParentPedigreeImproperFunnels", (DL_FUNC)&eightParentPedigreeImproperFunnels, 3},
 #ifdef HAS_BOOST
 		{"reorderPedigree", (DL_FUNC)&reorderPedigree, 3},
 #endif
 		{"testDistortion", (DL_FUNC)&testDistortion, 1},
 		{"removeHets", (DL_FUNC)&removeHets, 3},
+		{"createPackedTriangleFile", (DL_FUNC)&createPackedTriangleFile, 4},
+		{"packedTriangleFileHeader", (DL_FUNC)&packedTriangleFileHeader, 1},
+		{"readPackedTriangleFile", (DL_FUNC)&readPackedTriangleFile, 1},
+		{"assignPackedTriangleRange", (DL_FUNC)&assignPackedTriangleRange, 3},
+		{"triangleShardColumns", (DL_FUNC)&triangleShardColumns, 2},
 		{NULL, NULL, 0}
 	};
 	RcppExport void R_init_mpMap2(DllInfo *info)
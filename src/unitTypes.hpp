@@ -1,5 +1,6 @@
 #ifndef UNIT_TYPES_HEADER_GUARD
 #define UNIT_TYPES_HEADER_GUARD
+#include <cstring>
 template <typename T, typename V> struct Unique
 {
 	V value;
@@ -16,9 +17,24 @@ template <typename T, typename V> struct Unique
 struct markerPatternID_imp;
 typedef Unique<markerPatternID_imp, int> markerPatternID;
 
-//The funnel encoding struct represents a particular funnel, encoded as a bitfield
-struct funnelEncoding_imp;
-typedef Unique<funnelEncoding_imp, std::size_t> funnelEncoding;
+//The funnel encoding struct represents a particular funnel, as the founders (numbered from zero) in funnel order. Entries past the number of founders are zero.
+struct funnelEncoding
+{
+	static const int maxFounders = 64;
+	funnelEncoding()
+	{
+		memset(founders, 0, sizeof(founders));
+	}
+	int operator[](int founderCounter) const
+	{
+		return founders[founderCounter];
+	}
+	bool operator<(const funnelEncoding& other) const
+	{
+		return memcmp(founders, other.founders, sizeof(founders)) < 0;
+	}
+	unsigned char founders[maxFounders];
+};
 
 //The funnel ID struct representse a unique identifier, assigned to a particular funnel encoding
 struct funnelID_imp;
@@ -14,17 +14,35 @@
 #include "intercrossingHaplotypeToMarker.hpp"
 #include "funnelHaplotypeToMarker.hpp"
 #include <limits>
+/*
+ * Lines are imputed in batches. All the lines in a batch have the same class, meaning that they have the same number of generations of selfing, and either the same funnel (without intercrossing) or the same number of generations of intercrossing. Lines with intercrossing are treated as having the identity funnel. 
+ * Lines of the same class share the transition probabilities, and the funnel-permuted lookups of the founder genotypes. These are computed once per class and marker interval, and all the lines of the batch are then advanced together. Path lengths are stored with the line as the fastest index, so the inner max-plus loop runs over contiguous lines.
+ * Instead of copying the best path to each state at every marker, the best previous state is recorded, and the path is found by tracing back from the end. Path lengths are computed with the same operations in the same order as for a single line, and ties go to the lowest encoding, so the results are identical.
+ */
 template<int nFounders> struct viterbiAlgorithm<nFounders, false>
 {
-	typedef typename expandedProbabilities<nFounders, false>::type expandedProbabilitiesType;
+	typedef typename logCompressedGenotypeProbabilities<nFounders, false>::type logCompressedProbabilitiesType;
+	//Pairs of founders are encoded as 1 to nFounders(nFounders+1)/2 by key. Zero is never a valid encoding. 
+	static const int nEncodings = nFounders*(nFounders+1)/2 + 1;
 	Rcpp::List recodedHetData;
 	Rcpp::IntegerMatrix recodedFounders, recodedFinals;
-	rowMajorMatrix<int> intermediate1, intermediate2;
 	Rcpp::IntegerMatrix results;
-	std::vector<double> pathLengths1, pathLengths2;
-	std::vector<double> working;
-	xMajorMatrix<expandedProbabilitiesType>& intercrossingHaplotypeProbabilities;
-	rowMajorMatrix<expandedProbabilitiesType>& funnelHaplotypeProbabilities;
+	//Path lengths for each encoding, and each line of the current batch, with index encoding * nLines + line. The masked version is -inf wherever the state is not consistent with the data at the previous marker. 
+	std::vector<double> pathLengths1, pathLengths2, maskedPathLengths;
+	//The best previous state for each marker, encoding and line of the current batch. The working version is for a single marker and encoding, and is stored as double so that it has the same width as the path lengths. 
+	std::vector<unsigned char> bestPrevious;
+	std::vector<double> bestPreviousWorking;
+	//Whether each state is consistent with the data at the current marker, for each line of the current batch
+	std::vector<char> currentConsistent;
+	//The log probability of a missing value for a homozygote and a heterozygote at the current marker, or zero if the value is not missing. 
+	std::vector<double> homozygotePenalty, heterozygotePenalty;
+	//The parts of the transitions which depend only on the class, with index current encoding * nEncodings + previous encoding
+	std::vector<double> transitionMultiples;
+	std::vector<int> transitionMaskIndices;
+	std::vector<int> path;
+	std::vector<int> failedMarker;
+	xMajorMatrix<logCompressedProbabilitiesType>& intercrossingHaplotypeProbabilities;
+	rowMajorMatrix<logCompressedProbabilitiesType>& funnelHaplotypeProbabilities;
 	markerPatternsToUniqueValuesArgs& markerData;
 	std::vector<funnelID>* lineFunnelIDs;
 	std::vector<funnelEncoding>* lineFunnelEncodings;
@@ -38,290 +56,457 @@ template<int nFounders> struct viterbiAlgorithm<nFounders, false>
 	double heterozygoteMissingProb, homozygoteMissingProb;
 	std::vector<array2<nFounders> >* intercrossingSingleLociHaplotypeProbabilities;
 	std::vector<array2<nFounders> >* funnelSingleLociHaplotypeProbabilities;
-	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, xMajorMatrix<expandedProbabilitiesType>& intercrossingHaplotypeProbabilities, rowMajorMatrix<expandedProbabilitiesType>& funnelHaplotypeProbabilities, int maxChromosomeSize)
-		: intermediate1(nFounders*nFounders, maxChromosomeSize), intermediate2(nFounders*nFounders, maxChromosomeSize), pathLengths1(nFounders*nFounders), pathLengths2(nFounders*nFounders), working(nFounders*nFounders), intercrossingHaplotypeProbabilities(intercrossingHaplotypeProbabilities), funnelHaplotypeProbabilities(funnelHaplotypeProbabilities), markerData(markerData)
+	//The working memory depends on the number of lines in a batch, so it's allocated as required
+	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, xMajorMatrix<logCompressedProbabilitiesType>& intercrossingHaplotypeProbabilities, rowMajorMatrix<logCompressedProbabilitiesType>& funnelHaplotypeProbabilities, int maxChromosomeSize)
+		: path(maxChromosomeSize), intercrossingHaplotypeProbabilities(intercrossingHaplotypeProbabilities), funnelHaplotypeProbabilities(funnelHaplotypeProbabilities), markerData(markerData)
 	{}
-	void apply(int start, int end)
+	//Impute the given lines, for the markers from start to end - 1. Different objects can be applied to different lines at the same time, as they only share data which is read. Consecutive lines of the same class are imputed as a batch. 
+	void apply(int start, int end, const int* lines, int nLines)
 	{
 		minSelfingGenerations = *std::min_element(selfingGenerations->begin(), selfingGenerations->end());
 		maxSelfingGenerations = *std::max_element(selfingGenerations->begin(), selfingGenerations->end());
 		minAIGenerations = *std::min_element(intercrossingGenerations->begin(), intercrossingGenerations->end());
 		maxAIGenerations = *std::max_element(intercrossingGenerations->begin(), intercrossingGenerations->end());
 		minAIGenerations = std::max(minAIGenerations, 1);
-		int nFinals = recodedFinals.nrow();
 
 		//If there's not meant to be any missing values, check that first
 		if(homozygoteMissingProb == 0 && heterozygoteMissingProb == 0)
 		{
-			for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 			{
 				for(int markerCounter = start; markerCounter < end; markerCounter++)
 				{
-					if(recodedFinals(finalCounter, markerCounter) == NA_INTEGER)
+					if(recodedFinals(lines[lineCounter], markerCounter) == NA_INTEGER)
 					{
 						throw std::runtime_error("Inputs heterozygoteMissingProb and homozygoteMissingProb imply that missing values are not allowed");
 					}
 				}
 			}
 		}
-		for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+		//If the data are impossible for several lines, report the smallest line, whatever order the lines are given in
+		int failedLine = -1, failedLineMarker = -1;
+		int batchStart = 0;
+		while(batchStart < nLines)
 		{
-			if((*intercrossingGenerations)[finalCounter] == 0)
+			int batchEnd = batchStart + 1;
+			while(batchEnd < nLines && sameClass(lines[batchStart], lines[batchEnd])) batchEnd++;
+			try
 			{
-				applyFunnel(start, end, finalCounter, (*lineFunnelIDs)[finalCounter], (*selfingGenerations)[finalCounter]);
+				applyBatch(start, end, lines + batchStart, batchEnd - batchStart);
 			}
-			else
+			catch(impossibleDataException& err)
 			{
-				applyIntercrossing(start, end, finalCounter, (*intercrossingGenerations)[finalCounter], (*selfingGenerations)[finalCounter]);
-			}
-			std::vector<double>::iterator longestPath = std::max_element(pathLengths1.begin(), pathLengths1.end());
-			int longestIndex = (int)std::distance(pathLengths1.begin(), longestPath);
-			for(int i = 0; i < end - start; i++)
-			{
-				results(finalCounter, i+start) = intermediate1(longestIndex, i);
+				if(failedLine == -1 || err.line < failedLine)
+				{
+					failedLine = err.line;
+					failedLineMarker = err.marker;
+				}
 			}
+			batchStart = batchEnd;
 		}
+		if(failedLine != -1) throw impossibleDataException(failedLineMarker, failedLine);
+	}
+	bool sameClass(int line1, int line2) const
+	{
+		int intercrossingGeneration = (*intercrossingGenerations)[line1];
+		if(intercrossingGeneration != (*intercrossingGenerations)[line2] || (*selfingGenerations)[line1] != (*selfingGenerations)[line2]) return false;
+		return intercrossingGeneration != 0 || (*lineFunnelIDs)[line1] == (*lineFunnelIDs)[line2];
+	}
+	//Is a pair of founders consistent with an observed marker value? Whether a missing value is possible depends on whether the founders have the same allele at foundersMarker. 
+	bool consistent(const ::markerData& currentMarkerData, int markerValue, int founder1, int founder2, int foundersMarker)
+	{
+		return currentMarkerData.hetData(founder1, founder2) == markerValue || (markerValue == NA_INTEGER && ((recodedFounders(founder2, foundersMarker) == recodedFounders(founder1, foundersMarker) && homozygoteMissingProb != 0) || (recodedFounders(founder2, foundersMarker) != recodedFounders(founder1, foundersMarker) && heterozygoteMissingProb != 0)));
 	}
-	void applyFunnel(int start, int end, int finalCounter, int funnelID, int selfingGenerations)
+	void applyBatch(int start, int end, const int* lines, int nLines)
 	{
+		const double negativeInfinity = -std::numeric_limits<double>::infinity();
 		double logHomozygoteMissingProb = log(homozygoteMissingProb);
 		double logHetrozygoteMissingProb = log(heterozygoteMissingProb);
-		//Initialise the algorithm
-		funnelEncoding enc = (*lineFunnelEncodings)[(*lineFunnelIDs)[finalCounter]];
+		const int intercrossingGeneration = (*intercrossingGenerations)[lines[0]];
+		const int selfingGeneration = (*selfingGenerations)[lines[0]];
 		int funnel[16];
-		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+		if(intercrossingGeneration == 0)
+		{
+			const funnelEncoding& enc = (*lineFunnelEncodings)[(*lineFunnelIDs)[lines[0]]];
+			for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+			{
+				funnel[founderCounter] = enc[founderCounter];
+			}
+		}
+		else
 		{
-			funnel[founderCounter] = ((enc & (15 << (4*founderCounter))) >> (4*founderCounter));
+			for(int founderCounter = 0; founderCounter < nFounders; founderCounter++) funnel[founderCounter] = founderCounter;
 		}
-		int startMarkerValue = recodedFinals(finalCounter, start);
-		::markerData& startMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[start]];
-		
-		//Some values are never touched, so just mark those as negative infinity
-		std::fill(pathLengths1.begin(), pathLengths1.end(), -std::numeric_limits<double>::infinity());
-		std::fill(pathLengths2.begin(), pathLengths2.end(), -std::numeric_limits<double>::infinity());
+		const std::vector<array2<nFounders> >& singleLociHaplotypeProbabilities = intercrossingGeneration == 0 ? *funnelSingleLociHaplotypeProbabilities : *intercrossingSingleLociHaplotypeProbabilities;
+		//The positions in the funnel of the founders for each encoding
+		int encodingFounder1[nEncodings], encodingFounder2[nEncodings];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			for(int founderCounter2 = 0; founderCounter2 < nFounders; founderCounter2++)
+			for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
 			{
-				int markerEncodingTheseFounders = startMarkerData.hetData(funnel[founderCounter], funnel[founderCounter2]);
 				int encodingTheseFounders = key(funnel[founderCounter], funnel[founderCounter2]);
-				intermediate1(encodingTheseFounders, 0) = encodingTheseFounders;
-				if(markerEncodingTheseFounders == startMarkerValue || (startMarkerValue == NA_INTEGER && ((recodedFounders(funnel[founderCounter2], start) == recodedFounders(funnel[founderCounter], start) && homozygoteMissingProb != 0) || (recodedFounders(funnel[founderCounter2], start) != recodedFounders(funnel[founderCounter], start) && heterozygoteMissingProb != 0))))
-				{
-					pathLengths2[encodingTheseFounders] = pathLengths1[encodingTheseFounders] = (*funnelSingleLociHaplotypeProbabilities)[selfingGenerations - minSelfingGenerations].values[founderCounter][founderCounter2];
-				}
-				else
+				encodingFounder1[encodingTheseFounders] = founderCounter;
+				encodingFounder2[encodingTheseFounders] = founderCounter2;
+			}
+		}
+		transitionMultiples.resize(nEncodings * nEncodings);
+		transitionMaskIndices.resize(nEncodings * nEncodings);
+		for(int encoding = 1; encoding < nEncodings; encoding++)
+		{
+			int founderCounter = encodingFounder1[encoding], founderCounter2 = encodingFounder2[encoding];
+			const int* maskRow = probabilityData<nFounders>::intermediateProbabilitiesMask[probabilityData<nFounders>::intermediateAllelesMask[founderCounter][founderCounter2]];
+			for(int previousEncoding = 1; previousEncoding < nEncodings; previousEncoding++)
+			{
+				int founderPreviousCounter = encodingFounder1[previousEncoding], founderPreviousCounter2 = encodingFounder2[previousEncoding];
+				double multiple = 0;
+				if(founderCounter != founderCounter2) multiple += log(2);
+				if(founderPreviousCounter != founderPreviousCounter2) multiple += log(2);
+				transitionMultiples[encoding * nEncodings + previousEncoding] = multiple;
+				transitionMaskIndices[encoding * nEncodings + previousEncoding] = maskRow[probabilityData<nFounders>::intermediateAllelesMask[founderPreviousCounter][founderPreviousCounter2]];
+			}
+		}
+
+		const int nMarkers = end - start;
+		const std::size_t batchSize = (std::size_t)nEncodings * nLines;
+		pathLengths1.assign(batchSize, negativeInfinity);
+		pathLengths2.assign(batchSize, negativeInfinity);
+		maskedPathLengths.resize(batchSize);
+		currentConsistent.resize(batchSize);
+		homozygotePenalty.resize(nLines);
+		bestPreviousWorking.resize(nLines);
+		heterozygotePenalty.resize(nLines);
+		//Encoding zero is never the best previous state, unless every state is impossible
+		bestPrevious.assign(batchSize * nMarkers, 0);
+		failedMarker.assign(nLines, -1);
+
+		//Initialise the algorithm
+		::markerData& startMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[start]];
+		for(int encoding = 1; encoding < nEncodings; encoding++)
+		{
+			int founderCounter = encodingFounder1[encoding], founderCounter2 = encodingFounder2[encoding];
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+			{
+				if(consistent(startMarkerData, recodedFinals(lines[lineCounter], start), funnel[founderCounter], funnel[founderCounter2], start))
 				{
-					pathLengths2[encodingTheseFounders] = pathLengths1[encodingTheseFounders] = -std::numeric_limits<double>::infinity();
+					pathLengths1[encoding * nLines + lineCounter] = singleLociHaplotypeProbabilities[selfingGeneration - minSelfingGenerations].values[founderCounter][founderCounter2];
 				}
 			}
 		}
-		int identicalIndex = 0;
 		for(int markerCounter = start; markerCounter < end - 1; markerCounter++)
 		{
-			int previousMarkerValue = recodedFinals(finalCounter, markerCounter);
-			int markerValue = recodedFinals(finalCounter, markerCounter+1);
 			::markerData& previousMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[markerCounter]];
 			::markerData& currentMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[markerCounter + 1]];
-			//The founder at the next marker
-			for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+			//The compressed log probabilities for this interval
+			const logCompressedProbabilitiesType& logProbabilities = intercrossingGeneration == 0 ? funnelHaplotypeProbabilities(markerCounter-start, selfingGeneration - minSelfingGenerations) : intercrossingHaplotypeProbabilities(markerCounter-start, intercrossingGeneration - minAIGenerations, selfingGeneration - minSelfingGenerations);
+			//Emissions for every line
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 			{
-				for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
+				int previousMarkerValue = recodedFinals(lines[lineCounter], markerCounter);
+				int markerValue = recodedFinals(lines[lineCounter], markerCounter+1);
+				for(int encoding = 1; encoding < nEncodings; encoding++)
 				{
-					int encodingMarker = currentMarkerData.hetData(funnel[founderCounter], funnel[founderCounter2]);
-					int encodingTheseFounders = key(funnel[founderCounter], funnel[founderCounter2]);
-					if(encodingMarker == markerValue || (markerValue == NA_INTEGER && ((recodedFounders(funnel[founderCounter2], markerCounter) == recodedFounders(funnel[founderCounter], markerCounter) && homozygoteMissingProb != 0) || (recodedFounders(funnel[founderCounter2], markerCounter) != recodedFounders(funnel[founderCounter], markerCounter) && heterozygoteMissingProb != 0))))
-					{
-						//Founder at the previous marker. 
-						std::fill(working.begin(), working.end(), -std::numeric_limits<double>::infinity());
-						for(int founderPreviousCounter = 0; founderPreviousCounter < nFounders; founderPreviousCounter++)
-						{
-							for(int founderPreviousCounter2 = 0; founderPreviousCounter2 <= founderPreviousCounter; founderPreviousCounter2++)
-							{
-								int encodingPreviousMarker = previousMarkerData.hetData(funnel[founderPreviousCounter], funnel[founderPreviousCounter2]);
-								int encodingPreviousTheseFounders = key(funnel[founderPreviousCounter], funnel[founderPreviousCounter2]);
-								if(encodingPreviousMarker == previousMarkerValue || (previousMarkerValue == NA_INTEGER && ((recodedFounders(funnel[founderPreviousCounter2], markerCounter) == recodedFounders(funnel[founderPreviousCounter], markerCounter) && homozygoteMissingProb != 0) || (recodedFounders(funnel[founderPreviousCounter2], markerCounter) != recodedFounders(funnel[founderPreviousCounter], markerCounter) && heterozygoteMissingProb != 0))))
-								{
-									double multiple = 0;
-									if(founderCounter != founderCounter2) multiple += log(2);
-									if(founderPreviousCounter != founderPreviousCounter2) multiple += log(2);
-									working[encodingPreviousTheseFounders] = pathLengths1[encodingPreviousTheseFounders] + multiple + funnelHaplotypeProbabilities(markerCounter-start, selfingGenerations - minSelfingGenerations).values[founderCounter][founderCounter2][founderPreviousCounter][founderPreviousCounter2];
-									if(markerValue == NA_INTEGER)
-									{
-										if(founderCounter2 == founderCounter)
-										{
-											working[encodingPreviousTheseFounders] += logHomozygoteMissingProb;
-										}
-										else
-										{
-											working[encodingPreviousTheseFounders] += logHetrozygoteMissingProb;
-										}
-									}
-								}
-							}
-						}
-						//Get the shortest one, and check that it's not negative infinity.
-						std::vector<double>::iterator longest = std::max_element(working.begin(), working.end());
-						//This error is no longer valid, because some states are impossible to ever be in - E.g. heterozygote {1,2} with funnel {1,2,3,4} and no intercrossing. In this case all the probabilities are zero and all the log probabilities are -inf. So *longest == -std::numeric_limits<double>::infinity() doesn't indicate that there is no valid next state. It indicates that the state for the previous marker is impossible. 
-						//if(*longest == -std::numeric_limits<double>::infinity()) throw std::runtime_error("Internal error");
-						int bestPrevious = (int)std::distance(working.begin(), longest);
-						
-						memcpy(&(intermediate2(encodingTheseFounders, identicalIndex)), &(intermediate1(bestPrevious, identicalIndex)), sizeof(int)*(markerCounter - start + 1 - identicalIndex));
-						intermediate2(encodingTheseFounders, markerCounter-start+1) = encodingTheseFounders;
-						pathLengths2[encodingTheseFounders] = *longest;
-					}
-					else
+					int founder1 = funnel[encodingFounder1[encoding]], founder2 = funnel[encodingFounder2[encoding]];
+					std::size_t index = encoding * nLines + lineCounter;
+					maskedPathLengths[index] = consistent(previousMarkerData, previousMarkerValue, founder1, founder2, markerCounter) ? pathLengths1[index] : negativeInfinity;
+					currentConsistent[index] = consistent(currentMarkerData, markerValue, founder1, founder2, markerCounter);
+				}
+				homozygotePenalty[lineCounter] = markerValue == NA_INTEGER ? logHomozygoteMissingProb : 0;
+				heterozygotePenalty[lineCounter] = markerValue == NA_INTEGER ? logHetrozygoteMissingProb : 0;
+			}
+			//The founders at the next marker
+			for(int encoding = 1; encoding < nEncodings; encoding++)
+			{
+				double* longest = &(pathLengths2[encoding * nLines]);
+				double* bestPreviousThisEncoding = &(bestPreviousWorking[0]);
+				const double* penalty = encodingFounder1[encoding] == encodingFounder2[encoding] ? &(homozygotePenalty[0]) : &(heterozygotePenalty[0]);
+				std::fill(longest, longest + nLines, negativeInfinity);
+				std::fill(bestPreviousThisEncoding, bestPreviousThisEncoding + nLines, 0.0);
+				//Founders at the previous marker, in order of encoding, so that ties go to the lowest encoding
+				for(int previousEncoding = 1; previousEncoding < nEncodings; previousEncoding++)
+				{
+					const double multiple = transitionMultiples[encoding * nEncodings + previousEncoding];
+					const double logProbability = logProbabilities[transitionMaskIndices[encoding * nEncodings + previousEncoding]];
+					const double* previous = &(maskedPathLengths[previousEncoding * nLines]);
+					const double previousEncodingValue = previousEncoding;
+					//Written without branches, as the comparisons are unpredictable
+					for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 					{
-						pathLengths2[encodingTheseFounders] = -std::numeric_limits<double>::infinity();
+						double candidate = previous[lineCounter] + multiple + logProbability + penalty[lineCounter];
+						bool better = candidate > longest[lineCounter];
+						longest[lineCounter] = better ? candidate : longest[lineCounter];
+						bestPreviousThisEncoding[lineCounter] = better ? previousEncodingValue : bestPreviousThisEncoding[lineCounter];
 					}
 				}
+				const char* consistentThisEncoding = &(currentConsistent[encoding * nLines]);
+				unsigned char* bestPreviousStored = &(bestPrevious[((std::size_t)(markerCounter - start + 1) * nEncodings + encoding) * nLines]);
+				for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+				{
+					if(!consistentThisEncoding[lineCounter]) longest[lineCounter] = negativeInfinity;
+					bestPreviousStored[lineCounter] = (unsigned char)bestPreviousThisEncoding[lineCounter];
+				}
+			}
+			//If this condition holds, it's almost guaranteed to be because the map contains two markers at the same location, but the data implies a non-zero distance because recombinations are observed to occur between them. 
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+			{
+				if(failedMarker[lineCounter] != -1) continue;
+				bool possible = false;
+				for(int encoding = 1; encoding < nEncodings && !possible; encoding++) possible = pathLengths2[encoding * nLines + lineCounter] != negativeInfinity;
+				if(!possible) failedMarker[lineCounter] = markerCounter;
 			}
-			//If this condition throws, it's almost guaranteed to be because the map contains two markers at the same location, but the data implies a non-zero distance because recombinations are observed to occur between them. 
-			std::vector<double>::iterator longest = std::max_element(pathLengths2.begin(), pathLengths2.end());
-			if(*longest == -std::numeric_limits<double>::infinity()) throw impossibleDataException(markerCounter, finalCounter);
-
-			intermediate1.swap(intermediate2);
 			pathLengths1.swap(pathLengths2);
-			while(identicalIndex != markerCounter-start + 1)
+		}
+		//Report the smallest line in the batch with impossible data, which is the line that would have been reported if the lines were imputed one at a time
+		int failedLineCounter = -1;
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+		{
+			if(failedMarker[lineCounter] != -1 && (failedLineCounter == -1 || lines[lineCounter] < lines[failedLineCounter])) failedLineCounter = lineCounter;
+		}
+		if(failedLineCounter != -1) throw impossibleDataException(failedMarker[failedLineCounter], lines[failedLineCounter]);
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+		{
+			int longestIndex = 0;
+			double longest = negativeInfinity;
+			for(int encoding = 1; encoding < nEncodings; encoding++)
 			{
-				int value = intermediate1(key(funnel[0], funnel[0]), identicalIndex);
-				for(int founderCounter = 1; founderCounter < nFounders; founderCounter++)
+				if(pathLengths1[encoding * nLines + lineCounter] > longest)
 				{
-					for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
-					{
-						int encodingTheseFounders = key(funnel[founderCounter], funnel[founderCounter2]);
-						if(value != intermediate1(encodingTheseFounders, identicalIndex)) goto stopIdenticalSearch;
-					}
+					longest = pathLengths1[encoding * nLines + lineCounter];
+					longestIndex = encoding;
 				}
-				//We don't care about the correct indexing here. Put the correct value in every row. 
-				for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+			}
+			path[nMarkers - 1] = longestIndex;
+			for(int markerCounter = nMarkers - 1; markerCounter > 0; markerCounter--)
+			{
+				path[markerCounter - 1] = bestPrevious[((std::size_t)markerCounter * nEncodings + path[markerCounter]) * nLines + lineCounter];
+			}
+			for(int i = 0; i < nMarkers; i++)
+			{
+				results(lines[lineCounter], i+start) = path[i];
+			}
+		}
+	}
+};
+/*
+ * The Viterbi algorithm for other numbers of founders than 2, 4, 8 and 16, where nFounders is 0 and the actual number of founders is only known at run time. This follows the general case, with the compressed probabilities and the mask taken from genericFunnelProbabilities in place of the closed forms and probabilityData. There's no intercrossing for these designs, so lines are only batched by funnel and generations of selfing.
+ */
+template<> struct viterbiAlgorithm<0, false>
+{
+	Rcpp::List recodedHetData;
+	Rcpp::IntegerMatrix recodedFounders, recodedFinals;
+	Rcpp::IntegerMatrix results;
+	const int nFounders, nEncodings;
+	//See the general case. There can be more than 256 encodings, so the best previous states are stored as unsigned short.
+	std::vector<double> pathLengths1, pathLengths2, maskedPathLengths;
+	std::vector<unsigned short> bestPrevious;
+	std::vector<double> bestPreviousWorking;
+	std::vector<char> currentConsistent;
+	std::vector<double> homozygotePenalty, heterozygotePenalty;
+	//The positions in the funnel of the founders for each encoding, and log(2) for the encodings of heterozygotes.
+	std::vector<int> encodingFounder1, encodingFounder2;
+	std::vector<double> encodingMultiples;
+	//The class of the transition, with index current encoding * nEncodings + previous encoding
+	std::vector<int> transitionMaskIndices;
+	std::vector<int> path;
+	std::vector<int> failedMarker;
+	//The compressed log probabilities, with index (class, marker interval, selfing generations - minimum selfing generations)
+	xMajorMatrix<double>& funnelHaplotypeProbabilities;
+	//The class of alleles a1, a2 at the first locus and b1, b2 at the second, see genericFunnelProbabilities::getFiniteMask
+	const std::vector<int>& finiteMask;
+	markerPatternsToUniqueValuesArgs& markerData;
+	std::vector<funnelID>* lineFunnelIDs;
+	std::vector<funnelEncoding>* lineFunnelEncodings;
+	std::vector<int>* selfingGenerations;
+	int minSelfingGenerations;
+	Rcpp::IntegerMatrix key;
+	double heterozygoteMissingProb, homozygoteMissingProb;
+	//The single locus log probabilities, with index (selfing generations - minimum selfing generations, founder1 * nFounders + founder2)
+	rowMajorMatrix<double>* funnelSingleLociHaplotypeProbabilities;
+	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, const std::vector<int>& finiteMask, xMajorMatrix<double>& funnelHaplotypeProbabilities, int maxChromosomeSize)
+		: nFounders(markerData.nFounders), nEncodings(markerData.nFounders*(markerData.nFounders+1)/2 + 1), encodingFounder1(nEncodings), encodingFounder2(nEncodings), encodingMultiples(nEncodings), path(maxChromosomeSize), funnelHaplotypeProbabilities(funnelHaplotypeProbabilities), finiteMask(finiteMask), markerData(markerData)
+	{}
+	void apply(int start, int end, const int* lines, int nLines)
+	{
+		minSelfingGenerations = *std::min_element(selfingGenerations->begin(), selfingGenerations->end());
+		if(homozygoteMissingProb == 0 && heterozygoteMissingProb == 0)
+		{
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+			{
+				for(int markerCounter = start; markerCounter < end; markerCounter++)
 				{
-					for(int founderCounter2 = 0; founderCounter2 < nFounders; founderCounter2++)
+					if(recodedFinals(lines[lineCounter], markerCounter) == NA_INTEGER)
 					{
-						intermediate2(founderCounter*nFounders + founderCounter2, identicalIndex) = value;
+						throw std::runtime_error("Inputs heterozygoteMissingProb and homozygoteMissingProb imply that missing values are not allowed");
 					}
 				}
-				identicalIndex++;
 			}
-stopIdenticalSearch:
-			;
 		}
+		int failedLine = -1, failedLineMarker = -1;
+		int batchStart = 0;
+		while(batchStart < nLines)
+		{
+			int batchEnd = batchStart + 1;
+			while(batchEnd < nLines && sameClass(lines[batchStart], lines[batchEnd])) batchEnd++;
+			try
+			{
+				applyBatch(start, end, lines + batchStart, batchEnd - batchStart);
+			}
+			catch(impossibleDataException& err)
+			{
+				if(failedLine == -1 || err.line < failedLine)
+				{
+					failedLine = err.line;
+					failedLineMarker = err.marker;
+				}
+			}
+			batchStart = batchEnd;
+		}
+		if(failedLine != -1) throw impossibleDataException(failedLineMarker, failedLine);
+	}
+	bool sameClass(int line1, int line2) const
+	{
+		return (*selfingGenerations)[line1] == (*selfingGenerations)[line2] && (*lineFunnelIDs)[line1] == (*lineFunnelIDs)[line2];
+	}
+	bool consistent(const ::markerData& currentMarkerData, int markerValue, int founder1, int founder2, int foundersMarker)
+	{
+		return currentMarkerData.hetData(founder1, founder2) == markerValue || (markerValue == NA_INTEGER && ((recodedFounders(founder2, foundersMarker) == recodedFounders(founder1, foundersMarker) && homozygoteMissingProb != 0) || (recodedFounders(founder2, foundersMarker) != recodedFounders(founder1, foundersMarker) && heterozygoteMissingProb != 0)));
 	}
-	void applyIntercrossing(int start, int end, int finalCounter, int intercrossingGeneration, int selfingGenerations)
+	void applyBatch(int start, int end, const int* lines, int nLines)
 	{
+		const double negativeInfinity = -std::numeric_limits<double>::infinity();
 		double logHomozygoteMissingProb = log(homozygoteMissingProb);
 		double logHetrozygoteMissingProb = log(heterozygoteMissingProb);
-		//Initialise the algorithm
-		int startMarkerValue = recodedFinals(finalCounter, start);
-		::markerData& startMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[start]];
-		
-		//Some values are never touched, so just mark those as negative infinity
-		std::fill(pathLengths1.begin(), pathLengths1.end(), -std::numeric_limits<double>::infinity());
-		std::fill(pathLengths2.begin(), pathLengths2.end(), -std::numeric_limits<double>::infinity());
+		const int selfingGeneration = (*selfingGenerations)[lines[0]];
+		const funnelEncoding& funnel = (*lineFunnelEncodings)[(*lineFunnelIDs)[lines[0]]];
+		const double* singleLociHaplotypeProbabilities = &((*funnelSingleLociHaplotypeProbabilities)(selfingGeneration - minSelfingGenerations, 0));
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			for(int founderCounter2 = 0; founderCounter2 < nFounders; founderCounter2++)
+			for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
 			{
-				int markerEncodingTheseFounders = startMarkerData.hetData(founderCounter, founderCounter2);
-				int encodingTheseFounders = key(founderCounter, founderCounter2);
-				intermediate1(encodingTheseFounders, 0) = encodingTheseFounders;
-				if(markerEncodingTheseFounders == startMarkerValue || (startMarkerValue == NA_INTEGER && ((recodedFounders(founderCounter2, start) == recodedFounders(founderCounter, start) && homozygoteMissingProb != 0) || (recodedFounders(founderCounter2, start) != recodedFounders(founderCounter, start) && heterozygoteMissingProb != 0))))
-				{
-					pathLengths2[encodingTheseFounders] = pathLengths1[encodingTheseFounders] = (*intercrossingSingleLociHaplotypeProbabilities)[selfingGenerations - minSelfingGenerations].values[founderCounter][founderCounter2];
-				}
-				else
+				int encodingTheseFounders = key(funnel[founderCounter], funnel[founderCounter2]);
+				encodingFounder1[encodingTheseFounders] = founderCounter;
+				encodingFounder2[encodingTheseFounders] = founderCounter2;
+				encodingMultiples[encodingTheseFounders] = founderCounter == founderCounter2 ? 0 : log(2);
+			}
+		}
+		transitionMaskIndices.resize((std::size_t)nEncodings * nEncodings);
+		const int nFoundersSquared = nFounders * nFounders;
+		for(int encoding = 1; encoding < nEncodings; encoding++)
+		{
+			const int* maskRow = &(finiteMask[(std::size_t)(encodingFounder1[encoding] * nFounders + encodingFounder2[encoding]) * nFoundersSquared]);
+			for(int previousEncoding = 1; previousEncoding < nEncodings; previousEncoding++)
+			{
+				transitionMaskIndices[(std::size_t)encoding * nEncodings + previousEncoding] = maskRow[encodingFounder1[previousEncoding] * nFounders + encodingFounder2[previousEncoding]];
+			}
+		}
+
+		const int nMarkers = end - start;
+		const std::size_t batchSize = (std::size_t)nEncodings * nLines;
+		pathLengths1.assign(batchSize, negativeInfinity);
+		pathLengths2.assign(batchSize, negativeInfinity);
+		maskedPathLengths.resize(batchSize);
+		currentConsistent.resize(batchSize);
+		homozygotePenalty.resize(nLines);
+		bestPreviousWorking.resize(nLines);
+		heterozygotePenalty.resize(nLines);
+		bestPrevious.assign(batchSize * nMarkers, 0);
+		failedMarker.assign(nLines, -1);
+
+		::markerData& startMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[start]];
+		for(int encoding = 1; encoding < nEncodings; encoding++)
+		{
+			int founderCounter = encodingFounder1[encoding], founderCounter2 = encodingFounder2[encoding];
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+			{
+				if(consistent(startMarkerData, recodedFinals(lines[lineCounter], start), funnel[founderCounter], funnel[founderCounter2], start))
 				{
-					pathLengths2[encodingTheseFounders] = pathLengths1[encodingTheseFounders] = -std::numeric_limits<double>::infinity();
+					pathLengths1[encoding * nLines + lineCounter] = singleLociHaplotypeProbabilities[founderCounter * nFounders + founderCounter2];
 				}
 			}
 		}
-		int identicalIndex = 0;
 		for(int markerCounter = start; markerCounter < end - 1; markerCounter++)
 		{
-			int previousMarkerValue = recodedFinals(finalCounter, markerCounter);
-			int markerValue = recodedFinals(finalCounter, markerCounter+1);
 			::markerData& previousMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[markerCounter]];
 			::markerData& currentMarkerData = markerData.allMarkerPatterns[markerData.markerPatternIDs[markerCounter + 1]];
-			//The founder at the next marker
-			for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+			const double* logProbabilities = &(funnelHaplotypeProbabilities(0, markerCounter - start, selfingGeneration - minSelfingGenerations));
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 			{
-				for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
+				int previousMarkerValue = recodedFinals(lines[lineCounter], markerCounter);
+				int markerValue = recodedFinals(lines[lineCounter], markerCounter+1);
+				for(int encoding = 1; encoding < nEncodings; encoding++)
 				{
-					int encodingMarker = currentMarkerData.hetData(founderCounter, founderCounter2);
-					int encodingTheseFounders = key(founderCounter, founderCounter2);
-					if(encodingMarker == markerValue || (markerValue == NA_INTEGER && ((recodedFounders(founderCounter2, markerCounter) == recodedFounders(founderCounter, markerCounter) && homozygoteMissingProb != 0) || (recodedFounders(founderCounter2, markerCounter) != recodedFounders(founderCounter, markerCounter) && heterozygoteMissingProb != 0))))
-					{
-						//Founder at the previous marker. 
-						std::fill(working.begin(), working.end(), -std::numeric_limits<double>::infinity());
-						for(int founderPreviousCounter = 0; founderPreviousCounter < nFounders; founderPreviousCounter++)
-						{
-							for(int founderPreviousCounter2 = 0; founderPreviousCounter2 <= founderPreviousCounter; founderPreviousCounter2++)
-							{
-								int encodingPreviousMarker = previousMarkerData.hetData(founderPreviousCounter, founderPreviousCounter2);
-								int encodingPreviousTheseFounders = key(founderPreviousCounter, founderPreviousCounter2);
-								if(encodingPreviousMarker == previousMarkerValue || (previousMarkerValue == NA_INTEGER && ((recodedFounders(founderPreviousCounter2, markerCounter) == recodedFounders(founderPreviousCounter, markerCounter) && homozygoteMissingProb != 0) || (recodedFounders(founderPreviousCounter2, markerCounter) != recodedFounders(founderPreviousCounter, markerCounter) && heterozygoteMissingProb != 0))))
-								{
-									double multiple = 0;
-									if(founderCounter != founderCounter2) multiple += log(2);
-									if(founderPreviousCounter != founderPreviousCounter2) multiple += log(2);
-									working[encodingPreviousTheseFounders] = pathLengths1[encodingPreviousTheseFounders] + multiple + intercrossingHaplotypeProbabilities(markerCounter-start, intercrossingGeneration - minAIGenerations, selfingGenerations - minSelfingGenerations).values[founderCounter][founderCounter2][founderPreviousCounter][founderPreviousCounter2];
-									if(markerValue == NA_INTEGER)
-									{
-										if(founderCounter2 == founderCounter)
-										{
-											working[encodingPreviousTheseFounders] += logHomozygoteMissingProb;
-										}
-										else
-										{
-											working[encodingPreviousTheseFounders] += logHetrozygoteMissingProb;
-										}
-									}
-								}
-							}
-						}
-						//Get the shortest one, and check that it's not negative infinity.
-						std::vector<double>::iterator longest = std::max_element(working.begin(), working.end());
-						int bestPrevious = (int)std::distance(working.begin(), longest);
-						
-						memcpy(&(intermediate2(encodingTheseFounders, identicalIndex)), &(intermediate1(bestPrevious, identicalIndex)), sizeof(int)*(markerCounter - start + 1 - identicalIndex));
-						intermediate2(encodingTheseFounders, markerCounter-start+1) = encodingTheseFounders;
-						pathLengths2[encodingTheseFounders] = *longest;
-					}
-					else
-					{
-						pathLengths2[encodingTheseFounders] = -std::numeric_limits<double>::infinity();
-					}
+					int founder1 = funnel[encodingFounder1[encoding]], founder2 = funnel[encodingFounder2[encoding]];
+					std::size_t index = encoding * nLines + lineCounter;
+					maskedPathLengths[index] = consistent(previousMarkerData, previousMarkerValue, founder1, founder2, markerCounter) ? pathLengths1[index] : negativeInfinity;
+					currentConsistent[index] = consistent(currentMarkerData, markerValue, founder1, founder2, markerCounter);
 				}
+				homozygotePenalty[lineCounter] = markerValue == NA_INTEGER ? logHomozygoteMissingProb : 0;
+				heterozygotePenalty[lineCounter] = markerValue == NA_INTEGER ? logHetrozygoteMissingProb : 0;
 			}
-			//If this condition throws, it's almost guaranteed to be because the map contains two markers at the same location, but the data implies a non-zero distance because recombinations are observed to occur between them.
-			std::vector<double>::iterator longest = std::max_element(pathLengths2.begin(), pathLengths2.end());
-			if(*longest == -std::numeric_limits<double>::infinity()) throw impossibleDataException(markerCounter, finalCounter);
-
-			intermediate1.swap(intermediate2);
-			pathLengths1.swap(pathLengths2);
-			while(identicalIndex != markerCounter-start + 1)
+			for(int encoding = 1; encoding < nEncodings; encoding++)
 			{
-				int value = intermediate1(key(0,0), identicalIndex);
-				for(int founderCounter = 1; founderCounter < nFounders; founderCounter++)
+				double* longest = &(pathLengths2[encoding * nLines]);
+				double* bestPreviousThisEncoding = &(bestPreviousWorking[0]);
+				const double* penalty = encodingFounder1[encoding] == encodingFounder2[encoding] ? &(homozygotePenalty[0]) : &(heterozygotePenalty[0]);
+				std::fill(longest, longest + nLines, negativeInfinity);
+				std::fill(bestPreviousThisEncoding, bestPreviousThisEncoding + nLines, 0.0);
+				for(int previousEncoding = 1; previousEncoding < nEncodings; previousEncoding++)
 				{
-					for(int founderCounter2 = 0; founderCounter2 <= founderCounter; founderCounter2++)
+					const double multiple = encodingMultiples[encoding] + encodingMultiples[previousEncoding];
+					const double logProbability = logProbabilities[transitionMaskIndices[(std::size_t)encoding * nEncodings + previousEncoding]];
+					const double* previous = &(maskedPathLengths[previousEncoding * nLines]);
+					const double previousEncodingValue = previousEncoding;
+					for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 					{
-						int encodingTheseFounders = key(founderCounter, founderCounter2);
-						if(value != intermediate1(encodingTheseFounders, identicalIndex)) goto stopIdenticalSearch;
+						double candidate = previous[lineCounter] + multiple + logProbability + penalty[lineCounter];
+						bool better = candidate > longest[lineCounter];
+						longest[lineCounter] = better ? candidate : longest[lineCounter];
+						bestPreviousThisEncoding[lineCounter] = better ? previousEncodingValue : bestPreviousThisEncoding[lineCounter];
 					}
 				}
-				//We don't care about the correct indexing here. Put the correct value in every row. 
-				for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+				const char* consistentThisEncoding = &(currentConsistent[encoding * nLines]);
+				unsigned short* bestPreviousStored = &(bestPrevious[((std::size_t)(markerCounter - start + 1) * nEncodings + encoding) * nLines]);
+				for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 				{
-					for(int founderCounter2 = 0; founderCounter2 < nFounders; founderCounter2++)
-					{
-						intermediate2(founderCounter*nFounders + founderCounter2, identicalIndex) = value;
-					}
+					if(!consistentThisEncoding[lineCounter]) longest[lineCounter] = negativeInfinity;
+					bestPreviousStored[lineCounter] = (unsigned short)bestPreviousThisEncoding[lineCounter];
 				}
-				identicalIndex++;
 			}
-stopIdenticalSearch:
-			;
+			for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+			{
+				if(failedMarker[lineCounter] != -1) continue;
+				bool possible = false;
+				for(int encoding = 1; encoding < nEncodings && !possible; encoding++) possible = pathLengths2[encoding * nLines + lineCounter] != negativeInfinity;
+				if(!possible) failedMarker[lineCounter] = markerCounter;
+			}
+			pathLengths1.swap(pathLengths2);
+		}
+		int failedLineCounter = -1;
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+		{
+			if(failedMarker[lineCounter] != -1 && (failedLineCounter == -1 || lines[lineCounter] < lines[failedLineCounter])) failedLineCounter = lineCounter;
+		}
+		if(failedLineCounter != -1) throw impossibleDataException(failedMarker[failedLineCounter], lines[failedLineCounter]);
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+		{
+			int longestIndex = 0;
+			double longest = negativeInfinity;
+			for(int encoding = 1; encoding < nEncodings; encoding++)
+			{
+				if(pathLengths1[encoding * nLines + lineCounter] > longest)
+				{
+					longest = pathLengths1[encoding * nLines + lineCounter];
+					longestIndex = encoding;
+				}
+			}
+			path[nMarkers - 1] = longestIndex;
+			for(int markerCounter = nMarkers - 1; markerCounter > 0; markerCounter--)
+			{
+				path[markerCounter - 1] = bestPrevious[((std::size_t)markerCounter * nEncodings + path[markerCounter]) * nLines + lineCounter];
+			}
+			for(int i = 0; i < nMarkers; i++)
+			{
+				results(lines[lineCounter], i+start) = path[i];
+			}
 		}
 	}
 };
@@ -16,15 +16,15 @@
 #include <limits>
 template<int nFounders> struct viterbiAlgorithm<nFounders, true>
 {
-	typedef typename expandedProbabilities<nFounders, true>::type expandedProbabilitiesType;
+	typedef typename logCompressedGenotypeProbabilities<nFounders, true>::type logCompressedProbabilitiesType;
 	Rcpp::List recodedHetData;
 	Rcpp::IntegerMatrix recodedFounders, recodedFinals;
 	rowMajorMatrix<int> intermediate1, intermediate2;
 	Rcpp::IntegerMatrix results;
 	std::vector<double> pathLengths1, pathLengths2;
 	std::vector<double> working;
-	xMajorMatrix<expandedProbabilitiesType>& intercrossingHaplotypeProbabilities;
-	rowMajorMatrix<expandedProbabilitiesType>& funnelHaplotypeProbabilities;
+	xMajorMatrix<logCompressedProbabilitiesType>& intercrossingHaplotypeProbabilities;
+	rowMajorMatrix<logCompressedProbabilitiesType>& funnelHaplotypeProbabilities;
 	markerPatternsToUniqueValuesArgs& markerData;
 	std::vector<funnelID>* lineFunnelIDs;
 	std::vector<funnelEncoding>* lineFunnelEncodings;
@@ -37,19 +37,20 @@ template<int nFounders> struct viterbiAlgorithm<nFounders, true>
 	Rcpp::IntegerMatrix key;
 	std::vector<array2<nFounders> >* intercrossingSingleLociHaplotypeProbabilities;
 	std::vector<array2<nFounders> >* funnelSingleLociHaplotypeProbabilities;
-	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, xMajorMatrix<expandedProbabilitiesType>& intercrossingHaplotypeProbabilities, rowMajorMatrix<expandedProbabilitiesType>& funnelHaplotypeProbabilities, int maxChromosomeSize)
+	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, xMajorMatrix<logCompressedProbabilitiesType>& intercrossingHaplotypeProbabilities, rowMajorMatrix<logCompressedProbabilitiesType>& funnelHaplotypeProbabilities, int maxChromosomeSize)
 		: intermediate1(nFounders, maxChromosomeSize), intermediate2(nFounders, maxChromosomeSize), pathLengths1(nFounders), pathLengths2(nFounders), working(nFounders), intercrossingHaplotypeProbabilities(intercrossingHaplotypeProbabilities), funnelHaplotypeProbabilities(funnelHaplotypeProbabilities), markerData(markerData)
 	{}
-	void apply(int start, int end)
+	//Impute the given lines, for the markers from start to end - 1. Different objects can be applied to different lines at the same time, as they only share data which is read. 
+	void apply(int start, int end, const int* lines, int nLines)
 	{
 		minSelfingGenerations = *std::min_element(selfingGenerations->begin(), selfingGenerations->end());
 		maxSelfingGenerations = *std::max_element(selfingGenerations->begin(), selfingGenerations->end());
 		minAIGenerations = *std::min_element(intercrossingGenerations->begin(), intercrossingGenerations->end());
 		maxAIGenerations = *std::max_element(intercrossingGenerations->begin(), intercrossingGenerations->end());
 		minAIGenerations = std::max(minAIGenerations, 1);
-		int nFinals = recodedFinals.nrow();
-		for(int finalCounter = 0; finalCounter < nFinals; finalCounter++)
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
 		{
+			int finalCounter = lines[lineCounter];
 			if((*intercrossingGenerations)[finalCounter] == 0)
 			{
 				applyFunnel(start, end, finalCounter, (*lineFunnelIDs)[finalCounter], (*selfingGenerations)[finalCounter]);
@@ -70,11 +71,11 @@ template<int nFounders> struct viterbiAlgorithm<nFounders, true>
 	{
 		//Initialise the algorithm. For infinite generations of selfing, we don't need to bother with the hetData object, as there are no hets
 		int markerValue = recodedFinals(finalCounter, start);
-		funnelEncoding enc = (*lineFunnelEncodings)[(*lineFunnelIDs)[finalCounter]];
+		const funnelEncoding& enc = (*lineFunnelEncodings)[(*lineFunnelIDs)[finalCounter]];
 		int funnel[16];
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
-			funnel[founderCounter] = ((enc & (15 << (4*founderCounter))) >> (4*founderCounter));
+			funnel[founderCounter] = enc[founderCounter];
 		}
 		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
 		{
@@ -101,7 +102,7 @@ template<int nFounders> struct viterbiAlgorithm<nFounders, true>
 					{
 						if(recodedFounders(funnel[founderCounter2], markerCounter) == previousMarkerValue || previousMarkerValue == NA_INTEGER)
 						{
-							working[funnel[founderCounter2]] = pathLengths1[funnel[founderCounter2]] + funnelHaplotypeProbabilities(markerCounter-start, selfingGenerations - minSelfingGenerations).values[founderCounter2][founderCounter];
+							working[funnel[founderCounter2]] = pathLengths1[funnel[founderCounter2]] + funnelHaplotypeProbabilities(markerCounter-start, selfingGenerations - minSelfingGenerations)[probabilityData<nFounders>::infiniteMask[founderCounter2][founderCounter]];
 						}
 					}
 					//Get the shortest one, and check that it's not negative infinity.
@@ -172,7 +173,7 @@ stopIdenticalSearch:
 						//NA corresponds to no restriction
 						if(recodedFounders(founderCounter2, markerCounter) == previousMarkerValue || previousMarkerValue == NA_INTEGER)
 						{
-							working[founderCounter2] = pathLengths1[founderCounter2] + intercrossingHaplotypeProbabilities(markerCounter-start, intercrossingGeneration - minAIGenerations, selfingGenerations - minSelfingGenerations).values[founderCounter2][founderCounter];
+							working[founderCounter2] = pathLengths1[founderCounter2] + intercrossingHaplotypeProbabilities(markerCounter-start, intercrossingGeneration - minAIGenerations, selfingGenerations - minSelfingGenerations)[probabilityData<nFounders>::infiniteMask[founderCounter2][founderCounter]];
 						}
 					}
 					//Get the longest one, and check that it's not negative infinity.
@@ -212,4 +213,113 @@ stopIdenticalSearch:
 		}
 	}
 };
+/*
+ * The Viterbi algorithm for other numbers of founders than 2, 4, 8 and 16, where nFounders is 0 and the actual number of founders is only known at run time. This is the same as applyFunnel of the general case, with the compressed probabilities and the mask taken from genericFunnelProbabilities. There's no intercrossing for these designs.
+ */
+template<> struct viterbiAlgorithm<0, true>
+{
+	Rcpp::List recodedHetData;
+	Rcpp::IntegerMatrix recodedFounders, recodedFinals;
+	const int nFounders;
+	rowMajorMatrix<int> intermediate1, intermediate2;
+	Rcpp::IntegerMatrix results;
+	std::vector<double> pathLengths1, pathLengths2;
+	std::vector<double> working;
+	//The compressed log probabilities, with index (class, marker interval, selfing generations - minimum selfing generations)
+	xMajorMatrix<double>& funnelHaplotypeProbabilities;
+	//The class of a line fixed for founder a at the first locus and founder b at the second, see genericFunnelProbabilities::getInfiniteMask
+	const std::vector<int>& infiniteMask;
+	markerPatternsToUniqueValuesArgs& markerData;
+	std::vector<funnelID>* lineFunnelIDs;
+	std::vector<funnelEncoding>* lineFunnelEncodings;
+	std::vector<int>* selfingGenerations;
+	int minSelfingGenerations;
+	double heterozygoteMissingProb, homozygoteMissingProb;
+	Rcpp::IntegerMatrix key;
+	rowMajorMatrix<double>* funnelSingleLociHaplotypeProbabilities;
+	viterbiAlgorithm(markerPatternsToUniqueValuesArgs& markerData, const std::vector<int>& infiniteMask, xMajorMatrix<double>& funnelHaplotypeProbabilities, int maxChromosomeSize)
+		: nFounders(markerData.nFounders), intermediate1(nFounders, maxChromosomeSize), intermediate2(nFounders, maxChromosomeSize), pathLengths1(nFounders), pathLengths2(nFounders), working(nFounders), funnelHaplotypeProbabilities(funnelHaplotypeProbabilities), infiniteMask(infiniteMask), markerData(markerData)
+	{}
+	void apply(int start, int end, const int* lines, int nLines)
+	{
+		minSelfingGenerations = *std::min_element(selfingGenerations->begin(), selfingGenerations->end());
+		for(int lineCounter = 0; lineCounter < nLines; lineCounter++)
+		{
+			int finalCounter = lines[lineCounter];
+			applyFunnel(start, end, finalCounter, (*selfingGenerations)[finalCounter]);
+			std::vector<double>::iterator longestPath = std::max_element(pathLengths1.begin(), pathLengths1.end());
+			int longestIndex = (int)std::distance(pathLengths1.begin(), longestPath);
+			for(int i = 0; i < end - start; i++)
+			{
+				results(finalCounter, i+start) = intermediate1(longestIndex, i);
+			}
+		}
+	}
+	void applyFunnel(int start, int end, int finalCounter, int selfingGenerations)
+	{
+		int markerValue = recodedFinals(finalCounter, start);
+		const funnelEncoding& funnel = (*lineFunnelEncodings)[(*lineFunnelIDs)[finalCounter]];
+		for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+		{
+			intermediate1(founderCounter, 0) = intermediate2(founderCounter, 0) = founderCounter+1;
+			pathLengths2[founderCounter] = pathLengths1[founderCounter] = 0;
+			if(recodedFounders(founderCounter, start) != markerValue && markerValue != NA_INTEGER)
+			{
+				pathLengths2[founderCounter] = pathLengths1[founderCounter] = -std::numeric_limits<double>::infinity();
+			}
+		}
+		int identicalIndex = 0;
+		for(int markerCounter = start; markerCounter < end - 1; markerCounter++)
+		{
+			int previousMarkerValue = recodedFinals(finalCounter, markerCounter);
+			markerValue = recodedFinals(finalCounter, markerCounter+1);
+			const double* logProbabilities = &(funnelHaplotypeProbabilities(0, markerCounter - start, selfingGenerations - minSelfingGenerations));
+			for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+			{
+				if(recodedFounders(funnel[founderCounter], markerCounter+1) == markerValue || markerValue == NA_INTEGER)
+				{
+					std::fill(working.begin(), working.end(), -std::numeric_limits<double>::infinity());
+					for(int founderCounter2 = 0; founderCounter2 < nFounders; founderCounter2++)
+					{
+						if(recodedFounders(funnel[founderCounter2], markerCounter) == previousMarkerValue || previousMarkerValue == NA_INTEGER)
+						{
+							working[funnel[founderCounter2]] = pathLengths1[funnel[founderCounter2]] + logProbabilities[infiniteMask[founderCounter2 * nFounders + founderCounter]];
+						}
+					}
+					std::vector<double>::iterator longest = std::max_element(working.begin(), working.end());
+					int bestPrevious = (int)std::distance(working.begin(), longest);
+
+					memcpy(&(intermediate2(funnel[founderCounter], identicalIndex)), &(intermediate1(bestPrevious, identicalIndex)), sizeof(int)*(markerCounter - start + 1 - identicalIndex));
+					intermediate2(funnel[founderCounter], markerCounter-start+1) = funnel[founderCounter]+1;
+					pathLengths2[funnel[founderCounter]] = *longest;
+				}
+				else
+				{
+					pathLengths2[funnel[founderCounter]] = -std::numeric_limits<double>::infinity();
+				}
+			}
+			//See the general case
+			std::vector<double>::iterator longest = std::max_element(pathLengths2.begin(), pathLengths2.end());
+			if(*longest == -std::numeric_limits<double>::infinity()) throw impossibleDataException(markerCounter, finalCounter);
+
+			intermediate1.swap(intermediate2);
+			pathLengths1.swap(pathLengths2);
+			while(identicalIndex != markerCounter-start + 1)
+			{
+				int value = intermediate1(0, identicalIndex);
+				for(int founderCounter = 1; founderCounter < nFounders; founderCounter++)
+				{
+					if(value != intermediate1(founderCounter, identicalIndex)) goto stopIdenticalSearch;
+				}
+				for(int founderCounter = 0; founderCounter < nFounders; founderCounter++)
+				{
+					intermediate2(founderCounter, identicalIndex) = value;
+				}
+				identicalIndex++;
+			}
+stopIdenticalSearch:
+			;
+		}
+	}
+};
 #endif